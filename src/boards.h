@@ -777,7 +777,7 @@
    * Free UART: GPIO4 (RX from scanner), GPIO5 (TX to scanner)
    * Ref: github.com/Xinyuan-LilyGO/T-QT-C6
    */
-  #define WY_BOARD_NAME       "LilyGo T-QT C6 (0.85" 128x128 touch)"
+  #define WY_BOARD_NAME       "LilyGo T-QT C6 (0.85\" 128x128 touch)"
   #define WY_MCU_ESP32C6
   #define WY_MCU_CORES        1
   #define WY_MCU_FREQ         160
@@ -801,7 +801,7 @@
   #define WY_DISPLAY_ROW_OFFSET 1
   /* Touch — CST816T */
   #define WY_HAS_TOUCH        1
-  #define WY_TOUCH_CST816T
+  #define WY_TOUCH_CST816S               /* CST816T: same registers, WyTouch driver */
   #define WY_TOUCH_BUS_I2C
   #define WY_TOUCH_SDA        21
   #define WY_TOUCH_SCL        22
@@ -1795,16 +1795,7 @@
   #define WY_SCREEN_W         WY_DISPLAY_W
   #define WY_SCREEN_H         WY_DISPLAY_H
 
-#else
-  #warning "wyltek-embedded-builder: no board defined. Add -DWY_BOARD_xxx to build_flags."
-  #define WY_HAS_DISPLAY  0
-  #define WY_HAS_TOUCH    0
-  #define WY_HAS_RGB_LED  0
-  #define WY_HAS_PSRAM    0
-  #define WY_HAS_CAMERA   0
-  #define WY_SCREEN_W     0
-  #define WY_SCREEN_H     0
-#endif
+#endif  /* core boards — no-board fallback is at the end of the extended list */
 
 // ═══════════════════════════════════════════════════════════════════
 // Extended board definitions (additional boards appended below)
@@ -2225,7 +2216,26 @@
   #define WY_SCREEN_W            WY_DISPLAY_W
   #define WY_SCREEN_H            WY_DISPLAY_H
 
-#else
-
-  #error "No WY_BOARD_* defined. See boards.h for available targets."
+/* Neither list matched: every board above defines WY_BOARD_NAME */
+#elif !defined(WY_BOARD_NAME)
+  #warning "wyltek-embedded-builder: no board defined. Add -DWY_BOARD_xxx to build_flags."
+  #define WY_SCREEN_W     0
+  #define WY_SCREEN_H     0
 #endif  /* board select */
+
+/* Capabilities a board doesn't mention are absent */
+#ifndef WY_HAS_DISPLAY
+  #define WY_HAS_DISPLAY  0
+#endif
+#ifndef WY_HAS_TOUCH
+  #define WY_HAS_TOUCH    0
+#endif
+#ifndef WY_HAS_RGB_LED
+  #define WY_HAS_RGB_LED  0
+#endif
+#ifndef WY_HAS_PSRAM
+  #define WY_HAS_PSRAM    0
+#endif
+#ifndef WY_HAS_CAMERA
+  #define WY_HAS_CAMERA   0
+#endif
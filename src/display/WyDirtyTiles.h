@@ -0,0 +1,130 @@
+/*
+ * WyDirtyTiles.h — per-tile change detection for screen mirroring
+ * =================================================================
+ * Splits a w × h RGB565 screen into tile × tile squares and keeps one
+ * 32-bit hash and one dirty flag per tile. Feed it the screen a strip at
+ * a time (GRAM readback) and it flags the tiles whose pixels changed;
+ * or skip the hashing and have the UI mark what it redrew. Either way a
+ * mirror only re-encodes when count() > 0. Pure C++ — runs in host tests.
+ *
+ * Memory: 5 bytes per tile — 1.5 KB for 320×240 at 16 px.
+ *
+ * Usage (WyScreenshot's /screen.mjpeg does this for you):
+ *   WyDirtyTiles dt;
+ *   dt.begin(320, 240);                           // everything starts dirty
+ *   for (y = 0; y < 240; y += 16) { read strip; dt.scanStrip(y, strip, 320, 16); }
+ *   if (dt.count()) { encode + send; dt.clear(); }
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+class WyDirtyTiles {
+public:
+    WyDirtyTiles() {}
+    ~WyDirtyTiles() { end(); }
+    WyDirtyTiles(const WyDirtyTiles &) = delete;
+    WyDirtyTiles &operator=(const WyDirtyTiles &) = delete;
+
+    /* Size the grid; all tiles start dirty so the first frame always goes */
+    bool begin(uint16_t w, uint16_t h, uint8_t tile = 16) {
+        end();
+        if (!w || !h || !tile) return false;
+        _w = w; _h = h; _t = tile;
+        _cols = (uint16_t)((w + tile - 1) / tile);
+        _rows = (uint16_t)((h + tile - 1) / tile);
+        size_t n = tiles();
+        _hash  = (uint32_t *)calloc(n, sizeof(uint32_t));
+        _dirty = (uint8_t *)malloc(n);
+        if (!_hash || !_dirty) { end(); return false; }
+        markAll();
+        return true;
+    }
+
+    void end() {
+        free(_hash);  _hash  = nullptr;
+        free(_dirty); _dirty = nullptr;
+        _cols = _rows = 0; _count = 0;
+    }
+
+    /*
+     * Hash the tiles covered by screen rows [y, y + rows) and flag the ones
+     * that differ from last time. px is row y of the strip, `stride` px per
+     * row. y must be tile-aligned; rows may span several tile rows and
+     * stop short at the bottom edge. Returns tiles newly flagged.
+     */
+    uint16_t scanStrip(uint16_t y, const uint16_t *px, uint16_t stride, uint16_t rows) {
+        if (!_hash || y % _t || y >= _h) return 0;
+        if (rows > _h - y) rows = (uint16_t)(_h - y);
+        uint16_t flagged = 0;
+        for (uint16_t r0 = 0; r0 < rows; r0 += _t) {
+            uint16_t ty = (uint16_t)((y + r0) / _t);
+            uint16_t th = (uint16_t)(rows - r0 < _t ? rows - r0 : _t);
+            for (uint16_t tx = 0; tx < _cols; tx++) {
+                uint16_t x0 = (uint16_t)(tx * _t);
+                uint16_t tw = (uint16_t)(_w - x0 < _t ? _w - x0 : _t);
+                uint32_t h = _tileHash(px + (size_t)r0 * stride + x0, stride, tw, th);
+                size_t i = (size_t)ty * _cols + tx;
+                if (h != _hash[i]) {
+                    _hash[i] = h;
+                    if (!_dirty[i]) { _dirty[i] = 1; _count++; flagged++; }
+                }
+            }
+        }
+        return flagged;
+    }
+
+    /* Flag every tile touching the rect (clipped to the screen) */
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+        if (!_dirty || w <= 0 || h <= 0) return;
+        int32_t x1 = x + w, y1 = y + h;
+        if (x < 0) x = 0;
+        if (y < 0) y = 0;
+        if (x1 > _w) x1 = _w;
+        if (y1 > _h) y1 = _h;
+        if (x >= x1 || y >= y1) return;
+        for (int32_t ty = y / _t; ty <= (y1 - 1) / _t; ty++)
+            for (int32_t tx = x / _t; tx <= (x1 - 1) / _t; tx++) {
+                uint8_t &d = _dirty[(size_t)ty * _cols + tx];
+                if (!d) { d = 1; _count++; }
+            }
+    }
+
+    void markAll() {
+        if (!_dirty) return;
+        memset(_dirty, 1, tiles());
+        _count = tiles();
+    }
+
+    /* After the frame went out */
+    void clear() {
+        if (_dirty) memset(_dirty, 0, tiles());
+        _count = 0;
+    }
+
+    bool     isDirty(uint16_t tx, uint16_t ty) const {
+        return _dirty && tx < _cols && ty < _rows && _dirty[(size_t)ty * _cols + tx];
+    }
+    uint16_t count() const { return _count; }
+    uint16_t cols()  const { return _cols; }
+    uint16_t rows()  const { return _rows; }
+    uint16_t tiles() const { return (uint16_t)(_cols * _rows); }
+    uint8_t  tile()  const { return _t; }
+
+private:
+    uint16_t  _w = 0, _h = 0, _cols = 0, _rows = 0, _count = 0;
+    uint8_t   _t = 16;
+    uint32_t *_hash  = nullptr;
+    uint8_t  *_dirty = nullptr;
+
+    /* FNV-1a over pixels, order-sensitive so moved content still differs */
+    static uint32_t _tileHash(const uint16_t *p, uint16_t stride, uint16_t w, uint16_t h) {
+        uint32_t hs = 2166136261u;
+        for (uint16_t r = 0; r < h; r++, p += stride)
+            for (uint16_t x = 0; x < w; x++) { hs ^= p[x]; hs *= 16777619u; }
+        return hs;
+    }
+};
@@ -0,0 +1,268 @@
+/*
+ * WyFrameDump.h — compressed RGB565 framebuffer stream (serial capture)
+ * =======================================================================
+ * Framebuffer → self-synchronising byte stream for a UART, and the reader
+ * that turns it back into pixels on the host (tools/wydump). Pixels are
+ * sent WY_DUMP_ROWS rows per chunk as Q565 ops (WyQ565.h: runs / index /
+ * small diffs, a tight byte loop), or raw when a chunk doesn't shrink.
+ * Every record carries a CRC-32, so log text on the same port, dropped
+ * bytes or a reset mid-frame only lose that frame.
+ * Pure C++ — runs in host tests.
+ *
+ * Stream (little-endian):
+ *   FRAME  "WYF1" u32 seq  u16 w  u16 h  u8 rows  u8 0  u16 chunks  u32 crc     20 B
+ *   CHUNK  "WYC1" u16 index  u8 codec  u8 nrows  u32 len  payload  u32 crc     16 B + len
+ *   END    "WYE1" u32 seq  u32 crc                                               12 B
+ *   crc = CRC-32 (zlib) of the record up to the crc field, payload included.
+ *   codec 0 = raw RGB565, 1 = Q565 ops with prev / index reset per chunk.
+ *
+ * Memory (device): one chunk of pixels + one chunk of output
+ * (320 px × 8 rows → 5 KB + 5 KB). test_image's 320×240 settings-screen
+ * frame (flat panels, text rows, a gradient bar) dumps to 5.5 KB, 3.6% of
+ * its 150 KB raw size: ~28 ms at 2 Mbaud. Photos compress far less.
+ *
+ * Usage (WyScreenshot::dumpSerial() does this for you):
+ *   wyFrameDump(w, h, fillRows, &fb, writeBytes, &Serial, seq++);
+ *   // host:
+ *   WyFrameDumpReader rd;
+ *   for (bool f = rd.feed(bytes, n); f; f = rd.feed(nullptr, 0))
+ *       savePNG(rd.pixels(), rd.width(), rd.height());      // tools/wydump.cpp
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "WyQ565.h"
+
+#ifndef WY_DUMP_ROWS
+  #define WY_DUMP_ROWS 8              /* rows per chunk */
+#endif
+
+#define WY_DUMP_CODEC_RAW   0
+#define WY_DUMP_CODEC_Q565  1
+#define WY_DUMP_FRAME_BYTES 20
+#define WY_DUMP_CHUNK_HEAD  12
+#define WY_DUMP_END_BYTES   12
+
+/* ── CRC-32 (zlib / PNG polynomial), nibble table ─────────────────── */
+static inline uint32_t wyCrc32(const uint8_t *p, size_t n, uint32_t crc = 0) {
+    static const uint32_t t[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+        0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+        0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ t[crc & 15];
+        crc = (crc >> 4) ^ t[crc & 15];
+    }
+    return ~crc;
+}
+
+static inline void _wy_put16(uint8_t *p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static inline void _wy_put32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+
+/* ── Writer ───────────────────────────────────────────────────────── */
+/* Fill `rows` rows starting at y into px (stride w) */
+typedef void (*WyDumpStripFn)(void *src, uint16_t y, uint16_t rows, uint16_t *px);
+/* Send bytes; false aborts the frame */
+typedef bool (*WyDumpWriteFn)(void *ctx, const uint8_t *p, size_t n);
+
+/*
+ * Stream one w × h frame. Returns bytes written, 0 on OOM or a failed
+ * write. compress = false sends every chunk raw.
+ */
+static inline size_t wyFrameDump(uint16_t w, uint16_t h, WyDumpStripFn fill, void *src,
+                                 WyDumpWriteFn out, void *octx, uint32_t seq,
+                                 uint8_t rows = WY_DUMP_ROWS, bool compress = true) {
+    if (!w || !h || !rows) return 0;
+    uint16_t chunks = (uint16_t)((h + rows - 1) / rows);
+    size_t   rawMax = (size_t)w * rows * 2;
+    uint16_t *px  = (uint16_t *)malloc(rawMax);
+    uint8_t  *buf = (uint8_t *)malloc(WY_DUMP_CHUNK_HEAD + rawMax + 4);
+    size_t total = 0;
+    if (!px || !buf) goto fail;
+    {
+        uint8_t f[WY_DUMP_FRAME_BYTES];
+        memcpy(f, "WYF1", 4);
+        _wy_put32(f + 4, seq);
+        _wy_put16(f + 8, w); _wy_put16(f + 10, h);
+        f[12] = rows; f[13] = 0;
+        _wy_put16(f + 14, chunks);
+        _wy_put32(f + 16, wyCrc32(f, 16));
+        if (!out(octx, f, sizeof(f))) goto fail;
+        total += sizeof(f);
+
+        for (uint16_t c = 0; c < chunks; c++) {
+            uint16_t y = (uint16_t)(c * rows);
+            uint16_t n = (uint16_t)(h - y < rows ? h - y : rows);
+            fill(src, y, n, px);
+            uint8_t *pay = buf + WY_DUMP_CHUNK_HEAD;
+            size_t raw = (size_t)w * n * 2, len = 0;
+            if (compress) {                                   /* Q565, capped at raw size */
+                uint16_t index[64] = { 0 }, prev = 0;
+                for (uint16_t r = 0; r < n; r++) {
+                    size_t k = _wy_q565_encode_row(px + (size_t)r * w, w, pay + len, raw - len,
+                                                   prev, index);
+                    if (!k) { len = 0; break; }
+                    len += k;
+                }
+            }
+            uint8_t codec = len ? WY_DUMP_CODEC_Q565 : WY_DUMP_CODEC_RAW;
+            if (!len) {
+                for (size_t i = 0; i < (size_t)w * n; i++) _wy_put16(pay + 2 * i, px[i]);
+                len = raw;
+            }
+            memcpy(buf, "WYC1", 4);
+            _wy_put16(buf + 4, c);
+            buf[6] = codec; buf[7] = (uint8_t)n;
+            _wy_put32(buf + 8, (uint32_t)len);
+            _wy_put32(pay + len, wyCrc32(buf, WY_DUMP_CHUNK_HEAD + len));
+            if (!out(octx, buf, WY_DUMP_CHUNK_HEAD + len + 4)) goto fail;
+            total += WY_DUMP_CHUNK_HEAD + len + 4;
+        }
+
+        uint8_t e[WY_DUMP_END_BYTES];
+        memcpy(e, "WYE1", 4);
+        _wy_put32(e + 4, seq);
+        _wy_put32(e + 8, wyCrc32(e, 8));
+        if (!out(octx, e, sizeof(e))) goto fail;
+        total += sizeof(e);
+    }
+    free(px); free(buf);
+    return total;
+fail:
+    free(px); free(buf);
+    return 0;
+}
+
+/* ── Reader (host side) ───────────────────────────────────────────── */
+/*
+ * Push bytes as they arrive, in any sized pieces. Anything that isn't a
+ * record with a good CRC is skipped a byte at a time until the next
+ * magic, so the port can carry log text too. Parsing stops at the end
+ * of each complete frame so pixels() is that frame; later bytes stay
+ * buffered until the next call — feed(nullptr, 0) drains them.
+ */
+class WyFrameDumpReader {
+public:
+    uint32_t frames = 0;              /* complete frames */
+    uint32_t incomplete = 0;          /* frames abandoned (gap / corrupt) */
+    uint32_t crcErrors = 0;
+    uint32_t skipped = 0;             /* bytes outside any record */
+
+    WyFrameDumpReader() {}
+    ~WyFrameDumpReader() { free(_buf); free(_fb); }
+    WyFrameDumpReader(const WyFrameDumpReader &) = delete;
+    WyFrameDumpReader &operator=(const WyFrameDumpReader &) = delete;
+
+    /* True if a frame completed during this call */
+    bool feed(const uint8_t *p, size_t n) {
+        if (_len + n > _cap) {
+            size_t cap = _cap ? _cap : 4096;
+            while (cap < _len + n) cap *= 2;
+            uint8_t *nb = (uint8_t *)realloc(_buf, cap);
+            if (!nb) return false;
+            _buf = nb; _cap = cap;
+        }
+        if (n) memcpy(_buf + _len, p, n);
+        _len += n;
+
+        bool done = false;
+        size_t pos = 0;
+        while (!done && _len - pos >= 4) {
+            const uint8_t *r = _buf + pos;
+            size_t avail = _len - pos, used = 0;
+            if (r[0] != 'W' || r[1] != 'Y' || r[3] != '1' ||
+                (r[2] != 'F' && r[2] != 'C' && r[2] != 'E')) {
+                used = 1; skipped++;
+            } else if (r[2] == 'F') {
+                if (avail < WY_DUMP_FRAME_BYTES) break;
+                used = _frame(r) ? WY_DUMP_FRAME_BYTES : 1;
+            } else if (r[2] == 'E') {
+                if (avail < WY_DUMP_END_BYTES) break;
+                if (wyCrc32(r, 8) != (uint32_t)_wy_le32(r + 8)) { crcErrors++; used = 1; }
+                else {
+                    if (_in && (uint32_t)_wy_le32(r + 4) == _seq && _next == _chunks) { frames++; done = true; }
+                    else if (_in) incomplete++;
+                    _in = false;
+                    used = WY_DUMP_END_BYTES;
+                }
+            } else {
+                if (avail < WY_DUMP_CHUNK_HEAD) break;
+                uint32_t len = (uint32_t)_wy_le32(r + 8);
+                if (!_in || len > (size_t)_w * _rows * 2) { used = 1; skipped++; }
+                else if (avail < WY_DUMP_CHUNK_HEAD + len + 4) break;
+                else if (wyCrc32(r, WY_DUMP_CHUNK_HEAD + len) != (uint32_t)_wy_le32(r + WY_DUMP_CHUNK_HEAD + len)) {
+                    crcErrors++; used = 1;
+                } else {
+                    if (!_chunk(r, len)) { _in = false; incomplete++; }
+                    used = WY_DUMP_CHUNK_HEAD + len + 4;
+                }
+            }
+            pos += used;
+        }
+        memmove(_buf, _buf + pos, _len - pos);
+        _len -= pos;
+        return done;
+    }
+
+    const uint16_t *pixels() const { return _fb; }
+    uint16_t width()  const { return _w; }
+    uint16_t height() const { return _h; }
+    uint32_t seq()    const { return _seq; }
+
+private:
+    uint8_t  *_buf = nullptr;
+    size_t    _len = 0, _cap = 0;
+    uint16_t *_fb = nullptr;
+    uint16_t  _w = 0, _h = 0, _chunks = 0, _next = 0;
+    uint8_t   _rows = 0;
+    uint32_t  _seq = 0;
+    bool      _in = false;
+
+    bool _frame(const uint8_t *r) {
+        if (wyCrc32(r, 16) != (uint32_t)_wy_le32(r + 16)) { crcErrors++; return false; }
+        uint16_t w = _wy_le16(r + 8), h = _wy_le16(r + 10);
+        uint8_t rows = r[12];
+        uint16_t chunks = _wy_le16(r + 14);
+        if (!w || !h || !rows || chunks != (h + rows - 1) / rows) return false;
+        if (_in) incomplete++;                                    /* previous one never ended */
+        if ((size_t)w * h != (size_t)_w * _h || !_fb) {
+            free(_fb);
+            _fb = (uint16_t *)malloc((size_t)w * h * 2);
+            if (!_fb) { _w = _h = 0; _in = false; return true; }
+        }
+        _w = w; _h = h; _rows = rows; _chunks = chunks;
+        _seq = (uint32_t)_wy_le32(r + 4);
+        _next = 0;
+        _in = true;
+        return true;
+    }
+
+    bool _chunk(const uint8_t *r, uint32_t len) {
+        uint16_t idx = _wy_le16(r + 4);
+        uint8_t codec = r[6], n = r[7];
+        uint32_t y = (uint32_t)idx * _rows;
+        if (idx != _next || y >= _h || n != (_h - y < _rows ? _h - y : _rows)) return false;
+        const uint8_t *p = r + WY_DUMP_CHUNK_HEAD, *end = p + len;
+        uint16_t *out = _fb + (size_t)y * _w;
+        if (codec == WY_DUMP_CODEC_RAW) {
+            if (len != (uint32_t)_w * n * 2) return false;
+            for (size_t i = 0; i < (size_t)_w * n; i++) out[i] = _wy_le16(p + 2 * i);
+        } else if (codec == WY_DUMP_CODEC_Q565) {
+            uint16_t index[64] = { 0 }, prev = 0;
+            for (uint8_t k = 0; k < n && p; k++)
+                p = _wy_q565_row(p, end, out + (size_t)k * _w, _w, prev, index);
+            if (p != end) return false;
+        } else {
+            return false;
+        }
+        _next++;
+        return true;
+    }
+};
@@ -0,0 +1,463 @@
+/*
+ * WyGif.h — Incremental GIF decoder with frame timing
+ * =====================================================
+ * Keeps the decoder state and an RGB565 canvas of the logical screen
+ * between calls, so an animation advances one frame at a time from
+ * loop() instead of blocking. Pure C++ — no Arduino dependency, runs in
+ * host tests. WyGifPlayer (WyGifPlayer.h) puts it on a display.
+ *
+ * Usage:
+ *   WyGif gif;
+ *   gif.open(readFn, &file);             // loops: 0 = as the file says
+ *   ...
+ *   WyGifFrame f;
+ *   if (gif.tick(millis(), f)) {
+ *       // gif.canvas() changed inside f.x, f.y, f.w, f.h — redraw that
+ *   }
+ *
+ * Timing:
+ *   tick(now) decodes only when the current frame's delay has elapsed and
+ *   returns false straight away otherwise. The schedule advances by each
+ *   frame's delay rather than from the time tick() happened to run, so
+ *   jitter in loop() doesn't accumulate; if the caller falls more than a
+ *   frame behind, it resyncs instead of bursting through missed frames.
+ *   Delays of 0/1 cs are shown for 100 ms, as browsers do.
+ *
+ * Dirty rectangle:
+ *   Each frame reports the union of its own image rect and whatever the
+ *   previous frame's disposal touched (2 = restore to background,
+ *   3 = restore previous). The first frame after open()/rewind() is the
+ *   whole canvas. Most animations only change a small region, so drawing
+ *   just that rect cuts SPI traffic accordingly.
+ *
+ * Memory:
+ *   canvas  width × height × 2
+ *   LZW     ~16 KB dictionary + palettes + WY_IMG_CHUNK input buffer
+ *   save    frame rect × 2, only while a disposal-3 frame is showing
+ *
+ * Supports GIF87a/89a, global + local colour tables, transparency,
+ * interlaced frames, frames partly outside the logical screen (clipped),
+ * NETSCAPE2.0 loop count. Plain-text extensions are skipped.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "WyImageInfo.h"
+#include "WyImageStream.h"
+
+#ifndef WY_GIF_DEFAULT_DELAY_MS
+  #define WY_GIF_DEFAULT_DELAY_MS 100   /* used for 0/1 cs frame delays */
+#endif
+
+/* What tick()/next() just produced */
+struct WyGifFrame {
+    int16_t  x = 0, y = 0;   /* dirty rect on the canvas */
+    uint16_t w = 0, h = 0;
+    uint16_t delayMs = 0;    /* how long this frame stays up */
+    uint16_t index   = 0;    /* frame number within the current loop */
+};
+
+class WyGif {
+public:
+    uint16_t bg = 0x0000;    /* background / disposal-2 colour (RGB565) */
+
+    WyGif() {}
+    ~WyGif() { close(); }
+    WyGif(const WyGif &) = delete;
+    WyGif &operator=(const WyGif &) = delete;
+
+    /*
+     * loops: -1 forever, N > 0 play N times, 0 follow the file
+     * (no NETSCAPE block = once, loop count 0 = forever, n = n + 1 plays).
+     */
+    WyImgResult open(WyImgReadFn rd, void *ctx, int loops = 0) {
+        close();
+        _rd = rd; _ctx = ctx; _loops = loops;
+        _fileLoops = -1;                                   /* set again by this file's NETSCAPE block */
+        _plays = 0; _started = false; _due = 0; _err = WY_IMG_OK;
+        uint8_t h[13];
+        if (rd(ctx, 0, h, 13) != 13 ||
+            (memcmp(h, "GIF87a", 6) != 0 && memcmp(h, "GIF89a", 6) != 0))
+            return WY_IMG_ERR_FORMAT;
+        _w = _wy_le16(h + 6);
+        _h = _wy_le16(h + 8);
+        if (!_w || !_h) return WY_IMG_ERR_FORMAT;
+
+        _work   = (_Work *)malloc(sizeof(_Work));
+        _canvas = (uint16_t *)malloc((size_t)_w * _h * 2);
+        if (!_work || !_canvas) { close(); return WY_IMG_ERR_NOMEM; }
+
+        _off = 13; _inLen = _inPos = 0;
+        _gctSize = 0;
+        if (h[10] & 0x80) {
+            _gctSize = (uint16_t)(2 << (h[10] & 7));
+            if (!_readPal(_work->gpal, _gctSize)) { close(); return WY_IMG_ERR_CORRUPT; }
+        }
+        _first   = _pos();
+        _playing = true;
+        rewind();
+        return WY_IMG_OK;
+    }
+
+    void close() {
+        free(_work);   _work   = nullptr;
+        free(_canvas); _canvas = nullptr;
+        free(_save);   _save   = nullptr;
+        _saveCap = 0;
+        _playing = false;
+        _w = _h = 0;
+    }
+
+    /* Back to frame 0 with a cleared canvas (loop count is kept) */
+    void rewind() {
+        if (!_canvas) return;
+        _seek(_first);
+        for (size_t i = 0, n = (size_t)_w * _h; i < n; i++) _canvas[i] = bg;
+        _frame = 0;
+        _disp = _prevDisp = 0;
+        _full = true;
+    }
+
+    /*
+     * Decode the next frame now, ignoring timing.
+     * WY_IMG_OK = frame decoded into canvas(), WY_IMG_STOPPED = end of file.
+     */
+    WyImgResult next(WyGifFrame &f) {
+        if (!_canvas) return WY_IMG_ERR_FORMAT;
+        _delay = 0; _disp = 0; _transp = -1;
+        for (;;) {
+            int b = _byte();
+            if (b < 0) return WY_IMG_ERR_CORRUPT;
+            if (b == 0x3B) return WY_IMG_STOPPED;                  /* trailer */
+            if (b == 0x21) {                                       /* extension */
+                if (!_extension()) return WY_IMG_ERR_CORRUPT;
+                continue;
+            }
+            if (b != 0x2C) return WY_IMG_ERR_CORRUPT;
+            return _image(f);
+        }
+    }
+
+    /* Decode the next frame if it's due. True = canvas changed (see f). */
+    bool tick(uint32_t now, WyGifFrame &f) {
+        if (!_playing) return false;
+        if (_started && (int32_t)(now - _due) < 0) return false;
+
+        WyImgResult rc = next(f);
+        if (rc == WY_IMG_STOPPED) {
+            _plays++;
+            int loops = _loops ? _loops
+                      : (_fileLoops < 0 ? 1 : (_fileLoops == 0 ? -1 : _fileLoops + 1));
+            if (!_frame || (loops > 0 && _plays >= loops)) { _playing = false; return false; }
+            rewind();
+            rc = next(f);
+        }
+        if (rc != WY_IMG_OK) { _err = rc; _playing = false; return false; }
+
+        if (!_started || now - _due > f.delayMs) _due = now;   /* first frame / fell behind */
+        _due += f.delayMs;
+        _started = true;
+        return true;
+    }
+
+    /* Restart playback from frame 0 (after stop() or a finished run) */
+    void restart() {
+        if (!_canvas) return;
+        rewind();
+        _plays = 0; _started = false; _err = WY_IMG_OK;
+        _playing = true;
+    }
+    void stop() { _playing = false; }
+
+    bool            playing() const { return _playing; }
+    uint32_t        due()     const { return _due; }      /* when tick() next decodes */
+    WyImgResult     error()   const { return _err; }
+    uint16_t        width()   const { return _w; }
+    uint16_t        height()  const { return _h; }
+    const uint16_t *canvas()  const { return _canvas; }
+    size_t memory() const {
+        return (_work ? sizeof(_Work) : 0) + (size_t)_w * _h * 2 + _saveCap * 2;
+    }
+
+private:
+    struct _Work {
+        uint16_t prefix[4096];
+        uint8_t  suffix[4096];
+        uint8_t  stack[4097];
+        uint16_t gpal[256], lpal[256];
+        uint8_t  in[WY_IMG_CHUNK];
+    };
+
+    WyImgReadFn _rd = nullptr; void *_ctx = nullptr;
+    _Work    *_work   = nullptr;
+    uint16_t *_canvas = nullptr;
+    uint16_t *_save   = nullptr; size_t _saveCap = 0;
+    uint16_t  _w = 0, _h = 0, _gctSize = 0;
+
+    /* Input */
+    uint32_t  _off = 0, _first = 0;
+    uint16_t  _inLen = 0, _inPos = 0;
+
+    /* Graphic control for the frame being read / shown */
+    uint16_t  _delay = 0;
+    uint8_t   _disp = 0, _prevDisp = 0;
+    int16_t   _transp = -1;
+    int16_t   _px = 0, _py = 0; uint16_t _pw = 0, _ph = 0;  /* previous frame rect (clipped) */
+    bool      _full = true;
+
+    /* Playback */
+    uint16_t  _frame = 0;
+    int       _loops = 0, _fileLoops = -1, _plays = 0;
+    bool      _playing = false, _started = false;
+    uint32_t  _due = 0;
+    WyImgResult _err = WY_IMG_OK;
+
+    /* ── Input ─────────────────────────────────────────────────── */
+    uint32_t _pos() const { return _off - _inLen + _inPos; }
+    void _seek(uint32_t p) { _off = p; _inLen = _inPos = 0; }
+
+    int _byte() {
+        if (_inPos >= _inLen) {
+            size_t n = _rd(_ctx, _off, _work->in, WY_IMG_CHUNK);
+            if (!n) return -1;
+            _off += n; _inLen = (uint16_t)n; _inPos = 0;
+        }
+        return _work->in[_inPos++];
+    }
+
+    bool _read(uint8_t *dst, uint16_t n) {
+        for (uint16_t i = 0; i < n; i++) {
+            int b = _byte();
+            if (b < 0) return false;
+            dst[i] = (uint8_t)b;
+        }
+        return true;
+    }
+
+    bool _readPal(uint16_t *pal, uint16_t n) {
+        uint8_t c[3];
+        for (uint16_t i = 0; i < n; i++) {
+            if (!_read(c, 3)) return false;
+            pal[i] = _wy_rgb565(c[0], c[1], c[2]);
+        }
+        return true;
+    }
+
+    /* Skip data sub-blocks up to and including the 0 terminator */
+    bool _skipBlocks() {
+        for (;;) {
+            int n = _byte();
+            if (n < 0) return false;
+            if (n == 0) return true;
+            uint32_t p = _pos() + n;
+            if (p <= _off) _inPos += n; else _seek(p);
+        }
+    }
+
+    bool _extension() {
+        int label = _byte();
+        if (label < 0) return false;
+        uint8_t b[12];
+        if (label == 0xF9) {                                   /* graphic control */
+            if (_byte() != 4 || !_read(b, 4)) return false;
+            _disp   = (b[0] >> 2) & 7;
+            _transp = (b[0] & 1) ? b[3] : -1;
+            _delay  = _wy_le16(b + 1);
+            return _skipBlocks();
+        }
+        if (label == 0xFF) {                                   /* application */
+            int n = _byte();
+            if (n < 0) return false;
+            if (n == 11) {
+                if (!_read(b, 11)) return false;
+                if (memcmp(b, "NETSCAPE2.0", 11) == 0) {
+                    int m = _byte();
+                    if (m < 0) return false;
+                    if (m >= 3) {
+                        uint8_t s[3];
+                        if (!_read(s, 3)) return false;
+                        if (s[0] == 1) _fileLoops = _wy_le16(s + 1);
+                        m -= 3;
+                    }
+                    uint32_t p = _pos() + m;
+                    if (p <= _off) _inPos += m; else _seek(p);
+                }
+            } else {
+                uint32_t p = _pos() + n;
+                if (p <= _off) _inPos += n; else _seek(p);
+            }
+            return _skipBlocks();
+        }
+        return _skipBlocks();                                  /* comment / plain text */
+    }
+
+    /* ── Disposal of the previous frame ────────────────────────── */
+    void _dispose() {
+        if (!_pw || !_ph) return;
+        if (_prevDisp == 2) {
+            for (uint16_t r = 0; r < _ph; r++) {
+                uint16_t *d = _canvas + (size_t)(_py + r) * _w + _px;
+                for (uint16_t c = 0; c < _pw; c++) d[c] = bg;
+            }
+        } else if (_prevDisp == 3 && _save) {
+            for (uint16_t r = 0; r < _ph; r++)
+                memcpy(_canvas + (size_t)(_py + r) * _w + _px, _save + (size_t)r * _pw, _pw * 2);
+        }
+    }
+
+    /* ── Image descriptor + LZW data ───────────────────────────── */
+    WyImgResult _image(WyGifFrame &f) {
+        uint8_t d[9];
+        if (!_read(d, 9)) return WY_IMG_ERR_CORRUPT;
+        int32_t  fx = _wy_le16(d),     fy = _wy_le16(d + 2);
+        uint16_t fw = _wy_le16(d + 4), fh = _wy_le16(d + 6);
+        bool interlace = d[8] & 0x40;
+
+        const uint16_t *pal = _work->gpal;
+        uint16_t palSize = _gctSize;
+        if (d[8] & 0x80) {
+            palSize = (uint16_t)(2 << (d[8] & 7));
+            if (!_readPal(_work->lpal, palSize)) return WY_IMG_ERR_CORRUPT;
+            pal = _work->lpal;
+        }
+
+        /* Undo the previous frame, remember what that touched */
+        int32_t dx0 = _w, dy0 = _h, dx1 = 0, dy1 = 0;
+        if (_prevDisp >= 2 && _pw && _ph) {
+            _dispose();
+            dx0 = _px; dy0 = _py; dx1 = _px + _pw; dy1 = _py + _ph;
+        }
+
+        /* Clip this frame to the logical screen */
+        int32_t cx0 = fx, cy0 = fy, cx1 = fx + fw, cy1 = fy + fh;
+        if (cx1 > _w) cx1 = _w;
+        if (cy1 > _h) cy1 = _h;
+        uint16_t cw = cx1 > cx0 ? (uint16_t)(cx1 - cx0) : 0;
+        uint16_t ch = cy1 > cy0 ? (uint16_t)(cy1 - cy0) : 0;
+
+        /* Disposal 3: keep what's under this frame so the next one can restore it */
+        if (_disp == 3 && cw && ch) {
+            size_t need = (size_t)cw * ch;
+            if (need > _saveCap) {
+                free(_save);
+                _save = (uint16_t *)malloc(need * 2);
+                _saveCap = _save ? need : 0;
+            }
+            if (_save)
+                for (uint16_t r = 0; r < ch; r++)
+                    memcpy(_save + (size_t)r * cw, _canvas + (size_t)(cy0 + r) * _w + cx0, cw * 2);
+        }
+
+        WyImgResult rc = _lzw(fx, fy, fw, fh, interlace, pal, palSize);
+        if (rc != WY_IMG_OK) return rc;
+
+        if (cw && ch) {
+            if (cx0 < dx0) dx0 = cx0;
+            if (cy0 < dy0) dy0 = cy0;
+            if (cx1 > dx1) dx1 = cx1;
+            if (cy1 > dy1) dy1 = cy1;
+        }
+        if (_full) { dx0 = 0; dy0 = 0; dx1 = _w; dy1 = _h; _full = false; }
+        if (dx1 <= dx0 || dy1 <= dy0) { dx0 = dy0 = 0; dx1 = dy1 = 0; }
+
+        f.x = (int16_t)dx0; f.y = (int16_t)dy0;
+        f.w = (uint16_t)(dx1 - dx0); f.h = (uint16_t)(dy1 - dy0);
+        f.delayMs = _delay <= 1 ? WY_GIF_DEFAULT_DELAY_MS : (uint16_t)(_delay * 10);
+        f.index = _frame++;
+
+        _px = (int16_t)cx0; _py = (int16_t)cy0; _pw = cw; _ph = ch;
+        _prevDisp = _disp;
+        return WY_IMG_OK;
+    }
+
+    WyImgResult _lzw(int32_t fx, int32_t fy, uint16_t fw, uint16_t fh,
+                     bool interlace, const uint16_t *pal, uint16_t palSize) {
+        int minSize = _byte();
+        if (minSize < 2 || minSize > 11) return WY_IMG_ERR_CORRUPT;
+        uint16_t *prefix = _work->prefix;
+        uint8_t  *suffix = _work->suffix, *stack = _work->stack;
+        const uint16_t clear = (uint16_t)(1u << minSize), eoi = clear + 1;
+        for (uint16_t i = 0; i < clear; i++) suffix[i] = (uint8_t)i;
+
+        uint8_t  size = (uint8_t)(minSize + 1);
+        uint16_t next = clear + 2;
+        int32_t  old  = -1;
+        uint8_t  first = 0;
+        uint32_t bits = 0; uint8_t nbits = 0;
+        int      blockLeft = 0;
+        bool     dataEnd = false;
+
+        /* Output position within the frame */
+        uint32_t total = (uint32_t)fw * fh, n = 0;
+        uint16_t col = 0, row = 0;
+        uint8_t  pass = 0;
+        static const uint8_t ilStart[4] = { 0, 4, 2, 1 }, ilStep[4] = { 8, 8, 4, 2 };
+
+        for (;;) {
+            while (nbits < size && !dataEnd) {
+                if (!blockLeft) {
+                    int b = _byte();
+                    if (b < 0) return WY_IMG_ERR_CORRUPT;
+                    if (!b) { dataEnd = true; break; }
+                    blockLeft = b;
+                }
+                int b = _byte();
+                if (b < 0) return WY_IMG_ERR_CORRUPT;
+                blockLeft--;
+                bits |= (uint32_t)b << nbits;
+                nbits += 8;
+            }
+            if (nbits < size) break;                        /* ran out without EOI */
+            uint16_t code = bits & ((1u << size) - 1);
+            bits >>= size; nbits -= size;
+
+            if (code == clear) { size = (uint8_t)(minSize + 1); next = clear + 2; old = -1; continue; }
+            if (code == eoi) break;
+
+            uint16_t sp = 0, c = code;
+            if (old < 0) {
+                if (code >= clear) return WY_IMG_ERR_CORRUPT;
+                stack[sp++] = (uint8_t)code;
+                first = (uint8_t)code;
+            } else {
+                if (code > next) return WY_IMG_ERR_CORRUPT;
+                if (code == next) { stack[sp++] = first; c = (uint16_t)old; }
+                while (c >= clear) {
+                    stack[sp++] = suffix[c];
+                    c = prefix[c];
+                }
+                first = (uint8_t)c;
+                stack[sp++] = first;
+                if (next < 4096) {
+                    prefix[next] = (uint16_t)old;
+                    suffix[next] = first;
+                    next++;
+                    if (next == (1u << size) && size < 12) size++;
+                }
+            }
+            old = code;
+
+            /* Emit (the stack holds the string reversed) */
+            while (sp && n < total) {
+                uint8_t idx = stack[--sp];
+                int32_t x = fx + col, y = fy + row;
+                if (idx != _transp && idx < palSize && x < _w && y < _h)
+                    _canvas[(size_t)y * _w + x] = pal[idx];
+                n++;
+                if (++col == fw) {
+                    col = 0;
+                    if (!interlace) row++;
+                    else {
+                        row += ilStep[pass];
+                        while (row >= fh && pass < 3) row = ilStart[++pass];
+                    }
+                }
+            }
+        }
+        if (!dataEnd && !_skipBlocks()) return WY_IMG_ERR_CORRUPT;
+        return WY_IMG_OK;
+    }
+};
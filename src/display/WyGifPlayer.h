@@ -0,0 +1,140 @@
+/*
+ * WyGifPlayer.h — Non-blocking animated GIF playback on Arduino_GFX
+ * ===================================================================
+ * Wraps WyGif (decoder + canvas + frame timing) around an fs::File or a
+ * PROGMEM buffer and draws each frame as it comes due. Call tick() from
+ * loop() alongside sensor reads, WiFi, etc. — it returns immediately when
+ * no frame is due.
+ *
+ * Usage:
+ *   WyGifPlayer anim(display.gfx);
+ *   anim.open(SPIFFS, "/spinner.gif", 100, 80);   // loops as the file says
+ *
+ *   void loop() {
+ *       anim.tick();            // draws only when the next frame is due
+ *       sensors.update();
+ *       server.handleClient();
+ *   }
+ *
+ *   anim.open(gifData, gifLen, 0, 0, -1);         // PROGMEM, loop forever
+ *   if (!anim.playing()) ...                      // finished / error
+ *
+ * Drawing:
+ *   With dirtyRects on (default) only the rectangle that changed since the
+ *   last frame is pushed — the frame's own rect plus whatever the previous
+ *   frame's disposal cleared or restored. A spinner in a 240×240 GIF
+ *   sends a few KB per frame instead of 112 KB.
+ *
+ * Memory: see WyGif.h — canvas (w × h × 2) + ~18 KB decoder state.
+ * The file stays open while playing; close() releases everything.
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+#include <Arduino_GFX_Library.h>
+#include "WyGif.h"
+
+class WyGifPlayer {
+public:
+    Arduino_GFX *gfx;
+    bool     verbose    = false;
+    bool     dirtyRects = true;     /* false = push the whole canvas each frame */
+    uint16_t bg         = 0x0000;   /* canvas clear / disposal-2 colour */
+
+    WyGifPlayer(Arduino_GFX *g) : gfx(g) {}
+    ~WyGifPlayer() { close(); }
+
+    /* loops: -1 forever, N plays N times, 0 = as the file says */
+    bool open(fs::FS &fs, const char *path, int16_t x = 0, int16_t y = 0, int loops = 0) {
+        close();
+        _file = fs.open(path, "r");
+        if (!_file) {
+            if (verbose) Serial.printf("[WyGifPlayer] open failed: %s\n", path);
+            return false;
+        }
+        return _start(_fileRead, &_file, x, y, loops, path);
+    }
+
+    bool open(const uint8_t *data, size_t len, int16_t x = 0, int16_t y = 0, int loops = 0) {
+        close();
+        _mem = { data, len };
+        return _start(_wy_img_mem_read, &_mem, x, y, loops, "(mem)");
+    }
+
+    /* Decode + draw the next frame if it's due. True = a frame was drawn. */
+    bool tick(uint32_t now = millis()) {
+        WyGifFrame f;
+        if (!_gif.tick(now, f)) {
+            if (verbose && !_gif.playing() && _gif.error() != WY_IMG_OK && !_reported) {
+                Serial.printf("[WyGifPlayer] decode error %d\n", _gif.error());
+                _reported = true;
+            }
+            return false;
+        }
+        _draw(f);
+        return true;
+    }
+
+    void stop()    { _gif.stop(); }
+    void restart() { _gif.restart(); _reported = false; }
+    void close() {
+        _gif.close();
+        if (_file) _file.close();
+    }
+
+    void moveTo(int16_t x, int16_t y) { _x = x; _y = y; }
+
+    bool        playing() const { return _gif.playing(); }
+    uint32_t    due()     const { return _gif.due(); }     /* millis() of the next frame */
+    WyImgResult error()   const { return _gif.error(); }
+    uint16_t    width()   const { return _gif.width(); }
+    uint16_t    height()  const { return _gif.height(); }
+
+private:
+    WyGif        _gif;
+    File         _file;
+    _WyImgMemSrc _mem = { nullptr, 0 };
+    int16_t      _x = 0, _y = 0;
+    bool         _reported = false;
+
+    bool _start(WyImgReadFn rd, void *ctx, int16_t x, int16_t y, int loops, const char *path) {
+        _x = x; _y = y;
+        _reported = false;
+        _gif.bg = bg;
+        WyImgResult rc = _gif.open(rd, ctx, loops);
+        if (rc != WY_IMG_OK) {
+            if (verbose) Serial.printf("[WyGifPlayer] %s: %s\n",
+                rc == WY_IMG_ERR_NOMEM ? "canvas malloc failed" : "not a GIF", path);
+            close();
+            return false;
+        }
+        if (verbose) Serial.printf("[WyGifPlayer] %s %ux%u, %u B heap\n",
+                                   path, _gif.width(), _gif.height(), (unsigned)_gif.memory());
+        return true;
+    }
+
+    void _draw(const WyGifFrame &f) {
+        uint16_t *c = (uint16_t *)_gif.canvas();
+        uint16_t  w = _gif.width();
+        if (!dirtyRects) {
+            gfx->draw16bitRGBBitmap(_x, _y, c, w, _gif.height());
+            return;
+        }
+        if (!f.w || !f.h) return;
+        if (f.w == w) {   /* full-width band is contiguous in the canvas */
+            gfx->draw16bitRGBBitmap(_x, _y + f.y, c + (size_t)f.y * w, w, f.h);
+            return;
+        }
+        for (uint16_t r = 0; r < f.h; r++)
+            gfx->draw16bitRGBBitmap(_x + f.x, _y + f.y + r,
+                                    c + (size_t)(f.y + r) * w + f.x, f.w, 1);
+    }
+
+    /* WyImgReadFn over an open fs::File */
+    static size_t _fileRead(void *ctx, uint32_t off, uint8_t *buf, size_t len) {
+        File *f = (File *)ctx;
+        if (!f->seek(off)) return 0;
+        return f->read(buf, len);
+    }
+};
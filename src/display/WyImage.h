@@ -14,8 +14,13 @@
  *   // Draw from filesystem
  *   img.draw(SPIFFS, "/logo.jpg", 0, 0);
  *   img.draw(SD,     "/splash.png", 10, 10);
- *   img.draw(SPIFFS, "/anim.gif",   0, 0);   // plays once
- *   img.drawGIF(SPIFFS, "/anim.gif", 0, 0, 3); // plays N loops
+ *   img.draw(SPIFFS, "/anim.gif",   0, 0);   // plays once (blocking)
+ *   img.drawGIF(SPIFFS, "/anim.gif", 0, 0, 3); // plays N loops (blocking)
+ *
+ *   // Animate without blocking loop() — see WyGifPlayer.h
+ *   WyGifPlayer anim(display.gfx);
+ *   anim.open(SPIFFS, "/anim.gif", 0, 0);
+ *   void loop() { anim.tick(); ... }
  *
  *   // Draw from PROGMEM (no FS needed)
  *   img.drawJPEGmem(data, len, 0, 0);
@@ -23,20 +28,48 @@
  *
  *   // Draw scaled/centred
  *   img.drawFit(SPIFFS, "/logo.jpg");          // fit to screen, centred
+ *   img.drawFit(SD, "/cam.jpg", 0, 40, 320, 200); // fit to a box
  *   img.drawAt(SPIFFS, "/icon.png", cx, cy);   // centred on cx,cy
  *
+ *   // Decoded-image cache (on by default with PSRAM — see WyImageCache.h)
+ *   img.draw(SD, "/bg.jpg");                   // decode once, keep the bitmap
+ *   img.draw(SD, "/bg.jpg");                   // single blit
+ *   img.cache->hits(); img.cache->misses();
+ *
+ *   // Header only — no decode
+ *   WyImageInfo info;
+ *   img.info(SD, "/cam.jpg", info);            // info.width, info.height
+ *
+ * Fit / scale:
+ *   drawFit() and drawAt() read the image header first (WyImageInfo.h) to
+ *   get its size. JPEGs larger than the box are decoded at 1/2, 1/4 or 1/8
+ *   inside the IDCT (TJpgDec) — a 1600×1200 camera JPEG previews on a
+ *   320×240 panel at 1/8 without ever producing the full-size pixels.
+ *   PNG/BMP/GIF can't be scaled while decoding; they are centred and clipped.
+ *
+ * Cache:
+ *   File draws of JPEG/PNG/BMP go through `cache` (default: the shared
+ *   WY_IMG_CACHE_BYTES PSRAM cache, nullptr on boards without PSRAM).
+ *   Keyed by path + mtime + size + JPEG scale, LRU-evicted to the budget.
+ *   *mem() draws and GIFs are never cached.
+ *
  * Format support:
- *   JPEG — Arduino_GFX built-in JPEG decoder (Bodmer TJpg_Decoder)
- *   PNG  — Arduino_GFX built-in PNG decoder  (pngle)
- *   BMP  — Arduino_GFX built-in BMP decoder
- *   GIF  — Arduino_GFX built-in GIF decoder  (AnimatedGIF)
+ *   JPEG — Bodmer TJpg_Decoder when present (streamed, 1/2–1/8 scaling),
+ *          otherwise the Arduino_GFX drawJpg() path (no scaling)
+ *   PNG  — streamed (WyImageStream.h): small file reads → inflate window →
+ *          one scanline at a time. Interlaced PNGs fall back to Arduino_GFX.
+ *   BMP  — streamed one row at a time (WyImageStream.h). RLE falls back.
+ *   Q565 — native RGB565 run/index/diff format (WyQ565.h, tools/q565.cpp to
+ *          convert PNGs) — the fastest option for UI assets
+ *   GIF  — WyGif.h: incremental LZW decoder + RGB565 canvas, frames drawn
+ *          as dirty rectangles when due (WyGifPlayer)
  *
  * Dependencies (add to platformio.ini lib_deps):
  *   moononournation/Arduino_GFX_Library  (already in wyltek-embedded-builder)
- *   No extra libs needed — all decoders are part of Arduino_GFX
+ *   No extra libs needed — BMP/PNG/GIF decoders are built in, JPEG uses Arduino_GFX
  *
  * Optional extras (add lib_deps if you want them):
- *   https://github.com/bitbank2/AnimatedGIF  — faster GIF decoder
+ *   bodmer/TJpg_Decoder                      — JPEG decode-time downscaling
  *   https://github.com/earlephilhower/ESP8266Audio — audio alongside GIF
  */
 
@@ -44,10 +77,37 @@
 #include <Arduino.h>
 #include <FS.h>
 #include <Arduino_GFX_Library.h>
+#include "WyImageInfo.h"
+#include "WyImageStream.h"
+#include "WyImageCache.h"
+#include "WyQ565.h"
+#include "WyGifPlayer.h"
 
-/* ── Format detection ───────────────────────────────────────────── */
-enum WyImgFmt { WY_IMG_UNKNOWN, WY_IMG_JPEG, WY_IMG_PNG, WY_IMG_BMP, WY_IMG_GIF };
+#if __has_include(<TJpg_Decoder.h>)
+  #include <TJpg_Decoder.h>
+  #define WY_IMG_HAS_TJPGD 1
+  #define WY_IMG_JPEG_MAX_SCALE 8
+#else
+  #define WY_IMG_JPEG_MAX_SCALE 1   /* no decode-time scaling available */
+#endif
+
+#ifndef WY_IMG_CACHE_BYTES
+  #define WY_IMG_CACHE_BYTES (1024 * 1024)   /* shared decoded-image cache (PSRAM only) */
+#endif
 
+/* ── Shared decoded-image cache ─────────────────────────────────── */
+/* Every WyImage starts out pointing here. nullptr without PSRAM. */
+static WyImageCache *wyImageSharedCache() {
+    static WyImageCache cache(0);
+    static bool init = false;
+    if (!init) {
+        init = true;
+        if (psramFound()) cache.setBudget(WY_IMG_CACHE_BYTES);
+    }
+    return cache.budget() ? &cache : nullptr;
+}
+
+/* ── Format detection ───────────────────────────────────────────── */
 static WyImgFmt _wy_img_detect(const char *path) {
     const char *ext = strrchr(path, '.');
     if (!ext) return WY_IMG_UNKNOWN;
@@ -55,6 +115,7 @@ static WyImgFmt _wy_img_detect(const char *path) {
     if (strcasecmp(ext, ".png") == 0) return WY_IMG_PNG;
     if (strcasecmp(ext, ".bmp") == 0) return WY_IMG_BMP;
     if (strcasecmp(ext, ".gif") == 0) return WY_IMG_GIF;
+    if (strcasecmp(ext, ".q565") == 0) return WY_IMG_Q565;
     return WY_IMG_UNKNOWN;
 }
 
@@ -62,9 +123,21 @@ static WyImgFmt _wy_img_detect(const char *path) {
 static Arduino_GFX *_wy_jpeg_gfx = nullptr;
 static int16_t      _wy_jpeg_x   = 0;
 static int16_t      _wy_jpeg_y   = 0;
+static uint16_t    *_wy_jpeg_buf = nullptr;   /* decode into a cache bitmap instead */
+static uint16_t     _wy_jpeg_bw  = 0;
+static uint16_t     _wy_jpeg_bh  = 0;
 
 static bool _wy_jpeg_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t *bitmap) {
+    if (_wy_jpeg_buf) {
+        if (x >= _wy_jpeg_bw) return true;
+        uint16_t n = x + w > _wy_jpeg_bw ? _wy_jpeg_bw - x : w;
+        for (uint16_t r = 0; r < h && y + r < _wy_jpeg_bh; r++)
+            memcpy(_wy_jpeg_buf + (size_t)(y + r) * _wy_jpeg_bw + x, bitmap + (size_t)r * w, n * 2);
+        return true;
+    }
     if (!_wy_jpeg_gfx) return false;
+    /* Below the bottom edge — returning false stops the decoder early */
+    if (_wy_jpeg_y + y >= _wy_jpeg_gfx->height()) return false;
     _wy_jpeg_gfx->draw16bitRGBBitmap(
         _wy_jpeg_x + x, _wy_jpeg_y + y, bitmap, w, h);
     return true;
@@ -75,10 +148,12 @@ static bool _wy_jpeg_output(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16
  * ══════════════════════════════════════════════════════════════════ */
 class WyImage {
 public:
-    Arduino_GFX *gfx;
-    bool verbose = false;
+    Arduino_GFX  *gfx;
+    bool          verbose = false;
+    uint16_t      bg      = 0x0000;   /* PNG alpha is blended over this colour */
+    WyImageCache *cache;              /* decoded bitmaps; nullptr = always decode */
 
-    WyImage(Arduino_GFX *g) : gfx(g) {}
+    WyImage(Arduino_GFX *g) : gfx(g), cache(wyImageSharedCache()) {}
 
     /* ── draw() — auto-detect format, draw from FS ───────────────── */
     bool draw(fs::FS &fs, const char *path, int16_t x = 0, int16_t y = 0) {
@@ -88,59 +163,136 @@ public:
             case WY_IMG_PNG:  return drawPNG(fs, path, x, y);
             case WY_IMG_BMP:  return drawBMP(fs, path, x, y);
             case WY_IMG_GIF:  return drawGIF(fs, path, x, y, 1);
+            case WY_IMG_Q565: return drawQ565(fs, path, x, y);
             default:
                 if (verbose) Serial.printf("[WyImage] Unknown format: %s\n", path);
                 return false;
         }
     }
 
-    /* ── drawFit() — fit image to screen, centred ────────────────── */
-    bool drawFit(fs::FS &fs, const char *path) {
-        // For now: draw at 0,0. Full fit/scale requires decoding header first.
-        // TODO: read image dimensions from header, compute offset.
-        return draw(fs, path, 0, 0);
+    /* ── info() — read format + dimensions from the header only ──── */
+    bool info(fs::FS &fs, const char *path, WyImageInfo &out) {
+        File f = fs.open(path, "r");
+        if (!f) {
+            if (verbose) Serial.printf("[WyImage] open failed: %s\n", path);
+            return false;
+        }
+        bool ok = wyImageProbe(_fileRead, &f, out);
+        f.close();
+        if (!ok && verbose) Serial.printf("[WyImage] unrecognised header: %s\n", path);
+        return ok;
+    }
+
+    /* ── drawFit() — fit image to a box (default: screen), centred ─ */
+    /*
+     * JPEGs are downscaled 1/2, 1/4 or 1/8 at decode time to fit;
+     * progressive JPEGs fail up front (wyImageCheck()) instead of mid-decode.
+     * Other formats are centred at 1:1 and clipped to the screen.
+     */
+    bool drawFit(fs::FS &fs, const char *path,
+                 int16_t box_x = 0, int16_t box_y = 0,
+                 uint16_t box_w = 0, uint16_t box_h = 0) {
+        if (!box_w) box_w = gfx->width()  - box_x;
+        if (!box_h) box_h = gfx->height() - box_y;
+        WyImageInfo inf;
+        if (!info(fs, path, inf)) return false;
+        if (!_check(wyImageCheck(inf), inf.progressive ? "progressive JPEG" : "image", path)) return false;
+        WyImageFit fit = wyImageFit(inf, box_w, box_h, WY_IMG_JPEG_MAX_SCALE);
+        if (verbose) Serial.printf("[WyImage] fit %ux%u -> %ux%u (1/%u) @%d,%d\n",
+                                   inf.width, inf.height, fit.w, fit.h, fit.scale,
+                                   box_x + fit.x, box_y + fit.y);
+        if (inf.fmt == WY_IMG_JPEG)
+            return drawJPEGscaled(fs, path, box_x + fit.x, box_y + fit.y, fit.scale);
+        return draw(fs, path, box_x + fit.x, box_y + fit.y);
     }
 
-    /* ── drawAt() — draw centred on (cx, cy) ────────────────────── */
+    /* ── drawAt() — draw centred on (cx, cy), size read from header ─ */
+    bool drawAt(fs::FS &fs, const char *path, int16_t cx, int16_t cy) {
+        WyImageInfo inf;
+        if (!info(fs, path, inf)) return false;
+        return draw(fs, path, cx - inf.width/2, cy - inf.height/2);
+    }
+
+    /* ── drawAt() — caller already knows the size (skips the header read) */
     bool drawAt(fs::FS &fs, const char *path, int16_t cx, int16_t cy,
                 uint16_t img_w, uint16_t img_h) {
         return draw(fs, path, cx - img_w/2, cy - img_h/2);
     }
 
     /* ════════════════════════════════════════════════════════════════
-     * JPEG
+     * JPEG — streamed through TJpgDec when available
      * ════════════════════════════════════════════════════════════════ */
     bool drawJPEG(fs::FS &fs, const char *path, int16_t x = 0, int16_t y = 0) {
-        File f = fs.open(path, "r");
-        if (!f) {
-            if (verbose) Serial.printf("[WyImage] JPEG open failed: %s\n", path);
-            return false;
-        }
-        size_t len = f.size();
-        uint8_t *buf = (uint8_t *)malloc(len);
-        if (!buf) {
-            f.close();
-            if (verbose) Serial.println("[WyImage] JPEG malloc failed");
-            return false;
-        }
-        f.read(buf, len);
-        f.close();
-        bool ok = drawJPEGmem(buf, len, x, y);
-        free(buf);
-        return ok;
+#ifdef WY_IMG_HAS_TJPGD
+        return drawJPEGscaled(fs, path, x, y, 1);
+#else
+        return _drawBuffered(fs, path, WY_IMG_JPEG, x, y);
+#endif
     }
 
     bool drawJPEGmem(const uint8_t *data, size_t len, int16_t x = 0, int16_t y = 0) {
         _wy_jpeg_gfx = gfx;
         _wy_jpeg_x   = x;
         _wy_jpeg_y   = y;
+#ifdef WY_IMG_HAS_TJPGD
+        TJpgDec.setJpgScale(1);
+        TJpgDec.setCallback(_wy_jpeg_output);
+        JRESULT rc = TJpgDec.drawJpg(0, 0, data, len);
+        return rc == JDR_OK || rc == JDR_INTR;
+#else
         // Arduino_GFX built-in JPEG: drawJpg(data, len, x, y, maxW, maxH, offX, offY, scale)
         gfx->drawJpg(data, len, x, y);
         return true;
+#endif
+    }
+
+    /* ── drawJPEGscaled() — decode at 1/scale (1, 2, 4 or 8) ─────── */
+    /*
+     * Scaling happens inside the IDCT, so decode time and the MCU output
+     * buffer shrink with the scale. Streams from the file — no full-file
+     * malloc. Needs TJpg_Decoder; without it scale must be 1.
+     */
+    bool drawJPEGscaled(fs::FS &fs, const char *path,
+                        int16_t x, int16_t y, uint8_t scale) {
+#ifdef WY_IMG_HAS_TJPGD
+        _CacheSlot slot;
+        if (cache) {
+            File f = fs.open(path, "r");
+            if (!f) {
+                if (verbose) Serial.printf("[WyImage] JPEG open failed: %s\n", path);
+                return false;
+            }
+            bool hit = _cacheDraw(fs, f, path, scale, x, y, slot);
+            f.close();
+            if (hit) return true;
+        }
+        _wy_jpeg_gfx = gfx;
+        _wy_jpeg_x   = x;
+        _wy_jpeg_y   = y;
+        _wy_jpeg_buf = slot.px;
+        _wy_jpeg_bw  = slot.w;
+        _wy_jpeg_bh  = slot.h;
+        if (slot.px)   /* edge MCUs may round short at 1/n — don't leave garbage */
+            for (size_t i = 0, n = (size_t)slot.w * slot.h; i < n; i++) slot.px[i] = bg;
+        TJpgDec.setJpgScale(scale);
+        TJpgDec.setCallback(_wy_jpeg_output);
+        JRESULT rc = TJpgDec.drawFsJpg(0, 0, path, fs);
+        _wy_jpeg_buf = nullptr;
+        bool ok = rc == JDR_OK || rc == JDR_INTR;
+        if (!ok && verbose) Serial.printf("[WyImage] JPEG decode error %d: %s\n", rc, path);
+        if (slot.px) return _cacheFinish(slot, ok, x, y);
+        return ok;
+#else
+        if (scale != 1) {
+            if (verbose) Serial.println("[WyImage] JPEG scaling needs TJpg_Decoder");
+            return false;
+        }
+        return drawJPEG(fs, path, x, y);
+#endif
     }
 
     /* ════════════════════════════════════════════════════════════════
-     * PNG
+     * PNG — streamed: WY_IMG_CHUNK reads → inflate window → row
      * ════════════════════════════════════════════════════════════════ */
     bool drawPNG(fs::FS &fs, const char *path, int16_t x = 0, int16_t y = 0) {
         File f = fs.open(path, "r");
@@ -148,27 +300,31 @@ public:
             if (verbose) Serial.printf("[WyImage] PNG open failed: %s\n", path);
             return false;
         }
-        size_t len = f.size();
-        uint8_t *buf = (uint8_t *)malloc(len);
-        if (!buf) {
-            f.close();
-            if (verbose) Serial.println("[WyImage] PNG malloc failed");
-            return false;
-        }
-        f.read(buf, len);
+        _CacheSlot slot;
+        if (_cacheDraw(fs, f, path, 1, x, y, slot)) { f.close(); return true; }
+        _RowSink sink = { gfx, x, y, true, slot.px, slot.w, slot.h };
+        WyImgResult rc = wyDecodePNG(_fileRead, &f, _drawRow, &sink, bg);
         f.close();
-        bool ok = drawPNGmem(buf, len, x, y);
-        free(buf);
-        return ok;
+        if (slot.px && rc != WY_IMG_OK) { cache->drop(slot.px); slot.px = nullptr; }
+        /* Interlaced — no row-order output, use the whole-file decoder */
+        if (rc == WY_IMG_ERR_UNSUPPORTED) return _drawBuffered(fs, path, WY_IMG_PNG, x, y);
+        if (slot.px) return _cacheFinish(slot, true, x, y);
+        return _check(rc, "PNG", path);
     }
 
     bool drawPNGmem(const uint8_t *data, size_t len, int16_t x = 0, int16_t y = 0) {
-        gfx->drawPng(data, len, x, y);
-        return true;
+        _WyImgMemSrc src  = { data, len };
+        _RowSink     sink = { gfx, x, y, true, nullptr, 0, 0 };
+        WyImgResult rc = wyDecodePNG(_wy_img_mem_read, &src, _drawRow, &sink, bg);
+        if (rc == WY_IMG_ERR_UNSUPPORTED) {
+            gfx->drawPng(data, len, x, y);
+            return true;
+        }
+        return _check(rc, "PNG", "(mem)");
     }
 
     /* ════════════════════════════════════════════════════════════════
-     * BMP
+     * BMP — streamed one file row at a time
      * ════════════════════════════════════════════════════════════════ */
     bool drawBMP(fs::FS &fs, const char *path, int16_t x = 0, int16_t y = 0) {
         File f = fs.open(path, "r");
@@ -176,79 +332,79 @@ public:
             if (verbose) Serial.printf("[WyImage] BMP open failed: %s\n", path);
             return false;
         }
-        size_t len = f.size();
-        uint8_t *buf = (uint8_t *)malloc(len);
-        if (!buf) {
-            f.close();
-            if (verbose) Serial.println("[WyImage] BMP malloc failed");
-            return false;
-        }
-        f.read(buf, len);
+        _CacheSlot slot;
+        if (_cacheDraw(fs, f, path, 1, x, y, slot)) { f.close(); return true; }
+        _RowSink sink = { gfx, x, y, false, slot.px, slot.w, slot.h };   /* rows may arrive bottom-up */
+        WyImgResult rc = wyDecodeBMP(_fileRead, &f, _drawRow, &sink);
         f.close();
-        bool ok = drawBMPmem(buf, len, x, y);
-        free(buf);
-        return ok;
+        if (slot.px && rc != WY_IMG_OK) { cache->drop(slot.px); slot.px = nullptr; }
+        /* RLE-compressed — hand the whole file to Arduino_GFX */
+        if (rc == WY_IMG_ERR_UNSUPPORTED) return _drawBuffered(fs, path, WY_IMG_BMP, x, y);
+        if (slot.px) return _cacheFinish(slot, true, x, y);
+        return _check(rc, "BMP", path);
     }
 
     bool drawBMPmem(const uint8_t *data, size_t len, int16_t x = 0, int16_t y = 0) {
-        gfx->drawBmp(data, len, x, y);
-        return true;
+        _WyImgMemSrc src  = { data, len };
+        _RowSink     sink = { gfx, x, y, false, nullptr, 0, 0 };
+        WyImgResult rc = wyDecodeBMP(_wy_img_mem_read, &src, _drawRow, &sink);
+        if (rc == WY_IMG_ERR_UNSUPPORTED) {
+            gfx->drawBmp(data, len, x, y);
+            return true;
+        }
+        return _check(rc, "BMP", "(mem)");
     }
 
     /* ════════════════════════════════════════════════════════════════
-     * GIF — streamed from FS (no full buffer needed — great for RAM)
+     * Q565 — native RGB565 (WyQ565.h). Only rows on screen are decoded;
+     * alpha-keyed pixels are skipped. Not cached — decoding is already
+     * about as cheap as copying the bitmap.
      * ════════════════════════════════════════════════════════════════ */
-    bool drawGIF(fs::FS &fs, const char *path,
-                 int16_t x = 0, int16_t y = 0, int loops = 1) {
+    bool drawQ565(fs::FS &fs, const char *path, int16_t x = 0, int16_t y = 0) {
         File f = fs.open(path, "r");
         if (!f) {
-            if (verbose) Serial.printf("[WyImage] GIF open failed: %s\n", path);
+            if (verbose) Serial.printf("[WyImage] Q565 open failed: %s\n", path);
             return false;
         }
-
-        GifClass gif;
-        if (!gif.gd_open_gif(&f)) {
+        uint8_t h[WY_Q565_HEADER];
+        WyQ565Header hd;
+        if (!_wy_q565_header(h, f.read(h, sizeof(h)), hd)) {
             f.close();
-            if (verbose) Serial.println("[WyImage] GIF decode init failed");
-            return false;
-        }
-
-        uint8_t *buf = (uint8_t *)malloc(gif.gif.width * gif.gif.height * 2);
-        if (!buf) {
-            gif.gd_close_gif();
-            f.close();
-            if (verbose) Serial.println("[WyImage] GIF frame malloc failed");
-            return false;
-        }
-
-        for (int loop = 0; loop < loops || loops < 0; loop++) {
-            while (true) {
-                int res = gif.gd_get_frame(&f);
-                if (res < 0 || res == 0) break;  // error or end of GIF
-                gfx->draw16bitRGBBitmap(x, y,
-                    (uint16_t *)buf,
-                    gif.gif.width, gif.gif.height);
-                delay(gif.gif.gce.delay * 10);  // delay in centiseconds → ms
-            }
-            if (loops < 0) gif.gd_rewind(&f);  // infinite loop
+            return _check(WY_IMG_ERR_FORMAT, "Q565", path);
         }
-
-        free(buf);
-        gif.gd_close_gif();
+        _RowSink sink = { gfx, x, y, true, nullptr, 0, 0,
+                          (hd.flags & WY_Q565_FLAG_KEY) != 0, hd.key };
+        WyImgResult rc = wyDecodeQ565(_fileRead, &f, _drawRow, &sink,
+                                      -y, gfx->height() - 1 - y);
         f.close();
-        return true;
+        return _check(rc, "Q565", path);
     }
 
-    /* ── GIF infinite loop (call from loop(), returns false when done) */
-    bool drawGIFframe(GifClass &gif, fs::FS &fs, File &f,
-                      int16_t x, int16_t y, uint8_t *framebuf) {
-        int res = gif.gd_get_frame(&f);
-        if (res <= 0) return false;
-        gfx->draw16bitRGBBitmap(x, y,
-            (uint16_t *)framebuf,
-            gif.gif.width, gif.gif.height);
-        delay(gif.gif.gce.delay * 10);
-        return true;
+    bool drawQ565mem(const uint8_t *data, size_t len, int16_t x = 0, int16_t y = 0) {
+        WyQ565Header hd;
+        if (!_wy_q565_header(data, len, hd)) return _check(WY_IMG_ERR_FORMAT, "Q565", "(mem)");
+        _RowSink sink = { gfx, x, y, true, nullptr, 0, 0,
+                          (hd.flags & WY_Q565_FLAG_KEY) != 0, hd.key };
+        return _check(wyDecodeQ565Mem(data, len, _drawRow, &sink, -y, gfx->height() - 1 - y),
+                      "Q565", "(mem)");
+    }
+
+    /* ════════════════════════════════════════════════════════════════
+     * GIF — blocking playback (for non-blocking use WyGifPlayer + tick())
+     * loops: N plays N times, -1 forever (never returns)
+     * ════════════════════════════════════════════════════════════════ */
+    bool drawGIF(fs::FS &fs, const char *path,
+                 int16_t x = 0, int16_t y = 0, int loops = 1) {
+        WyGifPlayer p(gfx);
+        p.verbose = verbose;
+        p.bg      = bg;
+        if (!p.open(fs, path, x, y, loops ? loops : 1)) return false;
+        while (p.playing()) {
+            p.tick(millis());
+            int32_t wait = (int32_t)(p.due() - millis());
+            if (p.playing() && wait > 0) delay(wait);
+        }
+        return p.error() == WY_IMG_OK;
     }
 
     /* ════════════════════════════════════════════════════════════════
@@ -264,10 +420,126 @@ public:
         return true;
     }
 
+    /* drawPNG() already streams — kept for existing callers */
     bool drawPNGstream(fs::FS &fs, const char *path, int16_t x = 0, int16_t y = 0) {
-        gfx->drawPngFile(fs, path, x, y);
+        return drawPNG(fs, path, x, y);
+    }
+
+private:
+    /* Scanline target for the streaming decoders */
+    struct _RowSink {
+        Arduino_GFX *gfx;
+        int16_t      x, y;
+        bool         topDown;   /* rows arrive in order — stop once off-screen */
+        uint16_t    *buf;       /* set: fill this cache bitmap instead of drawing */
+        uint16_t     bw, bh;
+        bool         keyed = false;   /* skip pixels equal to key (Q565 alpha key) */
+        uint16_t     key   = 0;
+    };
+
+    static bool _drawRow(void *ctx, int16_t row, const uint16_t *px, uint16_t w) {
+        _RowSink *s = (_RowSink *)ctx;
+        if (s->buf) {
+            if (row >= 0 && row < s->bh && w == s->bw)
+                memcpy(s->buf + (size_t)row * w, px, (size_t)w * 2);
+            return true;
+        }
+        int16_t y = s->y + row;
+        if (y >= s->gfx->height()) return !s->topDown;
+        if (y < 0) return true;
+        if (!s->keyed) {
+            s->gfx->draw16bitRGBBitmap(s->x, y, (uint16_t *)px, w, 1);
+            return true;
+        }
+        for (uint16_t i = 0; i < w; ) {            /* opaque spans only */
+            while (i < w && px[i] == s->key) i++;
+            uint16_t j = i;
+            while (j < w && px[j] != s->key) j++;
+            if (j > i) s->gfx->draw16bitRGBBitmap(s->x + i, y, (uint16_t *)px + i, j - i, 1);
+            i = j;
+        }
+        return true;
+    }
+
+    /* ── Decoded-image cache ──────────────────────────────────── */
+    struct _CacheSlot {
+        uint16_t *px = nullptr;   /* reserved bitmap to decode into (miss) */
+        uint16_t  w = 0, h = 0;
+    };
+
+    /*
+     * Hit: blit the cached bitmap, return true. Miss: reserve an entry the
+     * size of the decoded image (slot.px stays null if it isn't cacheable).
+     */
+    bool _cacheDraw(fs::FS &fs, File &f, const char *path, uint8_t scale, int16_t x, int16_t y,
+                    _CacheSlot &slot) {
+        if (!cache) return false;
+        uint32_t mtime = (uint32_t)f.getLastWrite(), size = (uint32_t)f.size();
+        uint16_t w, h;
+        const uint16_t *px = cache->get(path, mtime, size, scale, w, h, &fs, bg);   /* bg: alpha / edge fill */
+        if (px) {
+            gfx->draw16bitRGBBitmap(x, y, (uint16_t *)px, w, h);
+            return true;
+        }
+        WyImageInfo inf;
+        if (!wyImageProbe(_fileRead, &f, inf)) return false;
+        slot.w  = (uint16_t)((inf.width  + scale - 1) / scale);
+        slot.h  = (uint16_t)((inf.height + scale - 1) / scale);
+        slot.px = cache->reserve(path, mtime, size, scale, slot.w, slot.h, &fs, bg);
+        if (verbose) Serial.printf("[WyImage] cache miss %s (%s, %u/%u KB)\n", path,
+                                   slot.px ? "stored" : "not cached",
+                                   (unsigned)(cache->used() / 1024), (unsigned)(cache->budget() / 1024));
+        return false;
+    }
+
+    /* Blit a freshly filled cache bitmap, or drop it if the decode failed */
+    bool _cacheFinish(_CacheSlot &slot, bool ok, int16_t x, int16_t y) {
+        if (!ok) {
+            cache->drop(slot.px);
+            return false;
+        }
+        gfx->draw16bitRGBBitmap(x, y, slot.px, slot.w, slot.h);
+        return true;
+    }
+
+    bool _check(WyImgResult rc, const char *fmt, const char *path) {
+        if (rc >= 0) return true;
+        if (verbose) Serial.printf("[WyImage] %s decode error %d: %s\n", fmt, rc, path);
+        return false;
+    }
+
+    /* Fallback: read the whole file and hand it to Arduino_GFX */
+    bool _drawBuffered(fs::FS &fs, const char *path, WyImgFmt fmt, int16_t x, int16_t y) {
+        File f = fs.open(path, "r");
+        if (!f) {
+            if (verbose) Serial.printf("[WyImage] open failed: %s\n", path);
+            return false;
+        }
+        size_t len = f.size();
+        uint8_t *buf = (uint8_t *)malloc(len);
+        if (!buf) {
+            f.close();
+            if (verbose) Serial.println("[WyImage] malloc failed");
+            return false;
+        }
+        f.read(buf, len);
+        f.close();
+        switch (fmt) {
+            case WY_IMG_JPEG: gfx->drawJpg(buf, len, x, y); break;
+            case WY_IMG_PNG:  gfx->drawPng(buf, len, x, y); break;
+            case WY_IMG_BMP:  gfx->drawBmp(buf, len, x, y); break;
+            default: break;
+        }
+        free(buf);
         return true;
     }
+
+    /* WyImgReadFn over an open fs::File */
+    static size_t _fileRead(void *ctx, uint32_t off, uint8_t *buf, size_t len) {
+        File *f = (File *)ctx;
+        if (!f->seek(off)) return 0;
+        return f->read(buf, len);
+    }
 };
 
 /* ── Convenience free functions (drop-in one-liners) ─────────────── */
@@ -0,0 +1,196 @@
+/*
+ * WyImageCache.h — LRU cache of decoded RGB565 bitmaps for WyImage
+ * ==================================================================
+ * Dashboards redraw the same icons and backgrounds on every page switch.
+ * With a cache attached, WyImage decodes a file once into a bitmap in
+ * PSRAM; later draws of the same file are a single blit.
+ * Pure C++ — no Arduino dependency, runs in host tests.
+ *
+ * Usage:
+ *   WyImage img(gfx);              // uses wyImageSharedCache() on PSRAM boards
+ *   img.draw(SD, "/bg.jpg");       // miss: decode into cache, then blit
+ *   img.draw(SD, "/bg.jpg");       // hit:  one draw16bitRGBBitmap()
+ *   Serial.printf("%u hits / %u misses\n", img.cache->hits(), img.cache->misses());
+ *
+ *   WyImageCache icons(256 * 1024); // separate budget for one screen
+ *   img.cache = &icons;
+ *   img.cache = nullptr;            // bypass
+ *
+ * Keys:
+ *   path + file mtime + file size + decode scale + source + background.
+ *   Rewriting a file changes its mtime/size, so the stale bitmap is
+ *   dropped on the next lookup — no manual invalidation needed
+ *   (invalidate() exists for files replaced with identical size inside
+ *   one mtime tick). `src` tells filesystems apart (WyImage passes the
+ *   fs::FS, so /a.png on SD and on SPIFFS are two entries) and `bg` is
+ *   the colour alpha was blended over, so changing WyImage::bg decodes
+ *   afresh instead of serving the old blend.
+ *
+ * Budget:
+ *   Counts bitmap bytes (w × h × 2). When a new entry doesn't fit, least
+ *   recently drawn entries are evicted until it does; images bigger than
+ *   the whole budget are simply not cached. Bitmaps are allocated with
+ *   WY_IMG_CACHE_MALLOC — PSRAM on ESP32 — and lookup is a linear scan
+ *   over a short list (hash compare first), which is noise next to a blit.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef WY_IMG_CACHE_MALLOC
+  #if defined(ESP_PLATFORM)
+    #include <esp_heap_caps.h>
+    #define WY_IMG_CACHE_MALLOC(n) heap_caps_malloc((n), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+  #else
+    #define WY_IMG_CACHE_MALLOC(n) malloc(n)
+  #endif
+#endif
+#ifndef WY_IMG_CACHE_FREE
+  #define WY_IMG_CACHE_FREE(p) free(p)        /* heap_caps memory frees with free() */
+#endif
+
+class WyImageCache {
+public:
+    WyImageCache(size_t budgetBytes = 0) : _budget(budgetBytes) {}
+    ~WyImageCache() { clear(); }
+    WyImageCache(const WyImageCache &) = delete;
+    WyImageCache &operator=(const WyImageCache &) = delete;
+
+    /* Shrinking evicts immediately; 0 disables caching */
+    void setBudget(size_t bytes) {
+        _budget = bytes;
+        while (_used > _budget && _tail) _evict(_tail);
+    }
+
+    /* Cached bitmap for this key, or nullptr. Marks the entry most recent. */
+    const uint16_t *get(const char *path, uint32_t mtime, uint32_t size, uint8_t scale,
+                        uint16_t &w, uint16_t &h, const void *src = nullptr, uint16_t bg = 0) {
+        _Entry *e = _find(path, scale, src, bg);
+        if (e && (e->mtime != mtime || e->size != size)) {   /* file changed */
+            _remove(e);
+            e = nullptr;
+        }
+        if (!e) { _misses++; return nullptr; }
+        _hits++;
+        _unlink(e);
+        _pushFront(e);
+        w = e->w; h = e->h;
+        return e->px;
+    }
+
+    /*
+     * New entry for the caller to decode into (w × h RGB565, row-major).
+     * Evicts LRU entries to make room. nullptr = too big / no memory —
+     * draw uncached. If the decode then fails, drop() the buffer.
+     */
+    uint16_t *reserve(const char *path, uint32_t mtime, uint32_t size, uint8_t scale,
+                      uint16_t w, uint16_t h, const void *src = nullptr, uint16_t bg = 0) {
+        size_t bytes = (size_t)w * h * 2;
+        if (!bytes || bytes > _budget) return nullptr;
+        _Entry *old = _find(path, scale, src, bg);
+        if (old) _remove(old);
+        while (_used + bytes > _budget && _tail) _evict(_tail);
+
+        size_t plen = strlen(path);
+        _Entry *e = (_Entry *)malloc(sizeof(_Entry) + plen + 1);
+        if (!e) return nullptr;
+        e->px = (uint16_t *)WY_IMG_CACHE_MALLOC(bytes);
+        while (!e->px && _tail) {                   /* heap fragmented — free more */
+            _evict(_tail);
+            e->px = (uint16_t *)WY_IMG_CACHE_MALLOC(bytes);
+        }
+        if (!e->px) { free(e); return nullptr; }
+        memcpy(e->path, path, plen + 1);
+        e->hash  = _hash(path);
+        e->mtime = mtime; e->size = size; e->scale = scale;
+        e->src = src; e->bg = bg;
+        e->w = w; e->h = h; e->bytes = bytes;
+        _pushFront(e);
+        _used += bytes;
+        _count++;
+        return e->px;
+    }
+
+    /* Discard a reserved entry whose decode failed */
+    void drop(const uint16_t *px) {
+        for (_Entry *e = _head; e; e = e->next)
+            if (e->px == px) { _remove(e); return; }
+    }
+
+    /* Forget every scale / source / bg of a path. True if anything was cached. */
+    bool invalidate(const char *path) {
+        uint32_t hv = _hash(path);
+        bool any = false;
+        for (_Entry *e = _head, *n; e; e = n) {
+            n = e->next;
+            if (e->hash == hv && strcmp(e->path, path) == 0) { _remove(e); any = true; }
+        }
+        return any;
+    }
+
+    void clear() { while (_head) _remove(_head); }
+    void resetStats() { _hits = _misses = _evictions = 0; }
+
+    size_t   budget()    const { return _budget; }
+    size_t   used()      const { return _used; }
+    uint16_t count()     const { return _count; }
+    uint32_t hits()      const { return _hits; }
+    uint32_t misses()    const { return _misses; }
+    uint32_t evictions() const { return _evictions; }
+
+private:
+    struct _Entry {
+        _Entry   *prev, *next;       /* head = most recently drawn */
+        uint16_t *px;
+        size_t    bytes;
+        uint32_t  hash, mtime, size;
+        const void *src;
+        uint16_t  w, h, bg;
+        uint8_t   scale;
+        char      path[1];           /* allocated to fit */
+    };
+
+    _Entry  *_head = nullptr, *_tail = nullptr;
+    size_t   _budget, _used = 0;
+    uint16_t _count = 0;
+    uint32_t _hits = 0, _misses = 0, _evictions = 0;
+
+    static uint32_t _hash(const char *s) {            /* FNV-1a */
+        uint32_t h = 2166136261u;
+        while (*s) { h ^= (uint8_t)*s++; h *= 16777619u; }
+        return h;
+    }
+
+    _Entry *_find(const char *path, uint8_t scale, const void *src, uint16_t bg) const {
+        uint32_t hv = _hash(path);
+        for (_Entry *e = _head; e; e = e->next)
+            if (e->hash == hv && e->scale == scale && e->src == src && e->bg == bg &&
+                strcmp(e->path, path) == 0) return e;
+        return nullptr;
+    }
+
+    void _unlink(_Entry *e) {
+        if (e->prev) e->prev->next = e->next; else _head = e->next;
+        if (e->next) e->next->prev = e->prev; else _tail = e->prev;
+    }
+
+    void _pushFront(_Entry *e) {
+        e->prev = nullptr;
+        e->next = _head;
+        if (_head) _head->prev = e; else _tail = e;
+        _head = e;
+    }
+
+    void _remove(_Entry *e) {
+        _unlink(e);
+        _used -= e->bytes;
+        _count--;
+        WY_IMG_CACHE_FREE(e->px);
+        free(e);
+    }
+
+    void _evict(_Entry *e) { _evictions++; _remove(e); }
+};
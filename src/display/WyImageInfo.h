@@ -0,0 +1,207 @@
+/*
+ * WyImageInfo.h — Image header probing for WyImage (no decoding)
+ * ================================================================
+ * Reads just enough of a JPEG / PNG / BMP / GIF / Q565 file to learn its format
+ * and dimensions, then works out where and at what scale to draw it.
+ * Pure C++ — no Arduino, FS or GFX dependency, so it runs in host tests.
+ *
+ * Usage:
+ *   WyImageInfo info;
+ *   if (wyImageProbeMem(data, len, info)) {
+ *       // info.fmt, info.width, info.height
+ *       WyImageFit fit = wyImageFit(info, 320, 240);
+ *       // fit.scale (1/2/4/8 for JPEG), fit.x, fit.y, fit.w, fit.h
+ *   }
+ *
+ *   // Random-access source (WyImage uses this with fs::File):
+ *   wyImageProbe(myReadFn, &ctx, info);
+ *
+ * Probing cost:
+ *   PNG / BMP / GIF / Q565 — one read of the first 32 bytes.
+ *   JPEG            — walks the marker chain with one 4-byte read per
+ *                     segment, seeking over EXIF/ICC blobs rather than
+ *                     reading them, until it reaches the SOFn frame header.
+ *
+ * JPEG decode-time scaling:
+ *   The JPEG decoder (TJpgDec) can reduce the IDCT output to 1/2, 1/4 or
+ *   1/8 per block, so a downscaled preview costs a fraction of the time and
+ *   RAM of a full decode. wyImageFit() picks the smallest of those factors
+ *   that makes the image fit the box. Other formats always use scale 1 and
+ *   are centred (and clipped) as-is.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/* ── Format ──────────────────────────────────────────────────────── */
+enum WyImgFmt { WY_IMG_UNKNOWN, WY_IMG_JPEG, WY_IMG_PNG, WY_IMG_BMP, WY_IMG_GIF, WY_IMG_Q565 };
+
+struct WyImageInfo {
+    WyImgFmt fmt         = WY_IMG_UNKNOWN;
+    uint16_t width       = 0;
+    uint16_t height      = 0;
+    uint8_t  bpp         = 0;      /* bits per pixel (BMP) / bit depth (PNG) */
+    bool     progressive = false;  /* JPEG SOF2 — TJpgDec can't decode these */
+    bool     topDown     = false;  /* BMP stored top row first */
+};
+
+/* Where to draw an image inside a box, and at what decode scale */
+struct WyImageFit {
+    uint8_t  scale = 1;   /* JPEG decode divisor: 1, 2, 4 or 8 */
+    uint16_t w     = 0;   /* drawn size after scaling */
+    uint16_t h     = 0;
+    int16_t  x     = 0;   /* top-left, relative to the box origin */
+    int16_t  y     = 0;   /* (negative = image larger than box, centre-cropped) */
+};
+
+/* Random-access read: copy up to len bytes from offset into buf,
+   return the number of bytes actually read. */
+typedef size_t (*WyImgReadFn)(void *ctx, uint32_t offset, uint8_t *buf, size_t len);
+
+/* ── Byte helpers ────────────────────────────────────────────────── */
+static inline uint16_t _wy_be16(const uint8_t *p) { return (uint16_t)(p[0] << 8 | p[1]); }
+static inline uint32_t _wy_be32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+static inline uint16_t _wy_le16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+static inline int32_t  _wy_le32(const uint8_t *p) {
+    return (int32_t)((uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24);
+}
+
+/* ── Format sniffing from magic bytes ────────────────────────────── */
+static inline WyImgFmt wyImageSniff(const uint8_t *p, size_t n) {
+    if (n >= 3 && p[0] == 0xFF && p[1] == 0xD8 && p[2] == 0xFF)         return WY_IMG_JPEG;
+    if (n >= 8 && memcmp(p, "\x89PNG\r\n\x1a\n", 8) == 0)               return WY_IMG_PNG;
+    if (n >= 2 && p[0] == 'B' && p[1] == 'M')                           return WY_IMG_BMP;
+    if (n >= 6 && (memcmp(p, "GIF87a", 6) == 0 || memcmp(p, "GIF89a", 6) == 0)) return WY_IMG_GIF;
+    if (n >= 4 && memcmp(p, "Q565", 4) == 0)                            return WY_IMG_Q565;
+    return WY_IMG_UNKNOWN;
+}
+
+/* ── JPEG: walk markers to the SOFn header ───────────────────────── */
+static inline bool _wy_probe_jpeg(WyImgReadFn rd, void *ctx, WyImageInfo &info) {
+    uint32_t off = 2;                       /* skip SOI */
+    uint8_t  b[9];
+    for (int guard = 0; guard < 256; guard++) {
+        if (rd(ctx, off, b, 4) != 4) return false;
+        if (b[0] != 0xFF) return false;
+        uint8_t m = b[1];
+        if (m == 0xFF) { off++; continue; } /* fill byte */
+        if (m == 0xD8 || m == 0x01 || (m >= 0xD0 && m <= 0xD7)) { off += 2; continue; }
+        if (m == 0xD9 || m == 0xDA) return false;   /* EOI / SOS before any SOF */
+        uint16_t seglen = _wy_be16(b + 2);
+        /* SOF0..SOF15, excluding DHT (C4), JPG (C8), DAC (CC) */
+        if (m >= 0xC0 && m <= 0xCF && m != 0xC4 && m != 0xC8 && m != 0xCC) {
+            if (rd(ctx, off + 4, b, 5) != 5) return false;
+            info.fmt         = WY_IMG_JPEG;
+            info.bpp         = b[0];
+            info.height      = _wy_be16(b + 1);
+            info.width       = _wy_be16(b + 3);
+            info.progressive = (m == 0xC2 || m == 0xC6 || m == 0xCA || m == 0xCE);
+            return info.width && info.height;
+        }
+        off += 2 + seglen;
+    }
+    return false;
+}
+
+/* ── Probe any supported format ──────────────────────────────────── */
+static inline bool wyImageProbe(WyImgReadFn rd, void *ctx, WyImageInfo &info) {
+    info = WyImageInfo();
+    uint8_t h[32];
+    size_t n = rd(ctx, 0, h, sizeof(h));
+    switch (wyImageSniff(h, n)) {
+        case WY_IMG_JPEG:
+            return _wy_probe_jpeg(rd, ctx, info);
+
+        case WY_IMG_PNG:
+            /* 8-byte signature, then IHDR: len(4) "IHDR" w(4) h(4) depth type */
+            if (n < 26 || memcmp(h + 12, "IHDR", 4) != 0) return false;
+            info.fmt    = WY_IMG_PNG;
+            info.width  = (uint16_t)_wy_be32(h + 16);
+            info.height = (uint16_t)_wy_be32(h + 20);
+            info.bpp    = h[24];
+            return info.width && info.height;
+
+        case WY_IMG_BMP: {
+            if (n < 26) return false;
+            uint32_t dib = (uint32_t)_wy_le32(h + 14);
+            info.fmt = WY_IMG_BMP;
+            if (dib == 12) {                /* BITMAPCOREHEADER (OS/2) */
+                info.width  = _wy_le16(h + 18);
+                info.height = _wy_le16(h + 20);
+                info.bpp    = h[24];
+            } else {                        /* BITMAPINFOHEADER and later */
+                if (n < 30) return false;
+                int32_t w  = _wy_le32(h + 18);
+                int32_t hh = _wy_le32(h + 22);
+                info.topDown = hh < 0;
+                info.width   = (uint16_t)(w < 0 ? -w : w);
+                info.height  = (uint16_t)(hh < 0 ? -hh : hh);
+                info.bpp     = h[28];
+            }
+            return info.width && info.height;
+        }
+
+        case WY_IMG_GIF:
+            if (n < 10) return false;
+            info.fmt    = WY_IMG_GIF;
+            info.width  = _wy_le16(h + 6);  /* logical screen size */
+            info.height = _wy_le16(h + 8);
+            return info.width && info.height;
+
+        case WY_IMG_Q565:                   /* see WyQ565.h */
+            if (n < 16) return false;
+            info.fmt    = WY_IMG_Q565;
+            info.width  = _wy_le16(h + 4);
+            info.height = _wy_le16(h + 6);
+            info.bpp    = 16;
+            info.topDown = true;
+            return info.width && info.height;
+
+        default:
+            return false;
+    }
+}
+
+/* ── Probe an in-memory image ────────────────────────────────────── */
+struct _WyImgMemSrc { const uint8_t *data; size_t len; };
+
+static inline size_t _wy_img_mem_read(void *ctx, uint32_t off, uint8_t *buf, size_t len) {
+    const _WyImgMemSrc *s = (const _WyImgMemSrc *)ctx;
+    if (off >= s->len) return 0;
+    if (len > s->len - off) len = s->len - off;
+    memcpy(buf, s->data + off, len);
+    return len;
+}
+
+static inline bool wyImageProbeMem(const uint8_t *data, size_t len, WyImageInfo &info) {
+    _WyImgMemSrc src = { data, len };
+    return wyImageProbe(_wy_img_mem_read, &src, info);
+}
+
+/* ── Fit into a box: pick decode scale, centre ───────────────────── */
+/*
+ * JPEG: smallest divisor in {1,2,4,8} whose output fits box_w × box_h
+ * (maxScale if nothing fits — the result is then centre-cropped).
+ * Never upscales. Other formats: scale 1, centred.
+ */
+static inline WyImageFit wyImageFit(const WyImageInfo &info, uint16_t box_w, uint16_t box_h,
+                                    uint8_t maxScale = 8) {
+    WyImageFit f;
+    uint8_t s = 1;
+    if (info.fmt == WY_IMG_JPEG) {
+        while (s < maxScale && ((info.width  + s - 1) / s > box_w ||
+                         (info.height + s - 1) / s > box_h)) {
+            s <<= 1;
+        }
+    }
+    f.scale = s;
+    f.w = (uint16_t)((info.width  + s - 1) / s);
+    f.h = (uint16_t)((info.height + s - 1) / s);
+    f.x = (int16_t)(((int32_t)box_w - f.w) / 2);
+    f.y = (int16_t)(((int32_t)box_h - f.h) / 2);
+    return f;
+}
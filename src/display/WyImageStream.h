@@ -0,0 +1,633 @@
+/*
+ * WyImageStream.h — Streaming BMP / PNG decoders for WyImage
+ * ============================================================
+ * Decodes straight from a file (or memory) in small fixed reads and hands
+ * each finished scanline to a callback as RGB565. Nothing ever holds the
+ * whole file or the whole image, so large SD images work on boards
+ * without PSRAM. Pure C++ — no Arduino dependency, runs in host tests.
+ *
+ * Usage:
+ *   bool row(void *ctx, int16_t y, const uint16_t *px, uint16_t w) {
+ *       gfx->draw16bitRGBBitmap(x0, y0 + y, (uint16_t *)px, w, 1);
+ *       return true;              // false = stop decoding (e.g. off-screen)
+ *   }
+ *   WyImgResult rc = wyDecodePNG(readFn, &file, row, nullptr);
+ *   WyImgResult rc = wyDecodeBMP(readFn, &file, row, nullptr);
+ *
+ * Peak memory:
+ *   BMP — one file row + one RGB565 row (+ palette for ≤8 bpp).
+ *   PNG — inflate window (from the zlib header, ≤32 KB; usually 32 KB)
+ *         + two raw scanlines + one RGB565 row + WY_IMG_CHUNK input bytes
+ *         + ~2.5 KB decoder state. wyDecodePNGMemory() reports the exact
+ *         figure for a given file.
+ *
+ * BMP:
+ *   1/4/8 bpp palette, 16 bpp (555 or bitfields, 565 fast path), 24 bpp,
+ *   32 bpp. Uncompressed / BI_BITFIELDS only (no RLE). Rows are emitted
+ *   in file order — bottom-up files paint bottom-up, which keeps the SD
+ *   reads sequential.
+ *
+ * PNG:
+ *   All colour types and bit depths (16-bit samples use the high byte),
+ *   PLTE + tRNS, all five row filters, stored / fixed / dynamic deflate
+ *   blocks, IDAT split across any number of chunks. Alpha is blended over
+ *   the bg colour passed in. Adam7 interlaced files return
+ *   WY_IMG_ERR_UNSUPPORTED (callers fall back to a buffered decoder).
+ *   CRCs and the Adler-32 trailer are not checked.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "WyImageInfo.h"
+
+#ifndef WY_IMG_CHUNK
+  #define WY_IMG_CHUNK 512      /* PNG input read size (bytes) */
+#endif
+
+enum WyImgResult {
+    WY_IMG_OK              = 0,  /* every row delivered */
+    WY_IMG_STOPPED         = 1,  /* row callback asked to stop — not an error */
+    WY_IMG_ERR_FORMAT      = -1, /* not a BMP/PNG, or bad header */
+    WY_IMG_ERR_UNSUPPORTED = -2, /* valid file, variant we don't stream (RLE, interlace) */
+    WY_IMG_ERR_NOMEM       = -3,
+    WY_IMG_ERR_CORRUPT     = -4, /* bad deflate data / truncated */
+};
+
+/* Scanline sink: y is the image row (0 = top). Return false to stop. */
+typedef bool (*WyImgRowFn)(void *ctx, int16_t y, const uint16_t *px, uint16_t w);
+
+/* Can a probed file be decoded at all? Progressive JPEG → UNSUPPORTED (TJpgDec is baseline-only) */
+static inline WyImgResult wyImageCheck(const WyImageInfo &info) {
+    if (info.fmt == WY_IMG_UNKNOWN) return WY_IMG_ERR_FORMAT;
+    if (info.fmt == WY_IMG_JPEG && info.progressive) return WY_IMG_ERR_UNSUPPORTED;
+    return WY_IMG_OK;
+}
+
+/* ── Pixel helpers ───────────────────────────────────────────────── */
+static inline uint16_t _wy_rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)((r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3);
+}
+
+/* c over bg with 8-bit alpha */
+static inline uint8_t _wy_blend8(uint8_t c, uint8_t bg, uint8_t a) {
+    return (uint8_t)((c * a + bg * (255 - a)) / 255);
+}
+
+/* ══════════════════════════════════════════════════════════════════
+ * BMP
+ * ══════════════════════════════════════════════════════════════════ */
+
+/* Channel value under a bitfield mask, scaled to 8 bits */
+static inline uint8_t _wy_mask8(uint32_t v, uint32_t mask) {
+    if (!mask) return 0;
+    uint8_t shift = 0, bits = 0;
+    while (!(mask & 1)) { mask >>= 1; shift++; }
+    while (mask & 1)    { mask >>= 1; bits++; }
+    uint32_t max = (bits >= 32) ? 0xFFFFFFFFu : ((1u << bits) - 1);
+    uint32_t c   = (v >> shift) & max;
+    return bits >= 8 ? (uint8_t)(c >> (bits - 8)) : (uint8_t)(c * 255 / max);
+}
+
+static inline WyImgResult wyDecodeBMP(WyImgReadFn rd, void *rctx,
+                                      WyImgRowFn row, void *wctx) {
+    uint8_t h[70];
+    size_t n = rd(rctx, 0, h, sizeof(h));
+    if (n < 26 || h[0] != 'B' || h[1] != 'M') return WY_IMG_ERR_FORMAT;
+
+    uint32_t pixOff = (uint32_t)_wy_le32(h + 10);
+    uint32_t dib    = (uint32_t)_wy_le32(h + 14);
+    int32_t  w, hh;
+    uint16_t bpp;
+    uint32_t comp = 0, nColors = 0;
+    uint32_t rmask = 0, gmask = 0, bmask = 0;
+    uint8_t  palStride = 4;
+
+    if (dib == 12) {                        /* BITMAPCOREHEADER */
+        w = _wy_le16(h + 18); hh = _wy_le16(h + 20); bpp = _wy_le16(h + 24);
+        palStride = 3;
+    } else {
+        if (n < 54) return WY_IMG_ERR_FORMAT;
+        w = _wy_le32(h + 18); hh = _wy_le32(h + 22); bpp = _wy_le16(h + 28);
+        comp    = (uint32_t)_wy_le32(h + 30);
+        nColors = (uint32_t)_wy_le32(h + 46);
+    }
+    bool topDown = hh < 0;
+    if (hh < 0) hh = -hh;
+    if (w <= 0 || hh <= 0 || w > 0x7FFF || hh > 0x7FFF) return WY_IMG_ERR_FORMAT;
+
+    if (comp == 3 || comp == 6) {           /* BI_BITFIELDS / ALPHABITFIELDS */
+        if (n < 66) return WY_IMG_ERR_FORMAT;
+        rmask = (uint32_t)_wy_le32(h + 54);
+        gmask = (uint32_t)_wy_le32(h + 58);
+        bmask = (uint32_t)_wy_le32(h + 62);
+    } else if (comp != 0) {
+        return WY_IMG_ERR_UNSUPPORTED;      /* RLE4/RLE8/JPEG/PNG-in-BMP */
+    } else if (bpp == 16) {                 /* BI_RGB 16 bpp is X1R5G5B5 */
+        rmask = 0x7C00; gmask = 0x03E0; bmask = 0x001F;
+    }
+    if (bpp != 1 && bpp != 4 && bpp != 8 && bpp != 16 && bpp != 24 && bpp != 32)
+        return WY_IMG_ERR_UNSUPPORTED;
+    bool is565 = (bpp == 16 && rmask == 0xF800 && gmask == 0x07E0 && bmask == 0x001F);
+
+    uint32_t stride = (((uint32_t)w * bpp + 31) / 32) * 4;
+    uint8_t  *in  = (uint8_t *)malloc(stride);
+    uint16_t *out = (uint16_t *)malloc((size_t)w * 2);
+    uint16_t *pal = nullptr;
+    WyImgResult rc = WY_IMG_OK;
+    if (!in || !out) { rc = WY_IMG_ERR_NOMEM; goto done; }
+
+    if (bpp <= 8) {                         /* palette → RGB565 once */
+        uint32_t count = nColors ? nColors : (1u << bpp);
+        if (count > 256) count = 256;
+        pal = (uint16_t *)calloc(256, 2);
+        if (!pal) { rc = WY_IMG_ERR_NOMEM; goto done; }
+        uint8_t e[4];
+        for (uint32_t i = 0; i < count; i++) {
+            if (rd(rctx, 14 + dib + i * palStride, e, 3) != 3) { rc = WY_IMG_ERR_CORRUPT; goto done; }
+            pal[i] = _wy_rgb565(e[2], e[1], e[0]);
+        }
+    }
+
+    for (int32_t i = 0; i < hh; i++) {
+        if (rd(rctx, pixOff + (uint32_t)i * stride, in, stride) != stride) {
+            rc = WY_IMG_ERR_CORRUPT; break;
+        }
+        const uint8_t *p = in;
+        switch (bpp) {
+            case 24:
+                for (int32_t x = 0; x < w; x++, p += 3) out[x] = _wy_rgb565(p[2], p[1], p[0]);
+                break;
+            case 32:
+                if (comp == 0)
+                    for (int32_t x = 0; x < w; x++, p += 4) out[x] = _wy_rgb565(p[2], p[1], p[0]);
+                else
+                    for (int32_t x = 0; x < w; x++, p += 4) {
+                        uint32_t v = (uint32_t)_wy_le32(p);
+                        out[x] = _wy_rgb565(_wy_mask8(v, rmask), _wy_mask8(v, gmask), _wy_mask8(v, bmask));
+                    }
+                break;
+            case 16:
+                if (is565)
+                    for (int32_t x = 0; x < w; x++, p += 2) out[x] = _wy_le16(p);
+                else
+                    for (int32_t x = 0; x < w; x++, p += 2) {
+                        uint16_t v = _wy_le16(p);
+                        out[x] = _wy_rgb565(_wy_mask8(v, rmask), _wy_mask8(v, gmask), _wy_mask8(v, bmask));
+                    }
+                break;
+            case 8:
+                for (int32_t x = 0; x < w; x++) out[x] = pal[p[x]];
+                break;
+            case 4:
+                for (int32_t x = 0; x < w; x++) out[x] = pal[(p[x >> 1] >> ((x & 1) ? 0 : 4)) & 0x0F];
+                break;
+            case 1:
+                for (int32_t x = 0; x < w; x++) out[x] = pal[(p[x >> 3] >> (7 - (x & 7))) & 1];
+                break;
+        }
+        int16_t y = (int16_t)(topDown ? i : hh - 1 - i);
+        if (!row(wctx, y, out, (uint16_t)w)) { rc = WY_IMG_STOPPED; break; }
+    }
+
+done:
+    free(in); free(out); free(pal);
+    return rc;
+}
+
+/* ══════════════════════════════════════════════════════════════════
+ * PNG — chunk reader → inflate (windowed) → unfilter → RGB565 rows
+ * ══════════════════════════════════════════════════════════════════ */
+
+struct _WyHuff {
+    uint16_t count[16];     /* codes per bit length */
+    uint16_t sym[288];      /* symbols ordered by code */
+};
+
+struct _WyPng {
+    /* Input */
+    WyImgReadFn rd; void *rctx;
+    uint32_t off;           /* file offset of the next read */
+    uint8_t  *in; uint16_t inLen, inPos;
+    uint32_t idatLeft;      /* bytes left in the current IDAT chunk */
+    bool     err;
+    uint32_t bitbuf; uint8_t bitcnt;
+
+    /* Inflate window */
+    uint8_t  *win; uint32_t winMask; uint32_t produced;
+    _WyHuff  lit, dist;
+
+    /* Image */
+    uint16_t w, h;
+    uint8_t  depth, ctype, channels, bppBytes;
+    uint32_t stride;        /* raw bytes per row, excluding the filter byte */
+    uint8_t  *cur, *prev;   /* filter byte + stride */
+    uint32_t curPos;
+    uint16_t y;
+    uint16_t *out;
+    uint8_t  pal[256][3];
+    uint8_t  trns[256];
+    bool     hasKey; uint16_t key[3];   /* tRNS colour key (gray / RGB) */
+    uint8_t  bgR, bgG, bgB;
+
+    WyImgRowFn row; void *wctx;
+    bool     stopped;
+};
+
+/* Raw file byte (-1 at EOF) */
+static inline int _wy_png_raw(_WyPng *s) {
+    if (s->inPos >= s->inLen) {
+        size_t n = s->rd(s->rctx, s->off, s->in, WY_IMG_CHUNK);
+        if (!n) return -1;
+        s->off += n; s->inLen = (uint16_t)n; s->inPos = 0;
+    }
+    return s->in[s->inPos++];
+}
+
+static inline void _wy_png_skip(_WyPng *s, uint32_t n) {
+    uint32_t avail = s->inLen - s->inPos;
+    if (n <= avail) { s->inPos += n; return; }
+    s->off += n - avail;
+    s->inPos = s->inLen = 0;
+}
+
+static inline bool _wy_png_read(_WyPng *s, uint8_t *dst, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        int b = _wy_png_raw(s);
+        if (b < 0) return false;
+        dst[i] = (uint8_t)b;
+    }
+    return true;
+}
+
+/* Next zlib byte, crossing IDAT chunk boundaries */
+static inline int _wy_png_zbyte(_WyPng *s) {
+    while (!s->idatLeft) {
+        uint8_t ch[12];
+        /* CRC of the previous IDAT + next chunk header */
+        if (!_wy_png_read(s, ch, 12) || memcmp(ch + 8, "IDAT", 4) != 0) {
+            s->err = true;
+            return -1;
+        }
+        s->idatLeft = _wy_be32(ch + 4);
+    }
+    s->idatLeft--;
+    int b = _wy_png_raw(s);
+    if (b < 0) s->err = true;
+    return b;
+}
+
+static inline uint32_t _wy_png_bits(_WyPng *s, uint8_t n) {
+    while (s->bitcnt < n) {
+        int b = _wy_png_zbyte(s);
+        if (b < 0) b = 0;
+        s->bitbuf |= (uint32_t)b << s->bitcnt;
+        s->bitcnt += 8;
+    }
+    uint32_t v = s->bitbuf & ((1u << n) - 1);
+    s->bitbuf >>= n;
+    s->bitcnt -= n;
+    return v;
+}
+
+/* Canonical Huffman: build count/sym tables from code lengths */
+static inline bool _wy_huff_build(_WyHuff *hf, const uint8_t *lens, uint16_t n) {
+    uint16_t offs[16];
+    memset(hf->count, 0, sizeof(hf->count));
+    for (uint16_t i = 0; i < n; i++) hf->count[lens[i]]++;
+    hf->count[0] = 0;
+    int left = 1;
+    for (int len = 1; len < 16; len++) {
+        left = (left << 1) - hf->count[len];
+        if (left < 0) return false;         /* over-subscribed */
+    }
+    offs[1] = 0;
+    for (int len = 1; len < 15; len++) offs[len + 1] = offs[len] + hf->count[len];
+    for (uint16_t i = 0; i < n; i++)
+        if (lens[i]) hf->sym[offs[lens[i]]++] = i;
+    return true;
+}
+
+static inline int _wy_huff_decode(_WyPng *s, const _WyHuff *hf) {
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len < 16; len++) {
+        code |= (int)_wy_png_bits(s, 1);
+        int c = hf->count[len];
+        if (code - c < first) return hf->sym[index + (code - first)];
+        index += c;
+        first  = (first + c) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+static inline uint8_t _wy_paeth(uint8_t a, uint8_t b, uint8_t c) {
+    int p = a + b - c;
+    int pa = p > a ? p - a : a - p;
+    int pb = p > b ? p - b : b - p;
+    int pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+/* Sample x of a ≤8-bit packed row, scaled to 8 bits unless raw */
+static inline uint8_t _wy_png_sub8(const uint8_t *r, uint32_t x, uint8_t depth) {
+    if (depth == 8) return r[x];
+    uint8_t per = 8 / depth;
+    uint8_t v = (r[x / per] >> (8 - depth - (x % per) * depth)) & ((1 << depth) - 1);
+    return v;
+}
+
+/* Unfilter the completed row in s->cur and emit it */
+static inline void _wy_png_row(_WyPng *s) {
+    uint8_t *c = s->cur + 1, *p = s->prev + 1;
+    uint8_t  bpp = s->bppBytes;
+    uint32_t n = s->stride;
+    switch (s->cur[0]) {
+        case 0: break;
+        case 1: for (uint32_t i = bpp; i < n; i++) c[i] += c[i - bpp]; break;
+        case 2: for (uint32_t i = 0; i < n; i++) c[i] += p[i]; break;
+        case 3:
+            for (uint32_t i = 0; i < n; i++)
+                c[i] += (uint8_t)(((i >= bpp ? c[i - bpp] : 0) + p[i]) >> 1);
+            break;
+        case 4:
+            for (uint32_t i = 0; i < n; i++)
+                c[i] += _wy_paeth(i >= bpp ? c[i - bpp] : 0, p[i], i >= bpp ? p[i - bpp] : 0);
+            break;
+        default: s->err = true; return;
+    }
+
+    /* → RGB565 */
+    uint16_t *o = s->out;
+    uint8_t  d = s->depth;
+    uint8_t  step = d == 16 ? 2 : 1;        /* bytes per sample (≥8-bit) */
+    for (uint32_t x = 0; x < s->w; x++) {
+        uint8_t r, g, b, a = 255;
+        switch (s->ctype) {
+            case 0: {                       /* grey */
+                uint16_t raw;
+                if (d == 16) { raw = (uint16_t)(c[x * 2] << 8 | c[x * 2 + 1]); r = c[x * 2]; }
+                else         { raw = _wy_png_sub8(c, x, d); r = (uint8_t)(raw * 255 / ((1 << d) - 1)); }
+                g = b = r;
+                if (s->hasKey && raw == s->key[0]) a = 0;
+                break;
+            }
+            case 2: {                       /* RGB */
+                const uint8_t *q = c + x * 3 * step;
+                r = q[0]; g = q[step]; b = q[2 * step];
+                if (s->hasKey) {
+                    uint16_t kr = d == 16 ? (uint16_t)(q[0] << 8 | q[1]) : q[0];
+                    uint16_t kg = d == 16 ? (uint16_t)(q[2] << 8 | q[3]) : q[1];
+                    uint16_t kb = d == 16 ? (uint16_t)(q[4] << 8 | q[5]) : q[2];
+                    if (kr == s->key[0] && kg == s->key[1] && kb == s->key[2]) a = 0;
+                }
+                break;
+            }
+            case 3: {                       /* palette */
+                uint8_t i = _wy_png_sub8(c, x, d);
+                r = s->pal[i][0]; g = s->pal[i][1]; b = s->pal[i][2]; a = s->trns[i];
+                break;
+            }
+            case 4: {                       /* grey + alpha */
+                const uint8_t *q = c + x * 2 * step;
+                r = g = b = q[0]; a = q[step];
+                break;
+            }
+            default: {                      /* 6: RGBA */
+                const uint8_t *q = c + x * 4 * step;
+                r = q[0]; g = q[step]; b = q[2 * step]; a = q[3 * step];
+                break;
+            }
+        }
+        if (a != 255) {
+            r = _wy_blend8(r, s->bgR, a);
+            g = _wy_blend8(g, s->bgG, a);
+            b = _wy_blend8(b, s->bgB, a);
+        }
+        o[x] = _wy_rgb565(r, g, b);
+    }
+    if (!s->row(s->wctx, (int16_t)s->y, o, s->w)) s->stopped = true;
+    s->y++;
+    uint8_t *t = s->prev; s->prev = s->cur; s->cur = t;
+}
+
+/* One decompressed byte → window + scanline assembler */
+static inline void _wy_png_put(_WyPng *s, uint8_t v) {
+    s->win[s->produced & s->winMask] = v;
+    s->produced++;
+    s->cur[s->curPos++] = v;
+    if (s->curPos == s->stride + 1) {
+        s->curPos = 0;
+        _wy_png_row(s);
+    }
+}
+
+static inline bool _wy_png_done(_WyPng *s) {
+    return s->err || s->stopped || s->y >= s->h;
+}
+
+static inline WyImgResult _wy_png_inflate(_WyPng *s) {
+    static const uint16_t LBASE[29] = {3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,
+                                       35,43,51,59,67,83,99,115,131,163,195,227,258};
+    static const uint8_t  LEXT[29]  = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
+    static const uint16_t DBASE[30] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,
+                                       513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
+    static const uint8_t  DEXT[30]  = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
+    static const uint8_t  CLORDER[19] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
+
+    uint8_t lens[320];
+    bool last = false;
+    while (!last && !_wy_png_done(s)) {
+        last = _wy_png_bits(s, 1);
+        uint32_t type = _wy_png_bits(s, 2);
+
+        if (type == 0) {                    /* stored */
+            s->bitbuf = 0; s->bitcnt = 0;   /* align to byte */
+            int l0 = _wy_png_zbyte(s), l1 = _wy_png_zbyte(s);
+            _wy_png_zbyte(s); _wy_png_zbyte(s);          /* NLEN */
+            uint32_t len = (uint32_t)(l0 | l1 << 8);
+            while (len-- && !_wy_png_done(s)) {
+                int b = _wy_png_zbyte(s);
+                if (b < 0) break;
+                _wy_png_put(s, (uint8_t)b);
+            }
+            continue;
+        }
+
+        if (type == 1) {                    /* fixed Huffman */
+            uint16_t i = 0;
+            for (; i < 144; i++) lens[i] = 8;
+            for (; i < 256; i++) lens[i] = 9;
+            for (; i < 280; i++) lens[i] = 7;
+            for (; i < 288; i++) lens[i] = 8;
+            _wy_huff_build(&s->lit, lens, 288);
+            for (i = 0; i < 30; i++) lens[i] = 5;
+            _wy_huff_build(&s->dist, lens, 30);
+        } else if (type == 2) {             /* dynamic Huffman */
+            uint16_t hlit  = (uint16_t)_wy_png_bits(s, 5) + 257;
+            uint16_t hdist = (uint16_t)_wy_png_bits(s, 5) + 1;
+            uint16_t hclen = (uint16_t)_wy_png_bits(s, 4) + 4;
+            uint8_t  cl[19] = {0};
+            for (uint16_t i = 0; i < hclen; i++) cl[CLORDER[i]] = (uint8_t)_wy_png_bits(s, 3);
+            if (!_wy_huff_build(&s->lit, cl, 19)) return WY_IMG_ERR_CORRUPT;
+            uint16_t i = 0;
+            while (i < hlit + hdist) {
+                int sym = _wy_huff_decode(s, &s->lit);
+                if (sym < 0 || s->err) return WY_IMG_ERR_CORRUPT;
+                if (sym < 16) { lens[i++] = (uint8_t)sym; continue; }
+                uint8_t  v = 0;
+                uint32_t rep;
+                if (sym == 16) {
+                    if (!i) return WY_IMG_ERR_CORRUPT;
+                    v = lens[i - 1]; rep = 3 + _wy_png_bits(s, 2);
+                } else if (sym == 17) {
+                    rep = 3 + _wy_png_bits(s, 3);
+                } else {
+                    rep = 11 + _wy_png_bits(s, 7);
+                }
+                if (i + rep > (uint32_t)(hlit + hdist)) return WY_IMG_ERR_CORRUPT;
+                while (rep--) lens[i++] = v;
+            }
+            if (!_wy_huff_build(&s->lit, lens, hlit) ||
+                !_wy_huff_build(&s->dist, lens + hlit, hdist)) return WY_IMG_ERR_CORRUPT;
+        } else {
+            return WY_IMG_ERR_CORRUPT;
+        }
+
+        for (;;) {
+            if (_wy_png_done(s)) break;
+            int sym = _wy_huff_decode(s, &s->lit);
+            if (sym < 0 || s->err) return WY_IMG_ERR_CORRUPT;
+            if (sym < 256) { _wy_png_put(s, (uint8_t)sym); continue; }
+            if (sym == 256) break;
+            sym -= 257;
+            if (sym >= 29) return WY_IMG_ERR_CORRUPT;
+            uint32_t len = LBASE[sym] + _wy_png_bits(s, LEXT[sym]);
+            int ds = _wy_huff_decode(s, &s->dist);
+            if (ds < 0 || ds >= 30) return WY_IMG_ERR_CORRUPT;
+            uint32_t d = DBASE[ds] + _wy_png_bits(s, DEXT[ds]);
+            if (d > s->produced || d > s->winMask + 1) return WY_IMG_ERR_CORRUPT;
+            while (len-- && !_wy_png_done(s))
+                _wy_png_put(s, s->win[(s->produced - d) & s->winMask]);
+        }
+    }
+    if (s->stopped) return WY_IMG_STOPPED;
+    if (s->err || s->y < s->h) return WY_IMG_ERR_CORRUPT;
+    return WY_IMG_OK;
+}
+
+/* Parse up to the first IDAT and allocate buffers. Returns WY_IMG_OK with
+   s->in/win/cur/prev/out allocated, or an error (buffers freed by caller). */
+static inline WyImgResult _wy_png_open(_WyPng *s) {
+    uint8_t hdr[33];
+    if (!_wy_png_read(s, hdr, 33)) return WY_IMG_ERR_FORMAT;
+    if (memcmp(hdr, "\x89PNG\r\n\x1a\n", 8) != 0 || memcmp(hdr + 12, "IHDR", 4) != 0)
+        return WY_IMG_ERR_FORMAT;
+    uint32_t w = _wy_be32(hdr + 16), h = _wy_be32(hdr + 20);
+    s->depth = hdr[24]; s->ctype = hdr[25];
+    if (!w || !h || w > 0x7FFF || h > 0x7FFF) return WY_IMG_ERR_FORMAT;
+    if (hdr[26] != 0 || hdr[27] != 0) return WY_IMG_ERR_FORMAT;
+    if (hdr[28] != 0) return WY_IMG_ERR_UNSUPPORTED;    /* Adam7 */
+    s->w = (uint16_t)w; s->h = (uint16_t)h;
+
+    switch (s->ctype) {
+        case 0: s->channels = 1; break;
+        case 2: s->channels = 3; break;
+        case 3: s->channels = 1; break;
+        case 4: s->channels = 2; break;
+        case 6: s->channels = 4; break;
+        default: return WY_IMG_ERR_FORMAT;
+    }
+    uint8_t d = s->depth;
+    if (d != 1 && d != 2 && d != 4 && d != 8 && d != 16) return WY_IMG_ERR_FORMAT;
+    if ((s->ctype == 3 && d == 16) || ((s->ctype == 2 || s->ctype >= 4) && d < 8))
+        return WY_IMG_ERR_FORMAT;
+    uint32_t bitsPx = (uint32_t)s->channels * d;
+    s->bppBytes = (uint8_t)(bitsPx < 8 ? 1 : bitsPx / 8);
+    s->stride   = (w * bitsPx + 7) / 8;
+
+    memset(s->trns, 255, sizeof(s->trns));
+    for (;;) {
+        uint8_t ch[8];
+        if (!_wy_png_read(s, ch, 8)) return WY_IMG_ERR_FORMAT;
+        uint32_t len = _wy_be32(ch);
+        if (memcmp(ch + 4, "IDAT", 4) == 0) { s->idatLeft = len; break; }
+        if (memcmp(ch + 4, "IEND", 4) == 0) return WY_IMG_ERR_FORMAT;
+        if (memcmp(ch + 4, "PLTE", 4) == 0 && len <= 768) {
+            if (!_wy_png_read(s, &s->pal[0][0], len)) return WY_IMG_ERR_FORMAT;
+            _wy_png_skip(s, 4);
+        } else if (memcmp(ch + 4, "tRNS", 4) == 0 && len <= 256) {
+            uint8_t t[256];
+            if (!_wy_png_read(s, t, len)) return WY_IMG_ERR_FORMAT;
+            if (s->ctype == 3) memcpy(s->trns, t, len);
+            else if (s->ctype == 0 && len >= 2) { s->hasKey = true; s->key[0] = _wy_be16(t); }
+            else if (s->ctype == 2 && len >= 6) {
+                s->hasKey = true;
+                s->key[0] = _wy_be16(t); s->key[1] = _wy_be16(t + 2); s->key[2] = _wy_be16(t + 4);
+            }
+            _wy_png_skip(s, 4);
+        } else {
+            _wy_png_skip(s, len + 4);       /* ancillary chunk + CRC */
+        }
+    }
+
+    /* zlib header → window size */
+    int cmf = _wy_png_zbyte(s), flg = _wy_png_zbyte(s);
+    if (cmf < 0 || flg < 0 || (cmf & 0x0F) != 8 || (cmf >> 4) > 7 ||
+        ((cmf << 8) | flg) % 31 != 0 || (flg & 0x20)) return WY_IMG_ERR_CORRUPT;
+    uint32_t winSize = 1u << ((cmf >> 4) + 8);
+    s->winMask = winSize - 1;
+
+    s->win  = (uint8_t *)malloc(winSize);
+    s->cur  = (uint8_t *)calloc(1, s->stride + 1);
+    s->prev = (uint8_t *)calloc(1, s->stride + 1);
+    s->out  = (uint16_t *)malloc((size_t)w * 2);
+    if (!s->win || !s->cur || !s->prev || !s->out) return WY_IMG_ERR_NOMEM;
+    return WY_IMG_OK;
+}
+
+static inline void _wy_png_free(_WyPng *s) {
+    free(s->in); free(s->win); free(s->cur); free(s->prev); free(s->out);
+    free(s);
+}
+
+static inline _WyPng *_wy_png_new(WyImgReadFn rd, void *rctx) {
+    _WyPng *s = (_WyPng *)calloc(1, sizeof(_WyPng));
+    if (!s) return nullptr;
+    s->in = (uint8_t *)malloc(WY_IMG_CHUNK);
+    if (!s->in) { free(s); return nullptr; }
+    s->rd = rd; s->rctx = rctx;
+    return s;
+}
+
+/* Decode a PNG, alpha-blended over bg (RGB565) */
+static inline WyImgResult wyDecodePNG(WyImgReadFn rd, void *rctx,
+                                      WyImgRowFn row, void *wctx,
+                                      uint16_t bg = 0x0000) {
+    _WyPng *s = _wy_png_new(rd, rctx);
+    if (!s) return WY_IMG_ERR_NOMEM;
+    s->row = row; s->wctx = wctx;
+    uint8_t r5 = bg >> 11, g6 = (bg >> 5) & 0x3F, b5 = bg & 0x1F;
+    s->bgR = (uint8_t)(r5 << 3 | r5 >> 2);
+    s->bgG = (uint8_t)(g6 << 2 | g6 >> 4);
+    s->bgB = (uint8_t)(b5 << 3 | b5 >> 2);
+    WyImgResult rc = _wy_png_open(s);
+    if (rc == WY_IMG_OK) rc = _wy_png_inflate(s);
+    _wy_png_free(s);
+    return rc;
+}
+
+/* Heap the streaming PNG decoder will need for this file (0 = can't stream) */
+static inline size_t wyDecodePNGMemory(WyImgReadFn rd, void *rctx) {
+    _WyPng *s = _wy_png_new(rd, rctx);
+    if (!s) return 0;
+    size_t total = 0;
+    if (_wy_png_open(s) == WY_IMG_OK)
+        total = sizeof(_WyPng) + WY_IMG_CHUNK + (s->winMask + 1) +
+                2 * (s->stride + 1) + (size_t)s->w * 2;
+    _wy_png_free(s);
+    return total;
+}
@@ -0,0 +1,357 @@
+/*
+ * WyKeyCanvas.h — Off-screen keycap canvases and a round-robin flusher
+ * =====================================================================
+ * The platform-free half of WyKeyDisplay. Each keycap gets an 8bpp
+ * canvas (16 KB at 128×128 instead of 32 KB) with its own 256-colour
+ * palette; drawing only touches RAM and records damage. WyKeyFlush then
+ * pushes the damage to the panels over the shared bus:
+ *
+ *   - round-robin over the keys, one CS switch per key with damage
+ *   - only the damaged rects (WyDamage), in chunks of WY_KDISP_CHUNK px
+ *   - two chunk buffers: the next chunk is converted (palette → RGB565)
+ *     while the bus still sends the previous one, so an asynchronous
+ *     (DMA) bus overlaps the two; a blocking bus just runs them in turn
+ *   - poll() does a bounded slice of work, so loop() never stalls on a
+ *     full update of all four keys
+ *
+ * setLabel() / setMetric() remember what they drew and repaint only the
+ * text that changed — a new value clears and redraws its own box, not
+ * the whole 128×128 cap.
+ *
+ * Text uses the classic 5×7 GFX font (built in — the canvas has no
+ * Arduino_GFX behind it). Palette overflow (> 256 colours on one key)
+ * maps to the nearest colour already in the palette.
+ *
+ * Pure C++ — host tests drive it with a simulated bus.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ui/WyUICore.h"
+
+#ifndef WY_KDISP_CHUNK
+#define WY_KDISP_CHUNK  2048          /* px per bus write (16 rows of 128) */
+#endif
+#ifndef WY_KDISP_TEXT
+#define WY_KDISP_TEXT   16            /* label / value length incl. NUL */
+#endif
+
+/* ── 5×7 font, ASCII 32..126, one byte per column (bit 0 = top row) ── */
+static const uint8_t WY_FONT5X7[95 * 5] = {
+    0x00,0x00,0x00,0x00,0x00, 0x00,0x00,0x5F,0x00,0x00, 0x00,0x07,0x00,0x07,0x00, 0x14,0x7F,0x14,0x7F,0x14,  /*   ! " # */
+    0x24,0x2A,0x7F,0x2A,0x12, 0x23,0x13,0x08,0x64,0x62, 0x36,0x49,0x56,0x20,0x50, 0x00,0x08,0x07,0x03,0x00,  /* $ % & ' */
+    0x00,0x1C,0x22,0x41,0x00, 0x00,0x41,0x22,0x1C,0x00, 0x2A,0x1C,0x7F,0x1C,0x2A, 0x08,0x08,0x3E,0x08,0x08,  /* ( ) * + */
+    0x00,0x80,0x70,0x30,0x00, 0x08,0x08,0x08,0x08,0x08, 0x00,0x00,0x60,0x60,0x00, 0x20,0x10,0x08,0x04,0x02,  /* , - . / */
+    0x3E,0x51,0x49,0x45,0x3E, 0x00,0x42,0x7F,0x40,0x00, 0x72,0x49,0x49,0x49,0x46, 0x21,0x41,0x49,0x4D,0x33,  /* 0 1 2 3 */
+    0x18,0x14,0x12,0x7F,0x10, 0x27,0x45,0x45,0x45,0x39, 0x3C,0x4A,0x49,0x49,0x31, 0x41,0x21,0x11,0x09,0x07,  /* 4 5 6 7 */
+    0x36,0x49,0x49,0x49,0x36, 0x46,0x49,0x49,0x29,0x1E, 0x00,0x00,0x14,0x00,0x00, 0x00,0x40,0x34,0x00,0x00,  /* 8 9 : ; */
+    0x00,0x08,0x14,0x22,0x41, 0x14,0x14,0x14,0x14,0x14, 0x00,0x41,0x22,0x14,0x08, 0x02,0x01,0x59,0x09,0x06,  /* < = > ? */
+    0x3E,0x41,0x5D,0x59,0x4E, 0x7C,0x12,0x11,0x12,0x7C, 0x7F,0x49,0x49,0x49,0x36, 0x3E,0x41,0x41,0x41,0x22,  /* @ A B C */
+    0x7F,0x41,0x41,0x41,0x3E, 0x7F,0x49,0x49,0x49,0x41, 0x7F,0x09,0x09,0x09,0x01, 0x3E,0x41,0x41,0x51,0x73,  /* D E F G */
+    0x7F,0x08,0x08,0x08,0x7F, 0x00,0x41,0x7F,0x41,0x00, 0x20,0x40,0x41,0x3F,0x01, 0x7F,0x08,0x14,0x22,0x41,  /* H I J K */
+    0x7F,0x40,0x40,0x40,0x40, 0x7F,0x02,0x1C,0x02,0x7F, 0x7F,0x04,0x08,0x10,0x7F, 0x3E,0x41,0x41,0x41,0x3E,  /* L M N O */
+    0x7F,0x09,0x09,0x09,0x06, 0x3E,0x41,0x51,0x21,0x5E, 0x7F,0x09,0x19,0x29,0x46, 0x26,0x49,0x49,0x49,0x32,  /* P Q R S */
+    0x03,0x01,0x7F,0x01,0x03, 0x3F,0x40,0x40,0x40,0x3F, 0x1F,0x20,0x40,0x20,0x1F, 0x3F,0x40,0x38,0x40,0x3F,  /* T U V W */
+    0x63,0x14,0x08,0x14,0x63, 0x03,0x04,0x78,0x04,0x03, 0x61,0x59,0x49,0x4D,0x43, 0x00,0x7F,0x41,0x41,0x41,  /* X Y Z [ */
+    0x02,0x04,0x08,0x10,0x20, 0x00,0x41,0x41,0x41,0x7F, 0x04,0x02,0x01,0x02,0x04, 0x40,0x40,0x40,0x40,0x40,  /* \ ] ^ _ */
+    0x00,0x03,0x07,0x08,0x00, 0x20,0x54,0x54,0x78,0x40, 0x7F,0x28,0x44,0x44,0x38, 0x38,0x44,0x44,0x44,0x28,  /* ` a b c */
+    0x38,0x44,0x44,0x28,0x7F, 0x38,0x54,0x54,0x54,0x18, 0x00,0x08,0x7E,0x09,0x02, 0x18,0xA4,0xA4,0x9C,0x78,  /* d e f g */
+    0x7F,0x08,0x04,0x04,0x78, 0x00,0x44,0x7D,0x40,0x00, 0x20,0x40,0x40,0x3D,0x00, 0x7F,0x10,0x28,0x44,0x00,  /* h i j k */
+    0x00,0x41,0x7F,0x40,0x00, 0x7C,0x04,0x78,0x04,0x78, 0x7C,0x08,0x04,0x04,0x78, 0x38,0x44,0x44,0x44,0x38,  /* l m n o */
+    0xFC,0x18,0x24,0x24,0x18, 0x18,0x24,0x24,0x18,0xFC, 0x7C,0x08,0x04,0x04,0x08, 0x48,0x54,0x54,0x54,0x24,  /* p q r s */
+    0x04,0x04,0x3F,0x44,0x24, 0x3C,0x40,0x40,0x20,0x7C, 0x1C,0x20,0x40,0x20,0x1C, 0x3C,0x40,0x30,0x40,0x3C,  /* t u v w */
+    0x44,0x28,0x10,0x28,0x44, 0x4C,0x90,0x90,0x90,0x7C, 0x44,0x64,0x54,0x4C,0x44, 0x00,0x08,0x36,0x41,0x00,  /* x y z { */
+    0x00,0x00,0x77,0x00,0x00, 0x00,0x41,0x36,0x08,0x00, 0x02,0x01,0x02,0x04,0x02,                            /* | } ~   */
+};
+
+/* ══════════════════════════════════════════════════════════════════
+ * WyKeyCanvas — 8bpp palette canvas for one keycap
+ * ══════════════════════════════════════════════════════════════════ */
+class WyKeyCanvas : public WyPainter {
+public:
+    WyKeyCanvas(uint16_t w, uint16_t h) : WyPainter(w, h) {
+        _px = (uint8_t *)calloc((size_t)w * h, 1);
+        if (!_px) resize(0, 0);
+        _pal[0] = 0x0000;                     /* calloc'd pixels are index 0 = black */
+        _npal = 1;
+    }
+    ~WyKeyCanvas() { free(_px); }
+    WyKeyCanvas(const WyKeyCanvas &) = delete;
+    WyKeyCanvas &operator=(const WyKeyCanvas &) = delete;
+
+    bool ok() const { return _px != nullptr; }
+    const uint8_t  *indices() const { return _px; }
+    const uint16_t *palette() const { return _pal; }
+    uint16_t paletteSize() const { return _npal; }
+    uint16_t at(int16_t x, int16_t y) const { return _pal[_px[(size_t)y * _w + x]]; }
+
+    /* Palette slot for an RGB565 colour: added on first use, nearest
+       existing colour once all 256 are taken */
+    uint8_t colourIndex(uint16_t c) {
+        if (c == _lastC && _npal) return _lastI;
+        int i = 0;
+        while (i < _npal && _pal[i] != c) i++;
+        if (i == _npal) {
+            if (_npal < 256) _pal[_npal++] = c;
+            else             i = _nearest(c);
+        }
+        _lastC = c;
+        _lastI = (uint8_t)i;
+        return (uint8_t)i;
+    }
+
+    /* Damage not yet flushed */
+    WyDamage &dirty() { return _dirty; }
+    void markAll() { _dirty.add(WyRect{ 0, 0, (int16_t)_w, (int16_t)_h }); }
+
+    /* ── Keycap content ──────────────────────────────────────────── */
+    /* Centred text. Same bg as last time: only the text box changes */
+    void setLabel(const char *text, uint16_t fg, uint16_t bg, uint8_t size = 2) {
+        if (_mode != MODE_LABEL || bg != _bg) _reset(MODE_LABEL, bg);
+        _setText(_main, text, fg, size, (int16_t)((_h - wyTextHeight(size)) / 2));
+    }
+
+    /* Small label at the top, large value below — the value drops to
+       size 2 / 1 when it doesn't fit */
+    void setMetric(const char *label, const char *value, uint16_t labelCol, uint16_t valueCol, uint16_t bg) {
+        if (_mode != MODE_METRIC || bg != _bg) _reset(MODE_METRIC, bg);
+        _setText(_top, label, labelCol, 1, 28);
+        uint8_t size = 3;
+        while (size > 1 && wyTextWidth(value, size) > _w - 4) size--;
+        _setText(_main, value, valueCol, size, 62);
+    }
+
+protected:
+    enum { MODE_NONE, MODE_LABEL, MODE_METRIC };
+
+    /* One line of text as drawn: for clearing it when it changes */
+    struct Line {
+        char     text[WY_KDISP_TEXT];
+        uint16_t col;
+        uint8_t  size;
+        WyRect   box;
+    };
+
+    uint8_t  *_px = nullptr;
+    uint16_t  _pal[256];
+    uint16_t  _npal = 0;
+    uint16_t  _lastC = 0;
+    uint8_t   _lastI = 0;
+    WyDamage  _dirty;
+
+    uint8_t   _mode = MODE_NONE;
+    uint16_t  _bg = 0;
+    Line      _top = {}, _main = {};
+
+    void _reset(uint8_t mode, uint16_t bg) {
+        _mode = mode;
+        _bg   = bg;
+        _top  = Line{};
+        _main = Line{};
+        fillRect(0, 0, (int16_t)_w, (int16_t)_h, bg);
+    }
+
+    void _setText(Line &l, const char *s, uint16_t col, uint8_t size, int16_t y) {
+        char t[WY_KDISP_TEXT];
+        strncpy(t, s ? s : "", sizeof(t) - 1);
+        t[sizeof(t) - 1] = '\0';
+        if (!strcmp(t, l.text) && col == l.col && size == l.size) return;
+        WyRect box = { (int16_t)((_w - wyTextWidth(t, size)) / 2), y, wyTextWidth(t, size), wyTextHeight(size) };
+        WyRect clr = box.unite(l.box);
+        if (!clr.empty()) fillRect(clr.x, clr.y, clr.w, clr.h, _bg);
+        text(box.x, box.y, t, size, col);
+        memcpy(l.text, t, sizeof(t));
+        l.col  = col;
+        l.size = size;
+        l.box  = box;
+    }
+
+    int _nearest(uint16_t c) const {
+        int r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F, best = 0;
+        int32_t bestD = INT32_MAX;
+        for (int i = 0; i < _npal; i++) {
+            int dr = (r - (_pal[i] >> 11)) * 2, dg = g - ((_pal[i] >> 5) & 0x3F), db = (b - (_pal[i] & 0x1F)) * 2;
+            int32_t d = dr * dr + dg * dg + db * db;
+            if (d < bestD) { bestD = d; best = i; }
+        }
+        return best;
+    }
+
+    void _fill(const WyRect &r, uint16_t c) override {
+        uint8_t i = colourIndex(c);
+        for (int16_t y = r.y; y < r.bottom(); y++) memset(_px + (size_t)y * _w + r.x, i, r.w);
+        _dirty.add(r);
+    }
+
+    void _text(int16_t x, int16_t y, const char *s, uint8_t size, uint16_t fg) override {
+        uint8_t i = colourIndex(fg);
+        WyRect box = WyRect{ x, y, wyTextWidth(s, size), wyTextHeight(size) }.intersect(_clip);
+        for (; *s; s++, x = (int16_t)(x + WY_UI_CHAR_W * size)) {
+            uint8_t ch = (uint8_t)*s;
+            if (ch <= ' ' || ch > '~') continue;
+            const uint8_t *g = WY_FONT5X7 + (ch - ' ') * 5;
+            for (int cx = 0; cx < 5; cx++)
+                for (int cy = 0; cy < 8; cy++) {
+                    if (!(g[cx] >> cy & 1)) continue;
+                    WyRect d = WyRect{ (int16_t)(x + cx * size), (int16_t)(y + cy * size), size, size }.intersect(box);
+                    for (int16_t py = d.y; py < d.bottom(); py++) memset(_px + (size_t)py * _w + d.x, i, d.w);
+                }
+        }
+        _dirty.add(box);
+    }
+
+    void _blit(const WyRect &r, const uint16_t *px, uint16_t stride) override {
+        for (int16_t y = 0; y < r.h; y++) {
+            uint8_t *row = _px + (size_t)(r.y + y) * _w + r.x;
+            for (int16_t x = 0; x < r.w; x++) row[x] = colourIndex(px[(size_t)y * stride + x]);
+        }
+        _dirty.add(r);
+    }
+};
+
+/* ══════════════════════════════════════════════════════════════════
+ * WyKeyFlush — push canvas damage to the panels, round-robin
+ * ══════════════════════════════════════════════════════════════════ */
+
+/* The shared bus. write() may return before the transfer is done (DMA);
+   wait() blocks until it is. A blocking bus leaves wait() empty. */
+class WyKeyBus {
+public:
+    virtual ~WyKeyBus() {}
+    virtual void select(uint8_t key) = 0;                      /* CS of this key low, the rest high */
+    virtual void write(const WyRect &r, const uint16_t *px) = 0;   /* r.w × r.h px, row-major */
+    virtual void wait() {}
+};
+
+class WyKeyFlush {
+public:
+    uint32_t pixels = 0, chunks = 0, selects = 0;     /* totals, for tuning */
+
+    ~WyKeyFlush() { free(_buf[0]); free(_buf[1]); }
+
+    /* swap = send big-endian pixels (raw SPI DMA); free in the palette step */
+    bool begin(WyKeyBus *bus, WyKeyCanvas *const *keys, uint8_t n, uint32_t chunkPx = WY_KDISP_CHUNK,
+               bool swap = false) {
+        free(_buf[0]);
+        free(_buf[1]);
+        for (uint8_t i = 0; i < n && i < 8; i++)     /* a chunk holds at least one full row */
+            if (keys[i]->width() > chunkPx) chunkPx = keys[i]->width();
+        _buf[0] = (uint16_t *)malloc(chunkPx * 2);
+        _buf[1] = (uint16_t *)malloc(chunkPx * 2);
+        if (!_buf[0] || !_buf[1] || !bus || n > 8) {
+            free(_buf[0]); free(_buf[1]);
+            _buf[0] = _buf[1] = nullptr;
+            return false;
+        }
+        _bus = bus;
+        _n = n;
+        for (uint8_t i = 0; i < n; i++) _keys[i] = keys[i];
+        _chunk = chunkPx;
+        _swap = swap;
+        _key = -1;
+        _last = (int8_t)(n - 1);
+        _sel = -1;
+        return true;
+    }
+
+    /*
+     * Send at least one chunk and up to budgetPx pixels, then return.
+     * True while damage is left. Call from loop(); flush() to finish.
+     */
+    bool poll(uint32_t budgetPx = WY_KDISP_CHUNK) {
+        if (!_bus) return false;
+        uint32_t sent = 0;
+        do {
+            if (_key < 0 && !_nextJob()) return false;
+            sent += _step();
+        } while (sent < budgetPx);
+        return !idle();
+    }
+    void flush() {
+        while (poll(UINT32_MAX)) {}
+        if (_bus) _bus->wait();
+    }
+    bool idle() const {
+        if (_key >= 0) return false;
+        for (uint8_t i = 0; i < _n; i++)
+            if (!_keys[i]->dirty().empty()) return false;
+        return true;
+    }
+
+    /* Someone else drove CS (direct drawing): select again next time */
+    void reselect() {
+        if (_bus) _bus->wait();
+        _sel = -1;
+    }
+
+private:
+    WyKeyBus    *_bus = nullptr;
+    WyKeyCanvas *_keys[8] = {};
+    uint8_t      _n = 0;
+    uint16_t    *_buf[2] = { nullptr, nullptr };
+    uint8_t      _cur = 0;
+    uint32_t     _chunk = 0;
+    bool         _swap = false;
+
+    int8_t   _key = -1, _last = 0, _sel = -1;  /* job key, last served, key with CS low */
+    WyRect   _rects[WY_UI_DAMAGE_MAX];
+    uint8_t  _nr = 0, _ri = 0;
+    int16_t  _row = 0;                          /* next row inside _rects[_ri] */
+
+    /* Next key after the last one served that has damage: take it all */
+    bool _nextJob() {
+        for (uint8_t i = 1; i <= _n; i++) {
+            uint8_t k = (uint8_t)((_last + i) % _n);
+            WyDamage &d = _keys[k]->dirty();
+            if (d.empty()) continue;
+            _nr = d.count();
+            for (uint8_t j = 0; j < _nr; j++) _rects[j] = d[j];
+            d.clear();                 /* drawing from now on is the next job's */
+            _key = (int8_t)k;
+            _last = (int8_t)k;
+            _ri = 0;
+            _row = 0;
+            return true;
+        }
+        return false;
+    }
+
+    /* Convert one chunk while the previous one is on the bus, then send */
+    uint32_t _step() {
+        const WyKeyCanvas &c = *_keys[_key];
+        const WyRect &r = _rects[_ri];
+        int16_t rows = (int16_t)(_chunk / (uint32_t)r.w);
+        if (rows < 1) rows = 1;
+        if (rows > r.h - _row) rows = (int16_t)(r.h - _row);
+        WyRect part = { r.x, (int16_t)(r.y + _row), r.w, rows };
+
+        uint16_t *out = _buf[_cur];
+        const uint16_t *pal = c.palette();
+        for (int16_t y = 0; y < rows; y++) {
+            const uint8_t *src = c.indices() + (size_t)(part.y + y) * c.width() + part.x;
+            if (_swap) for (int16_t x = 0; x < part.w; x++) { uint16_t v = pal[src[x]]; *out++ = (uint16_t)(v >> 8 | v << 8); }
+            else       for (int16_t x = 0; x < part.w; x++) *out++ = pal[src[x]];
+        }
+
+        _bus->wait();                                   /* the other buffer is free, CS may switch */
+        if (_sel != _key) {
+            _bus->select((uint8_t)_key);
+            _sel = _key;
+            selects++;
+        }
+        _bus->write(part, _buf[_cur]);
+        _cur ^= 1;
+        uint32_t n = (uint32_t)part.w * rows;
+        pixels += n;
+        chunks++;
+
+        _row = (int16_t)(_row + rows);
+        if (_row >= r.h) {
+            _row = 0;
+            if (++_ri >= _nr) _key = -1;
+        }
+        return n;
+    }
+};
@@ -11,6 +11,16 @@
  *   - All 4 share the same Arduino_GFX instance; caller selects
  *     which display receives the data before each draw call
  *
+ * Buffered drawing (WyKeyCanvas.h), opt-in with begin(true):
+ *   Each key gets an 8bpp off-screen canvas (16 KB, own palette).
+ *   setLabel() / setMetric() / key(i) draw into RAM and only repaint
+ *   the text that changed; update() from loop() then flushes the
+ *   damaged rects, key by key, a chunk at a time — no call blocks for
+ *   a whole 32 KB cap. select() / selectAll() flush what's pending
+ *   first, so direct gfx drawing lands on top; later canvas edits
+ *   repaint only their own rects. begin() alone, or no RAM for the
+ *   canvases, draws straight to the panels as before.
+ *
  * CS pins: CS1=12, CS2=13, CS3=14, CS4=21
  * Key pins: KEY1=10, KEY2=9, KEY3=46, KEY4=3
  *
@@ -31,6 +41,11 @@
  *   keys.selectAll();                  // broadcast to all 4
  *   keys.gfx->fillScreen(WY_BLACK);   // clear all at once
  *
+ *   // Buffered: keys.begin(true) instead, then
+ *   keys.setMetric(1, "PEERS", "21");  // RAM only
+ *   keys.key(3)->fillRect(0, 120, 128, 8, WY_RED);   // any WyPainter call
+ *   void loop() { keys.update(); }     // flush a slice of the damage
+ *
  * Key layout (USB-C at bottom):
  *   [0/KEY1] [1/KEY2]
  *   [2/KEY3] [3/KEY4]
@@ -52,6 +67,8 @@
 
 #include <Arduino.h>
 #include <Arduino_GFX_Library.h>
+#include <new>
+#include "WyKeyCanvas.h"
 
 /* ── Colours (shared with WyDisplay.h) ─────────────────────────── */
 #ifndef WY_BLACK
@@ -79,7 +96,8 @@ public:
     uint16_t width  = WY_KDISP_W;
     uint16_t height = WY_KDISP_H;
 
-    void begin() {
+    /* buffered: 4 × 16 KB off-screen canvases + update(); false = direct */
+    void begin(bool buffered = false) {
         /* Init CS pins as outputs, all HIGH (deselected) */
         for (int i = 0; i < WY_KDISP_NUM; i++) {
             pinMode(_cs[i], OUTPUT);
@@ -123,10 +141,39 @@ public:
         ledcSetup(WY_KDISP_BL_CHAN, 2000, 8);
         ledcAttachPin(WY_KDISP_BL, WY_KDISP_BL_CHAN);
         ledcWrite(WY_KDISP_BL_CHAN, 255);
+
+        if (!buffered) return;
+
+        /* Canvases start black and clean, like the panels */
+        bool ok = true;
+        for (int i = 0; i < WY_KDISP_NUM; i++) {
+            _canvas[i] = new (std::nothrow) WyKeyCanvas(WY_KDISP_W, WY_KDISP_H);
+            ok = ok && _canvas[i] && _canvas[i]->ok();
+        }
+        _bus.owner = this;
+        if (ok) ok = _flush.begin(&_bus, _canvas, WY_KDISP_NUM);
+        if (!ok) {
+            Serial.printf("[WyKeyDisplay] no RAM for key canvases — drawing direct\n");
+            for (int i = 0; i < WY_KDISP_NUM; i++) { delete _canvas[i]; _canvas[i] = nullptr; }
+        }
     }
 
-    /* Select one display (0–3). Deselects all others. */
+    /* Off-screen canvas of one key (nullptr when drawing direct).
+       Draw with the WyPainter calls; update() sends the damage. */
+    WyKeyCanvas *key(uint8_t idx) { return idx < WY_KDISP_NUM ? _canvas[idx] : nullptr; }
+
+    /* Flush up to budgetPx damaged pixels (at least one chunk), round-
+       robin over the keys. True while more is pending — call every loop(). */
+    bool update(uint32_t budgetPx = WY_KDISP_CHUNK) { return _canvas[0] && _flush.poll(budgetPx); }
+    /* Flush everything now */
+    void flush() { if (_canvas[0]) _flush.flush(); }
+    bool idle() const { return !_canvas[0] || _flush.idle(); }
+
+    /* Select one display (0–3). Deselects all others.
+       Buffered: pending canvas damage goes out first. */
     void select(uint8_t idx) {
+        flush();
+        _flush.reselect();
         for (int i = 0; i < WY_KDISP_NUM; i++) {
             digitalWrite(_cs[i], (i == idx) ? LOW : HIGH);
         }
@@ -134,6 +181,8 @@ public:
 
     /* Select all displays — next draw call hits all 4 simultaneously */
     void selectAll() {
+        flush();
+        _flush.reselect();
         for (int i = 0; i < WY_KDISP_NUM; i++) {
             digitalWrite(_cs[i], LOW);
         }
@@ -141,6 +190,7 @@ public:
 
     /* Deselect all */
     void deselect() {
+        _flush.reselect();
         for (int i = 0; i < WY_KDISP_NUM; i++) {
             digitalWrite(_cs[i], HIGH);
         }
@@ -152,10 +202,15 @@ public:
     }
 
     /* ── Convenience helpers ──────────────────────────────────────
-     * Each helper selects the target key, draws, then deselects.   */
+     * Buffered: draw into the canvases, update() sends them.
+     * Direct (no canvases): select the target key, draw, deselect. */
 
     /* Fill all 4 keys with one colour */
     void fillAll(uint16_t colour) {
+        if (_canvas[0]) {
+            for (int i = 0; i < WY_KDISP_NUM; i++) _canvas[i]->fillRect(0, 0, WY_KDISP_W, WY_KDISP_H, colour);
+            return;
+        }
         selectAll();
         gfx->fillScreen(colour);
         deselect();
@@ -166,6 +221,7 @@ public:
                   uint16_t fg = WY_WHITE, uint16_t bg = WY_BLACK,
                   uint8_t textSize = 2) {
         if (idx >= WY_KDISP_NUM) return;
+        if (_canvas[idx]) { _canvas[idx]->setLabel(text, fg, bg, textSize); return; }
         select(idx);
         gfx->fillScreen(bg);
         gfx->setTextColor(fg);
@@ -182,6 +238,7 @@ public:
                    uint16_t labelCol = WY_GRAY, uint16_t valueCol = WY_CYAN,
                    uint16_t bg = WY_BLACK) {
         if (idx >= WY_KDISP_NUM) return;
+        if (_canvas[idx]) { _canvas[idx]->setMetric(label, value, labelCol, valueCol, bg); return; }
         select(idx);
         gfx->fillScreen(bg);
         /* Label — small, upper area */
@@ -216,9 +273,25 @@ public:
     }
 
 private:
+    /* Arduino_ESP32SPI has no async write, so write() blocks and wait()
+       is a no-op here; the chunk conversion still runs between writes
+       rather than inside one big fillScreen/print. */
+    struct GfxBus : WyKeyBus {
+        WyKeyDisplay *owner = nullptr;
+        void select(uint8_t key) override {
+            for (int i = 0; i < WY_KDISP_NUM; i++) digitalWrite(owner->_cs[i], (i == key) ? LOW : HIGH);
+        }
+        void write(const WyRect &r, const uint16_t *px) override {
+            owner->gfx->draw16bitRGBBitmap(r.x, r.y, (uint16_t *)px, r.w, r.h);
+        }
+    };
+
     const int8_t _cs[WY_KDISP_NUM]     = { WY_KDISP_CS0, WY_KDISP_CS1,
                                              WY_KDISP_CS2, WY_KDISP_CS3 };
     const int8_t _keyPin[WY_KDISP_NUM] = { WY_KEY1, WY_KEY2, WY_KEY3, WY_KEY4 };
+    WyKeyCanvas *_canvas[WY_KDISP_NUM] = {};
+    WyKeyFlush   _flush;
+    GfxBus       _bus;
 };
 
 #else
@@ -227,7 +300,7 @@ class WyKeyDisplay {
 public:
     void *gfx = nullptr;
     uint16_t width = 0, height = 0;
-    void begin() {}
+    void begin(bool = false) {}
     void select(uint8_t) {}
     void selectAll() {}
     void deselect() {}
@@ -235,6 +308,10 @@ public:
     void fillAll(uint16_t) {}
     void setLabel(uint8_t, const char*, uint16_t=0, uint16_t=0, uint8_t=2) {}
     void setMetric(uint8_t, const char*, const char*, uint16_t=0, uint16_t=0, uint16_t=0) {}
+    void *key(uint8_t) { return nullptr; }
+    bool update(uint32_t = 0) { return false; }
+    void flush() {}
+    bool idle() const { return true; }
     bool keyPressed(uint8_t) { return false; }
     void attachKeyInterrupt(uint8_t, void(*)(), int=1) {}
 };
@@ -0,0 +1,148 @@
+/*
+ * WyPixel.h — pixel format conversion kernels
+ * =============================================
+ * RGB565 → RGB888, RGB565 byte swap, RGB565 → 8-bit grey and
+ * YUV422 (YUYV) → RGB565, for screenshot encoding and camera previews.
+ * Pure C++ — runs in host tests.
+ *
+ * Each kernel has a SWAR path: two RGB565 pixels sit in one 32-bit word,
+ * so one shift/mask works on both at once (16-bit lanes, no carries
+ * between them), loads and stores are whole words, and the scalar loop
+ * only mops up the last 1–3 pixels. The scalar _wy_px_*() versions are
+ * the reference the tests compare against.
+ *
+ * Usage:
+ *   wyRGB565toRGB888(strip, rgb, w * 16);        // JPEG encoder input
+ *   wyRGB565Swap(fb->buf, fb->buf, n);           // esp32-camera RGB565 is big-endian
+ *   wyYUV422toRGB565(fb->buf, line, w);          // camera YUYV → draw16bitRGBBitmap
+ *   wyRGB565toGray(line, luma, w);               // motion / blob detection
+ *
+ * Buffers need no alignment. wyRGB565Swap may run in place.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifndef WY_PIXEL_SWAR
+  #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    #define WY_PIXEL_SWAR 1           /* lanes assume pixel 0 in the low half */
+  #else
+    #define WY_PIXEL_SWAR 0
+  #endif
+#endif
+
+/* ── Scalar reference ─────────────────────────────────────────────── */
+static inline void _wy_px_rgb888(const uint16_t *src, uint8_t *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint16_t c = src[i];
+        uint8_t r = (uint8_t)(c >> 11), g = (uint8_t)((c >> 5) & 0x3F), b = (uint8_t)(c & 0x1F);
+        *dst++ = (uint8_t)((r << 3) | (r >> 2));
+        *dst++ = (uint8_t)((g << 2) | (g >> 4));
+        *dst++ = (uint8_t)((b << 3) | (b >> 2));
+    }
+}
+
+static inline void _wy_px_swap(const uint16_t *src, uint16_t *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = (uint16_t)((src[i] >> 8) | (src[i] << 8));
+}
+
+/* BT.601 luma, (77 R + 150 G + 29 B) >> 8 on 8-bit expanded channels */
+static inline void _wy_px_gray(const uint16_t *src, uint8_t *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint16_t c = src[i];
+        uint32_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        r = (r << 3) | (r >> 2); g = (g << 2) | (g >> 4); b = (b << 3) | (b >> 2);
+        dst[i] = (uint8_t)((77 * r + 150 * g + 29 * b) >> 8);
+    }
+}
+
+static inline uint8_t _wy_px_clamp(int32_t v) { return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v); }
+
+static inline uint16_t _wy_px_yuv(int32_t y, int32_t rv, int32_t guv, int32_t bu) {
+    uint8_t r = _wy_px_clamp(y + rv), g = _wy_px_clamp(y - guv), b = _wy_px_clamp(y + bu);
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+/* YUYV (Y0 U Y1 V per pixel pair), BT.601 full range, 8.8 fixed point */
+static inline void _wy_px_yuv422(const uint8_t *src, uint16_t *dst, size_t n) {
+    for (size_t i = 0; i < n; i += 2, src += 4) {
+        int32_t d = src[1] - 128, e = i + 1 < n ? src[3] - 128 : 0;    /* odd n: no V byte */
+        int32_t rv = (359 * e) >> 8, guv = (88 * d + 183 * e) >> 8, bu = (454 * d) >> 8;
+        dst[i] = _wy_px_yuv(src[0], rv, guv, bu);
+        if (i + 1 < n) dst[i + 1] = _wy_px_yuv(src[2], rv, guv, bu);
+    }
+}
+
+/* ── SWAR kernels ─────────────────────────────────────────────────── */
+static inline uint32_t _wy_ld32(const void *p) { uint32_t v; memcpy(&v, p, 4); return v; }
+static inline void     _wy_st32(void *p, uint32_t v) { memcpy(p, &v, 4); }
+
+/* Both pixels of w expanded to 8-bit R, G, B, one per 16-bit lane */
+static inline void _wy_px_lanes(uint32_t w, uint32_t &r, uint32_t &g, uint32_t &b) {
+    r = (w >> 11) & 0x001F001F; r = ((r << 3) | (r >> 2)) & 0x00FF00FF;
+    g = (w >> 5)  & 0x003F003F; g = ((g << 2) | (g >> 4)) & 0x00FF00FF;
+    b =  w        & 0x001F001F; b = ((b << 3) | (b >> 2)) & 0x00FF00FF;
+}
+
+/* n pixels → 3n bytes R, G, B */
+static inline void wyRGB565toRGB888(const uint16_t *src, uint8_t *dst, size_t n) {
+    size_t i = 0;
+#if WY_PIXEL_SWAR
+    for (; i + 4 <= n; i += 4, dst += 12) {                      /* 4 px → 3 words */
+        uint32_t ra, ga, ba, rb, gb, bb;
+        _wy_px_lanes(_wy_ld32(src + i), ra, ga, ba);
+        _wy_px_lanes(_wy_ld32(src + i + 2), rb, gb, bb);
+        _wy_st32(dst,     (ra & 0xFF) | (ga & 0xFF) << 8 | (ba & 0xFF) << 16 | (ra >> 16) << 24);
+        _wy_st32(dst + 4, (ga >> 16) | (ba >> 16) << 8 | (rb & 0xFF) << 16 | (gb & 0xFF) << 24);
+        _wy_st32(dst + 8, (bb & 0xFF) | (rb >> 16) << 8 | (gb >> 16) << 16 | (bb >> 16) << 24);
+    }
+#endif
+    _wy_px_rgb888(src + i, dst, n - i);
+}
+
+/* Byte-swap n RGB565 pixels (panel / camera big-endian ↔ native) */
+static inline void wyRGB565Swap(const uint16_t *src, uint16_t *dst, size_t n) {
+    size_t i = 0;
+#if WY_PIXEL_SWAR
+    for (; i + 2 <= n; i += 2) {
+        uint32_t w = _wy_ld32(src + i);
+        _wy_st32(dst + i, ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF));
+    }
+#endif
+    _wy_px_swap(src + i, dst + i, n - i);
+}
+
+/* n pixels → n bytes of luma */
+static inline void wyRGB565toGray(const uint16_t *src, uint8_t *dst, size_t n) {
+    size_t i = 0;
+#if WY_PIXEL_SWAR
+    for (; i + 4 <= n; i += 4) {
+        /* 77·255 + 150·255 + 29·255 = 65,280: the weighted sum fits its lane */
+        uint32_t r, g, b;
+        _wy_px_lanes(_wy_ld32(src + i), r, g, b);
+        uint32_t ya = ((77 * r + 150 * g + 29 * b) >> 8) & 0x00FF00FF;
+        _wy_px_lanes(_wy_ld32(src + i + 2), r, g, b);
+        uint32_t yb = ((77 * r + 150 * g + 29 * b) >> 8) & 0x00FF00FF;
+        _wy_st32(dst + i, (ya & 0xFF) | (ya >> 16) << 8 | (yb & 0xFF) << 16 | (yb >> 16) << 24);
+    }
+#endif
+    _wy_px_gray(src + i, dst + i, n - i);
+}
+
+/* n pixels of YUYV (2n bytes) → n RGB565; one word in, one word out */
+static inline void wyYUV422toRGB565(const uint8_t *src, uint16_t *dst, size_t n) {
+    size_t i = 0;
+#if WY_PIXEL_SWAR
+    for (; i + 2 <= n; i += 2, src += 4) {
+        uint32_t w = _wy_ld32(src);
+        int32_t d = (int32_t)((w >> 8) & 0xFF) - 128, e = (int32_t)(w >> 24) - 128;
+        int32_t rv = (359 * e) >> 8, guv = (88 * d + 183 * e) >> 8, bu = (454 * d) >> 8;
+        uint32_t p0 = _wy_px_yuv((int32_t)(w & 0xFF), rv, guv, bu);
+        uint32_t p1 = _wy_px_yuv((int32_t)((w >> 16) & 0xFF), rv, guv, bu);
+        _wy_st32(dst + i, p0 | p1 << 16);
+    }
+#endif
+    _wy_px_yuv422(src, dst + i, n - i);
+}
@@ -0,0 +1,324 @@
+/*
+ * WyQ565.h — Q565: fast-decoding native RGB565 image format
+ * ============================================================
+ * QOI-style byte ops (index / small diff / luma diff / run / literal)
+ * working directly on RGB565, so decoding is a tight byte loop with no
+ * entropy coder, no filters and no colour conversion. Flat-colour UI
+ * icons typically come out smaller than PNG and decode ~10× faster.
+ * Pure C++ — no Arduino dependency; the encoder runs on host (tools/q565).
+ *
+ * Usage:
+ *   wyDecodeQ565(readFn, &file, row, ctx);            // all rows
+ *   wyDecodeQ565(readFn, &file, row, ctx, 100, 139);  // rows 100..139 only
+ *   wyDecodeQ565Mem(data, len, row, ctx);             // PROGMEM, zero-copy
+ *   WyImage::drawQ565(SD, "/icon.q565", x, y);        // or draw() by extension
+ *
+ * File layout (little-endian):
+ *   0   "Q565"
+ *   4   u16 width, u16 height
+ *   8   u8  flags      bit0 = alpha key present
+ *   9   u8  rowGroup   rows per offset-table entry (≥ 1)
+ *   10  u16 key        RGB565 value that means "transparent"
+ *   12  u32 dataSize   bytes of op stream
+ *   16  u32 offsets[ceil(height / rowGroup)]   group start within op stream
+ *   ..  op stream
+ *
+ *   Decoder state (previous pixel = 0, index table = 0) resets at every
+ *   row group, so a clipped draw seeks straight to the first visible
+ *   group instead of decoding from the top.
+ *
+ * Ops (r/g/b are 5/6/5-bit fields, all arithmetic wraps):
+ *   00iiiiii               INDEX  pixel = index[i]
+ *   01rrggbb               DIFF   r,g,b += -2..1
+ *   10gggggg rrrrbbbb      LUMA   g += -32..31; r,b += (dg >> 1) + -8..7
+ *   11nnnnnn  (n < 62)     RUN    previous pixel n + 1 more times
+ *   11111110 lo hi         RGB    literal pixel
+ *   11111111 n             RUN    previous pixel n + 63 more times
+ *   index[(r*3 + g*5 + b*7) & 63] is updated after DIFF, LUMA and RGB.
+ *   Runs never cross the end of a row.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "WyImageInfo.h"
+#include "WyImageStream.h"
+
+#define WY_Q565_HEADER   16
+#define WY_Q565_FLAG_KEY 0x01
+
+#ifndef WY_Q565_ROW_GROUP
+  #define WY_Q565_ROW_GROUP 8     /* encoder default: offset entry every 8 rows */
+#endif
+
+struct WyQ565Header {
+    uint16_t w = 0, h = 0;
+    uint8_t  flags = 0, rowGroup = 1;
+    uint16_t key = 0;
+    uint32_t dataSize = 0;
+    uint16_t groups() const { return (uint16_t)((h + rowGroup - 1) / rowGroup); }
+    uint32_t dataStart() const { return WY_Q565_HEADER + 4u * groups(); }
+};
+
+static inline bool _wy_q565_header(const uint8_t *p, size_t n, WyQ565Header &hd) {
+    if (n < WY_Q565_HEADER || memcmp(p, "Q565", 4) != 0) return false;
+    hd.w        = _wy_le16(p + 4);
+    hd.h        = _wy_le16(p + 6);
+    hd.flags    = p[8];
+    hd.rowGroup = p[9];
+    hd.key      = _wy_le16(p + 10);
+    hd.dataSize = (uint32_t)_wy_le32(p + 12);
+    return hd.w && hd.h && hd.rowGroup;
+}
+
+static inline uint8_t _wy_q565_hash(uint16_t c) {
+    return (uint8_t)(((c >> 11) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) & 63);
+}
+
+/* ── Decode one row. Returns the new read position, nullptr if corrupt. */
+static inline const uint8_t *_wy_q565_row(const uint8_t *p, const uint8_t *end,
+                                          uint16_t *out, uint16_t w,
+                                          uint16_t &prev, uint16_t *index) {
+    uint16_t x = 0, px = prev;
+    while (x < w) {
+        if (p >= end) return nullptr;
+        uint8_t b = *p++;
+        uint8_t op = b >> 6;
+        if (op == 3) {
+            uint32_t run;
+            if (b < 0xFE) run = (uint32_t)(b & 0x3F) + 1;
+            else if (b == 0xFE) {
+                if (end - p < 2) return nullptr;
+                px = (uint16_t)(p[0] | p[1] << 8);
+                p += 2;
+                index[_wy_q565_hash(px)] = px;
+                out[x++] = px;
+                continue;
+            } else {
+                if (p >= end) return nullptr;
+                run = (uint32_t)*p++ + 63;
+            }
+            if (run > (uint32_t)(w - x)) return nullptr;
+            uint16_t *o = out + x;
+            x += (uint16_t)run;
+            while (run--) *o++ = px;
+            continue;
+        }
+        if (op == 0) {
+            px = index[b];
+        } else {
+            int r = px >> 11, g = (px >> 5) & 0x3F, bl = px & 0x1F;
+            if (op == 1) {
+                r  += ((b >> 4) & 3) - 2;
+                g  += ((b >> 2) & 3) - 2;
+                bl += (b & 3) - 2;
+            } else {
+                if (p >= end) return nullptr;
+                uint8_t b2 = *p++;
+                int dg = (b & 0x3F) - 32;
+                g  += dg;
+                r  += (dg >> 1) + (b2 >> 4) - 8;
+                bl += (dg >> 1) + (b2 & 15) - 8;
+            }
+            px = (uint16_t)((r & 0x1F) << 11 | (g & 0x3F) << 5 | (bl & 0x1F));
+            index[_wy_q565_hash(px)] = px;
+        }
+        out[x++] = px;
+    }
+    prev = px;
+    return p;
+}
+
+/* Decode rows [y0, y1] of one group held in memory */
+static inline WyImgResult _wy_q565_group(const WyQ565Header &hd, uint16_t g,
+                                         const uint8_t *p, const uint8_t *end,
+                                         int32_t y0, int32_t y1, uint16_t *out,
+                                         WyImgRowFn row, void *wctx) {
+    uint16_t index[64] = { 0 };
+    uint16_t prev = 0;
+    int32_t  ys = (int32_t)g * hd.rowGroup;
+    int32_t  ye = ys + hd.rowGroup - 1;
+    if (ye >= hd.h) ye = hd.h - 1;
+    if (ye > y1) ye = y1;
+    for (int32_t y = ys; y <= ye; y++) {
+        p = _wy_q565_row(p, end, out, hd.w, prev, index);
+        if (!p) return WY_IMG_ERR_CORRUPT;
+        if (y >= y0 && !row(wctx, (int16_t)y, out, hd.w)) return WY_IMG_STOPPED;
+    }
+    return WY_IMG_OK;
+}
+
+/* ── Decode from memory (no copies of the op stream) ──────────────── */
+static inline WyImgResult wyDecodeQ565Mem(const uint8_t *data, size_t len,
+                                          WyImgRowFn row, void *wctx,
+                                          int32_t y0 = 0, int32_t y1 = 0x7FFF) {
+    WyQ565Header hd;
+    if (!_wy_q565_header(data, len, hd)) return WY_IMG_ERR_FORMAT;
+    uint32_t ds = hd.dataStart();
+    if (ds + hd.dataSize > len) return WY_IMG_ERR_CORRUPT;
+    if (y0 < 0) y0 = 0;
+    if (y1 >= hd.h) y1 = hd.h - 1;
+    if (y0 > y1) return WY_IMG_OK;
+
+    uint16_t *out = (uint16_t *)malloc((size_t)hd.w * 2);
+    if (!out) return WY_IMG_ERR_NOMEM;
+    const uint8_t *ops = data + ds, *end = ops + hd.dataSize;
+    WyImgResult rc = WY_IMG_OK;
+    for (uint16_t g = (uint16_t)(y0 / hd.rowGroup); g <= y1 / hd.rowGroup && rc == WY_IMG_OK; g++) {
+        uint32_t off = (uint32_t)_wy_le32(data + WY_Q565_HEADER + 4u * g);
+        if (off > hd.dataSize) { rc = WY_IMG_ERR_CORRUPT; break; }
+        rc = _wy_q565_group(hd, g, ops + off, end, y0, y1, out, row, wctx);
+    }
+    free(out);
+    return rc;
+}
+
+/* ── Decode through a read callback, one row group per read ───────── */
+static inline WyImgResult wyDecodeQ565(WyImgReadFn rd, void *rctx,
+                                       WyImgRowFn row, void *wctx,
+                                       int32_t y0 = 0, int32_t y1 = 0x7FFF) {
+    uint8_t h[WY_Q565_HEADER];
+    WyQ565Header hd;
+    if (!_wy_q565_header(h, rd(rctx, 0, h, sizeof(h)), hd)) return WY_IMG_ERR_FORMAT;
+    if (y0 < 0) y0 = 0;
+    if (y1 >= hd.h) y1 = hd.h - 1;
+    if (y0 > y1) return WY_IMG_OK;
+
+    uint16_t g0 = (uint16_t)(y0 / hd.rowGroup), g1 = (uint16_t)(y1 / hd.rowGroup);
+    uint16_t ng = (uint16_t)(g1 - g0 + 1);
+    /* Offsets for the visible groups + the one after (or dataSize) */
+    uint32_t *offs = (uint32_t *)malloc(4u * (ng + 1));
+    uint16_t *out  = (uint16_t *)malloc((size_t)hd.w * 2);
+    uint8_t  *buf  = nullptr;
+    WyImgResult rc = WY_IMG_OK;
+    if (!offs || !out) { rc = WY_IMG_ERR_NOMEM; goto done; }
+    {
+        uint16_t nread = (g1 + 1 < hd.groups()) ? ng + 1 : ng;
+        size_t bytes = 4u * nread;
+        if (rd(rctx, WY_Q565_HEADER + 4u * g0, (uint8_t *)offs, bytes) != bytes) {
+            rc = WY_IMG_ERR_CORRUPT; goto done;
+        }
+        for (uint16_t i = 0; i < nread; i++) offs[i] = (uint32_t)_wy_le32((uint8_t *)&offs[i]);
+        if (nread == ng) offs[ng] = hd.dataSize;
+
+        uint32_t maxg = 0;
+        for (uint16_t i = 0; i < ng; i++) {
+            if (offs[i + 1] < offs[i] || offs[i + 1] > hd.dataSize) { rc = WY_IMG_ERR_CORRUPT; goto done; }
+            if (offs[i + 1] - offs[i] > maxg) maxg = offs[i + 1] - offs[i];
+        }
+        buf = (uint8_t *)malloc(maxg ? maxg : 1);
+        if (!buf) { rc = WY_IMG_ERR_NOMEM; goto done; }
+
+        uint32_t ds = hd.dataStart();
+        for (uint16_t i = 0; i < ng && rc == WY_IMG_OK; i++) {
+            uint32_t n = offs[i + 1] - offs[i];
+            if (rd(rctx, ds + offs[i], buf, n) != n) { rc = WY_IMG_ERR_CORRUPT; break; }
+            rc = _wy_q565_group(hd, (uint16_t)(g0 + i), buf, buf + n, y0, y1, out, row, wctx);
+        }
+    }
+done:
+    free(offs); free(out); free(buf);
+    return rc;
+}
+
+/* ══════════════════════════════════════════════════════════════════
+ * Encoder
+ * ══════════════════════════════════════════════════════════════════ */
+
+/* Worst case: every pixel a 3-byte literal */
+static inline size_t wyEncodeQ565Bound(uint16_t w, uint16_t h, uint8_t rowGroup = WY_Q565_ROW_GROUP) {
+    return WY_Q565_HEADER + 4u * ((h + rowGroup - 1) / rowGroup) + (size_t)w * h * 3;
+}
+
+/*
+ * Encode one row continuing from prev / index (zero both at a group
+ * start). Returns bytes written, 0 if cap is too small.
+ */
+static inline size_t _wy_q565_encode_row(const uint16_t *row, uint16_t w,
+                                         uint8_t *out, size_t cap,
+                                         uint16_t &prev, uint16_t *index) {
+    size_t o = 0;
+    for (uint16_t x = 0; x < w; ) {
+        if (cap - o < 3) return 0;
+        uint16_t c = row[x];
+        if (c == prev) {                                   /* RUN */
+            uint16_t n = 1;
+            while (x + n < w && row[x + n] == prev && n < 318) n++;
+            if (n <= 62) out[o++] = (uint8_t)(0xC0 | (n - 1));
+            else { out[o++] = 0xFF; out[o++] = (uint8_t)(n - 63); }
+            x += n;
+            continue;
+        }
+        uint8_t hs = _wy_q565_hash(c);
+        if (index[hs] == c) {                              /* INDEX */
+            out[o++] = hs;
+        } else {
+            int dr = (int)(c >> 11) - (int)(prev >> 11);
+            int dg = (int)((c >> 5) & 0x3F) - (int)((prev >> 5) & 0x3F);
+            int db = (int)(c & 0x1F) - (int)(prev & 0x1F);
+            /* Wrap into the signed ranges the decoder's modular adds reach */
+            dr = ((dr + 16) & 31) - 16;
+            dg = ((dg + 32) & 63) - 32;
+            db = ((db + 16) & 31) - 16;
+            int dr2 = ((dr - (dg >> 1) + 16) & 31) - 16;
+            int db2 = ((db - (dg >> 1) + 16) & 31) - 16;
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                out[o++] = (uint8_t)(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+            } else if (dr2 >= -8 && dr2 <= 7 && db2 >= -8 && db2 <= 7) {
+                out[o++] = (uint8_t)(0x80 | (dg + 32));
+                out[o++] = (uint8_t)((dr2 + 8) << 4 | (db2 + 8));
+            } else {
+                out[o++] = 0xFE;
+                out[o++] = (uint8_t)c;
+                out[o++] = (uint8_t)(c >> 8);
+            }
+            index[hs] = c;
+        }
+        prev = c;
+        x++;
+    }
+    return o;
+}
+
+/*
+ * Encode w × h RGB565 pixels. Transparent pixels must already hold `key`
+ * when hasKey is set. Returns bytes written, 0 if cap is too small.
+ */
+static inline size_t wyEncodeQ565(const uint16_t *px, uint16_t w, uint16_t h,
+                                  uint8_t *out, size_t cap,
+                                  uint8_t rowGroup = WY_Q565_ROW_GROUP,
+                                  bool hasKey = false, uint16_t key = 0) {
+    if (!w || !h || !rowGroup) return 0;
+    uint16_t groups = (uint16_t)((h + rowGroup - 1) / rowGroup);
+    size_t ds = WY_Q565_HEADER + 4u * groups;
+    if (cap < ds) return 0;
+    size_t o = ds;
+    uint16_t index[64], prev = 0;
+
+    for (uint16_t y = 0; y < h; y++) {
+        if (y % rowGroup == 0) {
+            uint32_t off = (uint32_t)(o - ds);
+            uint8_t *t = out + WY_Q565_HEADER + 4u * (y / rowGroup);
+            t[0] = (uint8_t)off; t[1] = (uint8_t)(off >> 8);
+            t[2] = (uint8_t)(off >> 16); t[3] = (uint8_t)(off >> 24);
+            memset(index, 0, sizeof(index));
+            prev = 0;
+        }
+        size_t n = _wy_q565_encode_row(px + (size_t)y * w, w, out + o, cap - o, prev, index);
+        if (!n) return 0;
+        o += n;
+    }
+
+    uint32_t dsz = (uint32_t)(o - ds);
+    memcpy(out, "Q565", 4);
+    out[4]  = (uint8_t)w;  out[5]  = (uint8_t)(w >> 8);
+    out[6]  = (uint8_t)h;  out[7]  = (uint8_t)(h >> 8);
+    out[8]  = hasKey ? WY_Q565_FLAG_KEY : 0;
+    out[9]  = rowGroup;
+    out[10] = (uint8_t)key; out[11] = (uint8_t)(key >> 8);
+    out[12] = (uint8_t)dsz; out[13] = (uint8_t)(dsz >> 8);
+    out[14] = (uint8_t)(dsz >> 16); out[15] = (uint8_t)(dsz >> 24);
+    return o;
+}
@@ -2,7 +2,7 @@
  * WyQR.h — QR code renderer for wyltek-embedded-builder
  * =======================================================
  * Renders QR codes onto any Arduino_GFX display.
- * Uses the lightweight qrcode library (Rick Osgood / nayuki port).
+ * Encoder built in (WyQREncode.h) — no extra lib_deps.
  *
  * Usage:
  *   #include <WyQR.h>
@@ -18,54 +18,69 @@
  *   // With background fill + quiet zone
  *   qr.drawBox("0x1234abcd...", 40, 40, 3, WY_WHITE, WY_BLACK);
  *
- * platformio.ini lib_deps:
- *   ricmoo/QRCode@^0.0.1
- *
- * QR version auto-selected (1–10) based on data length.
+ * QR version auto-selected (1–40): the smallest that holds the data at
+ * `ecc`, from the exact ISO capacity tables. If that version has room,
+ * ECC is raised further for free.
  * ECC level: MEDIUM (M) by default — good balance of density vs error recovery.
+ * Lowercase bech32 addresses (ckb1…, bc1…) go out as uppercase alphanumeric
+ * unless upcaseBech32 = false — a 97-char CKB address is v5 instead of v6.
+ *
+ * Drawing: the encoder output is kept as a 1-bpp matrix (WyQRCode.h) and
+ * the last WY_QR_CACHE payloads stay encoded, so re-showing a payment QR
+ * skips the encoder. Pixels go out in WY_QR_BAND_BYTES bands — a v10 code
+ * at 4 px is ~16 blits instead of ~3,400 fillRects. Without heap for a
+ * band it falls back to one fillRect per run of dark modules.
  */
 
 #pragma once
 #include <Arduino.h>
 #include <Arduino_GFX_Library.h>
-#include <qrcode.h>       /* ricmoo/QRCode */
+#include "WyQREncode.h"
 
 /* ── Defaults ────────────────────────────────────────────────────── */
-#define WY_QR_ECC        ECC_MEDIUM   /* M = ~15% recovery */
+#ifndef WY_QR_ECC
+  #define WY_QR_ECC      WY_QR_ECC_M  /* M = ~15% recovery (minimum) */
+#endif
 #define WY_QR_MODULE_PX  4            /* pixels per QR module (default) */
 #define WY_QR_QUIET      2            /* quiet zone modules around QR */
 #define WY_QR_FG         0x0000       /* foreground: black */
 #define WY_QR_BG         0xFFFF       /* background: white */
 
+/* Cache shared by every WyQR (and wyDrawQR) unless one sets its own */
+static inline WyQRCache &wyQRSharedCache() {
+    static WyQRCache c;
+    return c;
+}
+
 class WyQR {
 public:
     Arduino_GFX *gfx;
+    WyQRCache   *cache = &wyQRSharedCache();    /* nullptr = encode every draw */
+    uint8_t      ecc   = WY_QR_ECC;             /* minimum ECC, WY_QR_ECC_L..H */
+    bool         upcaseBech32 = true;           /* bech32 → uppercase alnum */
 
     WyQR(Arduino_GFX *g) : gfx(g) {}
+    ~WyQR() { free(_scratch.bits); }
+    WyQR(const WyQR &) = delete;                /* owns _scratch.bits */
+    WyQR &operator=(const WyQR &) = delete;
 
     /* ── draw() — centred on screen, auto module size ────────────── */
     bool draw(const char *data,
               uint16_t fg = WY_QR_FG,
               uint16_t bg = WY_QR_BG) {
-        uint8_t ver = _autoVersion(strlen(data));
-        uint8_t sz  = qrcode_getBufferSize(ver);
-        QRCode  qrc;
-        uint8_t *buf = (uint8_t *)malloc(sz);
-        if (!buf) return false;
-
-        qrcode_initText(&qrc, buf, ver, WY_QR_ECC, data);
+        const WyQRBits *qr = _encode(data);
+        if (!qr) return false;
 
         // Auto-fit: largest module size that fits on screen with quiet zone
         uint16_t available = min(gfx->width(), gfx->height()) - 16;
-        uint8_t  mod_px    = available / (qrc.size + WY_QR_QUIET * 2);
+        uint8_t  mod_px    = available / (qr->size + WY_QR_QUIET * 2);
         if (mod_px < 1) mod_px = 1;
 
-        uint16_t total = (qrc.size + WY_QR_QUIET * 2) * mod_px;
+        uint16_t total = wyQRPixels(qr->size, mod_px, WY_QR_QUIET);
         int16_t  ox    = (gfx->width()  - total) / 2;
         int16_t  oy    = (gfx->height() - total) / 2;
 
-        _render(&qrc, ox, oy, mod_px, fg, bg, true);
-        free(buf);
+        _render(*qr, ox, oy, mod_px, WY_QR_QUIET, fg, bg);
         return true;
     }
 
@@ -75,15 +90,9 @@ public:
               uint8_t mod_px = WY_QR_MODULE_PX,
               uint16_t fg    = WY_QR_FG,
               uint16_t bg    = WY_QR_BG) {
-        uint8_t ver = _autoVersion(strlen(data));
-        uint8_t sz  = qrcode_getBufferSize(ver);
-        QRCode  qrc;
-        uint8_t *buf = (uint8_t *)malloc(sz);
-        if (!buf) return false;
-
-        qrcode_initText(&qrc, buf, ver, WY_QR_ECC, data);
-        _render(&qrc, x, y, mod_px, fg, bg, false);
-        free(buf);
+        const WyQRBits *qr = _encode(data);
+        if (!qr) return false;
+        _render(*qr, x, y, mod_px, 0, fg, bg);
         return true;
     }
 
@@ -94,19 +103,9 @@ public:
                  uint16_t bg     = WY_QR_BG,
                  uint16_t fg     = WY_QR_FG,
                  uint8_t  quiet  = WY_QR_QUIET) {
-        uint8_t ver = _autoVersion(strlen(data));
-        uint8_t sz  = qrcode_getBufferSize(ver);
-        QRCode  qrc;
-        uint8_t *buf = (uint8_t *)malloc(sz);
-        if (!buf) return false;
-
-        qrcode_initText(&qrc, buf, ver, WY_QR_ECC, data);
-
-        uint16_t total = (qrc.size + quiet * 2) * mod_px;
-        gfx->fillRect(x, y, total, total, bg);
-        _render(&qrc, x + quiet * mod_px, y + quiet * mod_px, mod_px, fg, bg, false);
-
-        free(buf);
+        const WyQRBits *qr = _encode(data);
+        if (!qr) return false;
+        _render(*qr, x, y, mod_px, quiet, fg, bg);
         return true;
     }
 
@@ -116,64 +115,75 @@ public:
                      uint8_t mod_px = WY_QR_MODULE_PX,
                      uint16_t fg    = WY_QR_FG,
                      uint16_t bg    = WY_QR_BG) {
-        uint8_t ver  = _autoVersion(strlen(data));
-        uint8_t sz   = qrcode_getBufferSize(ver);
-        QRCode  qrc;
-        uint8_t *buf = (uint8_t *)malloc(sz);
-        if (!buf) return false;
-
-        qrcode_initText(&qrc, buf, ver, WY_QR_ECC, data);
-        uint16_t total = (qrc.size + WY_QR_QUIET * 2) * mod_px;
-        _render(&qrc, cx - total/2, cy - total/2, mod_px, fg, bg, true);
-        free(buf);
+        const WyQRBits *qr = _encode(data);
+        if (!qr) return false;
+        uint16_t total = wyQRPixels(qr->size, mod_px, WY_QR_QUIET);
+        _render(*qr, cx - total/2, cy - total/2, mod_px, WY_QR_QUIET, fg, bg);
         return true;
     }
 
     /* ── pixelSize() — how many pixels wide will the QR be? ─────── */
     uint16_t pixelSize(const char *data, uint8_t mod_px = WY_QR_MODULE_PX) {
-        uint8_t ver = _autoVersion(strlen(data));
-        QRCode  qrc;
-        uint8_t *buf = (uint8_t *)malloc(qrcode_getBufferSize(ver));
-        if (!buf) return 0;
-        qrcode_initText(&qrc, buf, ver, WY_QR_ECC, data);
-        uint16_t sz = (qrc.size + WY_QR_QUIET * 2) * mod_px;
-        free(buf);
-        return sz;
+        const WyQRBits *qr = _encode(data);
+        return qr ? wyQRPixels(qr->size, mod_px, WY_QR_QUIET) : 0;
     }
 
 private:
-    /* Auto-select minimum QR version for data length */
-    uint8_t _autoVersion(size_t len) {
-        // Approximate capacity (alphanumeric/byte, ECC M):
-        if (len <=  20) return 2;
-        if (len <=  32) return 3;
-        if (len <=  46) return 4;
-        if (len <=  60) return 5;
-        if (len <=  74) return 6;
-        if (len <=  86) return 7;
-        if (len <= 108) return 8;
-        if (len <= 130) return 9;
-        return 10;  // max we support — ~154 bytes ECC-M
+    WyQRBits _scratch;                /* matrix when running without a cache */
+
+    /* Matrix for data: from the cache, or encoded (and cached) now */
+    const WyQRBits *_encode(const char *data) {
+        uint8_t key = (uint8_t)(ecc | (upcaseBech32 ? 0x80 : 0));
+        if (cache) {
+            WyQRBits *hit = cache->get(data, key);
+            if (hit) return hit;
+        }
+        WyQRPlan p;
+        if (!wyQRPlanFor(data, ecc, p, upcaseBech32)) return nullptr;   /* > v40 */
+
+        WyQRBits *qr = cache ? cache->reserve(data, key, p.size(), p.version) : nullptr;
+        if (!qr) {                                  /* no cache / no room: scratch */
+            free(_scratch.bits);
+            _scratch = WyQRBits();
+            _scratch.bits = (uint8_t *)malloc(WyQRBits::bytes(p.size()));
+            if (!_scratch.bits) return nullptr;
+            qr = &_scratch;
+        }
+        if (!wyQREncode(data, p, *qr)) {
+            if (qr != &_scratch && cache) cache->drop(qr);
+            return nullptr;
+        }
+        return qr;
     }
 
-    void _render(QRCode *qrc, int16_t ox, int16_t oy, uint8_t mod_px,
-                 uint16_t fg, uint16_t bg, bool fill_bg) {
-        if (fill_bg) {
-            uint16_t total = qrc->size * mod_px;
-            gfx->fillRect(ox, oy, total, total, bg);
-        }
-        for (uint8_t row = 0; row < qrc->size; row++) {
-            for (uint8_t col = 0; col < qrc->size; col++) {
-                uint16_t col16 = qrcode_getModule(qrc, col, row) ? fg : bg;
-                if (mod_px == 1) {
-                    gfx->drawPixel(ox + col, oy + row, col16);
-                } else {
-                    gfx->fillRect(ox + col * mod_px, oy + row * mod_px,
-                                  mod_px, mod_px, col16);
-                }
-            }
+    /* Code + quiet zone at (ox, oy): bands if there's heap, else runs */
+    void _render(const WyQRBits &qr, int16_t ox, int16_t oy, uint8_t mod_px, uint8_t quiet,
+                 uint16_t fg, uint16_t bg) {
+        if (mod_px < 1) mod_px = 1;
+        _Target t = { gfx, ox, oy };
+        size_t rowPx  = (size_t)wyQRPixels(qr.size, mod_px, quiet) * mod_px;
+        size_t bandPx = WY_QR_BAND_BYTES / 2;
+        if (bandPx < rowPx) bandPx = rowPx;         /* at least one module row */
+        uint16_t *band = (uint16_t *)malloc(bandPx * 2);
+        if (band) {
+            wyQRRenderBands(qr, mod_px, quiet, fg, bg, band, bandPx, _blit, &t);
+            free(band);
+        } else {
+            wyQRRenderRuns(qr, mod_px, quiet, fg, bg, _fill, &t);
         }
     }
+
+    struct _Target { Arduino_GFX *gfx; int16_t x, y; };
+
+    static void _blit(void *ctx, int16_t x, int16_t y, const uint16_t *px,
+                      uint16_t w, uint16_t h) {
+        _Target *t = (_Target *)ctx;
+        t->gfx->draw16bitRGBBitmap(t->x + x, t->y + y, (uint16_t *)px, w, h);
+    }
+    static void _fill(void *ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t c) {
+        _Target *t = (_Target *)ctx;
+        t->gfx->fillRect(t->x + x, t->y + y, w, h, c);
+    }
 };
 
 /* ── One-liner free function ─────────────────────────────────────── */
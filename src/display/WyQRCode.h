@@ -0,0 +1,226 @@
+/*
+ * WyQRCode.h — QR module bitmap, payload cache and band renderer
+ * ================================================================
+ * The Arduino-free half of WyQR: an encoded QR code kept as a 1-bpp module
+ * matrix, a small LRU of the last few payloads, and the scaler that turns
+ * the matrix into RGB565 bands (one blit per band) or, when no band buffer
+ * can be had, into horizontal runs of foreground modules.
+ * Pure C++ — runs in host tests.
+ *
+ * Why: drawing one fillRect per module is ~3,400 SPI address-window
+ * transactions for a version-10 code. A band of whole module rows is one
+ * transaction; an 8 KB band holds 4 module rows of a v10 code at 4 px.
+ *
+ * Usage (WyQR does this for you):
+ *   WyQRBits *b = cache.get(data, ecc);          // hit: no re-encode
+ *   if (!b) { b = cache.reserve(data, ecc, size, version); ...fill b... }
+ *   wyQRRenderBands(*b, 4, 2, fg, bg, band, bandPx, blit, ctx);
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef WY_QR_CACHE
+  #define WY_QR_CACHE      4          /* payloads kept encoded (LRU) */
+#endif
+#ifndef WY_QR_BAND_BYTES
+  #define WY_QR_BAND_BYTES 8192       /* RGB565 band buffer per draw */
+#endif
+#define WY_QR_MAX_SIZE     177        /* version 40 */
+
+/* ── 1-bpp module matrix ──────────────────────────────────────────── */
+/* Row-major, MSB first, (size + 7) / 8 bytes per row. 1 = dark. */
+struct WyQRBits {
+    uint8_t  size    = 0;             /* modules per side, 21..177 */
+    uint8_t  version = 0;
+    uint8_t *bits    = nullptr;
+
+    static uint16_t stride(uint8_t size) { return (uint16_t)((size + 7) / 8); }
+    static size_t   bytes(uint8_t size)  { return (size_t)stride(size) * size; }
+
+    bool get(uint8_t x, uint8_t y) const {
+        return bits[(size_t)y * stride(size) + (x >> 3)] & (0x80 >> (x & 7));
+    }
+    void set(uint8_t x, uint8_t y, bool dark) {
+        uint8_t &b = bits[(size_t)y * stride(size) + (x >> 3)];
+        if (dark) b |= (uint8_t)(0x80 >> (x & 7)); else b &= (uint8_t)~(0x80 >> (x & 7));
+    }
+    bool rowEquals(uint8_t a, uint8_t b) const {
+        uint16_t s = stride(size);
+        return memcmp(bits + (size_t)a * s, bits + (size_t)b * s, s) == 0;
+    }
+};
+
+/* ── Payload cache ────────────────────────────────────────────────── */
+/*
+ * Last WY_QR_CACHE payloads by (text, ecc). A payment screen that flips
+ * back to the same QR skips the encoder entirely. Matrices are ≤ 3.9 KB
+ * (v40); a typical v4–v10 code is 60–460 bytes.
+ */
+class WyQRCache {
+public:
+    WyQRCache() {}
+    ~WyQRCache() { clear(); }
+    WyQRCache(const WyQRCache &) = delete;
+    WyQRCache &operator=(const WyQRCache &) = delete;
+
+    /* Cached matrix or nullptr. Marks the entry most recent. */
+    WyQRBits *get(const char *data, uint8_t ecc) {
+        uint32_t h = _hash(data);
+        for (uint8_t i = 0; i < WY_QR_CACHE; i++) {
+            _Entry &e = _e[i];
+            if (e.text && e.hash == h && e.ecc == ecc && strcmp(e.text, data) == 0) {
+                e.age = ++_clock;
+                _hits++;
+                return &e.qr;
+            }
+        }
+        _misses++;
+        return nullptr;
+    }
+
+    /*
+     * Zeroed matrix for the caller to encode into, replacing the least
+     * recently used entry. nullptr = no memory. If encoding then fails,
+     * drop() it.
+     */
+    WyQRBits *reserve(const char *data, uint8_t ecc, uint8_t size, uint8_t version) {
+        _Entry *v = &_e[0];
+        for (uint8_t i = 0; i < WY_QR_CACHE; i++) {
+            if (!_e[i].text) { v = &_e[i]; break; }
+            if (_e[i].age < v->age) v = &_e[i];
+        }
+        _free(*v);
+        size_t tlen = strlen(data), mb = WyQRBits::bytes(size);
+        v->text = (char *)malloc(tlen + 1 + mb);           /* text + matrix, one block */
+        if (!v->text) return nullptr;
+        memcpy(v->text, data, tlen + 1);
+        v->qr.bits = (uint8_t *)v->text + tlen + 1;
+        memset(v->qr.bits, 0, mb);
+        v->qr.size = size; v->qr.version = version;
+        v->hash = _hash(data); v->ecc = ecc;
+        v->age = ++_clock;
+        return &v->qr;
+    }
+
+    void drop(WyQRBits *qr) {
+        for (uint8_t i = 0; i < WY_QR_CACHE; i++)
+            if (&_e[i].qr == qr) _free(_e[i]);
+    }
+
+    void clear() { for (uint8_t i = 0; i < WY_QR_CACHE; i++) _free(_e[i]); }
+
+    uint8_t count() const {
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < WY_QR_CACHE; i++) n += _e[i].text != nullptr;
+        return n;
+    }
+    uint32_t hits()   const { return _hits; }
+    uint32_t misses() const { return _misses; }
+    void     resetStats() { _hits = _misses = 0; }
+
+private:
+    struct _Entry {
+        char    *text = nullptr;          /* owns the matrix bytes too */
+        WyQRBits qr;
+        uint32_t hash = 0, age = 0;
+        uint8_t  ecc = 0;
+    };
+    _Entry   _e[WY_QR_CACHE];
+    uint32_t _clock = 0, _hits = 0, _misses = 0;
+
+    static uint32_t _hash(const char *s) {            /* FNV-1a */
+        uint32_t h = 2166136261u;
+        while (*s) { h ^= (uint8_t)*s++; h *= 16777619u; }
+        return h;
+    }
+    static void _free(_Entry &e) {
+        free(e.text);
+        e.text = nullptr;
+        e.qr = WyQRBits();
+        e.age = 0;
+    }
+};
+
+/* ── Renderers ────────────────────────────────────────────────────── */
+/* Pixel rect at (x, y) relative to the code's top-left (quiet zone included) */
+typedef void (*WyQRBlitFn)(void *ctx, int16_t x, int16_t y, const uint16_t *px,
+                           uint16_t w, uint16_t h);
+typedef void (*WyQRFillFn)(void *ctx, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                           uint16_t color);
+
+/* Pixels per side including the quiet zone */
+static inline uint16_t wyQRPixels(uint8_t size, uint8_t mod, uint8_t quiet) {
+    return (uint16_t)((size + 2 * quiet) * mod);
+}
+
+/*
+ * Scale the matrix into `band` (bandPx pixels) as many whole module rows
+ * at a time as fit, and blit each band. Returns blits issued, 0 if the
+ * band can't hold even one module row (use wyQRRenderRuns instead).
+ */
+static inline uint16_t wyQRRenderBands(const WyQRBits &qr, uint8_t mod, uint8_t quiet,
+                                       uint16_t fg, uint16_t bg,
+                                       uint16_t *band, size_t bandPx,
+                                       WyQRBlitFn blit, void *ctx) {
+    if (!mod || !qr.size) return 0;
+    uint16_t w = wyQRPixels(qr.size, mod, quiet);
+    size_t rowsPer = bandPx / ((size_t)w * mod);                  /* module rows per band */
+    if (!rowsPer) return 0;
+    uint16_t total = (uint16_t)(qr.size + 2 * quiet), blits = 0;
+    for (uint16_t m0 = 0; m0 < total; m0 += rowsPer) {
+        uint16_t n = (uint16_t)((size_t)(total - m0) < rowsPer ? total - m0 : rowsPer);
+        for (uint16_t m = 0; m < n; m++) {
+            uint16_t *line = band + (size_t)m * mod * w;
+            int16_t my = (int16_t)(m0 + m - quiet);
+            if (m > 0 && my > 0 && my < qr.size && qr.rowEquals((uint8_t)my, (uint8_t)(my - 1))) {
+                memcpy(line, line - (size_t)mod * w, (size_t)mod * w * 2);   /* repeated row */
+                continue;
+            }
+            uint16_t *p = line;
+            for (uint16_t mx = 0; mx < total; mx++) {
+                int16_t cx = (int16_t)(mx - quiet);
+                bool dark = my >= 0 && my < qr.size && cx >= 0 && cx < qr.size &&
+                            qr.get((uint8_t)cx, (uint8_t)my);
+                uint16_t c = dark ? fg : bg;
+                for (uint8_t k = 0; k < mod; k++) *p++ = c;
+            }
+            for (uint8_t k = 1; k < mod; k++) memcpy(line + (size_t)k * w, line, (size_t)w * 2);
+        }
+        blit(ctx, 0, (int16_t)(m0 * mod), band, w, (uint16_t)(n * mod));
+        blits++;
+    }
+    return blits;
+}
+
+/*
+ * No-buffer fallback: one bg fill for the whole box, then one fill per
+ * horizontal run of dark modules, merged downwards while the next module
+ * rows carry the identical run. Returns fills issued.
+ */
+static inline uint16_t wyQRRenderRuns(const WyQRBits &qr, uint8_t mod, uint8_t quiet,
+                                      uint16_t fg, uint16_t bg,
+                                      WyQRFillFn fill, void *ctx) {
+    uint16_t w = wyQRPixels(qr.size, mod, quiet);
+    fill(ctx, 0, 0, w, w, bg);
+    uint16_t calls = 1;
+    int16_t q = (int16_t)(quiet * mod);
+    for (uint8_t y = 0; y < qr.size; y++) {
+        /* Rows identical to the previous one were drawn with it */
+        if (y > 0 && qr.rowEquals(y, (uint8_t)(y - 1))) continue;
+        uint8_t rep = 1;
+        while (y + rep < qr.size && qr.rowEquals(y, (uint8_t)(y + rep))) rep++;
+        for (uint8_t x = 0; x < qr.size; ) {
+            if (!qr.get(x, y)) { x++; continue; }
+            uint8_t x0 = x;
+            while (x < qr.size && qr.get(x, y)) x++;
+            fill(ctx, (int16_t)(q + x0 * mod), (int16_t)(q + y * mod),
+                 (uint16_t)((x - x0) * mod), (uint16_t)(rep * mod), fg);
+            calls++;
+        }
+    }
+    return calls;
+}
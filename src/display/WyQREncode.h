@@ -0,0 +1,488 @@
+/*
+ * WyQREncode.h — QR Code encoder, versions 1–40
+ * ===============================================
+ * Text → WyQRBits module matrix (ISO/IEC 18004). Picks the densest mode
+ * that holds the whole string (numeric / alphanumeric / byte), the
+ * smallest version that fits from the exact capacity tables, then raises
+ * the ECC level as far as that version allows. Pure C++ — no Arduino
+ * dependency, runs in host tests. Replaces the ricmoo/QRCode dependency
+ * (which WyQR only ever drove up to version 10).
+ *
+ * Usage:
+ *   WyQRPlan p;
+ *   if (wyQRPlanFor(text, WY_QR_ECC_M, p)) {       // version / ecc / mode
+ *       WyQRBits qr;  qr.bits = buf;               // WyQRBits::bytes(p.size())
+ *       wyQREncode(text, p, qr);
+ *   }
+ *
+ * Bech32: CKB / BTC addresses are case-insensitive, and all-uppercase
+ * fits alphanumeric mode (5.5 bits/char instead of 8). wyQRPlanFor()
+ * encodes an all-lowercase bech32 string as uppercase alphanumeric — a
+ * full 97-char CKB address drops from version 6 to version 5 at ECC M.
+ *
+ * Memory (heap, freed before return): raw codewords (≤ 3,706 B) + one
+ * block (≤ 153 B) + function-module map (≤ 3.9 KB).
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "WyQRCode.h"
+
+/* ECC levels, lowest → highest recovery (L ~7%, M ~15%, Q ~25%, H ~30%) */
+#define WY_QR_ECC_L 0
+#define WY_QR_ECC_M 1
+#define WY_QR_ECC_Q 2
+#define WY_QR_ECC_H 3
+
+/* Mode indicators */
+#define WY_QR_MODE_NUMERIC 0x1
+#define WY_QR_MODE_ALNUM   0x2
+#define WY_QR_MODE_BYTE    0x4
+
+/* ── Capacity tables (ISO/IEC 18004 table 9), [ecc][version] ─────── */
+static const uint8_t _wy_qr_ecc_per_block[4][41] = {
+    { 0,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22, 24, 28, 30, 28, 28,
+         28, 28, 30, 30, 26, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+    { 0, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24, 28, 28, 26, 26, 26,
+         26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28 },
+    { 0, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30, 24, 28, 28, 26, 30,
+         28, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+    { 0, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24, 30, 28, 28, 26, 28,
+         30, 24, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+};
+static const uint8_t _wy_qr_blocks[4][41] = {
+    { 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 4, 4, 4, 4, 4, 6, 6, 6, 6, 7, 8,
+         8, 9, 9, 10, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25 },
+    { 0, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5, 5, 8, 9, 9, 10, 10, 11, 13, 14, 16,
+         17, 17, 18, 20, 21, 23, 25, 26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49 },
+    { 0, 1, 1, 2, 2, 4, 4, 6, 6, 8, 8, 8, 10, 12, 16, 12, 17, 16, 18, 21, 20,
+         23, 23, 25, 27, 29, 34, 34, 35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68 },
+    { 0, 1, 1, 2, 4, 4, 4, 5, 6, 8, 8, 11, 11, 16, 16, 18, 16, 19, 21, 25, 25,
+         25, 34, 30, 32, 35, 37, 40, 42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81 },
+};
+
+/* Data + ECC modules once function patterns are placed */
+static inline uint16_t _wy_qr_raw_modules(uint8_t ver) {
+    uint32_t r = (16u * ver + 128) * ver + 64;
+    if (ver >= 2) {
+        uint32_t na = ver / 7 + 2;
+        r -= (25 * na - 10) * na - 55;
+        if (ver >= 7) r -= 36;
+    }
+    return (uint16_t)r;
+}
+
+/* Data codewords available at version / ecc */
+static inline uint16_t wyQRDataCodewords(uint8_t ver, uint8_t ecc) {
+    return (uint16_t)(_wy_qr_raw_modules(ver) / 8 -
+                      _wy_qr_ecc_per_block[ecc][ver] * _wy_qr_blocks[ecc][ver]);
+}
+
+static inline uint8_t _wy_qr_count_bits(uint8_t mode, uint8_t ver) {
+    uint8_t band = ver < 10 ? 0 : ver < 27 ? 1 : 2;
+    static const uint8_t bits[3][3] = { { 10, 12, 14 }, { 9, 11, 13 }, { 8, 16, 16 } };
+    return bits[mode == WY_QR_MODE_NUMERIC ? 0 : mode == WY_QR_MODE_ALNUM ? 1 : 2][band];
+}
+
+/* Exact character capacity of one segment (the standard's capacity table) */
+static inline uint16_t wyQRCapacity(uint8_t ver, uint8_t ecc, uint8_t mode) {
+    if (ver < 1 || ver > 40 || ecc > 3) return 0;
+    int32_t bits = (int32_t)wyQRDataCodewords(ver, ecc) * 8 - 4 - _wy_qr_count_bits(mode, ver);
+    if (bits <= 0) return 0;
+    uint32_t n;
+    if (mode == WY_QR_MODE_NUMERIC)    n = bits / 10 * 3 + (bits % 10 >= 7 ? 2 : bits % 10 >= 4 ? 1 : 0);
+    else if (mode == WY_QR_MODE_ALNUM) n = bits / 11 * 2 + (bits % 11 >= 6 ? 1 : 0);
+    else                               n = bits / 8;
+    uint32_t maxCount = (1u << _wy_qr_count_bits(mode, ver)) - 1;
+    return (uint16_t)(n < maxCount ? n : maxCount);
+}
+
+/* ── Mode selection ───────────────────────────────────────────────── */
+static inline int8_t _wy_qr_alnum(char c) {
+    if (c >= '0' && c <= '9') return (int8_t)(c - '0');
+    if (c >= 'A' && c <= 'Z') return (int8_t)(c - 'A' + 10);
+    const char *sym = " $%*+-./:";
+    for (int8_t i = 0; sym[i]; i++) if (c == sym[i]) return (int8_t)(36 + i);
+    return -1;
+}
+
+/* hrp "1" data, data in the bech32 charset, one case throughout */
+static inline bool wyQRIsBech32(const char *s) {
+    static const char *cs = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+    size_t n = strlen(s);
+    const char *sep = strrchr(s, '1');
+    if (n < 8 || n > 1023 || !sep || sep == s || (size_t)(s + n - sep - 1) < 6) return false;
+    bool lower = false, upper = false;
+    for (const char *p = s; *p; p++) {
+        char c = *p;
+        if (c >= 'a' && c <= 'z') lower = true;
+        else if (c >= 'A' && c <= 'Z') upper = true;
+        else if (c < '0' || c > '9') return false;
+        if (p > sep) {
+            char l = (c >= 'A' && c <= 'Z') ? (char)(c + 32) : c;
+            if (!strchr(cs, l)) return false;
+        }
+    }
+    return !(lower && upper);
+}
+
+struct WyQRPlan {
+    uint8_t version = 0, ecc = 0, mode = 0;
+    bool    upcase  = false;        /* lowercase bech32 sent as uppercase alnum */
+    uint8_t size() const { return (uint8_t)(17 + 4 * version); }
+};
+
+/*
+ * Smallest version ≥ minVer holding `text` at ECC ≥ minEcc, then the
+ * highest ECC that still fits that version. False = too long for v40.
+ */
+static inline bool wyQRPlanFor(const char *text, uint8_t minEcc, WyQRPlan &p,
+                               bool upcaseBech32 = true, uint8_t minVer = 1) {
+    size_t n = strlen(text);
+    bool numeric = true, alnum = true;
+    for (const char *c = text; *c; c++) {
+        if (*c < '0' || *c > '9') numeric = false;
+        if (_wy_qr_alnum(*c) < 0) alnum = false;
+    }
+    p.upcase = false;
+    if (!alnum && upcaseBech32 && wyQRIsBech32(text)) { alnum = true; p.upcase = true; }
+    p.mode = numeric && n ? WY_QR_MODE_NUMERIC : alnum && n ? WY_QR_MODE_ALNUM : WY_QR_MODE_BYTE;
+    if (minEcc > WY_QR_ECC_H) minEcc = WY_QR_ECC_H;
+    if (minVer < 1) minVer = 1;
+    for (uint8_t v = minVer; v <= 40; v++) {
+        if (wyQRCapacity(v, minEcc, p.mode) < n) continue;
+        p.version = v;
+        p.ecc = minEcc;
+        while (p.ecc < WY_QR_ECC_H && wyQRCapacity(v, p.ecc + 1, p.mode) >= n) p.ecc++;
+        return true;
+    }
+    p.version = 0;
+    return false;
+}
+
+/* ── Reed–Solomon over GF(256), x^8 + x^4 + x^3 + x^2 + 1 ────────── */
+static inline uint8_t _wy_gf_mul(uint8_t x, uint8_t y) {
+    uint8_t z = 0;
+    for (int i = 7; i >= 0; i--) {
+        z = (uint8_t)((z << 1) ^ ((z >> 7) * 0x1D));
+        z ^= (uint8_t)(((y >> i) & 1) * x);
+    }
+    return z;
+}
+
+static inline void _wy_rs_divisor(uint8_t degree, uint8_t *gen) {
+    memset(gen, 0, degree);
+    gen[degree - 1] = 1;
+    uint8_t root = 1;
+    for (uint8_t i = 0; i < degree; i++) {
+        for (uint8_t j = 0; j < degree; j++) {
+            gen[j] = _wy_gf_mul(gen[j], root);
+            if (j + 1 < degree) gen[j] ^= gen[j + 1];
+        }
+        root = _wy_gf_mul(root, 0x02);
+    }
+}
+
+static inline void _wy_rs_remainder(const uint8_t *data, uint16_t len, const uint8_t *gen,
+                                    uint8_t degree, uint8_t *out) {
+    memset(out, 0, degree);
+    for (uint16_t i = 0; i < len; i++) {
+        uint8_t f = data[i] ^ out[0];
+        memmove(out, out + 1, degree - 1);
+        out[degree - 1] = 0;
+        for (uint8_t j = 0; j < degree; j++) out[j] ^= _wy_gf_mul(gen[j], f);
+    }
+}
+
+/* ── Codewords ────────────────────────────────────────────────────── */
+struct _WyQRBitBuf {
+    uint8_t *buf; uint32_t len, cap;          /* len in bits, cap in bytes */
+    void put(uint32_t v, uint8_t n) {
+        for (int i = n - 1; i >= 0; i--, len++)
+            if ((v >> i) & 1) buf[len >> 3] |= (uint8_t)(0x80 >> (len & 7));
+    }
+};
+
+/* Segment + terminator + padding → dataCW bytes in out (zeroed by caller) */
+static inline void _wy_qr_data(const char *text, const WyQRPlan &p, uint8_t *out, uint16_t dataCW) {
+    size_t n = strlen(text);
+    _WyQRBitBuf bb = { out, 0, dataCW };
+    bb.put(p.mode, 4);
+    bb.put((uint32_t)n, _wy_qr_count_bits(p.mode, p.version));
+    if (p.mode == WY_QR_MODE_NUMERIC) {
+        for (size_t i = 0; i < n; i += 3) {
+            uint8_t k = (uint8_t)(n - i < 3 ? n - i : 3);
+            uint32_t v = 0;
+            for (uint8_t j = 0; j < k; j++) v = v * 10 + (text[i + j] - '0');
+            bb.put(v, (uint8_t)(k * 3 + 1));
+        }
+    } else if (p.mode == WY_QR_MODE_ALNUM) {
+        auto val = [&](char c) {
+            if (p.upcase && c >= 'a' && c <= 'z') c = (char)(c - 32);
+            return (uint32_t)_wy_qr_alnum(c);
+        };
+        size_t i = 0;
+        for (; i + 1 < n; i += 2) bb.put(val(text[i]) * 45 + val(text[i + 1]), 11);
+        if (i < n) bb.put(val(text[i]), 6);
+    } else {
+        for (size_t i = 0; i < n; i++) bb.put((uint8_t)text[i], 8);
+    }
+    uint32_t capBits = (uint32_t)dataCW * 8;
+    uint32_t term = capBits - bb.len < 4 ? capBits - bb.len : 4;
+    bb.len += term;
+    bb.len = (bb.len + 7) & ~7u;
+    for (uint8_t pad = 0xEC; bb.len < capBits; pad ^= 0xEC ^ 0x11) bb.put(pad, 8);
+}
+
+/* Split into blocks, append ECC, interleave → raw (rawModules / 8 bytes) */
+static inline bool _wy_qr_interleave(const uint8_t *data, const WyQRPlan &p, uint8_t *raw) {
+    uint8_t  nb = _wy_qr_blocks[p.ecc][p.version];
+    uint8_t  el = _wy_qr_ecc_per_block[p.ecc][p.version];
+    uint16_t rawCW = _wy_qr_raw_modules(p.version) / 8;
+    uint16_t dataCW = wyQRDataCodewords(p.version, p.ecc);
+    uint8_t  nShort = (uint8_t)(nb - rawCW % nb);
+    uint16_t shortLen = (uint16_t)(rawCW / nb - el);          /* data bytes in a short block */
+    uint8_t  gen[30], ecc[30];
+    _wy_rs_divisor(el, gen);
+    const uint8_t *d = data;
+    for (uint8_t b = 0; b < nb; b++) {
+        uint16_t len = (uint16_t)(shortLen + (b < nShort ? 0 : 1));
+        _wy_rs_remainder(d, len, gen, el, ecc);
+        for (uint16_t j = 0, k = b; j < len; j++, k += nb) {
+            if (j == shortLen) k -= nShort;                   /* long blocks' extra byte */
+            raw[k] = d[j];
+        }
+        for (uint16_t j = 0, k = (uint16_t)(dataCW + b); j < el; j++, k += nb) raw[k] = ecc[j];
+        d += len;
+    }
+    return true;
+}
+
+/* ── Matrix ───────────────────────────────────────────────────────── */
+struct _WyQRBuild {
+    WyQRBits &qr;
+    WyQRBits  fn;                            /* 1 = function module */
+    void func(int x, int y, bool dark) {
+        qr.set((uint8_t)x, (uint8_t)y, dark);
+        fn.set((uint8_t)x, (uint8_t)y, true);
+    }
+};
+
+static inline uint8_t _wy_qr_align_pos(uint8_t ver, uint8_t *pos) {
+    if (ver == 1) return 0;
+    uint8_t n = (uint8_t)(ver / 7 + 2);
+    uint8_t step = ver == 32 ? 26 : (uint8_t)((ver * 4 + n * 2 + 1) / (n * 2 - 2) * 2);
+    pos[0] = 6;
+    for (int i = n - 1, p = ver * 4 + 10; i >= 1; i--, p -= step) pos[i] = (uint8_t)p;
+    return n;
+}
+
+/* 15-bit format word: ecc + mask, BCH(15,5), XOR 0x5412 */
+static inline uint16_t wyQRFormatBits(uint8_t ecc, uint8_t mask) {
+    static const uint8_t eccBits[4] = { 1, 0, 3, 2 };           /* L M Q H */
+    uint16_t data = (uint16_t)(eccBits[ecc] << 3 | mask), rem = data;
+    for (int i = 0; i < 10; i++) rem = (uint16_t)((rem << 1) ^ ((rem >> 9) * 0x537));
+    return (uint16_t)((data << 10 | rem) ^ 0x5412);
+}
+
+/* 18-bit version word, BCH(18,6) — versions 7+ */
+static inline uint32_t wyQRVersionBits(uint8_t ver) {
+    uint32_t rem = ver;
+    for (int i = 0; i < 12; i++) rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+    return (uint32_t)ver << 12 | rem;
+}
+
+static inline void _wy_qr_format(_WyQRBuild &b, uint8_t ecc, uint8_t mask) {
+    uint16_t bits = wyQRFormatBits(ecc, mask);
+    int size = b.qr.size;
+    auto bit = [&](int i) { return ((bits >> i) & 1) != 0; };
+    for (int i = 0; i <= 5; i++) b.func(8, i, bit(i));
+    b.func(8, 7, bit(6));
+    b.func(8, 8, bit(7));
+    b.func(7, 8, bit(8));
+    for (int i = 9; i < 15; i++) b.func(14 - i, 8, bit(i));
+    for (int i = 0; i < 8; i++) b.func(size - 1 - i, 8, bit(i));
+    for (int i = 8; i < 15; i++) b.func(8, size - 15 + i, bit(i));
+    b.func(8, size - 8, true);                               /* dark module */
+}
+
+static inline void _wy_qr_function_patterns(_WyQRBuild &b, uint8_t ver) {
+    int size = b.qr.size;
+    for (int i = 0; i < size; i++) {                         /* timing */
+        b.func(6, i, i % 2 == 0);
+        b.func(i, 6, i % 2 == 0);
+    }
+    const int fc[3][2] = { { 3, 3 }, { size - 4, 3 }, { 3, size - 4 } };
+    for (auto &c : fc)                                       /* finders + separators */
+        for (int dy = -4; dy <= 4; dy++)
+            for (int dx = -4; dx <= 4; dx++) {
+                int x = c[0] + dx, y = c[1] + dy;
+                if (x < 0 || y < 0 || x >= size || y >= size) continue;
+                int d = abs(dx) > abs(dy) ? abs(dx) : abs(dy);
+                b.func(x, y, d != 2 && d != 4);
+            }
+    uint8_t pos[7];
+    uint8_t na = _wy_qr_align_pos(ver, pos);
+    for (uint8_t i = 0; i < na; i++)
+        for (uint8_t j = 0; j < na; j++) {
+            if ((i == 0 && j == 0) || (i == 0 && j == na - 1) || (i == na - 1 && j == 0)) continue;
+            for (int dy = -2; dy <= 2; dy++)
+                for (int dx = -2; dx <= 2; dx++) {
+                    int d = abs(dx) > abs(dy) ? abs(dx) : abs(dy);
+                    b.func(pos[i] + dx, pos[j] + dy, d != 1);
+                }
+        }
+    _wy_qr_format(b, 0, 0);                                  /* reserve; real bits later */
+    if (ver >= 7) {
+        uint32_t bits = wyQRVersionBits(ver);
+        for (int i = 0; i < 18; i++) {
+            bool bit = (bits >> i) & 1;
+            int a = size - 11 + i % 3, c = i / 3;
+            b.func(a, c, bit);
+            b.func(c, a, bit);
+        }
+    }
+}
+
+/* Zig-zag the codewords into the non-function modules */
+static inline void _wy_qr_place(_WyQRBuild &b, const uint8_t *raw, uint16_t rawCW) {
+    int size = b.qr.size;
+    uint32_t i = 0, nbits = (uint32_t)rawCW * 8;
+    for (int right = size - 1; right >= 1; right -= 2) {
+        if (right == 6) right = 5;
+        for (int v = 0; v < size; v++)
+            for (int j = 0; j < 2; j++) {
+                int x = right - j;
+                bool up = ((right + 1) & 2) == 0;
+                int y = up ? size - 1 - v : v;
+                if (b.fn.get((uint8_t)x, (uint8_t)y)) continue;
+                if (i < nbits) b.qr.set((uint8_t)x, (uint8_t)y, (raw[i >> 3] >> (7 - (i & 7))) & 1);
+                i++;                                         /* remainder bits stay light */
+            }
+    }
+}
+
+static inline bool _wy_qr_mask_bit(uint8_t mask, int x, int y) {
+    switch (mask) {
+        case 0:  return (x + y) % 2 == 0;
+        case 1:  return y % 2 == 0;
+        case 2:  return x % 3 == 0;
+        case 3:  return (x + y) % 3 == 0;
+        case 4:  return (x / 3 + y / 2) % 2 == 0;
+        case 5:  return x * y % 2 + x * y % 3 == 0;
+        case 6:  return (x * y % 2 + x * y % 3) % 2 == 0;
+        default: return ((x + y) % 2 + x * y % 3) % 2 == 0;
+    }
+}
+
+static inline void _wy_qr_apply_mask(_WyQRBuild &b, uint8_t mask) {
+    int size = b.qr.size;
+    for (int y = 0; y < size; y++)
+        for (int x = 0; x < size; x++)
+            if (!b.fn.get((uint8_t)x, (uint8_t)y) && _wy_qr_mask_bit(mask, x, y))
+                b.qr.set((uint8_t)x, (uint8_t)y, !b.qr.get((uint8_t)x, (uint8_t)y));
+}
+
+/* ── Mask penalty (N1 = 3, N2 = 3, N3 = 40, N4 = 10) ─────────────── */
+struct _WyQRRuns {
+    int h[7];
+    int size;
+    void add(int run) {
+        if (h[0] == 0) run += size;                          /* light border before the row */
+        memmove(h + 1, h, 6 * sizeof(int));
+        h[0] = run;
+    }
+    int patterns() const {                                   /* 1:1:3:1:1 with 4 light */
+        int n = h[1];
+        bool core = n > 0 && h[2] == n && h[3] == n * 3 && h[4] == n && h[5] == n;
+        return (core && h[0] >= n * 4 && h[6] >= n ? 1 : 0) + (core && h[6] >= n * 4 && h[0] >= n ? 1 : 0);
+    }
+    int finish(bool dark, int run) {
+        if (dark) { add(run); run = 0; }
+        run += size;
+        add(run);
+        return patterns();
+    }
+};
+
+static inline long _wy_qr_penalty(const WyQRBits &qr) {
+    int size = qr.size;
+    long score = 0;
+    for (int pass = 0; pass < 2; pass++)                     /* rows, then columns */
+        for (int a = 0; a < size; a++) {
+            _WyQRRuns r = { { 0 }, size };
+            bool color = false;
+            int run = 0;
+            for (int b = 0; b < size; b++) {
+                bool m = pass ? qr.get((uint8_t)a, (uint8_t)b) : qr.get((uint8_t)b, (uint8_t)a);
+                if (m == color) {
+                    run++;
+                    if (run == 5) score += 3;
+                    else if (run > 5) score++;
+                } else {
+                    r.add(run);
+                    if (!color) score += r.patterns() * 40;
+                    color = m;
+                    run = 1;
+                }
+            }
+            score += r.finish(color, run) * 40;
+        }
+    long dark = 0;
+    for (int y = 0; y < size; y++)
+        for (int x = 0; x < size; x++) {
+            bool c = qr.get((uint8_t)x, (uint8_t)y);
+            dark += c;
+            if (x < size - 1 && y < size - 1 && c == qr.get((uint8_t)(x + 1), (uint8_t)y) &&
+                c == qr.get((uint8_t)x, (uint8_t)(y + 1)) && c == qr.get((uint8_t)(x + 1), (uint8_t)(y + 1)))
+                score += 3;
+        }
+    long total = (long)size * size;
+    long k = (labs(dark * 20 - total * 10) + total - 1) / total - 1;
+    return score + k * 10;
+}
+
+/*
+ * Encode into qr.bits (WyQRBits::bytes(p.size()) bytes). mask −1 = pick
+ * the lowest-penalty mask. Sets qr.size / qr.version. False = no memory
+ * or a plan that doesn't fit.
+ */
+static inline bool wyQREncode(const char *text, const WyQRPlan &p, WyQRBits &qr, int8_t mask = -1) {
+    if (p.version < 1 || p.version > 40 || p.ecc > 3 ||
+        strlen(text) > wyQRCapacity(p.version, p.ecc, p.mode)) return false;
+    uint8_t size = p.size();
+    uint16_t rawCW = _wy_qr_raw_modules(p.version) / 8;
+    uint16_t dataCW = wyQRDataCodewords(p.version, p.ecc);
+    size_t mb = WyQRBits::bytes(size);
+    uint8_t *mem = (uint8_t *)calloc(1, (size_t)dataCW + rawCW + mb);
+    if (!mem) return false;
+    uint8_t *data = mem, *raw = mem + dataCW;
+
+    qr.size = size; qr.version = p.version;
+    memset(qr.bits, 0, mb);
+    _WyQRBuild b = { qr, WyQRBits() };
+    b.fn.size = size; b.fn.bits = raw + rawCW;
+
+    _wy_qr_data(text, p, data, dataCW);
+    _wy_qr_interleave(data, p, raw);
+    _wy_qr_function_patterns(b, p.version);
+    _wy_qr_place(b, raw, rawCW);
+
+    if (mask < 0 || mask > 7) {
+        long best = -1;
+        for (uint8_t m = 0; m < 8; m++) {
+            _wy_qr_apply_mask(b, m);
+            _wy_qr_format(b, p.ecc, m);
+            long s = _wy_qr_penalty(qr);
+            if (best < 0 || s < best) { best = s; mask = (int8_t)m; }
+            _wy_qr_apply_mask(b, m);                         /* XOR again = undo */
+        }
+    }
+    _wy_qr_apply_mask(b, (uint8_t)mask);
+    _wy_qr_format(b, p.ecc, (uint8_t)mask);
+    free(mem);
+    return true;
+}
@@ -0,0 +1,132 @@
+/*
+ * WyTileView.h — Pan / zoom a tiled image (.wyt) on Arduino_GFX
+ * ===============================================================
+ * Shows a window onto a map or floor plan far bigger than RAM. Only the
+ * tiles under the viewport are read from SD / LittleFS; decoded tiles stay
+ * in an LRU sized to the viewport, so panning by a few pixels is pure
+ * blitting and only newly exposed tiles are decoded.
+ * Build the file on the host: tools/wytiles.cpp.
+ *
+ * Usage:
+ *   WyTileView map(display.gfx);                   // full screen
+ *   map.open(SD, "/plan.wyt");                     // opens at the top-left
+ *   map.setLevel(1);                               // 0 = 1:1, 1 = 1:2, ...
+ *   map.centerOn(1200, 900);
+ *   map.draw();
+ *
+ *   // touch drag
+ *   map.panBy(-dx, -dy);  map.draw();
+ *
+ *   WyTileView inset(display.gfx, 0, 40, 400, 300);  // viewport rectangle
+ *
+ * Memory: decoded tiles covering the viewport + WY_TILE_SPARE more, in
+ * PSRAM when available — see WyTiles.h. The file stays open until close().
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+#include <Arduino_GFX_Library.h>
+#include "WyTiles.h"
+
+class WyTileView {
+public:
+    Arduino_GFX *gfx;
+    bool     verbose = false;
+    uint16_t bg      = 0x0000;      /* outside the image / missing tiles */
+
+    /* w/h 0 = rest of the screen */
+    WyTileView(Arduino_GFX *g, int16_t x = 0, int16_t y = 0, uint16_t w = 0, uint16_t h = 0)
+        : gfx(g), _x(x), _y(y), _w(w), _h(h) {}
+    ~WyTileView() { close(); }
+
+    bool open(fs::FS &fs, const char *path, uint16_t spare = WY_TILE_SPARE) {
+        close();
+        _file = fs.open(path, "r");
+        if (!_file) {
+            if (verbose) Serial.printf("[WyTileView] open failed: %s\n", path);
+            return false;
+        }
+        WyImgResult rc = _map.open(_fileRead, &_file, spare);
+        if (rc != WY_IMG_OK) {
+            if (verbose) Serial.printf("[WyTileView] %s: %s\n", path,
+                rc == WY_IMG_ERR_NOMEM ? "tile cache malloc failed" : "not a .wyt tile set");
+            close();
+            return false;
+        }
+        if (!setViewport(_x, _y, _w, _h)) {
+            close();
+            return false;
+        }
+        if (verbose) {
+            const WyTileLevel &L = _map.levelInfo(0);
+            Serial.printf("[WyTileView] %s %ux%u, %u levels, %u px tiles, %u B cache\n",
+                          path, L.w, L.h, _map.levels(), _map.tileSize(), (unsigned)_map.memory());
+        }
+        return true;
+    }
+
+    void close() {
+        _map.close();
+        if (_file) _file.close();
+    }
+
+    bool setViewport(int16_t x, int16_t y, uint16_t w = 0, uint16_t h = 0) {
+        _x = x; _y = y; _w = w; _h = h;
+        if (!w) w = (uint16_t)(gfx->width()  - x);
+        if (!h) h = (uint16_t)(gfx->height() - y);
+        if (_map.setViewport(w, h)) return true;
+        if (verbose) Serial.printf("[WyTileView] no memory for a %ux%u viewport\n", w, h);
+        return false;
+    }
+
+    void setLevel(uint8_t l)            { _map.setLevel(l); }
+    void zoomIn()                       { if (_map.level() > 0) _map.setLevel(_map.level() - 1); }
+    void zoomOut()                      { _map.setLevel(_map.level() + 1); }
+    void centerOn(int32_t x, int32_t y) { _map.centerOn(x, y); }
+    void panBy(int32_t dx, int32_t dy)  { _map.panBy(dx, dy); }
+
+    /* Redraw the viewport. Returns tiles drawn. */
+    uint16_t draw() {
+        _map.bg = bg;
+        uint32_t t0 = micros(), m0 = _map.misses();
+        uint16_t n = _map.render(_blit, this);
+        if (verbose) Serial.printf("[WyTileView] L%u @%ld,%ld: %u tiles (%lu decoded) in %lu us\n",
+                                   _map.level(), (long)_map.viewX(), (long)_map.viewY(), n,
+                                   (unsigned long)(_map.misses() - m0), (unsigned long)(micros() - t0));
+        return n;
+    }
+
+    uint8_t  levels()   const { return _map.levels(); }
+    uint8_t  level()    const { return _map.level(); }
+    int32_t  viewX()    const { return _map.viewX(); }
+    int32_t  viewY()    const { return _map.viewY(); }
+    WyTileMap &map()          { return _map; }
+
+private:
+    WyTileMap _map;
+    File      _file;
+    int16_t   _x, _y;
+    uint16_t  _w, _h;
+
+    static void _blit(void *ctx, int16_t x, int16_t y, const uint16_t *px,
+                      uint16_t stride, uint16_t w, uint16_t h) {
+        WyTileView *v = (WyTileView *)ctx;
+        Arduino_GFX *g = v->gfx;
+        x += v->_x; y += v->_y;
+        if (!px) { g->fillRect(x, y, w, h, v->bg); return; }
+        if (w == stride) {   /* full tile width is contiguous */
+            g->draw16bitRGBBitmap(x, y, (uint16_t *)px, w, h);
+            return;
+        }
+        for (uint16_t r = 0; r < h; r++)
+            g->draw16bitRGBBitmap(x, y + r, (uint16_t *)px + (size_t)r * stride, w, 1);
+    }
+
+    /* WyImgReadFn over an open fs::File */
+    static size_t _fileRead(void *ctx, uint32_t off, uint8_t *buf, size_t len) {
+        File *f = (File *)ctx;
+        if (!f->seek(off)) return 0;
+        return f->read(buf, len);
+    }
+};
@@ -0,0 +1,438 @@
+/*
+ * WyTiles.h — Tiled multi-resolution image container (.wyt)
+ * ===========================================================
+ * Large maps / floor plans are cut into fixed-size tiles at several zoom
+ * levels (each half the size of the one before), so a viewport only ever
+ * reads and decodes the handful of tiles it can see. Tiles are Q565
+ * (WyQ565.h) blobs. Pure C++ — no Arduino dependency; WyTileView
+ * (WyTileView.h) puts a WyTileMap on a display, tools/wytiles.cpp builds
+ * the files on the host.
+ *
+ * Usage:
+ *   WyTileMap map;
+ *   map.open(readFn, &file);          // header + level table only
+ *   map.setViewport(800, 480);
+ *   map.setLevel(1);                  // 0 = full resolution
+ *   map.centerOn(2000, 1500);         // level pixel coordinates
+ *   map.render(blit, ctx);            // visible tiles, clipped
+ *   map.panBy(16, 0);
+ *
+ *   void blit(void *ctx, int16_t x, int16_t y, const uint16_t *px,
+ *             uint16_t stride, uint16_t w, uint16_t h);
+ *     x, y   — position inside the viewport
+ *     px     — first visible pixel, rows `stride` pixels apart;
+ *              nullptr = fill w × h with map.bg (outside the image,
+ *              unreadable tile)
+ *
+ * File layout (little-endian):
+ *   0   "WYT1"
+ *   4   u16 width, u16 height          level 0
+ *   8   u16 tileSize
+ *   10  u8  levels, u8 codec (1 = Q565)
+ *   12  u16 fill, u16 reserved      fill = colour of the tiles not stored
+ *   16  levels × { u16 w, u16 h, u16 cols, u16 rows, u32 indexOffset }
+ *   ..  per level: cols × rows × { u32 offset, u32 size }   (row-major;
+ *       size 0 = tile is all `fill` and isn't stored)
+ *   ..  tile blobs
+ *
+ * Memory:
+ *   The LRU holds every tile the viewport can touch plus `spare` more, so
+ *   panning within already-decoded ground never re-reads the card:
+ *   ((vw / tile + 2) × (vh / tile + 2) + spare) × tileSize² × 2, allocated
+ *   as tiles are first used, plus a buffer for the largest compressed tile.
+ *   800×480 with 128 px tiles ≈ 1.6 MB — PSRAM (WY_TILE_MALLOC); small
+ *   panels / 64 px tiles need far less.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "WyImageInfo.h"
+#include "WyImageStream.h"
+#include "WyQ565.h"
+
+#ifndef WY_TILE_SPARE
+  #define WY_TILE_SPARE 8              /* tiles cached beyond the visible set */
+#endif
+#ifndef WY_TILE_MALLOC
+  #if defined(ESP_PLATFORM)
+    #include <esp_heap_caps.h>
+    #define WY_TILE_MALLOC(n) heap_caps_malloc((n), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+  #else
+    #define WY_TILE_MALLOC(n) malloc(n)
+  #endif
+#endif
+
+#define WY_TILE_HEADER     16
+#define WY_TILE_LEVEL_SIZE 12
+#define WY_TILE_MAX_LEVELS 12
+#define WY_TILE_CODEC_Q565 1
+
+typedef void (*WyTileBlitFn)(void *ctx, int16_t x, int16_t y, const uint16_t *px,
+                             uint16_t stride, uint16_t w, uint16_t h);
+
+struct WyTileLevel {
+    uint16_t w, h, cols, rows;
+    uint32_t index;
+};
+
+class WyTileMap {
+public:
+    uint16_t bg = 0x0000;
+
+    WyTileMap() {}
+    ~WyTileMap() { close(); }
+    WyTileMap(const WyTileMap &) = delete;
+    WyTileMap &operator=(const WyTileMap &) = delete;
+
+    WyImgResult open(WyImgReadFn rd, void *ctx, uint16_t spare = WY_TILE_SPARE) {
+        close();
+        uint8_t h[WY_TILE_HEADER];
+        if (rd(ctx, 0, h, sizeof(h)) != sizeof(h) || memcmp(h, "WYT1", 4) != 0)
+            return WY_IMG_ERR_FORMAT;
+        _tile   = _wy_le16(h + 8);
+        _levels = h[10];
+        _fill   = _wy_le16(h + 12);
+        if (!_tile || !_levels || _levels > WY_TILE_MAX_LEVELS) return WY_IMG_ERR_FORMAT;
+        if (h[11] != WY_TILE_CODEC_Q565) return WY_IMG_ERR_UNSUPPORTED;
+
+        uint8_t lt[WY_TILE_LEVEL_SIZE * WY_TILE_MAX_LEVELS];
+        size_t n = (size_t)WY_TILE_LEVEL_SIZE * _levels;
+        if (rd(ctx, WY_TILE_HEADER, lt, n) != n) return WY_IMG_ERR_CORRUPT;
+        for (uint8_t l = 0; l < _levels; l++) {
+            const uint8_t *p = lt + WY_TILE_LEVEL_SIZE * l;
+            _lv[l] = { _wy_le16(p), _wy_le16(p + 2), _wy_le16(p + 4), _wy_le16(p + 6),
+                       (uint32_t)_wy_le32(p + 8) };
+        }
+
+        _spare = spare;
+        if (!_sizeCache()) { close(); return WY_IMG_ERR_NOMEM; }
+        _rd = rd; _ctx = ctx;
+        _level = 0;
+        _vx = _vy = 0;
+        return WY_IMG_OK;
+    }
+
+    void close() {
+        if (_slots) {
+            for (uint16_t i = 0; i < _nslots; i++) free(_slots[i].px);
+            free(_slots);
+        }
+        free(_blob);
+        _slots = nullptr; _nslots = _allocated = 0;
+        _blob = nullptr; _blobCap = 0;
+        _levels = 0;
+    }
+
+    /* ── Geometry ──────────────────────────────────────────────── */
+    uint8_t  levels()   const { return _levels; }
+    uint16_t tileSize() const { return _tile; }
+    uint8_t  level()    const { return _level; }
+    const WyTileLevel &levelInfo(uint8_t l) const { return _lv[l < _levels ? l : 0]; }
+    int32_t  viewX() const { return _vx; }      /* viewport top-left, level pixels */
+    int32_t  viewY() const { return _vy; }
+
+    /* Grows the LRU to cover the new viewport. False = out of memory. */
+    bool setViewport(uint16_t w, uint16_t h) {
+        _vw = w; _vh = h;
+        _clamp();
+        return _sizeCache();
+    }
+
+    /* Change zoom level, keeping the viewport centre on the same spot */
+    void setLevel(uint8_t l) {
+        if (l >= _levels || l == _level) return;
+        int64_t cx = _vx + _vw / 2, cy = _vy + _vh / 2;
+        if (l > _level) { cx >>= (l - _level); cy >>= (l - _level); }
+        else            { cx <<= (_level - l); cy <<= (_level - l); }
+        _level = l;
+        centerOn((int32_t)cx, (int32_t)cy);
+    }
+
+    void centerOn(int32_t x, int32_t y) { _vx = x - _vw / 2; _vy = y - _vh / 2; _clamp(); }
+    void panBy(int32_t dx, int32_t dy)  { _vx += dx; _vy += dy; _clamp(); }
+
+    /* ── Rendering ─────────────────────────────────────────────── */
+    /* Blit every visible tile (clipped) + bg margins. Returns tiles drawn. */
+    uint16_t render(WyTileBlitFn blit, void *bctx) {
+        if (!_levels) return 0;
+        const WyTileLevel &L = _lv[_level];
+        _margins(blit, bctx, L);
+        int32_t x0 = _vx > 0 ? _vx : 0, y0 = _vy > 0 ? _vy : 0;
+        int32_t x1 = _vx + _vw < L.w ? _vx + _vw : L.w;     /* exclusive */
+        int32_t y1 = _vy + _vh < L.h ? _vy + _vh : L.h;
+        if (x1 <= x0 || y1 <= y0) return 0;
+        uint16_t drawn = 0;
+        for (int32_t ty = y0 / _tile; ty <= (y1 - 1) / _tile; ty++)
+            for (int32_t tx = x0 / _tile; tx <= (x1 - 1) / _tile; tx++) {
+                uint16_t tw, th;
+                const uint16_t *px = tile(_level, (uint16_t)tx, (uint16_t)ty, tw, th);
+                int32_t ox = tx * _tile, oy = ty * _tile;          /* tile origin */
+                int32_t cx0 = ox > x0 ? ox : x0, cy0 = oy > y0 ? oy : y0;
+                int32_t cx1 = ox + tw < x1 ? ox + tw : x1, cy1 = oy + th < y1 ? oy + th : y1;
+                if (cx1 <= cx0 || cy1 <= cy0) continue;
+                blit(bctx, (int16_t)(cx0 - _vx), (int16_t)(cy0 - _vy),
+                     px ? px + (size_t)(cy0 - oy) * tw + (cx0 - ox) : nullptr,
+                     tw, (uint16_t)(cx1 - cx0), (uint16_t)(cy1 - cy0));
+                drawn++;
+            }
+        return drawn;
+    }
+
+    /*
+     * Decoded tile (w × h, stride w) through the LRU, or nullptr for an
+     * unreadable tile (draw bg). Valid until the next tile() call
+     * evicts it — render() blits each tile before fetching the next.
+     */
+    const uint16_t *tile(uint8_t level, uint16_t tx, uint16_t ty, uint16_t &w, uint16_t &h) {
+        w = h = 0;
+        if (level >= _levels) return nullptr;
+        const WyTileLevel &L = _lv[level];
+        if (tx >= L.cols || ty >= L.rows) return nullptr;
+        w = (uint16_t)((tx + 1) * _tile <= L.w ? _tile : L.w - tx * _tile);
+        h = (uint16_t)((ty + 1) * _tile <= L.h ? _tile : L.h - ty * _tile);
+        _clock++;
+        _Slot *victim = &_slots[0];
+        for (uint16_t i = 0; i < _nslots; i++) {
+            _Slot &s = _slots[i];
+            if (s.used && s.level == level && s.tx == tx && s.ty == ty) {
+                s.age = _clock;
+                _hits++;
+                return s.bad ? nullptr : s.px;
+            }
+            if (!s.used || (victim->used && s.age < victim->age)) victim = &s;
+        }
+        _misses++;
+        if (!victim->px) {                       /* first use of this slot */
+            victim->px = (uint16_t *)WY_TILE_MALLOC((size_t)_tile * _tile * 2);
+            if (!victim->px) {                   /* out of memory: reuse the oldest buffer */
+                _Slot *old = nullptr;
+                for (uint16_t i = 0; i < _nslots; i++)
+                    if (_slots[i].px && (!old || _slots[i].age < old->age)) old = &_slots[i];
+                if (!old) { _errors++; return nullptr; }
+                victim = old;
+            } else _allocated++;
+        }
+        victim->used = true;
+        victim->level = level; victim->tx = tx; victim->ty = ty;
+        victim->age = _clock;
+        victim->bad = !_load(L, tx, ty, w, h, victim->px);
+        return victim->bad ? nullptr : victim->px;
+    }
+
+    uint32_t hits()    const { return _hits; }
+    uint32_t misses()  const { return _misses; }    /* = tiles read + decoded */
+    uint32_t errors()  const { return _errors; }
+    void     resetStats() { _hits = _misses = _errors = 0; }
+    uint16_t cacheSlots() const { return _nslots; }
+    size_t   memory() const {
+        return (size_t)_allocated * _tile * _tile * 2 + (size_t)_nslots * sizeof(_Slot) + _blobCap;
+    }
+
+private:
+    struct _Slot {
+        uint16_t *px;
+        uint32_t  age;
+        uint16_t  tx, ty;
+        uint8_t   level;
+        bool      used, bad;           /* load failed: drawn as bg, not retried */
+    };
+
+    WyImgReadFn _rd = nullptr; void *_ctx = nullptr;
+    WyTileLevel _lv[WY_TILE_MAX_LEVELS];
+    uint8_t     _levels = 0, _level = 0;
+    uint16_t    _tile = 0, _fill = 0, _vw = 0, _vh = 0, _spare = 0, _nslots = 0, _allocated = 0;
+    int32_t     _vx = 0, _vy = 0;
+    _Slot      *_slots = nullptr;
+    uint8_t    *_blob = nullptr;             /* compressed tile being decoded */
+    uint32_t    _blobCap = 0;
+    uint32_t    _clock = 0, _hits = 0, _misses = 0, _errors = 0;
+
+    /* Slots for every tile a viewport can straddle + spare (never shrinks) */
+    bool _sizeCache() {
+        if (!_tile) return true;
+        uint32_t want = (uint32_t)((_vw + _tile - 1) / _tile + 1) * ((_vh + _tile - 1) / _tile + 1) + _spare;
+        if (!want) want = 1;
+        if (want > 0xFFFF) want = 0xFFFF;
+        if (want <= _nslots) return true;
+        _Slot *n = (_Slot *)realloc(_slots, want * sizeof(_Slot));
+        if (!n) return false;
+        memset(n + _nslots, 0, (want - _nslots) * sizeof(_Slot));
+        _slots = n;
+        _nslots = (uint16_t)want;
+        return true;
+    }
+
+    /* Keep the viewport on the image; centre it when the level is smaller */
+    void _clamp() {
+        if (!_levels) return;
+        const WyTileLevel &L = _lv[_level];
+        if (L.w <= _vw) _vx = -(int32_t)(_vw - L.w) / 2;
+        else if (_vx < 0) _vx = 0;
+        else if (_vx > L.w - _vw) _vx = L.w - _vw;
+        if (L.h <= _vh) _vy = -(int32_t)(_vh - L.h) / 2;
+        else if (_vy < 0) _vy = 0;
+        else if (_vy > L.h - _vh) _vy = L.h - _vh;
+    }
+
+    /* bg bands where the level doesn't cover the viewport */
+    void _margins(WyTileBlitFn blit, void *bctx, const WyTileLevel &L) {
+        int32_t l = -_vx, t = -_vy;                           /* left / top bands */
+        int32_t r = _vx + _vw - L.w, b = _vy + _vh - L.h;     /* right / bottom */
+        if (t > 0) blit(bctx, 0, 0, nullptr, 0, _vw, (uint16_t)t);
+        if (b > 0) blit(bctx, 0, (int16_t)(_vh - b), nullptr, 0, _vw, (uint16_t)b);
+        int32_t my = t > 0 ? t : 0, mh = _vh - my - (b > 0 ? b : 0);
+        if (mh <= 0) return;
+        if (l > 0) blit(bctx, 0, (int16_t)my, nullptr, 0, (uint16_t)l, (uint16_t)mh);
+        if (r > 0) blit(bctx, (int16_t)(_vw - r), (int16_t)my, nullptr, 0, (uint16_t)r, (uint16_t)mh);
+    }
+
+    /* Tile blob → slot, one read per tile (none for fill tiles). False = failed. */
+    struct _Dst { uint16_t *px; uint16_t w, h; };
+
+    static bool _dstRow(void *c, int16_t y, const uint16_t *px, uint16_t w) {
+        _Dst *d = (_Dst *)c;
+        if (y < d->h && w == d->w) memcpy(d->px + (size_t)y * w, px, (size_t)w * 2);
+        return true;
+    }
+
+    bool _load(const WyTileLevel &L, uint16_t tx, uint16_t ty, uint16_t w, uint16_t h,
+               uint16_t *px) {
+        uint8_t e[8];
+        if (_rd(_ctx, L.index + 8u * ((uint32_t)ty * L.cols + tx), e, 8) != 8) { _errors++; return false; }
+        uint32_t off = (uint32_t)_wy_le32(e), size = (uint32_t)_wy_le32(e + 4);
+        if (!size) {
+            for (size_t i = 0, n = (size_t)w * h; i < n; i++) px[i] = _fill;
+            return true;
+        }
+        if (size > _blobCap) {                   /* grows to the largest tile seen */
+            free(_blob);
+            _blob = (uint8_t *)WY_TILE_MALLOC(size);
+            _blobCap = _blob ? size : 0;
+            if (!_blob) { _errors++; return false; }
+        }
+        _Dst dst = { px, w, h };
+        if (_rd(_ctx, off, _blob, size) != size ||
+            wyDecodeQ565Mem(_blob, size, _dstRow, &dst) != WY_IMG_OK) { _errors++; return false; }
+        return true;
+    }
+};
+
+/* ══════════════════════════════════════════════════════════════════
+ * Builder (host tool / tests): RGB565 image → .wyt
+ * ══════════════════════════════════════════════════════════════════ */
+
+/* Levels until the whole image fits in one tile */
+static inline uint8_t wyTilesLevelCount(uint16_t w, uint16_t h, uint16_t tile) {
+    uint8_t n = 1;
+    while ((w > tile || h > tile) && n < WY_TILE_MAX_LEVELS) {
+        w = (uint16_t)((w + 1) / 2); h = (uint16_t)((h + 1) / 2);
+        n++;
+    }
+    return n;
+}
+
+/* Worst-case file size */
+static inline size_t wyTilesBound(uint16_t w, uint16_t h, uint16_t tile) {
+    size_t total = WY_TILE_HEADER + (size_t)WY_TILE_LEVEL_SIZE * WY_TILE_MAX_LEVELS;
+    uint8_t n = wyTilesLevelCount(w, h, tile);
+    for (uint8_t l = 0; l < n; l++) {
+        size_t cols = (w + tile - 1) / tile, rows = (h + tile - 1) / tile;
+        total += cols * rows * (8 + wyEncodeQ565Bound(tile, tile, 1));
+        w = (uint16_t)((w + 1) / 2); h = (uint16_t)((h + 1) / 2);
+    }
+    return total;
+}
+
+/* 2×2 box filter, edges replicated */
+static inline void _wy_tiles_half(const uint16_t *src, uint16_t w, uint16_t h,
+                                  uint16_t *dst, uint16_t dw, uint16_t dh) {
+    for (uint16_t y = 0; y < dh; y++)
+        for (uint16_t x = 0; x < dw; x++) {
+            uint16_t sx = (uint16_t)(2 * x), sy = (uint16_t)(2 * y);
+            uint16_t sx1 = sx + 1 < w ? sx + 1 : sx, sy1 = sy + 1 < h ? sy + 1 : sy;
+            uint16_t c[4] = { src[(size_t)sy * w + sx], src[(size_t)sy * w + sx1],
+                              src[(size_t)sy1 * w + sx], src[(size_t)sy1 * w + sx1] };
+            uint32_t r = 0, g = 0, b = 0;
+            for (int i = 0; i < 4; i++) { r += c[i] >> 11; g += (c[i] >> 5) & 0x3F; b += c[i] & 0x1F; }
+            dst[(size_t)y * dw + x] = (uint16_t)(((r + 2) / 4) << 11 | ((g + 2) / 4) << 5 | ((b + 2) / 4));
+        }
+}
+
+/*
+ * Build a tile pyramid. Tiles that are entirely `bg` are not stored; the
+ * viewer fills them with bg from the header.
+ * Returns bytes written (0 = cap too small / no memory).
+ */
+static inline size_t wyTilesEncode(const uint16_t *px, uint16_t w, uint16_t h, uint16_t tile,
+                                   uint8_t *out, size_t cap, uint16_t bg = 0x0000) {
+    if (!w || !h || !tile) return 0;
+    uint8_t n = wyTilesLevelCount(w, h, tile);
+    size_t o = WY_TILE_HEADER + (size_t)WY_TILE_LEVEL_SIZE * n;
+    if (cap < o) return 0;
+
+    /* Level table + index space */
+    uint16_t lw = w, lh = h;
+    uint32_t idx[WY_TILE_MAX_LEVELS];
+    for (uint8_t l = 0; l < n; l++) {
+        uint16_t cols = (uint16_t)((lw + tile - 1) / tile), rows = (uint16_t)((lh + tile - 1) / tile);
+        uint8_t *p = out + WY_TILE_HEADER + WY_TILE_LEVEL_SIZE * l;
+        p[0] = (uint8_t)lw; p[1] = (uint8_t)(lw >> 8); p[2] = (uint8_t)lh; p[3] = (uint8_t)(lh >> 8);
+        p[4] = (uint8_t)cols; p[5] = (uint8_t)(cols >> 8); p[6] = (uint8_t)rows; p[7] = (uint8_t)(rows >> 8);
+        idx[l] = (uint32_t)o;
+        p[8] = (uint8_t)o; p[9] = (uint8_t)(o >> 8); p[10] = (uint8_t)(o >> 16); p[11] = (uint8_t)(o >> 24);
+        o += 8u * cols * rows;
+        if (o > cap) return 0;
+        lw = (uint16_t)((lw + 1) / 2); lh = (uint16_t)((lh + 1) / 2);
+    }
+
+    uint16_t *cur = (uint16_t *)malloc((size_t)w * h * 2);
+    uint16_t *tbuf = (uint16_t *)malloc((size_t)tile * tile * 2);
+    if (!cur || !tbuf) { free(cur); free(tbuf); return 0; }
+    memcpy(cur, px, (size_t)w * h * 2);
+    lw = w; lh = h;
+    size_t result = 0;
+    uint8_t group = (uint8_t)(tile < 255 ? tile : 255);     /* tiles decode whole */
+    for (uint8_t l = 0; l < n; l++) {
+        uint16_t cols = (uint16_t)((lw + tile - 1) / tile), rows = (uint16_t)((lh + tile - 1) / tile);
+        for (uint16_t ty = 0; ty < rows; ty++)
+            for (uint16_t tx = 0; tx < cols; tx++) {
+                uint16_t tw = (uint16_t)((tx + 1) * tile <= lw ? tile : lw - tx * tile);
+                uint16_t th = (uint16_t)((ty + 1) * tile <= lh ? tile : lh - ty * tile);
+                bool empty = true;
+                for (uint16_t y = 0; y < th; y++)
+                    for (uint16_t x = 0; x < tw; x++) {
+                        uint16_t c = cur[(size_t)(ty * tile + y) * lw + tx * tile + x];
+                        tbuf[(size_t)y * tw + x] = c;
+                        empty &= c == bg;
+                    }
+                uint32_t off = (uint32_t)o, sz = 0;
+                if (!empty) {
+                    sz = (uint32_t)wyEncodeQ565(tbuf, tw, th, out + o, cap - o, group);
+                    if (!sz) goto fail;
+                    o += sz;
+                } else off = 0;
+                uint8_t *e = out + idx[l] + 8u * ((uint32_t)ty * cols + tx);
+                e[0] = (uint8_t)off; e[1] = (uint8_t)(off >> 8); e[2] = (uint8_t)(off >> 16); e[3] = (uint8_t)(off >> 24);
+                e[4] = (uint8_t)sz;  e[5] = (uint8_t)(sz >> 8);  e[6] = (uint8_t)(sz >> 16);  e[7] = (uint8_t)(sz >> 24);
+            }
+        if (l + 1 < n) {
+            uint16_t nw = (uint16_t)((lw + 1) / 2), nh = (uint16_t)((lh + 1) / 2);
+            _wy_tiles_half(cur, lw, lh, cur, nw, nh);   /* in place: dst index ≤ src index read */
+            lw = nw; lh = nh;
+        }
+    }
+    memcpy(out, "WYT1", 4);
+    out[4] = (uint8_t)w; out[5] = (uint8_t)(w >> 8);
+    out[6] = (uint8_t)h; out[7] = (uint8_t)(h >> 8);
+    out[8] = (uint8_t)tile; out[9] = (uint8_t)(tile >> 8);
+    out[10] = n; out[11] = WY_TILE_CODEC_Q565;
+    out[12] = (uint8_t)bg; out[13] = (uint8_t)(bg >> 8);
+    out[14] = out[15] = 0;
+    result = o;
+fail:
+    free(cur); free(tbuf);
+    return result;
+}
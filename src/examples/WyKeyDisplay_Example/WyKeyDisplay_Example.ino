@@ -8,6 +8,11 @@
  * the kind of thing you'd use for a CKB node status pad or SBC
  * control surface.
  *
+ * keys.begin(true) turns on buffering: setMetric() then only draws into
+ * the key's off-screen canvas (and only the text that changed);
+ * keys.update() in loop() sends the damage to the panels a slice at a
+ * time. Plain begin() draws straight to the panels.
+ *
  * Board: WY_BOARD_LILYGO_TKEYBOARD_S3
  * platformio.ini:
  *   [env:tkeyboard]
@@ -38,7 +43,7 @@ Metric metrics[4] = {
 
 void setup() {
     Serial.begin(115200);
-    keys.begin();
+    keys.begin(true);
 
     Serial.println("WyKeyDisplay ready — 4 keys initialised");
 
@@ -50,6 +55,8 @@ void setup() {
 }
 
 void loop() {
+    keys.update();   /* flush a chunk of pending key damage, never blocks long */
+
     /* Example: update block height on key 0 every 6 seconds */
     static uint32_t lastUpdate = 0;
     static uint32_t fakeBlock  = 18700000;
@@ -107,6 +107,9 @@ void loop() {
     int tx, ty;
     bool touched = touch.getXY(&tx, &ty);
 
+    kb.tick();                       /* ends the key press highlight */
+    if (!touched) kb.release();      /* next touch is a new key press */
+
     if (kb.active() && touched) {
         WyKbResult res = kb.press(tx, ty);
 
@@ -25,6 +25,14 @@
  *   WySensorData d = sensors.read("env");
  *   Serial.printf("temp=%.1f hum=%.1f\n", d.temperature, d.humidity);
  *
+ *   // Or measure everything at once — conversions overlap, so this
+ *   // takes about as long as the slowest sensor, not the sum
+ *   sensors.sweep();
+ *   WySensorData t = sensors.result("water_temp");
+ *
+ *   // Fully non-blocking from loop():
+ *   //   sensors.start();  ...  if (sensors.poll()) use sensors.result(...)
+ *
  *   // Or get sensor directly
  *   auto* bme = sensors.get<WyBME280>("env");
  *   if (bme) bme->doSomethingSpecific();
@@ -33,7 +41,9 @@
  *   1. Create WyMyNewSensor.h in sensors/drivers/
  *   2. Inherit from WySensorBase
  *   3. Implement: begin(), read(), sensorType(), pinSchema()
- *   4. Done — registry handles everything else
+ *   4. If a reading has to wait on a conversion, override
+ *      startMeasurement() / poll() and make read() return _measure()
+ *   5. Done — registry handles everything else
  */
 
 #pragma once
@@ -46,6 +56,11 @@
 #define WY_SENSORS_MAX 8
 #endif
 
+/* ── sweep() gives up on sensors still converting after this ──── */
+#ifndef WY_SENSORS_SWEEP_MS
+#define WY_SENSORS_SWEEP_MS 3000
+#endif
+
 /* ══════════════════════════════════════════════════════════════════
  * WySensorData — typed result struct
  * All drivers populate what they support, leave rest at NaN / 0
@@ -81,6 +96,94 @@ public:
     virtual WySensorData read()       = 0;
     virtual const char*  driverName() = 0;  /* "BME280", "DHT22", etc. */
     bool ready = false;
+
+    /* ── Non-blocking measurement ─────────────────────────────────
+     * startMeasurement() kicks off a conversion and returns at once;
+     * poll() advances it and returns true once resultReady(), after
+     * which result() holds the reading. Drivers with a conversion
+     * time override both; the default runs the blocking read() from
+     * poll(), so every driver works with WySensors::sweep(). */
+    virtual bool startMeasurement() { _start(); return true; }
+
+    virtual bool poll() {
+        if (_busy) _finish(read());
+        return _done;
+    }
+
+    bool                resultReady() const { return _done; }
+    bool                busy()        const { return _busy; }
+    const WySensorData& result()      const { return _result; }
+
+protected:
+    WySensorData _result;
+    bool         _busy  = false;
+    bool         _done  = false;
+    uint32_t     _dueMs = 0;     /* millis() the current step may run */
+
+    void _start()                        { _busy = true; _done = false; }
+    void _finish(const WySensorData& d)  { _result = d; _busy = false; _done = true; }
+    bool _fail(const char* err) {
+        WySensorData d; d.error = err;
+        _finish(d);
+        return false;
+    }
+
+    /* Schedule the next step ms from now; _waiting() until then */
+    void _wait(uint32_t ms)  { _dueMs = millis() + ms; }
+    bool _waiting() const    { return (int32_t)(millis() - _dueMs) < 0; }
+
+    /* Blocking read() for state-machine drivers — same wire protocol,
+     * just driven to completion here instead of by the registry.
+     * A driver whose read() returns this must override poll(). */
+    WySensorData _measure(uint32_t timeoutMs = 2000) {
+        if (startMeasurement()) {
+            uint32_t t0 = millis();
+            while (!poll()) {
+                if (millis() - t0 > timeoutMs) { _fail("timeout"); break; }
+                delay(1);
+            }
+        }
+        return _result;
+    }
+};
+
+/* ══════════════════════════════════════════════════════════════════
+ * WyAnalogSampler — averaged analogRead() without delay()
+ * Takes n samples gapMs apart, the first settleMs after start().
+ * Analog drivers run it from poll(); their blocking helpers call
+ * run(), which spaces the samples exactly as the old delay() loops.
+ * ══════════════════════════════════════════════════════════════════ */
+class WyAnalogSampler {
+public:
+    void start(int8_t pin, uint8_t n, uint16_t gapMs = 2, uint16_t settleMs = 0) {
+        _pin = pin; _n = n ? n : 1; _gap = gapMs;
+        _got = 0; _sum = 0;
+        _due = millis() + settleMs;
+    }
+
+    /* Take the next sample if it is due — true once all n are in */
+    bool poll() {
+        if (_got >= _n) return true;
+        if ((int32_t)(millis() - _due) < 0) return false;
+        _sum += analogRead(_pin);
+        _due = millis() + _gap;
+        return ++_got >= _n;
+    }
+
+    uint16_t mean() const { return _got ? (uint16_t)(_sum / _got) : 0; }
+
+    uint16_t run(int8_t pin, uint8_t n, uint16_t gapMs = 2, uint16_t settleMs = 0) {
+        start(pin, n, gapMs, settleMs);
+        while (!poll()) delay(1);
+        return mean();
+    }
+
+private:
+    int8_t   _pin = -1;
+    uint8_t  _n   = 1, _got = 0;
+    uint16_t _gap = 0;
+    uint32_t _sum = 0;
+    uint32_t _due = 0;
 };
 
 /* ══════════════════════════════════════════════════════════════════
@@ -212,6 +315,63 @@ public:
         return slot->driver->read();
     }
 
+    /* ── Non-blocking sweep ───────────────────────────────────────
+     * start() kicks off a measurement on every ready sensor; call
+     * poll() from loop() until it returns true, then result(name).
+     * Conversions overlap, so a sweep costs about the slowest sensor
+     * (750ms for a 12-bit DS18B20) rather than the sum of them all. */
+    void start() {
+        for (uint8_t i = 0; i < WY_SENSORS_MAX; i++) {
+            WySensorBase* drv = _slots[i].driver;
+            if (_slots[i].inUse && drv && drv->ready) drv->startMeasurement();
+        }
+    }
+
+    /* Advance every in-flight measurement once — true when none left */
+    bool poll() {
+        bool idle = true;
+        for (uint8_t i = 0; i < WY_SENSORS_MAX; i++) {
+            WySensorBase* drv = _slots[i].driver;
+            if (!_slots[i].inUse || !drv || !drv->busy()) continue;
+            if (!drv->poll()) idle = false;
+        }
+        return idle;
+    }
+
+    /* start() + poll() to completion — returns how many read ok */
+    uint8_t sweep(uint32_t timeoutMs = WY_SENSORS_SWEEP_MS) {
+        start();
+        uint32_t t0 = millis();
+        while (!poll()) {
+            if (millis() - t0 > timeoutMs) {
+                Serial.println("[WySensors] sweep timeout");
+                break;
+            }
+            delay(1);
+        }
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < WY_SENSORS_MAX; i++) {
+            WySensorBase* drv = _slots[i].driver;
+            if (_slots[i].inUse && drv && drv->ready && drv->resultReady()
+                && drv->result().ok) n++;
+        }
+        return n;
+    }
+
+    /* Last completed measurement — does not touch the bus */
+    WySensorData result(const char* name) {
+        WySensorEntry* slot = _find(name);
+        if (!slot || !slot->driver || !slot->driver->ready) {
+            WySensorData err; err.error = "not found or not ready";
+            return err;
+        }
+        if (!slot->driver->resultReady()) {
+            WySensorData err; err.error = "no result yet";
+            return err;
+        }
+        return slot->driver->result();
+    }
+
     /* ── Get typed driver pointer by name ───────────────────────── */
     template<typename T>
     T* get(const char* name) {
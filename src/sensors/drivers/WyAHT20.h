@@ -46,8 +46,10 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
+
+    bool startMeasurement() override {
+        _start();
 
         /* Trigger measurement: 0xAC 0x33 0x00 */
         Wire.beginTransmission(_pins.addr);
@@ -56,17 +58,26 @@ public:
         Wire.write(0x00);
         Wire.endTransmission();
 
-        /* Wait for measurement (max 80ms) */
-        delay(80);
-        uint32_t t = millis();
-        while (_readStatus() & AHT20_STATUS_BUSY) {
-            if (millis() - t > 100) { d.error = "timeout"; return d; }
-            delay(5);
+        /* Measurement takes up to 80ms, then poll busy for up to 100ms */
+        _trigMs = millis();
+        _wait(80);
+        return true;
+    }
+
+    bool poll() override {
+        if (!_busy) return _done;
+        if (_waiting()) return false;
+
+        if (_readStatus() & AHT20_STATUS_BUSY) {
+            if (millis() - _trigMs > 180) { _fail("timeout"); return true; }
+            _wait(5);
+            return false;
         }
 
+        WySensorData d;
         /* Read 6 bytes: status, hum[20bit], temp[20bit] */
         Wire.requestFrom(_pins.addr, (uint8_t)6);
-        if (Wire.available() < 6) { d.error = "no data"; return d; }
+        if (Wire.available() < 6) { _fail("no data"); return true; }
 
         uint8_t buf[6];
         for (uint8_t i = 0; i < 6; i++) buf[i] = Wire.read();
@@ -84,12 +95,14 @@ public:
         d.humidity    = (raw_h * 100.0f) / 1048576.0f;       /* / 2^20 * 100 */
         d.temperature = (raw_t * 200.0f / 1048576.0f) - 50.0f; /* / 2^20 * 200 - 50 */
         d.ok = true;
-        return d;
+        _finish(d);
+        return true;
     }
 
 private:
     WyI2CPins _pins;
     bool      _isAHT10;
+    uint32_t  _trigMs = 0;
 
     uint8_t _readStatus() {
         Wire.requestFrom(_pins.addr, (uint8_t)1);
@@ -42,32 +42,35 @@ public:
         delay(10);
         _sendCmd(BH1750_RESET);
         delay(10);
-        _sendCmd(_mode);
-
-        /* Verify by reading a plausible value (all 0xFF = not connected) */
-        delay(180);  /* wait for first measurement */
-        Wire.requestFrom(_pins.addr, (uint8_t)2);
-        if (!Wire.available()) return false;
-        uint8_t hi = Wire.read();
-        uint8_t lo = Wire.read();
-        uint16_t raw = (hi << 8) | lo;
-        return (raw != 0xFFFF);
+        /* Verify the mode write was ACKed — the first measurement is
+         * not due for 180ms, so the first poll() waits for it instead */
+        Wire.beginTransmission(_pins.addr);
+        Wire.write(_mode);
+        if (Wire.endTransmission() != 0) return false;
+        _wait(_convMs());
+        return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
 
-        /* For one-shot modes, trigger before read */
-        bool oneShot = (_mode == BH1750_MODE_ONE_HIGH  ||
-                        _mode == BH1750_MODE_ONE_HIGH2 ||
-                        _mode == BH1750_MODE_ONE_LOW);
-        if (oneShot) {
+    bool startMeasurement() override {
+        _start();
+        /* For one-shot modes, trigger before read; continuous modes
+         * only wait out whatever is left of a mode change */
+        if (_oneShot()) {
             _sendCmd(_mode);
-            delay(_mode == BH1750_MODE_ONE_LOW ? 24 : 180);
+            _wait(_convMs());
         }
+        return true;
+    }
 
+    bool poll() override {
+        if (!_busy) return _done;
+        if (_waiting()) return false;
+
+        WySensorData d;
         Wire.requestFrom(_pins.addr, (uint8_t)2);
-        if (Wire.available() < 2) { d.error = "no data"; return d; }
+        if (Wire.available() < 2) { _fail("no data"); return true; }
 
         uint16_t raw = ((uint16_t)Wire.read() << 8) | Wire.read();
 
@@ -79,19 +82,32 @@ public:
             d.light = raw / 1.2f;
 
         d.ok = true;
-        return d;
+        _finish(d);
+        return true;
     }
 
     /* Change measurement mode on the fly */
     void setMode(uint8_t mode) {
         _mode = mode;
         _sendCmd(_mode);
+        _wait(_convMs());
     }
 
 private:
     WyI2CPins _pins;
     uint8_t   _mode;
 
+    bool _oneShot() {
+        return _mode == BH1750_MODE_ONE_HIGH  ||
+               _mode == BH1750_MODE_ONE_HIGH2 ||
+               _mode == BH1750_MODE_ONE_LOW;
+    }
+
+    /* Worst-case conversion time for the current mode */
+    uint16_t _convMs() {
+        return (_mode == BH1750_MODE_CONT_LOW || _mode == BH1750_MODE_ONE_LOW) ? 24 : 180;
+    }
+
     void _sendCmd(uint8_t cmd) {
         Wire.beginTransmission(_pins.addr);
         Wire.write(cmd);
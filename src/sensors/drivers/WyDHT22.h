@@ -20,38 +20,46 @@ public:
 
     bool begin() override {
         pinMode(_pin, INPUT_PULLUP);
-        delay(2000);  /* DHT22 needs 2s after power-on */
+        _wait(2000);  /* DHT22 needs 2s after power-on — first poll() waits */
         return true;
     }
 
-    WySensorData read() override {
+    WySensorData read() override { return _measure(2500); }
+
+    /* Polls report busy until the power-on settle time is up, then one
+     * poll() runs the whole exchange: start pulse (18ms DHT11, 1ms DHT22)
+     * and the ~5ms 40-bit frame. The pulse stays inline — split across
+     * polls, a late loop() would hold the line low past the sensor's limit */
+    bool poll() override {
+        if (!_busy) return _done;
+        if (_waiting()) return false;
+
         WySensorData d;
         uint8_t data[5] = {0};
-
-        /* Send start signal */
         pinMode(_pin, OUTPUT);
         digitalWrite(_pin, LOW);
-        delay(_model == 11 ? 18 : 1);
+        if (_model == 11) delay(18);
+        else              delayMicroseconds(1100);
         digitalWrite(_pin, HIGH);
         delayMicroseconds(30);
         pinMode(_pin, INPUT_PULLUP);
 
         /* Wait for sensor response */
-        if (!_waitLevel(LOW,  80)) { d.error = "no response (low)";  return d; }
-        if (!_waitLevel(HIGH, 80)) { d.error = "no response (high)"; return d; }
-        if (!_waitLevel(LOW,  80)) { d.error = "no response (sync)"; return d; }
+        if (!_waitLevel(LOW,  80)) { _fail("no response (low)");  return true; }
+        if (!_waitLevel(HIGH, 80)) { _fail("no response (high)"); return true; }
+        if (!_waitLevel(LOW,  80)) { _fail("no response (sync)"); return true; }
 
         /* Read 40 bits */
         for (uint8_t i = 0; i < 40; i++) {
-            if (!_waitLevel(HIGH, 50)) { d.error = "read timeout"; return d; }
+            if (!_waitLevel(HIGH, 50)) { _fail("read timeout"); return true; }
             uint32_t t = micros();
-            if (!_waitLevel(LOW, 70))  { d.error = "bit timeout";  return d; }
+            if (!_waitLevel(LOW, 70))  { _fail("bit timeout");  return true; }
             if (micros() - t > 35) data[i/8] |= (1 << (7 - i%8));
         }
 
         /* Checksum */
         if (((data[0]+data[1]+data[2]+data[3]) & 0xFF) != data[4]) {
-            d.error = "checksum fail"; return d;
+            _fail("checksum fail"); return true;
         }
 
         if (_model == 11) {
@@ -63,7 +71,8 @@ public:
             d.temperature = raw_t * 0.1f * (data[2] & 0x80 ? -1 : 1);
         }
         d.ok = true;
-        return d;
+        _finish(d);
+        return true;
     }
 
 private:
@@ -12,9 +12,12 @@
  *   addGPIO<WyDS18B20>("inlet",   4, 2) // pin2 = index 2 (third found)
  *
  * Non-blocking (start conversion, read later):
- *   ds->startConversion();
- *   delay(750);                          // or do other work
- *   float t = ds->readTemperature();
+ *   ds->startMeasurement();
+ *   while (!ds->poll()) { do other work }   // ~750ms at 12-bit
+ *   float t = ds->result().temperature;
+ *
+ *   sensors.sweep() does the same for every registered sensor, so a
+ *   12-bit DS18B20 no longer adds its 750ms on top of everything else.
  *
  * ═══════════════════════════════════════════════════════════════════
  * WIRING
@@ -143,22 +146,40 @@ public:
     }
 
     /* ── Blocking read (starts conversion + waits + returns temp) ── */
-    WySensorData read() override {
+    WySensorData read() override { return _measure(); }
+
+    /* ── Non-blocking API ─────────────────────────────────────────── */
+
+    bool startMeasurement() override {
+        _start();
+        if (!startConversion()) return _fail("no presence pulse");
+        _convStart = millis();
+        _wait(0);
+        return true;
+    }
+
+    /* One read slot every 5ms: the sensor holds DQ low until the
+     * conversion completes (externally powered mode) */
+    bool poll() override {
+        if (!_busy) return _done;
+        if (_waiting()) return false;
+        if (!_readBit()) {
+            if (millis() - _convStart > (uint32_t)_convMs() + 50) {
+                _fail("conversion timeout");
+                return true;
+            }
+            _wait(5);
+            return false;
+        }
         WySensorData d;
-        startConversion();
-        uint32_t deadline = millis() + _convMs() + 50;
-        /* Busy-wait on conversion complete bit */
-        while (!_readBit() && millis() < deadline) yield();
-        if (millis() >= deadline) { d.error = "conversion timeout"; return d; }
         float t = readTemperature();
-        if (isnan(t)) { d.error = "CRC fail"; return d; }
+        if (isnan(t)) { _fail("CRC fail"); return true; }
         d.temperature = t;
         d.ok = true;
-        return d;
+        _finish(d);
+        return true;
     }
 
-    /* ── Non-blocking API ─────────────────────────────────────────── */
-
     /* Start temperature conversion. Returns immediately.
      * Wait conversionMs() before calling readTemperature(). */
     bool startConversion() {
@@ -208,6 +229,7 @@ private:
     uint8_t _res;
     uint8_t _rom[8];
     bool    _hasROM = false;
+    uint32_t _convStart = 0;
 
     void _selectDevice() {
         if (_hasROM) {
@@ -138,6 +138,31 @@ public:
         return d;
     }
 
+    /* ── Optional: non-blocking measurement ─────────────────────────
+     * If the sensor needs a trigger and then a conversion wait, don't
+     * delay() in read(). Split it so WySensors::sweep() can overlap it
+     * with the other sensors (see WySHT31.h for the smallest example):
+     *
+     *   WySensorData read() override { return _measure(); }
+     *
+     *   bool startMeasurement() override {
+     *       _start();
+     *       _writeReg(MY_SENSOR_REG_TRIGGER, 0x01);
+     *       _wait(MY_SENSOR_CONV_MS);          // instead of delay()
+     *       return true;
+     *   }
+     *
+     *   bool poll() override {
+     *       if (!_busy) return _done;
+     *       if (_waiting()) return false;
+     *       WySensorData d;
+     *       ... read + convert as above ...
+     *       _finish(d);                         // or _fail("no data")
+     *       return true;
+     *   }
+     *
+     * Analog drivers that average N samples use WyAnalogSampler. */
+
 private:
     WyI2CPins _pins;  /* TODO: match your bus type */
 
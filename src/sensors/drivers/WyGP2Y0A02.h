@@ -104,10 +104,42 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
+
+    bool startMeasurement() override {
+        _start();
+        _adc.start(_pin, WY_GP2Y_SAMPLES, 2);
+        return true;
+    }
+
+    bool poll() override {
+        if (!_busy) return _done;
+        if (!_adc.poll()) return false;
+        _finish(_fromMV(_toMV(_adc.mean())));
+        return true;
+    }
 
-        float vMV = _readVoltageMV();
+    /* Get distance in cm directly */
+    float readCm() {
+        WySensorData d = read();
+        return d.ok ? d.raw : -1.0f;
+    }
+
+    /* Get raw voltage (useful for custom curve fitting) */
+    float readMV() { return _readVoltageMV(); }
+
+    /* User-supplied custom curve constants (if datasheet values don't fit your unit) */
+    void setCurve(float A, float B) { _customA = A; _customB = B; _useCustom = true; }
+    void clearCustomCurve()         { _useCustom = false; }
+
+private:
+    int8_t _pin;
+    bool   _useCustom = false;
+    float  _customA = 0, _customB = 0;
+    WyAnalogSampler _adc;
+
+    WySensorData _fromMV(float vMV) {
+        WySensorData d;
         float vV  = vMV / 1000.0f;
 
         /* Guard: very low voltage means nothing in range or sensor disconnected */
@@ -141,34 +173,15 @@ public:
         return d;
     }
 
-    /* Get distance in cm directly */
-    float readCm() {
-        WySensorData d = read();
-        return d.ok ? d.raw : -1.0f;
+    /* Stagger reads — sensor has ~38ms internal LED cycle.
+     * Reading faster than that gets repeated ADC samples.
+     * WY_GP2Y_SAMPLES × 2ms gap = ~10ms spread; good enough for averaging noise. */
+    float _readVoltageMV() {
+        WyAnalogSampler s;  /* own sampler — don't disturb a poll() in flight */
+        return _toMV(s.run(_pin, WY_GP2Y_SAMPLES, 2));
     }
 
-    /* Get raw voltage (useful for custom curve fitting) */
-    float readMV() { return _readVoltageMV(); }
-
-    /* User-supplied custom curve constants (if datasheet values don't fit your unit) */
-    void setCurve(float A, float B) { _customA = A; _customB = B; _useCustom = true; }
-    void clearCustomCurve()         { _useCustom = false; }
-
-private:
-    int8_t _pin;
-    bool   _useCustom = false;
-    float  _customA = 0, _customB = 0;
-
-    float _readVoltageMV() {
-        /* Stagger reads — sensor has ~38ms internal LED cycle.
-         * Reading faster than that gets repeated ADC samples.
-         * WY_GP2Y_SAMPLES × 2ms delay = ~10ms spread; good enough for averaging noise. */
-        int64_t sum = 0;
-        for (uint8_t i = 0; i < WY_GP2Y_SAMPLES; i++) {
-            sum += analogRead(_pin);
-            delay(2);
-        }
-        float raw = (float)(sum / WY_GP2Y_SAMPLES);
+    float _toMV(uint16_t raw) {
         return (raw / (float)((1 << WY_GP2Y_ADC_BITS) - 1)) * WY_GP2Y_VREF_MV;
     }
 };
@@ -162,16 +162,43 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
 
-        /* Average ADC readings */
-        uint32_t sum = 0;
-        for (uint8_t i = 0; i < _samples; i++) {
-            sum += analogRead(_aoPin);
-            delay(2);
-        }
-        uint16_t raw = (uint16_t)(sum / _samples);
+    /* Averaging runs one ADC sample per poll(), 2ms apart */
+    bool startMeasurement() override {
+        _start();
+        _adc.start(_aoPin, _samples, 2);
+        return true;
+    }
+
+    bool poll() override {
+        if (!_busy) return _done;
+        if (!_adc.poll()) return false;
+        _finish(_fromRaw(_adc.mean()));
+        return true;
+    }
+
+    /* UVI category label */
+    const char* uviLabel() {
+        static const char* labels[] = {"Low", "Moderate", "High", "Very High", "Extreme"};
+        WySensorData d = read();
+        uint8_t cat = (uint8_t)d.humidity;
+        return labels[cat < 5 ? cat : 4];
+    }
+
+    /* UVI only — lightweight read */
+    float readUVI() { return read().raw; }
+
+private:
+    int8_t  _aoPin       = -1;
+    float   _divRatio    = 1.0f;
+    float   _sensitivity = WY_UV_SENSITIVITY_V_PER_MW;
+    float   _darkV       = 0.0f;
+    uint8_t _samples     = WY_UV_SAMPLES;
+    WyAnalogSampler _adc;
+
+    WySensorData _fromRaw(uint16_t raw) {
+        WySensorData d;
 
         /* ADC raw → voltage at ADC pin → actual sensor voltage */
         float adcV    = (raw / 4095.0f) * 3.3f;
@@ -195,24 +222,6 @@ public:
         return d;
     }
 
-    /* UVI category label */
-    const char* uviLabel() {
-        static const char* labels[] = {"Low", "Moderate", "High", "Very High", "Extreme"};
-        WySensorData d = read();
-        uint8_t cat = (uint8_t)d.humidity;
-        return labels[cat < 5 ? cat : 4];
-    }
-
-    /* UVI only — lightweight read */
-    float readUVI() { return read().raw; }
-
-private:
-    int8_t  _aoPin       = -1;
-    float   _divRatio    = 1.0f;
-    float   _sensitivity = WY_UV_SENSITIVITY_V_PER_MW;
-    float   _darkV       = 0.0f;
-    uint8_t _samples     = WY_UV_SAMPLES;
-
     uint8_t _uviCategory(float uvi) {
         if (uvi < 3.0f)  return 0;  /* Low */
         if (uvi < 6.0f)  return 1;  /* Moderate */
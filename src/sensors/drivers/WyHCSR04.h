@@ -156,41 +156,51 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
 
-        if (_samples == 1) {
-            float cm = _singleMeasure();
-            if (cm < 0) { d.error = "out of range"; return d; }
-            d.distance = cm * 10.0f;
-            d.raw      = cm;
-            d.ok       = true;
-        } else {
-            /* Median filter: take N readings, sort, return middle value */
-            float buf[7] = {};
-            uint8_t valid = 0;
-            for (uint8_t i = 0; i < _samples; i++) {
-                float cm = _singleMeasure();
-                if (cm > 0) buf[valid++] = cm;
-                delay(HCSR04_MIN_INTERVAL_MS);  /* sensor recovery time */
-            }
-            if (valid == 0) { d.error = "all samples failed"; return d; }
+    /* One ping per poll(), HCSR04_MIN_INTERVAL_MS apart. The echo
+     * itself (up to HCSR04_TIMEOUT_US) is still timed in-line — only
+     * the recovery gaps between median samples stop blocking. */
+    bool startMeasurement() override {
+        _start();
+        _taken = 0;
+        _valid = 0;
+        _wait(0);
+        return true;
+    }
+
+    bool poll() override {
+        if (!_busy) return _done;
+        if (_waiting()) return false;
+
+        float cm = _singleMeasure();
+        if (cm > 0) _buf[_valid++] = cm;
+        if (++_taken < _samples) {
+            _wait(HCSR04_MIN_INTERVAL_MS);  /* sensor recovery time */
+            return false;
+        }
 
-            /* Simple insertion sort on small array */
-            for (uint8_t i = 1; i < valid; i++) {
-                float key = buf[i];
-                int8_t j = i - 1;
-                while (j >= 0 && buf[j] > key) { buf[j+1] = buf[j]; j--; }
-                buf[j+1] = key;
-            }
+        WySensorData d;
+        if (_valid == 0) {
+            _fail(_samples == 1 ? "out of range" : "all samples failed");
+            return true;
+        }
 
-            float median = buf[valid / 2];
-            d.distance = median * 10.0f;  /* mm */
-            d.raw      = median;          /* cm */
-            d.rawInt   = valid;           /* how many valid samples */
-            d.ok       = true;
+        /* Median filter: sort the valid readings, take the middle one */
+        for (uint8_t i = 1; i < _valid; i++) {
+            float key = _buf[i];
+            int8_t j = i - 1;
+            while (j >= 0 && _buf[j] > key) { _buf[j+1] = _buf[j]; j--; }
+            _buf[j+1] = key;
         }
-        return d;
+
+        float median = _buf[_valid / 2];
+        d.distance = median * 10.0f;  /* mm */
+        d.raw      = median;          /* cm */
+        d.rawInt   = _valid;          /* how many valid samples */
+        d.ok       = true;
+        _finish(d);
+        return true;
     }
 
     /* Convenience: direct unit reads (takes a fresh measurement each call) */
@@ -206,6 +216,9 @@ private:
     uint8_t _samples = 3;
     float   _minCm   = 2.0f;
     float   _maxCm   = 400.0f;
+    float   _buf[7]  = {};     /* median samples for the measurement in flight */
+    uint8_t _taken   = 0;
+    uint8_t _valid   = 0;
 
     float _singleMeasure() {
         /* Enforce minimum inter-measurement interval */
@@ -68,6 +68,7 @@ public:
         return true;
     }
 
+    /* Immediate: reports "not ready" between conversions (10/80 SPS) */
     WySensorData read() override {
         WySensorData d;
         if (!isReady()) {
@@ -82,6 +83,24 @@ public:
         return d;
     }
 
+    /* Measurement waits for DOUT to drop instead of failing — at
+     * 10 SPS that can be up to 100ms, which overlaps in a sweep */
+    bool startMeasurement() override {
+        _start();
+        _readyStart = millis();
+        return true;
+    }
+
+    bool poll() override {
+        if (!_busy) return _done;
+        if (!isReady()) {
+            if (millis() - _readyStart > 200) { _fail("not ready"); return true; }
+            return false;
+        }
+        _finish(read());
+        return true;
+    }
+
     /* ── Scale control ─────────────────────────────────────────── */
 
     /* Tare: record current reading as zero (average N samples) */
@@ -132,6 +151,7 @@ private:
     int32_t  _tare       = 0;
     int32_t  _lastRaw    = 0;
     float    _calibFactor = 1.0f;
+    uint32_t _readyStart  = 0;
 
     int32_t _readRaw() {
         uint32_t data = 0;
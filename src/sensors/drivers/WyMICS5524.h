@@ -203,18 +203,31 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
 
+    /* Averaging runs one ADC sample per poll(), 2ms apart; during
+     * warm-up the measurement completes at once with the countdown */
+    bool startMeasurement() override {
+        _start();
         if (!isWarmedUp()) {
+            WySensorData d;
             uint32_t remaining = _warmupSec - ((millis() - _startMs) / 1000);
             d.error = "warming up";
             d.raw   = (float)remaining;   /* seconds remaining */
-            return d;
+            _finish(d);
+            return true;
         }
+        _adc.start(_aoPin, _samples, 2);
+        return true;
+    }
 
-        float rs = _readRsKOhm();
-        if (rs <= 0) { d.error = "read error"; return d; }
+    bool poll() override {
+        if (!_busy) return _done;
+        if (!_adc.poll()) return false;
+
+        WySensorData d;
+        float rs = _rawToRs(_adc.mean());
+        if (rs <= 0) { _fail("read error"); return true; }
 
         float ratio = rs / _r0KOhm;
 
@@ -230,7 +243,8 @@ public:
         d.rawInt = (uint32_t)(ratio * 100); /* Rs/R0 × 100 (integer) */
         d.voltage = rs;                      /* Rs in kΩ */
         d.ok      = true;
-        return d;
+        _finish(d);
+        return true;
     }
 
     /* ppm for specific gas (uses gas curve) */
@@ -252,14 +266,14 @@ private:
     uint8_t  _samples    = WY_MICS5524_SAMPLES;
     uint32_t _startMs    = 0;
 
+    WyAnalogSampler _adc;
+
     float _readRsKOhm() {
-        uint32_t sum = 0;
-        for (uint8_t i = 0; i < _samples; i++) {
-            sum += analogRead(_aoPin);
-            delay(2);
-        }
-        uint16_t raw = (uint16_t)(sum / _samples);
+        WyAnalogSampler s;  /* own sampler — don't disturb a poll() in flight */
+        return _rawToRs(s.run(_aoPin, _samples, 2));
+    }
 
+    float _rawToRs(uint16_t raw) {
         /* ADC → voltage at ADC pin → actual sensor output voltage */
         float adcV  = (raw / 4095.0f) * 3.3f;
         float vout  = adcV / _divRatio;   /* actual Vout from sensor circuit */
@@ -0,0 +1,361 @@
+/*
+ * drivers/WyMLX90640Blobs.h — hot regions and tracks over MLX90640 frames
+ * =======================================================================
+ * Connected hot regions of a 32×24 °C frame, and IDs that follow them
+ * from frame to frame. Pure C++, fixed size, no allocation — works on
+ * any float[768] (WyMLX90640::pixels(), copyFrame(), a recording).
+ *
+ *   WyMlxBlobs    adaptive threshold + union-find labelling → up to
+ *                 WY_MLX_MAX_BLOBS blobs: centroid, area, peak, bbox
+ *   WyMlxTracker  nearest-centroid matching with a velocity prediction
+ *                 → up to WY_MLX_MAX_TRACKS tracks with stable IDs;
+ *                 tracks whose blobs merge coast until they split
+ *
+ * Threshold: background = frame median, spread = 1.4826 × median
+ * absolute deviation (both from 256-bin histograms, O(n)), hot =
+ * above background + max(minDelta, k × spread). Medians ignore the
+ * hot pixels themselves, so a person filling a third of the frame
+ * doesn't drag the threshold up and shrink. setThreshold() pins it.
+ *
+ * Labelling is one raster pass of union-find (4- or 8-connected) with
+ * path halving, then one pass to size the components and one to
+ * measure the largest WY_MLX_MAX_BLOBS. Centroids are weighted by
+ * degrees above threshold — sub-pixel, and stable as a blob's edge
+ * pixels flicker in and out.
+ *
+ * RAM: ~3.9 KB per WyMlxBlobs, ~0.6 KB per WyMlxTracker.
+ *
+ *   WyMlxBlobs   blobs;
+ *   WyMlxTracker people;
+ *   ...
+ *   if (sensors.read("thermal").ok) {
+ *       blobs.find(cam->pixels());
+ *       people.update(blobs.blobs(), blobs.count());
+ *       for (uint8_t i = 0; i < people.count(); i++) {
+ *           const WyMlxTrack& t = people.track(i);   // t.id, t.cx, t.cy ...
+ *       }
+ *       uint8_t n; const WyMlxTrack* gone = people.ended(n);
+ *       for (uint8_t i = 0; i < n; i++)               // left the frame:
+ *           if (gone[i].x0 < 16 && gone[i].cx >= 16) in++;   // crossed the middle
+ *   }
+ */
+
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "WyMLX90640Core.h"
+
+#ifndef WY_MLX_MAX_BLOBS
+#define WY_MLX_MAX_BLOBS   16      /* blobs kept per frame, largest first */
+#endif
+#ifndef WY_MLX_MAX_TRACKS
+#define WY_MLX_MAX_TRACKS  8
+#endif
+
+/* ── Blobs ──────────────────────────────────────────────────────── */
+
+struct WyMlxBlob {
+    float    cx, cy;         /* centroid, px (col, row), weighted by T − threshold */
+    float    peak;           /* hottest pixel, °C */
+    float    mean;           /* mean temperature, °C */
+    uint16_t area;           /* pixels */
+    uint16_t peakIdx;        /* row * 32 + col */
+    uint8_t  x0, y0, x1, y1; /* bounding box, inclusive */
+};
+
+class WyMlxBlobs {
+public:
+    /* Adaptive: hot = background + max(minDelta, k × spread) */
+    void setDelta(float minDelta, float k = 4.0f) { _minDelta = minDelta; _k = k; }
+    /* Fixed threshold in °C; NAN goes back to adaptive */
+    void setThreshold(float t)      { _fixed = t; }
+    void setMinArea(uint16_t a)     { _minArea = a ? a : 1; }
+    void setConnectivity(uint8_t c) { _conn8 = c == 8; }
+
+    /* Label a 32×24 frame; returns the number of blobs found */
+    uint8_t find(const float *px) {
+        _n = 0;
+        _thr = isnan(_fixed) ? _adaptive(px) : _fixed;
+
+        /* Pass 1: union-find over hot pixels. Cold pixels park at a
+           sentinel; a hot pixel starts as its own root and joins its
+           already-visited neighbours (left, up, and the up diagonals
+           when 8-connected). */
+        for (int i = 0; i < MLX_PIXEL_COUNT; i++) {
+            if (!(px[i] > _thr)) { _parent[i] = COLD; continue; }
+            _parent[i] = (uint16_t)i;
+            int row = i / MLX_COLS, col = i % MLX_COLS;
+            if (col > 0 && _parent[i - 1] != COLD) _union(i, i - 1);
+            if (row > 0) {
+                int up = i - MLX_COLS;
+                if (_parent[up] != COLD) _union(i, up);
+                if (_conn8) {
+                    if (col > 0 && _parent[up - 1] != COLD)              _union(i, up - 1);
+                    if (col < MLX_COLS - 1 && _parent[up + 1] != COLD)   _union(i, up + 1);
+                }
+            }
+        }
+
+        /* Pass 2: flatten, size each component at its root */
+        memset(_size, 0, sizeof(_size));
+        for (int i = 0; i < MLX_PIXEL_COUNT; i++)
+            if (_parent[i] != COLD) { _parent[i] = _find((uint16_t)i); _size[_parent[i]]++; }
+
+        /* Keep the largest WY_MLX_MAX_BLOBS roots at or above minArea,
+           largest first (ties: first in raster order) */
+        uint16_t root[WY_MLX_MAX_BLOBS];
+        for (int i = 0; i < MLX_PIXEL_COUNT; i++) {
+            if (_parent[i] != i || _size[i] < _minArea) continue;
+            int at = _n;
+            while (at > 0 && _size[root[at - 1]] < _size[i]) at--;
+            if (at >= WY_MLX_MAX_BLOBS) continue;
+            int last = _n < WY_MLX_MAX_BLOBS ? _n : WY_MLX_MAX_BLOBS - 1;
+            for (int j = last; j > at; j--) root[j] = root[j - 1];
+            root[at] = (uint16_t)i;
+            if (_n < WY_MLX_MAX_BLOBS) _n++;
+        }
+        memset(_slot, 0xFF, sizeof(_slot));
+        for (int b = 0; b < _n; b++) _slot[root[b]] = (uint8_t)b;
+
+        /* Pass 3: measure the kept blobs */
+        float wsum[WY_MLX_MAX_BLOBS], sx[WY_MLX_MAX_BLOBS], sy[WY_MLX_MAX_BLOBS], st[WY_MLX_MAX_BLOBS];
+        for (int b = 0; b < _n; b++) {
+            WyMlxBlob &o = _blob[b];
+            o.area = 0; o.peak = -1e9f; o.peakIdx = 0;
+            o.x0 = o.y0 = 255; o.x1 = o.y1 = 0;
+            wsum[b] = sx[b] = sy[b] = st[b] = 0;
+        }
+        for (int i = 0; i < MLX_PIXEL_COUNT; i++) {
+            if (_parent[i] == COLD) continue;
+            uint8_t b = _slot[_parent[i]];
+            if (b == 0xFF) continue;
+            WyMlxBlob &o = _blob[b];
+            uint8_t row = (uint8_t)(i / MLX_COLS), col = (uint8_t)(i % MLX_COLS);
+            float w = px[i] - _thr;
+            wsum[b] += w; sx[b] += w * col; sy[b] += w * row; st[b] += px[i];
+            o.area++;
+            if (px[i] > o.peak) { o.peak = px[i]; o.peakIdx = (uint16_t)i; }
+            if (col < o.x0) o.x0 = col;
+            if (col > o.x1) o.x1 = col;
+            if (row < o.y0) o.y0 = row;
+            if (row > o.y1) o.y1 = row;
+        }
+        for (int b = 0; b < _n; b++) {
+            _blob[b].cx   = sx[b] / wsum[b];
+            _blob[b].cy   = sy[b] / wsum[b];
+            _blob[b].mean = st[b] / _blob[b].area;
+        }
+        return _n;
+    }
+
+    uint8_t          count() const          { return _n; }
+    const WyMlxBlob *blobs() const          { return _blob; }
+    const WyMlxBlob &blob(uint8_t i) const  { return _blob[i]; }
+    float            threshold() const      { return _thr; }
+    float            background() const     { return _bg; }
+
+    /* Blob index of a pixel after find(), -1 = not in a kept blob */
+    int labelAt(int i) const {
+        if (i < 0 || i >= MLX_PIXEL_COUNT || _parent[i] == COLD) return -1;
+        uint8_t b = _slot[_parent[i]];
+        return b == 0xFF ? -1 : b;
+    }
+
+private:
+    static const uint16_t COLD = 0xFFFF;
+
+    uint16_t  _parent[MLX_PIXEL_COUNT];
+    uint16_t  _size[MLX_PIXEL_COUNT];      /* also the threshold histograms */
+    uint8_t   _slot[MLX_PIXEL_COUNT];      /* root → blob index, 0xFF = dropped */
+    WyMlxBlob _blob[WY_MLX_MAX_BLOBS];
+    uint8_t   _n = 0;
+    float     _thr = 0, _bg = 0;
+    float     _fixed = NAN, _minDelta = 2.0f, _k = 4.0f;
+    uint16_t  _minArea = 2;
+    bool      _conn8 = true;
+
+    uint16_t _find(uint16_t i) {
+        while (_parent[i] != i) { _parent[i] = _parent[_parent[i]]; i = _parent[i]; }
+        return i;
+    }
+    void _union(int a, int b) {
+        uint16_t ra = _find((uint16_t)a), rb = _find((uint16_t)b);
+        if (ra == rb) return;
+        if (ra < rb) _parent[rb] = ra; else _parent[ra] = rb;   /* lowest index is the root */
+    }
+
+    /* Median of v[] (NaN skipped) from a 256-bin histogram over [lo, hi] */
+    float _median(const float *v, bool absDev, float centre, float lo, float hi, int n) {
+        uint16_t *hist = _size;
+        memset(hist, 0, 256 * sizeof(uint16_t));
+        float scale = hi > lo ? 255.999f / (hi - lo) : 0.0f;
+        for (int i = 0; i < MLX_PIXEL_COUNT; i++) {
+            if (isnan(v[i])) continue;
+            float x = absDev ? fabsf(v[i] - centre) : v[i];
+            hist[(int)((x - lo) * scale)]++;
+        }
+        int half = (n + 1) / 2, acc = 0, bin = 0;
+        while (bin < 255 && (acc += hist[bin]) < half) bin++;
+        return lo + (bin + 0.5f) * (hi - lo) / 256.0f;
+    }
+
+    float _adaptive(const float *px) {
+        float lo = 1e9f, hi = -1e9f;
+        int n = 0;
+        for (int i = 0; i < MLX_PIXEL_COUNT; i++) {
+            if (isnan(px[i])) continue;
+            if (px[i] < lo) lo = px[i];
+            if (px[i] > hi) hi = px[i];
+            n++;
+        }
+        if (!n) { _bg = 0; return INFINITY; }
+        _bg = _median(px, false, 0, lo, hi, n);
+        float dev = fmaxf(hi - _bg, _bg - lo);
+        float spread = 1.4826f * _median(px, true, _bg, 0.0f, dev, n);
+        return _bg + fmaxf(_minDelta, _k * spread);
+    }
+};
+
+/* ── Tracks ─────────────────────────────────────────────────────── */
+
+struct WyMlxTrack {
+    uint16_t id;             /* 1, 2, 3 … in order of appearance */
+    float    cx, cy;         /* last centroid (coasting while missed) */
+    float    vx, vy;         /* px per frame, smoothed */
+    float    x0, y0;         /* where it was first seen */
+    float    peak;
+    uint16_t area;
+    uint16_t age;            /* frames since first seen */
+    uint8_t  missed;         /* consecutive frames without a match */
+};
+
+class WyMlxTracker {
+public:
+    /* Max distance (px) between a track's predicted and a blob's centroid */
+    void setGate(float px)       { _gate = px; }
+    /* Frames a track coasts unmatched before it ends */
+    void setKeep(uint8_t frames) { _keep = frames; }
+    void reset()                 { _n = 0; _nEnded = 0; }
+
+    /*
+     * Match blobs to tracks: every (track, blob) pair within the gate of
+     * the track's predicted position, closest pairs first, each track
+     * and blob used once. A track left without a blob may share one
+     * that's 1.5× its own area: a merge — every track on it coasts
+     * until they split. Unmatched blobs start tracks (while slots are free); unmatched
+     * tracks coast on their velocity and end after setKeep() frames.
+     * Returns the number of live tracks.
+     */
+    uint8_t update(const WyMlxBlob *blobs, uint8_t nb) {
+        if (nb > WY_MLX_MAX_BLOBS) nb = WY_MLX_MAX_BLOBS;
+        _nEnded = 0;
+
+        struct Pair { float d2; uint8_t t, b; };
+        Pair pair[WY_MLX_MAX_TRACKS * WY_MLX_MAX_BLOBS];
+        int np = 0;
+        float gate2 = _gate * _gate;
+        for (uint8_t t = 0; t < _n; t++) {
+            float px = _track[t].cx + _track[t].vx, py = _track[t].cy + _track[t].vy;
+            for (uint8_t b = 0; b < nb; b++) {
+                float dx = blobs[b].cx - px, dy = blobs[b].cy - py, d2 = dx * dx + dy * dy;
+                if (d2 > gate2) continue;
+                int at = np++;
+                while (at > 0 && pair[at - 1].d2 > d2) { pair[at] = pair[at - 1]; at--; }
+                pair[at] = { d2, t, b };
+            }
+        }
+
+        /* Closest pairs first, one blob per track. A track left over may
+           still share a blob within its gate — two people merged into
+           one region. */
+        int8_t  tBlob[WY_MLX_MAX_TRACKS];
+        uint8_t bUsed[WY_MLX_MAX_BLOBS] = {}, merged[WY_MLX_MAX_BLOBS] = {};
+        memset(tBlob, -1, sizeof(tBlob));
+        for (int i = 0; i < np; i++) {
+            if (tBlob[pair[i].t] >= 0 || bUsed[pair[i].b]) continue;
+            tBlob[pair[i].t] = (int8_t)pair[i].b;
+            bUsed[pair[i].b] = 1;
+        }
+        for (int i = 0; i < np; i++) {
+            const Pair &q = pair[i];
+            if (tBlob[q.t] >= 0 || blobs[q.b].area < _track[q.t].area * 3 / 2) continue;
+            tBlob[q.t] = (int8_t)q.b;
+            merged[q.b] = 1;
+        }
+
+        for (uint8_t t = 0; t < _n; t++) {
+            if (tBlob[t] < 0) continue;
+            WyMlxTrack &k = _track[t];
+            const WyMlxBlob &o = blobs[tBlob[t]];
+            k.age++;
+            if (merged[tBlob[t]]) {
+                /* Merged: the blob's centroid is nobody's. Coast on the
+                   prediction so the track picks its own blob up again
+                   when they split. */
+                k.cx += k.vx; k.cy += k.vy;
+                k.peak = o.peak;
+                k.missed = 0;
+                continue;
+            }
+            float steps = (float)(k.missed + 1);
+            float lastX = k.cx - k.vx * k.missed, lastY = k.cy - k.vy * k.missed;  /* undo coasting */
+            float vx = (o.cx - lastX) / steps, vy = (o.cy - lastY) / steps;
+            k.vx = k.age > 1 ? 0.5f * (k.vx + vx) : vx;
+            k.vy = k.age > 1 ? 0.5f * (k.vy + vy) : vy;
+            k.cx = o.cx; k.cy = o.cy;
+            k.peak = o.peak; k.area = o.area;
+            k.missed = 0;
+        }
+
+        /* Coast or end the unmatched tracks, compacting in order */
+        uint8_t live = 0;
+        for (uint8_t t = 0; t < _n; t++) {
+            WyMlxTrack &k = _track[t];
+            if (tBlob[t] < 0) {
+                if (k.missed >= _keep) { _ended[_nEnded++] = k; continue; }
+                k.missed++;
+                k.age++;
+                k.cx += k.vx; k.cy += k.vy;
+            }
+            _track[live++] = k;
+        }
+        _n = live;
+
+        /* New tracks for unmatched blobs, largest first (blob order) */
+        for (uint8_t b = 0; b < nb && _n < WY_MLX_MAX_TRACKS; b++) {
+            if (bUsed[b]) continue;
+            WyMlxTrack &k = _track[_n++];
+            k.id = _nextId++;
+            if (!_nextId) _nextId = 1;
+            k.cx = k.x0 = blobs[b].cx;
+            k.cy = k.y0 = blobs[b].cy;
+            k.vx = k.vy = 0;
+            k.peak = blobs[b].peak;
+            k.area = blobs[b].area;
+            k.age = 0;
+            k.missed = 0;
+        }
+        return _n;
+    }
+
+    uint8_t           count() const          { return _n; }
+    const WyMlxTrack &track(uint8_t i) const { return _track[i]; }
+
+    /* Tracks that ended in the last update() — their final state */
+    const WyMlxTrack *ended(uint8_t &n) const { n = _nEnded; return _ended; }
+
+    /* Live track by id, or nullptr */
+    const WyMlxTrack *byId(uint16_t id) const {
+        for (uint8_t i = 0; i < _n; i++) if (_track[i].id == id) return &_track[i];
+        return nullptr;
+    }
+
+private:
+    WyMlxTrack _track[WY_MLX_MAX_TRACKS];
+    WyMlxTrack _ended[WY_MLX_MAX_TRACKS];
+    uint8_t    _n = 0, _nEnded = 0;
+    uint16_t   _nextId = 1;
+    float      _gate = 4.0f;
+    uint8_t    _keep = 3;
+};
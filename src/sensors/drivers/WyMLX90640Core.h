@@ -0,0 +1,495 @@
+/*
+ * drivers/WyMLX90640Core.h — MLX90640 frame math, no Arduino / I2C
+ * =================================================================
+ * The parts of WyMLX90640 that don't touch the bus, so host tests and
+ * benchmarks run exactly what the ESP32 runs:
+ *
+ *   wyMlxPalette()    256-entry RGB565 ironbow / rainbow tables
+ *   wyMlxRender()     32×24 → w×h bilinear upscale, one RGB565 row at a
+ *                     time into a line buffer, handed to a callback
+ *   wyMlxExtract()    EEPROM → MLXParams, frame-invariant terms folded in
+ *   wyMlxTa()         ambient temperature of a raw frame
+ *   wyMlxFrameConst() per-frame constants (gain, dTa, dV, TGC, Ta^4)
+ *   wyMlxPixels()     raw → °C kernel over a pixel range
+ *   wyMlxSubpagePixels()  the same over one subpage's half of the array
+ *   wyMlxScan()       min / max / hottest pixel of an assembled frame
+ *   wyMlxSubpageUs()  subpage period for a frame rate code
+ *   WyMlxFrameBuf     double-buffered frame, one writer task, lock-free
+ *                     readers
+ *
+ * Rendering is fixed point: temperatures are quantised once per frame
+ * to palette index × 256 (768 float ops), then every output pixel is
+ * two 8-bit-weighted blends, rounded, and a palette lookup. Output
+ * pixel centres map to source pixel centres, edges clamp — at scale 10
+ * each source pixel's centre lands between output pixels 4 and 5 of
+ * its tile.
+ *
+ * Stack: ~1.5 KB frame + 4 bytes per output column (WY_MLX_RENDER_MAXW).
+ */
+
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <atomic>
+
+#define MLX_COLS         32
+#define MLX_ROWS         24
+#define MLX_PIXEL_COUNT  768   /* 32 × 24 */
+#define MLX_WORDS        832   /* EEPROM and frame data size */
+
+#ifndef WY_MLX_RENDER_MAXW
+#define WY_MLX_RENDER_MAXW  480     /* widest render() output, px */
+#endif
+
+/* ── Palettes ───────────────────────────────────────────────────── */
+#define WY_MLX_IRONBOW  0
+#define WY_MLX_RAINBOW  1
+
+/* 256 RGB565 entries, index 0 = coldest. Built on first use. */
+static inline const uint16_t *wyMlxPalette(uint8_t which = WY_MLX_IRONBOW) {
+    static uint16_t lut[2][256];
+    static bool built = false;
+    if (!built) {
+        /* Ironbow: black→indigo→blue→magenta→red→orange→yellow→white,
+           33 anchors, channels blended linearly between them */
+        static const uint16_t IRON[33] = {
+            0x0000, 0x000B, 0x0013, 0x080E, 0x1009, 0x200A, 0x380C,
+            0x5010, 0x6815, 0x801B, 0x9020, 0xA020, 0xB010, 0xC001,
+            0xC801, 0xD001, 0xD800, 0xE000, 0xE800, 0xF000, 0xF800,
+            0xF900, 0xFA00, 0xFB00, 0xFC00, 0xFCC0, 0xFDA0, 0xFE80,
+            0xFF60, 0xFF20, 0xFF80, 0xFFC0, 0xFFFF
+        };
+        for (int i = 0; i < 256; i++) {
+            int pos = i * 32 * 256 / 255, a = pos >> 8, f = pos & 0xFF;
+            uint16_t c0 = IRON[a], c1 = IRON[a < 32 ? a + 1 : 32];
+            int r = ((c0 >> 11) * (256 - f) + (c1 >> 11) * f + 128) >> 8;
+            int g = (((c0 >> 5) & 0x3F) * (256 - f) + ((c1 >> 5) & 0x3F) * f + 128) >> 8;
+            int b = ((c0 & 0x1F) * (256 - f) + (c1 & 0x1F) * f + 128) >> 8;
+            lut[WY_MLX_IRONBOW][i] = (uint16_t)(r << 11 | g << 5 | b);
+        }
+        /* Rainbow: blue→cyan→green→yellow→red */
+        for (int i = 0; i < 256; i++) {
+            float t = i / 255.0f, r = 0, g = 0, b = 0;
+            if      (t < 0.25f) { b = 1.0f; g = t * 4.0f; }
+            else if (t < 0.5f)  { b = 1.0f - (t - 0.25f) * 4.0f; g = 1.0f; }
+            else if (t < 0.75f) { g = 1.0f; r = (t - 0.5f) * 4.0f; }
+            else                { g = 1.0f - (t - 0.75f) * 4.0f; r = 1.0f; }
+            lut[WY_MLX_RAINBOW][i] = (uint16_t)((uint16_t)(r * 31) << 11 | (uint16_t)(g * 63) << 5 | (uint16_t)(b * 31));
+        }
+        built = true;
+    }
+    return lut[which & 1];
+}
+
+/* ── Render ─────────────────────────────────────────────────────── */
+
+/* Output coordinate → source position in 1/256 px, centres aligned,
+   clamped to [0, n-1] */
+static inline int32_t _wyMlxSrc(int32_t o, int32_t out, int32_t n) {
+    int32_t s = (int32_t)(((2 * o + 1) * n * 256) / (2 * out)) - 128;
+    if (s < 0) s = 0;
+    if (s > (n - 1) * 256) s = (n - 1) * 256;
+    return s;
+}
+
+/*
+ * Bilinear-upscale a 32×24 °C frame to w×h RGB565 and call
+ * row(y, line) for y = 0..h-1 — line holds w pixels and is reused.
+ * tmin..tmax maps onto lut[0..255] (range floored at 0.1 °C).
+ * False if w is 0 or over WY_MLX_RENDER_MAXW, or h is 0.
+ */
+template<typename RowFn>
+bool wyMlxRender(const float *px, uint16_t w, uint16_t h, float tmin, float tmax,
+                 const uint16_t *lut, RowFn &&row) {
+    if (!px || !lut || !w || !h || w > WY_MLX_RENDER_MAXW) return false;
+
+    /* Quantise once: palette index in 8.8 fixed point, 0..255.0 */
+    float range = (tmax - tmin > 0.1f) ? (tmax - tmin) : 0.1f;
+    float k = 255.0f * 256.0f / range;
+    uint16_t q[MLX_PIXEL_COUNT];
+    for (int i = 0; i < MLX_PIXEL_COUNT; i++) {
+        float v = (px[i] - tmin) * k + 0.5f;
+        q[i] = v <= 0.0f ? 0 : v >= 65280.0f ? 65280 : (uint16_t)v;
+    }
+
+    /* Column map, same for every row: source column << 8 | weight */
+    uint16_t xmap[WY_MLX_RENDER_MAXW];
+    for (uint16_t ox = 0; ox < w; ox++) xmap[ox] = (uint16_t)_wyMlxSrc(ox, w, MLX_COLS);
+
+    uint16_t line[WY_MLX_RENDER_MAXW];
+    uint32_t vr[MLX_COLS + 1];          /* this row, blended vertically; [32] pads the right edge */
+    for (uint16_t oy = 0; oy < h; oy++) {
+        int32_t sy = _wyMlxSrc(oy, h, MLX_ROWS);
+        int y0 = sy >> 8, y1 = y0 < MLX_ROWS - 1 ? y0 + 1 : y0;
+        uint32_t fy = (uint32_t)(sy & 0xFF);
+        const uint16_t *r0 = q + y0 * MLX_COLS, *r1 = q + y1 * MLX_COLS;
+        for (int c = 0; c < MLX_COLS; c++) vr[c] = (r0[c] * (256 - fy) + r1[c] * fy + 128) >> 8;
+        vr[MLX_COLS] = vr[MLX_COLS - 1];
+
+        for (uint16_t ox = 0; ox < w; ox++) {
+            uint32_t m = xmap[ox], x0 = m >> 8, fx = m & 0xFF;
+            line[ox] = lut[(vr[x0] * (256 - fx) + vr[x0 + 1] * fx + 0x8000) >> 16];
+        }
+        row(oy, line);
+    }
+    return true;
+}
+
+/* ── Calibration (AN#0101) ──────────────────────────────────────── */
+
+/*
+ * Extracted calibration, per-pixel terms as separate arrays (the frame
+ * kernel streams through them in order). Everything that doesn't change
+ * between frames is folded in here once: the alpha correction becomes
+ * a reciprocal, the KsTo range search a breakpoint table.
+ */
+struct MLXParams {
+    float    offset[MLX_PIXEL_COUNT];
+    float    kta[MLX_PIXEL_COUNT];
+    float    kv[MLX_PIXEL_COUNT];
+    float    alphaInv[MLX_PIXEL_COUNT];   /* 1 / (alpha - tgc·cpAlpha[subpage]) */
+
+    float    KsTa;
+    float    KsTo[5];
+    float    ct[5];
+    float    ksToBreak[5];    /* sorted ct[]: segment = number of breaks ≤ To */
+    float    ksToDiv[6];      /* 1 / KsTo correction for each segment */
+    float    tgc;
+    float    cpAlpha[2];
+    int16_t  cpOffset[2];
+    float    cpKta, cpKv;
+    int16_t  gainEE;
+    float    vdd25, KvVdd;
+    float    KvPtat, KtPtat, alphaPTAT;
+    int16_t  ptatRef;
+    uint8_t  resolution;
+    bool     valid;
+};
+
+static inline int8_t _wyMlxS4(uint8_t v) { return (v & 0x8)  ? (int8_t)(v | 0xF0) : (int8_t)v; }
+static inline int8_t _wyMlxS6(uint8_t v) { return (v & 0x20) ? (int8_t)(v | 0xC0) : (int8_t)v; }
+
+/* KsTo correction the way the range loop applies it: first r with
+   ct[r] ≤ To < ct[r+1] divides by Π(1 + 10·KsTo[0..r]); none = 1 */
+static inline float _wyMlxKsToDiv(const MLXParams &p, float To) {
+    for (int r = 0; r < 4; r++) {
+        if (To >= p.ct[r] && To < p.ct[r + 1]) {
+            float correction = 1.0f;
+            for (int c = 0; c <= r; c++) correction *= 1.0f + p.KsTo[c] * 10.0f;
+            return 1.0f / correction;
+        }
+    }
+    return 1.0f;
+}
+
+static inline void wyMlxExtract(const uint16_t *ee, MLXParams &p) {
+    /* Gain */
+    p.gainEE = (int16_t)ee[0x30];
+
+    /* Vdd */
+    int16_t KvVdd_raw = (int8_t)(ee[0x33] >> 8);
+    p.KvVdd = KvVdd_raw * 32.0f;
+    int16_t vdd25_raw = (int8_t)(ee[0x33] & 0xFF) - 256;
+    p.vdd25 = (float)((vdd25_raw - 256) * 32 - 8192);
+
+    /* Ta */
+    int16_t KvPtat_raw = (int16_t)(ee[0x32] >> 10);
+    if (KvPtat_raw > 31) KvPtat_raw -= 64;
+    p.KvPtat = KvPtat_raw / 4096.0f;
+
+    int16_t KtPtat_raw = (int16_t)(ee[0x32] & 0x03FF);
+    if (KtPtat_raw > 511) KtPtat_raw -= 1024;
+    p.KtPtat = KtPtat_raw / 8.0f;
+
+    p.ptatRef    = (int16_t)ee[0x31];
+    p.alphaPTAT  = (float)((ee[0x10] >> 12) & 0xF) / 4.0f + 8.0f;
+    p.resolution = (uint8_t)((ee[0x39] >> 12) & 0x03);
+
+    /* KsTa */
+    p.KsTa = (int8_t)(ee[0x3C] >> 8) / 8192.0f;
+
+    /* KsTo */
+    float ksToScale = 1.0f / (float)(1 << ((ee[0x3F] & 0xF) + 8));
+    p.KsTo[0] = (int8_t)( ee[0x3D] & 0xFF)         * ksToScale;
+    p.KsTo[1] = (int8_t)((ee[0x3D] >> 8) & 0xFF)   * ksToScale;
+    p.KsTo[2] = (int8_t)( ee[0x3E] & 0xFF)         * ksToScale;
+    p.KsTo[3] = (int8_t)((ee[0x3E] >> 8) & 0xFF)   * ksToScale;
+    p.KsTo[4] = -0.0002f;
+    p.ct[0] = -40.0f; p.ct[1] = 0.0f;
+    p.ct[2] = ((ee[0x3F] >> 4) & 0xF) * 10.0f;
+    p.ct[3] = ((ee[0x3F] >> 8) & 0xFF) * 10.0f;
+    p.ct[4] = 400.0f;
+
+    /* TGC */
+    p.tgc = (int8_t)(ee[0x3C] & 0xFF) / 32.0f;
+
+    /* Alpha scale */
+    uint8_t alphaScale  = ((ee[0x20] >> 12) & 0xF) + 30;
+    float   alphaBase   = (float)ee[0x21];
+    float   alphaScaleF = 1.0f / (float)(1ULL << alphaScale);
+    float   alphaStep   = (float)(1ULL << (alphaScale - 4));
+
+    /* Per-pixel: offset, alpha, kta, kv */
+    int16_t occRef = (int16_t)(ee[0x11] >> 10);
+    uint8_t ktaScale1 = ((ee[0x3A] >> 4) & 0xF) + 8;
+    uint8_t ktaScale2 =  (ee[0x3A] & 0xF);
+    uint8_t kvScale   = ((ee[0x38] >> 8) & 0xF);
+
+    /* Row and column base arrays */
+    int16_t occRow[24], occCol[32];
+    for (int i = 0; i < 6; i++) {
+        uint16_t w = ee[0x12 + i];
+        occRow[i*4+0] = _wyMlxS4((w>>0)&0xF); occRow[i*4+1] = _wyMlxS4((w>>4)&0xF);
+        occRow[i*4+2] = _wyMlxS4((w>>8)&0xF); occRow[i*4+3] = _wyMlxS4((w>>12)&0xF);
+    }
+    for (int i = 0; i < 8; i++) {
+        uint16_t w = ee[0x18 + i];
+        occCol[i*4+0] = _wyMlxS4((w>>0)&0xF); occCol[i*4+1] = _wyMlxS4((w>>4)&0xF);
+        occCol[i*4+2] = _wyMlxS4((w>>8)&0xF); occCol[i*4+3] = _wyMlxS4((w>>12)&0xF);
+    }
+    uint8_t aRow[24], aCol[32];
+    for (int i = 0; i < 6; i++) {
+        uint16_t w = ee[0x22 + i];
+        aRow[i*4+0] = (w>>0)&0xF; aRow[i*4+1] = (w>>4)&0xF;
+        aRow[i*4+2] = (w>>8)&0xF; aRow[i*4+3] = (w>>12)&0xF;
+    }
+    for (int i = 0; i < 8; i++) {
+        uint16_t w = ee[0x28 + i];
+        aCol[i*4+0] = (w>>0)&0xF; aCol[i*4+1] = (w>>4)&0xF;
+        aCol[i*4+2] = (w>>8)&0xF; aCol[i*4+3] = (w>>12)&0xF;
+    }
+    int8_t ktaCol[2] = { _wyMlxS4((ee[0x3B]>>8)&0xF), _wyMlxS4((ee[0x3B])&0xF) };
+    int8_t kvRow[2]  = { _wyMlxS4((ee[0x34]>>12)&0xF), _wyMlxS4((ee[0x34]>>8)&0xF) };
+    int8_t kvCol[2]  = { _wyMlxS4((ee[0x34]>>4)&0xF),  _wyMlxS4((ee[0x34])&0xF) };
+
+    /* Compensation pixel — before the pixels, their alpha needs it */
+    p.cpAlpha[0]  = (float)((ee[0x3F] >> 10) & 0x3F) * alphaScaleF;
+    p.cpAlpha[1]  = p.cpAlpha[0] * (1.0f + (float)(ee[0x3F] & 0x3F) / 128.0f);
+    p.cpOffset[0] = _wyMlxS6((ee[0x3E] >> 10) & 0x3F);
+    p.cpOffset[1] = p.cpOffset[0] + _wyMlxS6((ee[0x3E] >> 4) & 0x3F);
+    p.cpKta = (float)(int8_t)(ee[0x3E] & 0x0F) / (float)(1 << ktaScale1);
+    p.cpKv  = (float)(int8_t)((ee[0x3E] >> 4) & 0x0F) / (float)(1 << kvScale);
+
+    for (int i = 0; i < MLX_PIXEL_COUNT; i++) {
+        int row = i / 32, col = i % 32;
+        /* Pixel data at EEPROM offset 0x40 = 64 words in */
+        uint16_t w = ee[0x40 + i];
+
+        /* Offset: bits [15:10], 6-bit signed */
+        int16_t pOff = _wyMlxS6((w >> 10) & 0x3F);
+        p.offset[i] = (float)(pOff + occRef + occRow[row] + occCol[col]);
+
+        /* Alpha: bits [9:4], 6-bit unsigned + row/col/reference,
+           minus the TGC share of the compensation pixel, inverted */
+        uint8_t pAlpha = (w >> 4) & 0x3F;
+        float alpha = (alphaBase + (float)aRow[row] * alphaStep + (float)aCol[col] * alphaStep +
+                       (float)pAlpha) * alphaScaleF;
+        p.alphaInv[i] = 1.0f / (alpha - p.tgc * p.cpAlpha[row & 1]);
+
+        /* Kta: bit [3] = row parity contribution */
+        int8_t pKta = (w >> 3) & 0x01 ? 1 : -1;
+        p.kta[i] = (float)(ktaCol[col & 1] + pKta * (1 << ktaScale2)) / (float)(1 << ktaScale1);
+
+        /* Kv: row/col base only */
+        p.kv[i] = (float)(kvRow[row & 1] + kvCol[col & 1]) / (float)(1 << kvScale);
+    }
+
+    /* KsTo breakpoints: the correction is constant between sorted ct[]
+       values, so evaluate the range rule once per segment */
+    for (int i = 0; i < 5; i++) p.ksToBreak[i] = p.ct[i];
+    for (int i = 1; i < 5; i++)
+        for (int j = i; j > 0 && p.ksToBreak[j] < p.ksToBreak[j - 1]; j--) {
+            float t = p.ksToBreak[j]; p.ksToBreak[j] = p.ksToBreak[j - 1]; p.ksToBreak[j - 1] = t;
+        }
+    p.ksToDiv[0] = _wyMlxKsToDiv(p, p.ksToBreak[0] - 1.0f);
+    for (int s = 1; s <= 5; s++) p.ksToDiv[s] = _wyMlxKsToDiv(p, p.ksToBreak[s - 1]);
+
+    p.valid = true;
+}
+
+/* ── Per-frame compensation ─────────────────────────────────────── */
+
+/* Ambient temperature from PTAT (RAM 800) and VDD (RAM 810) */
+static inline float wyMlxTa(const MLXParams &p, const uint16_t *frame) {
+    int16_t vddRaw = (int16_t)frame[810];
+    float vdd = (float)p.gainEE / (float)(1 << p.resolution) * ((float)vddRaw - p.vdd25) / p.KvVdd + 3.3f;
+    int16_t ptatRaw = (int16_t)frame[800];
+    float dV = vdd - 3.3f;
+    return (float)ptatRaw / (p.KvPtat * dV + p.KtPtat) - p.alphaPTAT + 25.0f;
+}
+
+/* Everything the pixel kernel needs that is the same for all 768 */
+struct WyMlxFrameConst {
+    float gain;        /* gainEE / RAM gain */
+    float dTa, dV;
+    float tgcCp;       /* TGC-scaled compensation pixel */
+    float scale;       /* (1 + KsTa·dTa) / emissivity */
+    float taK4;        /* (Ta + 273.15)^4 */
+};
+
+static inline WyMlxFrameConst wyMlxFrameConst(const MLXParams &p, const uint16_t *frame, float Ta, float emissivity) {
+    WyMlxFrameConst k;
+    k.gain = (float)p.gainEE / (float)(int16_t)frame[778];
+    float vdd = k.gain * ((float)(int16_t)frame[810] - p.vdd25) / p.KvVdd + 3.3f;
+    k.dV  = vdd - 3.3f;
+    k.dTa = Ta - 25.0f;
+    float cpPix[2];
+    for (int sp = 0; sp < 2; sp++)
+        cpPix[sp] = k.gain * (float)(int16_t)frame[808 + sp]
+                  - p.cpOffset[sp] * (1.0f + p.cpKta * k.dTa) * (1.0f + p.cpKv * k.dV);
+    k.tgcCp = p.tgc * ((cpPix[0] + cpPix[1]) * 0.5f);
+    k.scale = (1.0f + p.KsTa * k.dTa) / emissivity;
+    float t = Ta + 273.15f;
+    k.taK4 = t * t * t * t;
+    return k;
+}
+
+struct WyMlxStats {
+    float tmin, tmax;
+    int   maxIdx;
+};
+
+/* One pixel, raw → °C: the offset term, one multiply by the
+   precomputed 1/alpha, two sqrtf and a breakpoint count. brk is a
+   local copy of ksToBreak — out[] stores can't alias it, so it stays
+   in registers across the loop. */
+static inline float _wyMlxTo(const MLXParams &p, const uint16_t *frame, const WyMlxFrameConst &k,
+                             const float (&brk)[5], int i) {
+    float pix = k.gain * (float)(int16_t)frame[i]
+              - p.offset[i] * (1.0f + p.kta[i] * k.dTa) * (1.0f + p.kv[i] * k.dV);
+    float v   = (pix - k.tgcCp) * p.alphaInv[i] * k.scale + k.taK4;
+    float To  = sqrtf(sqrtf(v)) - 273.15f;
+    int seg = (To >= brk[0]) + (To >= brk[1]) + (To >= brk[2]) + (To >= brk[3]) + (To >= brk[4]);
+    return To * p.ksToDiv[seg];
+}
+
+/*
+ * Raw frame → °C for pixels [first, last), no divisions and no
+ * range-search branches per pixel. Stats cover that range only.
+ */
+static inline WyMlxStats wyMlxPixels(const MLXParams &p, const uint16_t *frame, const WyMlxFrameConst &k,
+                                     float *out, int first = 0, int last = MLX_PIXEL_COUNT) {
+    WyMlxStats s = { 999.0f, -999.0f, 0 };
+    float brk[5];
+    memcpy(brk, p.ksToBreak, sizeof(brk));
+    for (int i = first; i < last; i++) {
+        float To = _wyMlxTo(p, frame, k, brk, i);
+        out[i] = To;
+        if (To < s.tmin) s.tmin = To;
+        if (To > s.tmax) { s.tmax = To; s.maxIdx = i; }
+    }
+    return s;
+}
+
+/* ── Subpages ───────────────────────────────────────────────────── */
+
+/*
+ * Each measurement refreshes only one subpage — half the pixels — and
+ * status bit 0 says which. Chess pattern (control bit 12 = 1, the reset
+ * default): pixel (row, col) is in subpage (row + col) & 1. Interleaved
+ * (bit 12 = 0): subpage row & 1. The other half of the RAM still holds
+ * the previous measurement.
+ */
+#define WY_MLX_CHESS        0
+#define WY_MLX_INTERLEAVED  1
+
+static inline uint8_t wyMlxSubpageOf(int i, uint8_t pattern = WY_MLX_CHESS) {
+    int row = i / MLX_COLS, col = i % MLX_COLS;
+    return (uint8_t)((pattern == WY_MLX_INTERLEAVED ? row : row + col) & 1);
+}
+
+/* Convert only the pixels subpage measured into out[]; the rest of
+   out[] keeps the other subpage's last values */
+static inline void wyMlxSubpagePixels(const MLXParams &p, const uint16_t *frame, const WyMlxFrameConst &k,
+                                      float *out, uint8_t subpage, uint8_t pattern = WY_MLX_CHESS) {
+    subpage &= 1;
+    float brk[5];
+    memcpy(brk, p.ksToBreak, sizeof(brk));
+    for (int row = 0; row < MLX_ROWS; row++) {
+        int col = 0, step = 1;
+        if (pattern == WY_MLX_INTERLEAVED) {
+            if ((row & 1) != subpage) continue;
+        } else {
+            col = (row + subpage) & 1;
+            step = 2;
+        }
+        for (int i = row * MLX_COLS + col; i < (row + 1) * MLX_COLS; i += step)
+            out[i] = _wyMlxTo(p, frame, k, brk, i);
+    }
+}
+
+/* Min / max / hottest index of an assembled frame */
+static inline WyMlxStats wyMlxScan(const float *px) {
+    WyMlxStats s = { 999.0f, -999.0f, 0 };
+    for (int i = 0; i < MLX_PIXEL_COUNT; i++) {
+        if (px[i] < s.tmin) s.tmin = px[i];
+        if (px[i] > s.tmax) { s.tmax = px[i]; s.maxIdx = i; }
+    }
+    return s;
+}
+
+/* ── Acquisition ────────────────────────────────────────────────── */
+
+/* One subpage per period: code 0 = 0.5 Hz = 2 s … code 6 = 32 Hz = 31.25 ms */
+static inline uint32_t wyMlxSubpageUs(uint8_t fps) {
+    return 2000000u >> (fps > 7 ? 7 : fps);
+}
+
+/*
+ * Two frames: the writer assembles the next one in back() while readers
+ * use front(). beginWrite() starts the back slot from the front one, so
+ * the half a subpage doesn't touch carries over; publish() flips them.
+ *
+ * The writer never waits. A reader holding front() has it to itself
+ * for one subpage period — after the next publish() the writer starts
+ * on that slot. copy() is the safe version: it retries if a publish()
+ * lands while it copies (seqlock).
+ */
+struct WyMlxFrameInfo {
+    WyMlxStats st;
+    float      Ta;
+    bool       complete;        /* both subpages seen */
+};
+
+struct WyMlxFrameBuf {
+    struct Slot {
+        float          px[MLX_PIXEL_COUNT];
+        WyMlxFrameInfo info;
+    };
+
+    Slot slot[2] = {};
+
+    /* Writer */
+    Slot &beginWrite() {
+        uint32_t s = _seq.load(std::memory_order_relaxed);
+        Slot &b = slot[(s + 1) & 1];
+        std::atomic_thread_fence(std::memory_order_seq_cst);   /* publish() visible before we reuse the slot */
+        memcpy(&b, &slot[s & 1], sizeof(Slot));
+        return b;
+    }
+    void publish() { _seq.fetch_add(1, std::memory_order_release); }
+
+    /* Readers */
+    Slot       &front()       { return slot[_seq.load(std::memory_order_acquire) & 1]; }
+    const Slot &front() const { return slot[_seq.load(std::memory_order_acquire) & 1]; }
+    uint32_t    frames() const { return _seq.load(std::memory_order_acquire); }
+
+    /* Tear-free copy of the front slot — pixels into px, stats into
+       info, either may be null. False if the writer kept flipping it
+       underneath for `tries` attempts. */
+    bool copy(float *px, WyMlxFrameInfo *info = nullptr, int tries = 4) const {
+        while (tries--) {
+            uint32_t s0 = _seq.load(std::memory_order_acquire);
+            const Slot &f = slot[s0 & 1];
+            if (px) memcpy(px, f.px, sizeof(f.px));
+            if (info) *info = f.info;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_seq.load(std::memory_order_relaxed) == s0) return true;
+        }
+        return false;
+    }
+
+private:
+    std::atomic<uint32_t> _seq{0};
+};
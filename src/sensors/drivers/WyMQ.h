@@ -27,11 +27,13 @@
  * Calibration (required for ppm accuracy):
  *   1. In clean air, read raw ADC for 1 minute (sensor must be warm — 20+ min)
  *   2. Call sensor->calibrateR0() — stores average Rs as R0 baseline
+ *      (refused with false until preheated())
  *   3. Or manually set: sensor->setR0(known_R0_value)
  *
  * Output:
  *   d.co2     = ppm of primary target gas (CO2, CH4, CO, etc.)
- *   d.raw     = raw ADC value (0–4095)
+ *   d.raw     = raw ADC value (0–4095); seconds of preheat left while
+ *               d.error == "preheating"
  *   d.voltage = analog voltage in mV
  */
 
@@ -53,6 +55,11 @@
 #define WY_MQ_ADC_BITS  12
 #endif
 
+/* Heater preheat before readings are trusted (ms) */
+#ifndef WY_MQ_PREHEAT_MS
+#define WY_MQ_PREHEAT_MS  20000UL
+#endif
+
 /* ── Base class ─────────────────────────────────────────────────── */
 class WyMQBase : public WySensorBase {
 public:
@@ -62,13 +69,25 @@ public:
     bool begin() override {
         pinMode(_pin, INPUT);
         analogReadResolution(WY_MQ_ADC_BITS);
-        delay(20000);  /* MOX sensors need 20 seconds preheat minimum */
-        /* NOTE: For best accuracy, preheat 24 hours before first calibration */
+        /* MOX sensors need 20 seconds preheat minimum — reads report
+         * "preheating" until then instead of begin() stalling the boot.
+         * NOTE: For best accuracy, preheat 24 hours before first calibration */
+        _warmStart = millis();
         return true;
     }
 
+    /* True once the preheat window has passed (or was skipped) */
+    bool preheated() {
+        return _skipPreheat || millis() - _warmStart >= WY_MQ_PREHEAT_MS;
+    }
+
     WySensorData read() override {
         WySensorData d;
+        if (!preheated()) {
+            d.error = "preheating";
+            d.raw   = (float)((WY_MQ_PREHEAT_MS - (millis() - _warmStart)) / 1000);
+            return d;
+        }
         int32_t raw = analogRead(_pin);
         float vMV   = (raw / (float)((1 << WY_MQ_ADC_BITS) - 1)) * WY_MQ_VREF_MV;
 
@@ -88,8 +107,15 @@ public:
         return d;
     }
 
-    /* Calibrate R0 in clean air — run for ~1 min with warm sensor */
-    void calibrateR0(uint16_t samples = 50) {
+    /* Calibrate R0 in clean air — run for ~1 min with warm sensor.
+     * False (R0 unchanged) while still preheating: a cold heater's Rs
+     * would become a baseline that's wrong for every later reading */
+    bool calibrateR0(uint16_t samples = 50) {
+        if (!preheated()) {
+            Serial.printf("[%s] calibrateR0: still preheating (%lus left)\n", driverName(),
+                          (unsigned long)((WY_MQ_PREHEAT_MS - (millis() - _warmStart)) / 1000));
+            return false;
+        }
         Serial.printf("[%s] calibrating R0 in clean air...\n", driverName());
         float sum = 0;
         for (uint16_t i = 0; i < samples; i++) {
@@ -101,6 +127,7 @@ public:
         }
         _r0 = sum / samples;
         Serial.printf("[%s] R0 = %.2f kΩ\n", driverName(), _r0);
+        return true;
     }
 
     void setR0(float r0) { _r0 = r0; }
@@ -108,7 +135,7 @@ public:
     float getLastRs() { return _lastRs; }
     float getRsR0()   { return _r0 > 0 ? _lastRs / _r0 : 0; }
 
-    /* Skip the 20s preheat in begin() — use when sensor is already warm */
+    /* Skip the 20s preheat — use when sensor is already warm */
     void skipPreheat() { _skipPreheat = true; }
 
     bool begin(bool skipPreheat) {
@@ -122,6 +149,7 @@ protected:
     float  _r0;          /* calibrated clean-air resistance (kΩ) */
     float  _lastRs = 0;
     bool   _skipPreheat = false;
+    uint32_t _warmStart = 0;
 };
 
 /* ══════════════════════════════════════════════════════════════════
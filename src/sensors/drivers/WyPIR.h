@@ -135,12 +135,14 @@ public:
     /* Register callback — called on state change, call poll() in loop() */
     void onMotion(void (*cb)(bool detected)) { _callback = cb; }
 
-    void poll() {
+    /* Also the WySensorBase poll() — a sweep fires the callback too */
+    bool poll() override {
         bool current = motion();
         if (current != _callbackState) {
             _callbackState = current;
             if (_callback) _callback(current);
         }
+        return WySensorBase::poll();
     }
 
     /* ── Warm-up ─────────────────────────────────────────────────── */
@@ -62,22 +62,30 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
 
+    bool startMeasurement() override {
+        _start();
         _sendCmd(SGP30_CMD_MEASURE_AIR_QUALITY);
-        delay(12);  /* measurement takes 12ms */
+        _wait(12);  /* measurement takes 12ms */
+        return true;
+    }
 
+    bool poll() override {
+        if (!_busy) return _done;
+        if (_waiting()) return false;
+
+        WySensorData d;
         /* Response: eCO2_H eCO2_L CRC TVOC_H TVOC_L CRC */
         Wire.requestFrom(_pins.addr, (uint8_t)6);
-        if (Wire.available() < 6) { d.error = "no data"; return d; }
+        if (Wire.available() < 6) { _fail("no data"); return true; }
 
         uint8_t buf[6];
         for (uint8_t i = 0; i < 6; i++) buf[i] = Wire.read();
 
         /* CRC check on each word */
         if (_crc8(buf, 2) != buf[2] || _crc8(buf+3, 2) != buf[5]) {
-            d.error = "CRC fail"; return d;
+            _fail("CRC fail"); return true;
         }
 
         uint16_t eco2 = ((uint16_t)buf[0] << 8) | buf[1];
@@ -89,7 +97,8 @@ public:
         d.raw = tvoc;        /* TVOC in ppb stored in raw field */
         d.ok  = _warmedUp;   /* mark ok only after warm-up */
         if (!_warmedUp) d.error = "warming up";
-        return d;
+        _finish(d);
+        return true;
     }
 
     bool warmedUp() { return _warmedUp; }
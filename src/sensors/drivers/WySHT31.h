@@ -32,12 +32,22 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
+
+    bool startMeasurement() override {
+        _start();
         _sendCmd(SHT31_CMD_MEAS_HIGHREP);
-        delay(20);
+        _wait(20);  /* high-repeatability conversion: 15ms max */
+        return true;
+    }
+
+    bool poll() override {
+        if (!_busy) return _done;
+        if (_waiting()) return false;
+
+        WySensorData d;
         Wire.requestFrom(_pins.addr, (uint8_t)6);
-        if (Wire.available() < 6) { d.error = "no data"; return d; }
+        if (Wire.available() < 6) { _fail("no data"); return true; }
         uint8_t buf[6];
         for (uint8_t i = 0; i < 6; i++) buf[i] = Wire.read();
         /* CRC check (optional — skip for speed) */
@@ -46,7 +56,8 @@ public:
         d.temperature = -45.0f + 175.0f * raw_t / 65535.0f;
         d.humidity    = 100.0f * raw_h / 65535.0f;
         d.ok = true;
-        return d;
+        _finish(d);
+        return true;
     }
 
 private:
@@ -118,6 +118,11 @@
 #define WY_SOIL_SAMPLES  8
 #endif
 
+/* Settle time after switching probe power on (ms) — power pin only */
+#ifndef WY_SOIL_SETTLE_MS
+#define WY_SOIL_SETTLE_MS  80
+#endif
+
 /* Default calibration (approximate for 3.3V supply, adjust with setCalibration) */
 #ifndef WY_SOIL_WET_RAW
 #define WY_SOIL_WET_RAW   1200
@@ -167,10 +172,44 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
-        uint16_t raw = _readRaw();
+    WySensorData read() override { return _measure(); }
+
+    /* Probe power-up settle and the averaging both run from poll() */
+    bool startMeasurement() override {
+        _start();
+        _powerOn();
+        _adc.start(_aoPin, _samples, 2, _pwrPin >= 0 ? WY_SOIL_SETTLE_MS : 0);
+        return true;
+    }
+
+    bool poll() override {
+        if (!_busy) return _done;
+        if (!_adc.poll()) return false;
+        _powerOff();
+        _finish(_fromRaw(_adc.mean()));
+        return true;
+    }
+
+    /* Raw ADC value — useful for calibration */
+    uint16_t rawValue() { return _readRaw(); }
 
+    /* True if dry threshold output is triggered (DO pin required) */
+    bool isDry() {
+        if (_doPin < 0) return false;
+        return digitalRead(_doPin) == HIGH;  /* DO HIGH = below moisture threshold = dry */
+    }
+
+private:
+    int8_t   _aoPin    = -1;
+    int8_t   _pwrPin   = -1;
+    int8_t   _doPin    = -1;
+    uint16_t _wetRaw   = WY_SOIL_WET_RAW;
+    uint16_t _dryRaw   = WY_SOIL_DRY_RAW;
+    uint8_t  _samples  = WY_SOIL_SAMPLES;
+    WyAnalogSampler _adc;
+
+    WySensorData _fromRaw(uint16_t raw) {
+        WySensorData d;
         d.rawInt = raw;
 
         /* Map raw to 0–100% moisture
@@ -194,43 +233,18 @@ public:
         return d;
     }
 
-    /* Raw ADC value — useful for calibration */
-    uint16_t rawValue() { return _readRaw(); }
+    /* Power on — the sampler's settle time covers probe + ADC
+     * capacitance + RC filter */
+    void _powerOn()  { if (_pwrPin >= 0) digitalWrite(_pwrPin, HIGH); }
 
-    /* True if dry threshold output is triggered (DO pin required) */
-    bool isDry() {
-        if (_doPin < 0) return false;
-        return digitalRead(_doPin) == HIGH;  /* DO HIGH = below moisture threshold = dry */
-    }
-
-private:
-    int8_t   _aoPin    = -1;
-    int8_t   _pwrPin   = -1;
-    int8_t   _doPin    = -1;
-    uint16_t _wetRaw   = WY_SOIL_WET_RAW;
-    uint16_t _dryRaw   = WY_SOIL_DRY_RAW;
-    uint8_t  _samples  = WY_SOIL_SAMPLES;
+    /* Power off immediately — stops corrosion */
+    void _powerOff() { if (_pwrPin >= 0) digitalWrite(_pwrPin, LOW); }
 
     uint16_t _readRaw() {
-        /* Power on */
-        if (_pwrPin >= 0) {
-            digitalWrite(_pwrPin, HIGH);
-            delay(80);  /* settle time: probe + ADC capacitance + RC filter */
-        }
-
-        /* Average multiple ADC readings */
-        uint32_t sum = 0;
-        for (uint8_t i = 0; i < _samples; i++) {
-            sum += analogRead(_aoPin);
-            delay(2);
-        }
-        uint16_t raw = (uint16_t)(sum / _samples);
-
-        /* Power off immediately — stops corrosion */
-        if (_pwrPin >= 0) {
-            digitalWrite(_pwrPin, LOW);
-        }
-
+        WyAnalogSampler s;  /* own sampler — don't disturb a poll() in flight */
+        _powerOn();
+        uint16_t raw = s.run(_aoPin, _samples, 2, _pwrPin >= 0 ? WY_SOIL_SETTLE_MS : 0);
+        _powerOff();
         return raw;
     }
 };
@@ -187,41 +187,20 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
-
-        uint16_t raw = _readRaw();
-        float voltage = _rawToVoltage(raw);
-        float ntu = _voltageToNTU(voltage);
-
-        /* Temperature compensation (if set) */
-        if (_tempC > 0.0f) {
-            /* Correction: ~0.5% per °C from reference 25°C */
-            float correction = 1.0f + 0.005f * (_tempC - 25.0f);
-            ntu /= correction;
-        }
-
-        ntu = max(ntu, 0.0f);
-
-        d.rawInt   = raw;
-        d.voltage  = voltage;
-        d.raw      = ntu;
+    WySensorData read() override { return _measure(); }
 
-        /* Water quality category */
-        if      (ntu < 1.0f)   d.humidity = 0;  /* clear (drinking water) */
-        else if (ntu < 10.0f)  d.humidity = 1;  /* good (slightly hazy) */
-        else if (ntu < 100.0f) d.humidity = 2;  /* fair (noticeably turbid) */
-        else                   d.humidity = 3;  /* poor (very turbid) */
-
-        /* Digital threshold if wired (LOW = turbid = threshold exceeded) */
-        if (_doPin >= 0) {
-            bool triggered = (digitalRead(_doPin) == LOW);
-            /* Store in error field only if triggered — non-intrusive */
-            if (triggered) d.error = "threshold";
-        }
+    /* Averaging runs one ADC sample per poll(), 2ms apart */
+    bool startMeasurement() override {
+        _start();
+        _adc.start(_aoPin, _samples, 2);
+        return true;
+    }
 
-        d.ok = true;
-        return d;
+    bool poll() override {
+        if (!_busy) return _done;
+        if (!_adc.poll()) return false;
+        _finish(_fromRaw(_adc.mean()));
+        return true;
     }
 
     /* Human-readable water quality label */
@@ -253,13 +232,46 @@ private:
     const float* _calNTU = WY_TURB_NTU;
     uint8_t      _calN   = WY_TURB_LUT_SIZE;
 
+    WyAnalogSampler _adc;
+
     uint16_t _readRaw() {
-        uint32_t sum = 0;
-        for (uint8_t i = 0; i < _samples; i++) {
-            sum += analogRead(_aoPin);
-            delay(2);
+        WyAnalogSampler s;  /* own sampler — don't disturb a poll() in flight */
+        return s.run(_aoPin, _samples, 2);
+    }
+
+    WySensorData _fromRaw(uint16_t raw) {
+        WySensorData d;
+        float voltage = _rawToVoltage(raw);
+        float ntu = _voltageToNTU(voltage);
+
+        /* Temperature compensation (if set) */
+        if (_tempC > 0.0f) {
+            /* Correction: ~0.5% per °C from reference 25°C */
+            float correction = 1.0f + 0.005f * (_tempC - 25.0f);
+            ntu /= correction;
+        }
+
+        ntu = max(ntu, 0.0f);
+
+        d.rawInt   = raw;
+        d.voltage  = voltage;
+        d.raw      = ntu;
+
+        /* Water quality category */
+        if      (ntu < 1.0f)   d.humidity = 0;  /* clear (drinking water) */
+        else if (ntu < 10.0f)  d.humidity = 1;  /* good (slightly hazy) */
+        else if (ntu < 100.0f) d.humidity = 2;  /* fair (noticeably turbid) */
+        else                   d.humidity = 3;  /* poor (very turbid) */
+
+        /* Digital threshold if wired (LOW = turbid = threshold exceeded) */
+        if (_doPin >= 0) {
+            bool triggered = (digitalRead(_doPin) == LOW);
+            /* Store in error field only if triggered — non-intrusive */
+            if (triggered) d.error = "threshold";
         }
-        return (uint16_t)(sum / _samples);
+
+        d.ok = true;
+        return d;
     }
 
     /* Convert raw ADC → actual sensor voltage (correcting for divider) */
@@ -97,30 +97,36 @@ public:
         Wire.setClock(_pins.freq);
         delay(5);
 
-        /* Write config: gain + IT + interrupt disable + power on */
+        /* Write config: gain + IT + interrupt disable + power on.
+         * The first integration period runs out in the background —
+         * the first poll() waits for it instead of begin(). */
         _applyConfig();
-        delay(_itMs() + 10);  /* wait one integration period */
 
-        /* Verify by reading ALS — 0xFFFF with no light source means missing */
-        uint16_t als = _readReg16(VEML7700_REG_ALS);
-        /* 0xFFFF in total darkness usually means sensor not present */
-        if (als == 0xFFFF) {
-            /* Try again after a moment — could be first read */
-            delay(200);
-            als = _readReg16(VEML7700_REG_ALS);
-            if (als == 0xFFFF) {
-                Serial.println("[VEML7700] sensor may not be connected (0xFFFF)");
-                /* Don't fail — 0xFFFF is also valid at very high illuminance */
-            }
+        /* Verify by reading ALS_CONF back — unlike the ALS count, it
+         * can't legitimately be 0xFFFF (that's a missing ACK) */
+        if (_readReg16(VEML7700_REG_ALS_CONF) == 0xFFFF) {
+            Serial.println("[VEML7700] no response — check wiring");
+            return false;
         }
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
+    WySensorData read() override { return _measure(); }
+
+    /* The ALS runs continuously, so a measurement only has to wait
+     * out the integration period after a config or range change */
+    bool startMeasurement() override {
+        _start();
+        /* Don't range on a count from before the last config change */
+        if (_autoRange && !_waiting()) _adjustRange();
+        return true;
+    }
 
-        if (_autoRange) _adjustRange();
+    bool poll() override {
+        if (!_busy) return _done;
+        if (_waiting()) return false;
 
+        WySensorData d;
         uint16_t als   = _readReg16(VEML7700_REG_ALS);
         uint16_t white = _readReg16(VEML7700_REG_WHITE);
 
@@ -129,7 +135,8 @@ public:
             if (!_autoRange) d.error = "saturated — reduce gain or IT";
             d.rawInt = 0xFFFF;
             d.ok     = false;
-            return d;
+            _finish(d);
+            return true;
         }
 
         /* Convert to lux using resolution factor */
@@ -142,7 +149,8 @@ public:
         d.raw    = als;
         d.rawInt = white;
         d.ok     = true;
-        return d;
+        _finish(d);
+        return true;
     }
 
     /* ── Configuration ───────────────────────────────────────────── */
@@ -177,7 +185,7 @@ private:
                       | (uint16_t)(_it   & 0x0F) << 6;
         /* SD=0 (power on), interrupts disabled */
         _writeReg16(VEML7700_REG_ALS_CONF, conf);
-        delay(_itMs() + 5);  /* settle after config change */
+        _wait(_itMs() + 5);  /* next poll() settles after config change */
     }
 
     float _resolution() {
@@ -315,41 +315,20 @@ public:
         return true;
     }
 
-    WySensorData read() override {
-        WySensorData d;
-
-        /* Average ADC */
-        uint32_t sum = 0;
-        for (uint8_t i = 0; i < _samples; i++) {
-            sum += analogRead(_aoPin);
-            delay(2);
-        }
-        uint16_t raw = (uint16_t)(sum / _samples);
+    WySensorData read() override { return _measure(); }
 
-        /* Convert to voltage → ratio */
-        float adcV  = (raw / 4095.0f) * 3.3f;
-        float sensV = adcV / _divRatio;
-        float ratio = sensV / _vcc;
-
-        /* Find closest LUT entry */
-        uint8_t best     = 0;
-        float   bestDist = fabsf(ratio - _lut[0].ratio);
-        for (uint8_t i = 1; i < _lutSize; i++) {
-            float dist = fabsf(ratio - _lut[i].ratio);
-            if (dist < bestDist) { bestDist = dist; best = i; }
-        }
-
-        /* Apply north offset + wrap */
-        int16_t deg = (int16_t)_lut[best].degrees + _northOffset;
-        while (deg < 0)   deg += 360;
-        while (deg >= 360) deg -= 360;
+    /* Averaging runs one ADC sample per poll(), 2ms apart */
+    bool startMeasurement() override {
+        _start();
+        _adc.start(_aoPin, _samples, 2);
+        return true;
+    }
 
-        d.rawInt  = best;          /* LUT index */
-        d.voltage = sensV;         /* actual sensor voltage */
-        d.raw     = (float)deg;    /* compass bearing 0–359° */
-        d.ok      = (bestDist < WY_VANE_TOLERANCE);  /* false if no match */
-        if (!d.ok) d.error = "no match — check pull-up and supply voltage";
-        return d;
+    bool poll() override {
+        if (!_busy) return _done;
+        if (!_adc.poll()) return false;
+        _finish(_fromRaw(_adc.mean()));
+        return true;
     }
 
     /* Compass label for last reading */
@@ -383,4 +362,34 @@ private:
     int16_t  _northOffset = 0;
     const WyVaneEntry* _lut    = WY_VANE_8PT;
     uint8_t            _lutSize = 8;
+    WyAnalogSampler    _adc;
+
+    WySensorData _fromRaw(uint16_t raw) {
+        WySensorData d;
+
+        /* Convert to voltage → ratio */
+        float adcV  = (raw / 4095.0f) * 3.3f;
+        float sensV = adcV / _divRatio;
+        float ratio = sensV / _vcc;
+
+        /* Find closest LUT entry */
+        uint8_t best     = 0;
+        float   bestDist = fabsf(ratio - _lut[0].ratio);
+        for (uint8_t i = 1; i < _lutSize; i++) {
+            float dist = fabsf(ratio - _lut[i].ratio);
+            if (dist < bestDist) { bestDist = dist; best = i; }
+        }
+
+        /* Apply north offset + wrap */
+        int16_t deg = (int16_t)_lut[best].degrees + _northOffset;
+        while (deg < 0)   deg += 360;
+        while (deg >= 360) deg -= 360;
+
+        d.rawInt  = best;          /* LUT index */
+        d.voltage = sensV;         /* actual sensor voltage */
+        d.raw     = (float)deg;    /* compass bearing 0–359° */
+        d.ok      = (bestDist < WY_VANE_TOLERANCE);  /* false if no match */
+        if (!d.ok) d.error = "no match — check pull-up and supply voltage";
+        return d;
+    }
 };
@@ -99,13 +99,15 @@ public:
     /* Register a callback for state changes (call poll() in loop) */
     void onStateChange(void (*cb)(bool present)) { _callback = cb; }
 
-    /* Call in loop() to fire state-change callbacks */
-    void poll() {
+    /* Call in loop() to fire state-change callbacks. Also the
+     * WySensorBase poll() — a sweep fires the callback too */
+    bool poll() override {
         bool current = _readDebounced();
         if (current != _lastState) {
             _lastState = current;
             if (_callback) _callback(current);
         }
+        return WySensorBase::poll();
     }
 
 private:
@@ -0,0 +1,834 @@
+/*
+ * WyKeyboardCore.h — on-screen keyboard logic and incremental drawing
+ * ====================================================================
+ * The platform-free half of WyKeyboard: layouts, hit testing, input
+ * buffer and painting through a WyPainter. WyKeyboard.h binds it to
+ * Arduino_GFX and millis().
+ *
+ * Nothing here blocks. A key press draws the key highlighted and
+ * returns; tick(now) puts it back WY_KB_FLASH_MS later. The keyboard
+ * remembers what every key looks like on screen (background, label
+ * colour, label), and each redraw compares that with what it should be:
+ *
+ *   background changed (press, shift key)  → the whole key
+ *   only the label changed (shift / caps)  → the label box, filled with
+ *                                            the key's background, + text
+ *   nothing changed                        → nothing
+ *
+ * Key backgrounds are flat under the label (corners are at most 4 px and
+ * labels sit ≥ 6 px from the edge), so restoring the label box is one
+ * fillRect — what a cached background bitmap would send, without the RAM.
+ * The input field redraws from the first character that changed.
+ *
+ * Layouts are constexpr tables (KeySpec: row, start / end column in
+ * 1/40ths of the width). begin() / show() scale all three once into
+ * resident key rects and a hit grid of [row][column] → key, so a touch
+ * is a divide per axis and two indexes, and switching layer or shift
+ * rebuilds nothing. Rendering walks the same scaled table.
+ *
+ * Prediction bar (setPredictor): WY_KB_SUGGEST cells between the field
+ * and the keys, refilled from WyPredict after every edit — one trie
+ * lookup, and only cells whose word changed are repainted. Tapping a
+ * cell replaces the word being typed; picked words and words finished
+ * with space / OK are learned. Never shown or learned in password mode.
+ *
+ * Pure C++ — host tests drive it with WyFbPainter and count pixels.
+ */
+
+#pragma once
+#include <ctype.h>
+#include "WyUICore.h"
+#include "WyPredict.h"
+
+#ifndef WY_KB_UNITS
+#define WY_KB_UNITS     40            /* layout columns across the width */
+#endif
+#ifndef WY_KB_ROWS
+#define WY_KB_ROWS      5             /* key rows, all layouts */
+#endif
+
+#ifndef WY_KB_FLASH_MS
+#define WY_KB_FLASH_MS  60            /* press highlight */
+#endif
+#ifndef WY_KB_REARM_MS
+#define WY_KB_REARM_MS  50            /* press() gap that counts as a new touch */
+#endif
+#ifndef WY_KB_SUGGEST
+#define WY_KB_SUGGEST   3             /* prediction bar cells */
+#endif
+
+/* ── Result codes ────────────────────────────────────────────────── */
+enum WyKbResult {
+    WY_KB_NONE   = 0,   /* no action */
+    WY_KB_TYPING = 1,   /* character added/removed */
+    WY_KB_DONE   = 2,   /* Enter pressed */
+    WY_KB_CANCEL = 3,   /* Cancel/ESC pressed */
+};
+
+/* ── Keyboard layout ─────────────────────────────────────────────── */
+enum WyKbLayout {
+    WY_KB_QWERTY  = 0,
+    WY_KB_NUMERIC = 1,
+    WY_KB_SYMBOLS = 2,
+};
+
+/* ── Theme ───────────────────────────────────────────────────────── */
+struct WyKbTheme {
+    uint16_t bg;          /* keyboard background */
+    uint16_t key_bg;      /* normal key background */
+    uint16_t key_fg;      /* normal key text */
+    uint16_t key_special; /* shift/del/enter background */
+    uint16_t key_accent;  /* enter/done key */
+    uint16_t key_press;   /* key highlight on press */
+    uint16_t field_bg;    /* input field background */
+    uint16_t field_fg;    /* input field text */
+    uint16_t label_fg;    /* prompt label */
+    uint16_t border;      /* field border */
+};
+
+/* Default dark theme */
+static const WyKbTheme WY_KB_THEME_DARK = {
+    .bg          = 0x1082,   /* #101820 */
+    .key_bg      = 0x2945,   /* #212830 */
+    .key_fg      = 0xEF7D,   /* #E8ECF0 */
+    .key_special = 0x39C7,   /* #374050 */
+    .key_accent  = 0x0696,   /* #00D4AA teal */
+    .key_press   = 0x0475,   /* #009080 */
+    .field_bg    = 0x10A2,   /* #101820 slightly lighter */
+    .field_fg    = 0xEF7D,
+    .label_fg    = 0x8C71,   /* #808080 */
+    .border      = 0x0696,
+};
+
+/* Light theme */
+static const WyKbTheme WY_KB_THEME_LIGHT = {
+    .bg          = 0xD69A,   /* #D0D8E0 */
+    .key_bg      = 0xFFFF,
+    .key_fg      = 0x0000,
+    .key_special = 0xC618,   /* #C0C8D0 */
+    .key_accent  = 0x0696,
+    .key_press   = 0xB5B6,
+    .field_bg    = 0xFFFF,
+    .field_fg    = 0x0000,
+    .label_fg    = 0x4A49,
+    .border      = 0x0696,
+};
+
+/* ══════════════════════════════════════════════════════════════════
+ * WyKeyboardCore
+ * ══════════════════════════════════════════════════════════════════ */
+class WyKeyboardCore {
+public:
+    static const int MAX_LEN  = 128;
+    static const int MAX_KEYS = 48;
+
+    enum KeyType {
+        KT_CHAR,    /* printable character */
+        KT_SHIFT,
+        KT_CAPS,
+        KT_BACKSPACE,
+        KT_ENTER,
+        KT_CANCEL,
+        KT_SPACE,
+        KT_LAYOUT,  /* switch layout */
+        KT_CLEAR,
+    };
+
+    struct KeyDef {
+        int16_t x, y, w, h;
+        KeyType type;
+        char    ch;         /* for KT_CHAR */
+        char    label[6];   /* display label */
+        WyKbLayout switchTo; /* for KT_LAYOUT */
+    };
+
+    /* Layout table entry: key spans columns [u0, u1) of WY_KB_UNITS */
+    struct KeySpec {
+        uint8_t    row, u0, u1;
+        KeyType    type;
+        char       ch;         /* KT_CHAR: lower case; KT_LAYOUT: target */
+        char       label[6];
+    };
+
+    /* ── Init ────────────────────────────────────────────────────── */
+    void begin(WyPainter *p, uint16_t screen_w, uint16_t screen_h,
+               const WyKbTheme *theme = &WY_KB_THEME_DARK) {
+        _p      = p;
+        _sw     = screen_w;
+        _sh     = screen_h;
+        _theme  = theme;
+        _active = false;
+        _recalc_layout();
+        _scale();
+    }
+
+    /* ── Show keyboard ───────────────────────────────────────────── */
+    /*
+     * prompt   — label above input field (nullptr = none)
+     * maxLen   — maximum input length (0 = MAX_LEN)
+     * password — mask input with ●
+     * layout   — initial layout (QWERTY/NUMERIC/SYMBOLS)
+     * yOffset  — top of keyboard area in pixels (default = auto: bottom half)
+     */
+    void show(const char *prompt = nullptr,
+              uint8_t     maxLen   = 0,
+              bool        password = false,
+              WyKbLayout  layout   = WY_KB_QWERTY,
+              int         yOffset  = -1) {
+        _active   = true;
+        _password = password;
+        _maxLen   = maxLen ? maxLen : MAX_LEN;
+        _layout   = layout;
+        _shift    = false;
+        _caps     = false;
+        _bufLen   = 0;
+        _buf[0]   = '\0';
+        _flash    = -1;
+
+        if (prompt) {
+            strncpy(_prompt, prompt, sizeof(_prompt) - 1);
+            _prompt[sizeof(_prompt) - 1] = '\0';
+        } else {
+            _prompt[0] = '\0';
+        }
+
+        /* Keyboard top = yOffset or auto (bottom 55% of screen) */
+        _kb_y = (yOffset >= 0) ? yOffset : (int)(_sh * 0.45f);
+        _recalc_layout();
+        if (yOffset < 0 && _bar_h) {
+            /* Auto: the prediction bar takes its room from above, not from the keys */
+            _kb_y = _max(0, _kb_y - _bar_h - _row_gap);
+            _recalc_layout();
+        }
+        _scale();
+        _draw_all();
+    }
+
+    /* ── Word prediction: bar above the keys from the next show() ── */
+    void setPredictor(WyPredict *p) { _predict = p; }
+    WyPredict *predictor() const { return _predict; }
+    const char *suggestion(int i) const { return (i >= 0 && i < WY_KB_SUGGEST) ? _bar[i] : ""; }
+
+    /* ── Hide keyboard ───────────────────────────────────────────── */
+    void hide() {
+        _active = false;
+        _flash  = -1;
+        /* Caller is responsible for redrawing the screen area */
+    }
+
+    /* ── Process a touch event ───────────────────────────────────── */
+    /* `now` in ms; the pressed key stays highlighted until tick().
+       Edge-triggered: acts on touch-down only and ignores the held
+       finger. Call press() every loop while touched; a call more than
+       WY_KB_REARM_MS after the previous one is a new touch, and
+       release() when the finger lifts re-arms at once (WY_KB_POLL) */
+    WyKbResult press(int tx, int ty, uint32_t now) {
+        if (!_active) return WY_KB_NONE;
+        bool held = _down && now - _lastPress <= WY_KB_REARM_MS;
+        _down = true;
+        _lastPress = now;
+        if (held) return WY_KB_NONE;
+        tick(now);
+
+        int c = barAt(tx, ty);
+        if (c >= 0) return _accept(c);
+        int i = keyAt(tx, ty);
+        return i < 0 ? WY_KB_NONE : _handle_key(i, now);
+    }
+
+    /* ── Finger lifted: the next press() is a new key (optional) ─── */
+    void release() { _down = false; }
+
+    /* ── Hit test: key index in the current layout, -1 = none ───── */
+    /* Gaps belong to the key left of / above them, so no touch on the
+       key rows is lost */
+    int keyAt(int tx, int ty) const {
+        if (ty < _keys_y || tx < 0 || tx >= _sw) return -1;
+        int row = (ty - _keys_y) / _row_pitch;
+        if (row >= WY_KB_ROWS) return -1;
+        /* column u covers x in [_ux(u), _ux(u + 1)) */
+        int t = tx - _key_gap;
+        int u = t < 0 ? 0 : ((t + 1) * WY_KB_UNITS - 1) / _span;
+        if (u >= WY_KB_UNITS) u = WY_KB_UNITS - 1;
+        uint8_t k = _hit[_layout][row][u];
+        return k == 0xFF ? -1 : k;
+    }
+
+    /* ── Hit test: prediction bar cell, -1 = none ─────────────────── */
+    int barAt(int tx, int ty) const {
+        if (!_bar_h || ty < _bar_y() || ty >= _bar_y() + _bar_h || tx < 0 || tx >= _sw) return -1;
+        int c = (tx - _key_gap) * WY_KB_SUGGEST / _span;
+        return c < 0 ? 0 : _min(c, WY_KB_SUGGEST - 1);
+    }
+
+    /* ── Timed redraws — call every loop() ───────────────────────── */
+    void tick(uint32_t now) {
+        if (_flash < 0 || (int32_t)(now - _flashUntil) < 0) return;
+        _flash = -1;
+        if (_active) _draw_keys();
+    }
+    bool flashing() const { return _flash >= 0; }
+
+    /* ── Getters ─────────────────────────────────────────────────── */
+    bool        active()  const { return _active; }
+    const char *value()   const { return _buf; }
+    int         length()  const { return _bufLen; }
+    int         kb_top()  const { return _kb_y; }  /* y where keyboard starts */
+    int         keyCount() const { return _count[_layout]; }
+    const KeyDef &key(int i) const { return _layers[_layout][i]; }
+
+    /* ── Set initial value (e.g. for edit mode) ──────────────────── */
+    void setValue(const char *s) {
+        strncpy(_buf, s, _maxLen);
+        _buf[_maxLen] = '\0';
+        _bufLen = strlen(_buf);
+        _draw_field();
+    }
+
+    /* ── Clear input ─────────────────────────────────────────────── */
+    void clear() {
+        _bufLen = 0;
+        _buf[0] = '\0';
+        _draw_field();
+    }
+
+protected:
+    /* What a key looks like on screen right now */
+    struct KeyLook {
+        uint16_t bg, fg;
+        char     label[6];
+        bool     valid;
+    };
+
+    /* ── State ───────────────────────────────────────────────────── */
+    WyPainter        *_p       = nullptr;
+    const WyKbTheme  *_theme   = &WY_KB_THEME_DARK;
+    uint16_t          _sw = 0, _sh = 0;
+    bool              _active  = false;
+    bool              _password= false;
+    bool              _shift   = false;
+    bool              _caps    = false;
+    uint8_t           _maxLen  = MAX_LEN;
+    WyKbLayout        _layout  = WY_KB_QWERTY;
+
+    char     _buf[MAX_LEN + 1] = "";
+    int      _bufLen = 0;
+    char     _prompt[64] = "";
+
+    /* All layouts, scaled to the screen and kept */
+    KeyDef   _layers[3][MAX_KEYS];
+    uint8_t  _count[3] = {};
+    uint8_t  _hit[3][WY_KB_ROWS][WY_KB_UNITS];
+    KeyLook  _drawn[MAX_KEYS] = {};
+    int      _kb_y      = 0;   /* top of keyboard panel in screen coords */
+    int      _keys_y    = 0;   /* top of the first key row */
+    int      _row_pitch = 1;   /* key height + row gap */
+    int      _span      = 1;   /* width the columns divide (screen - gap) */
+
+    bool     _down  = false;   /* touch held since the last press() */
+    uint32_t _lastPress = 0;
+    int      _flash = -1;      /* highlighted key, -1 = none */
+    uint32_t _flashUntil = 0;
+
+    char     _shown[MAX_LEN + 1] = "";   /* field text as drawn */
+    int      _cursor_x = -1;             /* -1 = field not drawn */
+
+    /* Prediction bar */
+    WyPredict *_predict = nullptr;
+    int      _bar_h = 0;                 /* 0 = no bar */
+    char     _bar[WY_KB_SUGGEST][WY_PREDICT_WORD] = {};
+    char     _barShown[WY_KB_SUGGEST][WY_PREDICT_WORD] = {};
+    bool     _barValid = false;          /* _barShown is on screen */
+
+    /* Computed layout dimensions */
+    int _key_h;     /* key height */
+    int _key_gap;   /* gap between keys */
+    int _row_gap;   /* gap between rows */
+    int _field_h;   /* input field height */
+    int _label_h;   /* prompt label height */
+
+    static int _max(int a, int b) { return a > b ? a : b; }
+    static int _min(int a, int b) { return a < b ? a : b; }
+
+    /* ── Layout recalc ───────────────────────────────────────────── */
+    void _recalc_layout() {
+        int kb_height = _sh - _kb_y;
+
+        /* Rows: label + field + 4 key rows + bottom row = 7 slots */
+        _label_h = _max(14, kb_height / 14);
+        _field_h = _max(24, kb_height / 8);
+        _key_gap = _max(2,  kb_height / 60);
+        _row_gap = _max(2,  kb_height / 50);
+        int rows_area = kb_height - _label_h - _field_h - _key_gap * 2 - _row_gap * 2;
+        _bar_h = (_predict && !_password) ? _max(16, kb_height / 10) : 0;
+        if (_bar_h) rows_area -= _bar_h + _row_gap;
+        _key_h = _max(20, rows_area / 5 - _row_gap);
+    }
+
+    /* Bar sits where the keys would start without it */
+    int _bar_y() const { return _kb_y + _label_h + _field_h + _key_gap; }
+
+    /* ── Layout tables ───────────────────────────────────────────── */
+    /* Function-local: before C++17 a constexpr member array would need
+       an out-of-line definition, which a header can't provide */
+    static const KeySpec *_table(int layout, int &n) {
+        static constexpr KeySpec QWERTY[] = {
+            { 0,  0,  4, KT_CHAR, 'q', "q" }, { 0,  4,  8, KT_CHAR, 'w', "w" },
+            { 0,  8, 12, KT_CHAR, 'e', "e" }, { 0, 12, 16, KT_CHAR, 'r', "r" },
+            { 0, 16, 20, KT_CHAR, 't', "t" }, { 0, 20, 24, KT_CHAR, 'y', "y" },
+            { 0, 24, 28, KT_CHAR, 'u', "u" }, { 0, 28, 32, KT_CHAR, 'i', "i" },
+            { 0, 32, 36, KT_CHAR, 'o', "o" }, { 0, 36, 40, KT_CHAR, 'p', "p" },
+            /* Row 1: a-l, centred */
+            { 1,  2,  6, KT_CHAR, 'a', "a" }, { 1,  6, 10, KT_CHAR, 's', "s" },
+            { 1, 10, 14, KT_CHAR, 'd', "d" }, { 1, 14, 18, KT_CHAR, 'f', "f" },
+            { 1, 18, 22, KT_CHAR, 'g', "g" }, { 1, 22, 26, KT_CHAR, 'h', "h" },
+            { 1, 26, 30, KT_CHAR, 'j', "j" }, { 1, 30, 34, KT_CHAR, 'k', "k" },
+            { 1, 34, 38, KT_CHAR, 'l', "l" },
+            /* Row 2: SHIFT + z-m + BACKSPACE */
+            { 2,  0,  6, KT_SHIFT, 0, "⬆" },
+            { 2,  6, 10, KT_CHAR, 'z', "z" }, { 2, 10, 14, KT_CHAR, 'x', "x" },
+            { 2, 14, 18, KT_CHAR, 'c', "c" }, { 2, 18, 22, KT_CHAR, 'v', "v" },
+            { 2, 22, 26, KT_CHAR, 'b', "b" }, { 2, 26, 30, KT_CHAR, 'n', "n" },
+            { 2, 30, 34, KT_CHAR, 'm', "m" },
+            { 2, 34, 40, KT_BACKSPACE, 0, "⌫" },
+            /* Row 3: ?123 | SPACE | CANCEL | ENTER */
+            { 3,  0,  6, KT_LAYOUT, WY_KB_NUMERIC, "?123" },
+            { 3,  6, 26, KT_SPACE,  0, "SPACE" },
+            { 3, 26, 32, KT_CANCEL, 0, "ESC" },
+            { 3, 32, 40, KT_ENTER,  0, "OK" },
+        };
+
+        static constexpr KeySpec NUMERIC[] = {
+            /* 3×3 numpad + extras column */
+            { 0,  0, 10, KT_CHAR, '7', "7" }, { 0, 10, 20, KT_CHAR, '8', "8" },
+            { 0, 20, 30, KT_CHAR, '9', "9" }, { 0, 30, 40, KT_CHAR, '+', "+" },
+            { 1,  0, 10, KT_CHAR, '4', "4" }, { 1, 10, 20, KT_CHAR, '5', "5" },
+            { 1, 20, 30, KT_CHAR, '6', "6" }, { 1, 30, 40, KT_CHAR, '-', "-" },
+            { 2,  0, 10, KT_CHAR, '1', "1" }, { 2, 10, 20, KT_CHAR, '2', "2" },
+            { 2, 20, 30, KT_CHAR, '3', "3" }, { 2, 30, 40, KT_CHAR, '*', "*" },
+            /* ABC | 0 | . | DEL */
+            { 3,  0, 10, KT_LAYOUT, WY_KB_QWERTY, "ABC" },
+            { 3, 10, 20, KT_CHAR, '0', "0" }, { 3, 20, 30, KT_CHAR, '.', "." },
+            { 3, 30, 40, KT_BACKSPACE, 0, "⌫" },
+            /* CANCEL | SPACE | ENTER */
+            { 4,  0, 10, KT_CANCEL, 0, "ESC" },
+            { 4, 10, 30, KT_SPACE,  0, "SPACE" },
+            { 4, 30, 40, KT_ENTER,  0, "OK" },
+        };
+
+        static constexpr KeySpec SYMBOLS[] = {
+            { 0,  0,  4, KT_CHAR, '!', "!" }, { 0,  4,  8, KT_CHAR, '@', "@" },
+            { 0,  8, 12, KT_CHAR, '#', "#" }, { 0, 12, 16, KT_CHAR, '$', "$" },
+            { 0, 16, 20, KT_CHAR, '%', "%" }, { 0, 20, 24, KT_CHAR, '^', "^" },
+            { 0, 24, 28, KT_CHAR, '&', "&" }, { 0, 28, 32, KT_CHAR, '*', "*" },
+            { 0, 32, 36, KT_CHAR, '(', "(" }, { 0, 36, 40, KT_CHAR, ')', ")" },
+            { 1,  0,  4, KT_CHAR, '-', "-" }, { 1,  4,  8, KT_CHAR, '_', "_" },
+            { 1,  8, 12, KT_CHAR, '=', "=" }, { 1, 12, 16, KT_CHAR, '+', "+" },
+            { 1, 16, 20, KT_CHAR, '[', "[" }, { 1, 20, 24, KT_CHAR, ']', "]" },
+            { 1, 24, 28, KT_CHAR, '{', "{" }, { 1, 28, 32, KT_CHAR, '}', "}" },
+            { 1, 32, 36, KT_CHAR, '|', "|" }, { 1, 36, 40, KT_CHAR, ';', ";" },
+            { 2,  0,  4, KT_CHAR, ':', ":" }, { 2,  4,  8, KT_CHAR, '\'', "'" },
+            { 2,  8, 12, KT_CHAR, ',', "," }, { 2, 12, 16, KT_CHAR, '.', "." },
+            { 2, 16, 20, KT_CHAR, '<', "<" }, { 2, 20, 24, KT_CHAR, '>', ">" },
+            { 2, 24, 28, KT_CHAR, '?', "?" }, { 2, 28, 32, KT_CHAR, '/', "/" },
+            { 2, 32, 36, KT_CHAR, '`', "`" }, { 2, 36, 40, KT_CHAR, '~', "~" },
+            /* ABC | SPACE | DEL */
+            { 3,  0, 10, KT_LAYOUT, WY_KB_QWERTY, "ABC" },
+            { 3, 10, 32, KT_SPACE,  0, "SPACE" },
+            { 3, 32, 40, KT_BACKSPACE, 0, "⌫" },
+            /* CANCEL | ENTER */
+            { 4,  0, 20, KT_CANCEL, 0, "ESC" },
+            { 4, 20, 40, KT_ENTER,  0, "OK" },
+        };
+        switch (layout) {
+            case WY_KB_NUMERIC: n = sizeof(NUMERIC) / sizeof(KeySpec); return NUMERIC;
+            case WY_KB_SYMBOLS: n = sizeof(SYMBOLS) / sizeof(KeySpec); return SYMBOLS;
+            default:            n = sizeof(QWERTY)  / sizeof(KeySpec); return QWERTY;
+        }
+    }
+
+    /* Left edge of column u; a key spanning [u0, u1) is drawn from
+       _ux(u0) to _ux(u1) - gap, so every key has a gap on its right */
+    int _ux(int u) const { return _key_gap + u * _span / WY_KB_UNITS; }
+
+    /* ── Scale the layout tables to this screen ──────────────────── */
+    void _scale() {
+        _keys_y    = _bar_y() + (_bar_h ? _bar_h + _row_gap : 0);
+        _row_pitch = _key_h + _row_gap;
+        _span      = _max(WY_KB_UNITS, _sw - _key_gap);
+        memset(_hit, 0xFF, sizeof(_hit));
+        for (int l = 0; l < 3; l++) {
+            int n;
+            const KeySpec *spec = _table(l, n);
+            _count[l] = (uint8_t)_min(n, MAX_KEYS);
+            for (int i = 0; i < _count[l]; i++) {
+                const KeySpec &s = spec[i];
+                KeyDef &k = _layers[l][i];
+                k.x = (int16_t)_ux(s.u0);
+                k.y = (int16_t)(_keys_y + s.row * _row_pitch);
+                k.w = (int16_t)(_ux(s.u1) - _key_gap - k.x);
+                k.h = (int16_t)_key_h;
+                k.type = s.type;
+                k.ch = s.type == KT_LAYOUT ? 0 : s.ch;
+                k.switchTo = s.type == KT_LAYOUT ? (WyKbLayout)s.ch : WY_KB_QWERTY;
+                memcpy(k.label, s.label, sizeof(k.label));
+                for (int u = s.u0; u < s.u1; u++) _hit[l][s.row][u] = (uint8_t)i;
+            }
+        }
+        _apply_case();
+    }
+
+    /* ── Shift / caps: relabel the letter keys in place ──────────── */
+    void _apply_case() {
+        bool up = _shift || _caps;
+        KeyDef *keys = _layers[WY_KB_QWERTY];
+        for (int i = 0; i < _count[WY_KB_QWERTY]; i++) {
+            KeyDef &k = keys[i];
+            if (k.type == KT_CHAR && isalpha((unsigned char)k.ch)) {
+                k.ch = up ? toupper(k.ch) : tolower(k.ch);
+                k.label[0] = k.ch;
+            } else if (k.type == KT_SHIFT) {
+                strcpy(k.label, _shift ? "⬆!" : "⬆");
+            }
+        }
+    }
+
+    /* ── Switch layer: keys moved, so clear the key area ─────────── */
+    void _switch_layer(WyKbLayout to) {
+        _layout = to;
+        for (int i = 0; i < MAX_KEYS; i++) _drawn[i].valid = false;
+        int top = _bar_h ? _bar_y() + _bar_h : _kb_y + _label_h + _field_h;
+        _p->fillRect(0, (int16_t)top, (int16_t)_sw, (int16_t)(_sh - top), _theme->bg);
+        _draw_keys();
+    }
+
+    /* ── Handle key press ────────────────────────────────────────── */
+    WyKbResult _handle_key(int idx, uint32_t now) {
+        KeyDef &k = _layers[_layout][idx];
+
+        /* Flash key — tick() restores it */
+        _flash      = idx;
+        _flashUntil = now + WY_KB_FLASH_MS;
+
+        switch (k.type) {
+            case KT_CHAR:
+                if (_bufLen < _maxLen) {
+                    _buf[_bufLen++] = k.ch;
+                    _buf[_bufLen]   = '\0';
+                    if (_shift && !_caps) {
+                        _shift = false;
+                        _apply_case();
+                    }
+                    _draw_keys();
+                    _draw_field();
+                    return WY_KB_TYPING;
+                }
+                _draw_keys();
+                return WY_KB_NONE;
+
+            case KT_BACKSPACE:
+                _draw_keys();
+                if (_bufLen > 0) {
+                    _buf[--_bufLen] = '\0';
+                    _draw_field();
+                    return WY_KB_TYPING;
+                }
+                return WY_KB_NONE;
+
+            case KT_SPACE:
+                _draw_keys();
+                _learn_word();
+                if (_bufLen < _maxLen) {
+                    _buf[_bufLen++] = ' ';
+                    _buf[_bufLen]   = '\0';
+                    _draw_field();
+                    return WY_KB_TYPING;
+                }
+                return WY_KB_NONE;
+
+            case KT_SHIFT:
+                _shift = !_shift;
+                _caps  = false;
+                _apply_case();
+                _draw_keys();
+                return WY_KB_TYPING;
+
+            case KT_CAPS:
+                _caps  = !_caps;
+                _shift = false;
+                _apply_case();
+                _draw_keys();
+                return WY_KB_TYPING;
+
+            case KT_CLEAR:
+                _draw_keys();
+                _bufLen = 0;
+                _buf[0] = '\0';
+                _draw_field();
+                return WY_KB_TYPING;
+
+            case KT_LAYOUT:
+                _flash  = -1;                     /* the key is gone */
+                _switch_layer(k.switchTo);
+                return WY_KB_NONE;
+
+            case KT_ENTER:
+                _learn_word();
+                _flash  = -1;                     /* caller repaints the screen */
+                _active = false;
+                return WY_KB_DONE;
+
+            case KT_CANCEL:
+                _flash  = -1;
+                _active = false;
+                _bufLen = 0;
+                _buf[0] = '\0';
+                return WY_KB_CANCEL;
+
+            default:
+                _draw_keys();
+                return WY_KB_NONE;
+        }
+    }
+
+    /* ── Draw: all ───────────────────────────────────────────────── */
+    void _draw_all() {
+        /* Background */
+        _p->fillRect(0, (int16_t)_kb_y, (int16_t)_sw, (int16_t)(_sh - _kb_y), _theme->bg);
+
+        _draw_label();
+        _cursor_x = -1;
+        _barValid = false;
+        _draw_field();
+        for (int i = 0; i < MAX_KEYS; i++) _drawn[i].valid = false;
+        _apply_case();
+        _draw_keys();
+    }
+
+    /* ── Draw: prompt label ──────────────────────────────────────── */
+    void _draw_label() {
+        if (!_prompt[0]) return;
+        int y = _kb_y + 2;
+        _p->text(6, (int16_t)(y + 4), _prompt, 1, _theme->label_fg);
+    }
+
+    /* ── Draw: input field ───────────────────────────────────────── */
+    /* Frame once; after that only from the first changed character on */
+    void _draw_field() {
+        if (!_p) return;
+        int fy = _kb_y + _label_h;
+        int fw = _sw - 4;
+        int ty = fy + (_field_h - 8) / 2;
+
+        /* Display text or password mask; scroll to show the last N chars */
+        int max_chars = (fw - 16) / 6;  /* approx for default font */
+        int n = _min(_bufLen, max_chars);
+        char vis[MAX_LEN + 1];
+        if (_password) memset(vis, '\xDB', n);      /* solid block */
+        else           memcpy(vis, _buf + _bufLen - n, n);
+        vis[n] = '\0';
+
+        /* Cursor */
+        int cx = 8 + n * 6;
+
+        int from = 0;
+        if (_cursor_x < 0) {
+            _p->fillRect(2, (int16_t)fy, (int16_t)fw, (int16_t)_field_h, _theme->field_bg);
+            _p->fillRect(2, (int16_t)fy, (int16_t)fw, 1, _theme->border);
+            _p->fillRect(2, (int16_t)(fy + _field_h - 1), (int16_t)fw, 1, _theme->border);
+            _p->fillRect(2, (int16_t)fy, 1, (int16_t)_field_h, _theme->border);
+            _p->fillRect((int16_t)(2 + fw - 1), (int16_t)fy, 1, (int16_t)_field_h, _theme->border);
+        } else {
+            while (vis[from] && vis[from] == _shown[from]) from++;
+            int end = 8 + (int)strlen(_shown) * 6;
+            if (_cursor_x + 2 > end) end = _cursor_x + 2;
+            int x0 = 8 + from * 6;
+            if (end > x0)
+                _p->fillRect((int16_t)x0, (int16_t)(fy + 4), (int16_t)(end - x0),
+                             (int16_t)(_field_h - 8), _theme->field_bg);
+        }
+        _p->text((int16_t)(8 + from * 6), (int16_t)ty, vis + from, 1, _theme->field_fg);
+        if (cx < fw - 4) {
+            _p->fillRect((int16_t)cx, (int16_t)(fy + 4), 2, (int16_t)(_field_h - 8), _theme->border);
+        }
+        memcpy(_shown, vis, n + 1);
+        _cursor_x = cx;
+        _update_bar();
+    }
+
+    /* ── Prediction bar ──────────────────────────────────────────── */
+    /* Start of the word being typed: letters, digits, - _ ' */
+    int _word_start() const {
+        int i = _bufLen;
+        while (i > 0) {
+            char c = _buf[i - 1];
+            if (!isalnum((unsigned char)c) && c != '-' && c != '_' && c != '\'') break;
+            i--;
+        }
+        return i;
+    }
+
+    void _learn_word() {
+        if (!_bar_h) return;
+        int ws = _word_start();
+        if (_bufLen - ws < 2 || _bufLen - ws >= WY_PREDICT_WORD) return;
+        _predict->learn(_buf + ws);
+    }
+
+    /* Tapped cell: its word replaces the one being typed, plus a space */
+    WyKbResult _accept(int c) {
+        if (!_bar[c][0]) return WY_KB_NONE;
+        char word[WY_PREDICT_WORD];
+        memcpy(word, _bar[c], sizeof(word));
+        int ws = _word_start();
+        int len = (int)strlen(word);
+        if (ws + len > _maxLen) return WY_KB_NONE;
+        memcpy(_buf + ws, word, len);
+        _bufLen = ws + len;
+        if (_bufLen < _maxLen) _buf[_bufLen++] = ' ';
+        _buf[_bufLen] = '\0';
+        _predict->learn(word);
+        if (_shift && !_caps) {
+            _shift = false;
+            _apply_case();
+            _draw_keys();
+        }
+        _draw_field();
+        return WY_KB_TYPING;
+    }
+
+    /* One lookup per edit; repaint only the cells whose word changed */
+    void _update_bar() {
+        if (!_bar_h) return;
+        WyPredictHit hit[WY_KB_SUGGEST];
+        uint8_t n = 0;
+        int ws = _word_start();
+        if (ws < _bufLen && _bufLen - ws < WY_PREDICT_WORD) {
+            char word[WY_PREDICT_WORD];
+            memcpy(word, _buf + ws, _bufLen - ws);
+            word[_bufLen - ws] = '\0';
+            n = _predict->suggest(word, hit, WY_KB_SUGGEST);
+        }
+        for (int i = 0; i < WY_KB_SUGGEST; i++) {
+            if (i < n) memcpy(_bar[i], hit[i].word, WY_PREDICT_WORD);
+            else       _bar[i][0] = '\0';
+        }
+        for (int i = 0; i < WY_KB_SUGGEST; i++) _draw_cell(i);
+        _barValid = true;
+    }
+
+    KeyDef _cell(int i) const {
+        KeyDef k = {};
+        int x0 = _key_gap + i * _span / WY_KB_SUGGEST;
+        int x1 = _key_gap + (i + 1) * _span / WY_KB_SUGGEST;
+        k.x = (int16_t)x0;
+        k.y = (int16_t)_bar_y();
+        k.w = (int16_t)(x1 - _key_gap - x0);
+        k.h = (int16_t)_bar_h;
+        return k;
+    }
+
+    void _draw_cell(int i) {
+        char *shown = _barShown[i];
+        const char *word = _bar[i];
+        if (_barValid && strcmp(shown, word) == 0) return;
+
+        KeyDef k = _cell(i);
+        /* Clip to the cell: long words lose their tail */
+        char label[WY_PREDICT_WORD];
+        int fit = _max(0, _min((k.w - 4) / 6, WY_PREDICT_WORD - 1));
+        strncpy(label, word, fit);
+        label[fit] = '\0';
+        WyRect nb = _label_box(k, label);
+
+        if (!word[0]) {
+            if (_barValid) _p->fillRect(k.x, k.y, k.w, k.h, _theme->bg);   /* else still background */
+        } else if (_barValid && shown[0]) {
+            char old[WY_PREDICT_WORD];
+            strncpy(old, shown, fit);
+            old[fit] = '\0';
+            WyRect clr = nb.unite(_label_box(k, old)).intersect(WyRect{ k.x, k.y, k.w, k.h });
+            _p->fillRect(clr.x, clr.y, clr.w, clr.h, _theme->key_special);
+        } else {
+            _p->fillRoundRect(k.x, k.y, k.w, k.h, (int16_t)_min(4, _bar_h / 5), _theme->key_special);
+        }
+        if (word[0]) _p->text(nb.x, nb.y, label, 1, _theme->key_fg);
+        memcpy(shown, word, WY_PREDICT_WORD);
+    }
+
+    /* ── Draw: keys that changed ─────────────────────────────────── */
+    void _draw_keys() {
+        for (int i = 0; i < _count[_layout]; i++) _draw_key(i);
+    }
+
+    void _key_colours(int idx, uint16_t &bg, uint16_t &fg) const {
+        const KeyDef &k = _layers[_layout][idx];
+        if (idx == _flash) {
+            bg = _theme->key_press;
+            fg = _theme->key_fg;
+            return;
+        }
+        switch (k.type) {
+            case KT_ENTER:
+                bg = _theme->key_accent;
+                fg = 0x0000;
+                break;
+            case KT_SHIFT:
+                bg = (_shift || _caps) ? _theme->key_accent : _theme->key_special;
+                fg = (_shift || _caps) ? 0x0000 : _theme->key_fg;
+                break;
+            case KT_BACKSPACE:
+            case KT_CANCEL:
+            case KT_LAYOUT:
+                bg = _theme->key_special;
+                fg = _theme->key_fg;
+                break;
+            case KT_SPACE:
+                bg = _theme->key_special;
+                fg = _theme->label_fg;
+                break;
+            default:
+                bg = _theme->key_bg;
+                fg = _theme->key_fg;
+                break;
+        }
+    }
+
+    /* Centred label box */
+    WyRect _label_box(const KeyDef &k, const char *label) const {
+        int label_w = strlen(label) * 6;
+        int label_h = 8;
+        int lx = k.x + (k.w - label_w) / 2;
+        int ly = k.y + (k.h - label_h) / 2;
+        if (lx < k.x) lx = k.x + 2;
+        return WyRect{ (int16_t)lx, (int16_t)ly, (int16_t)label_w, (int16_t)label_h };
+    }
+
+    /* ── Draw: single key, only what differs from the screen ─────── */
+    void _draw_key(int idx) {
+        KeyDef  &k = _layers[_layout][idx];
+        KeyLook &d = _drawn[idx];
+        uint16_t bg, fg;
+        _key_colours(idx, bg, fg);
+
+        bool same = strcmp(d.label, k.label) == 0;
+        if (d.valid && d.bg == bg && d.fg == fg && same) return;
+
+        WyRect nb = _label_box(k, k.label);
+        if (d.valid && d.bg == bg) {
+            /* Same background: clear the old label, draw the new one */
+            WyRect clr = nb.unite(_label_box(k, d.label))
+                           .intersect(WyRect{ k.x, k.y, k.w, k.h });
+            _p->fillRect(clr.x, clr.y, clr.w, clr.h, bg);
+        } else {
+            int r = _min(4, _key_h / 5);
+            _p->fillRoundRect(k.x, k.y, k.w, k.h, (int16_t)r, bg);
+        }
+        _p->text(nb.x, nb.y, k.label, 1, fg);
+
+        d.bg = bg;
+        d.fg = fg;
+        memcpy(d.label, k.label, sizeof(d.label));
+        d.valid = true;
+    }
+};
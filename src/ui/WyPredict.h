@@ -0,0 +1,481 @@
+/*
+ * WyPredict.h — Word prediction from a flash-resident trie
+ * ==========================================================
+ * Suggests completions for the word being typed on WyKeyboard. The
+ * vocabulary is a compact trie blob — generated on the host by
+ * tools/wytrie.cpp (or at runtime with wyTrieBuild) — read in place from
+ * flash; a small RAM table learns the words the user actually uses.
+ *
+ * Blob ("WYT1", little-endian), a path-compressed trie in preorder:
+ *
+ *   header   "WYT1", u32 total length               root node at offset 8
+ *   node     u8  terminal (bit 7) | child count (bits 0-6)
+ *            u8  best rank in the subtree            nodes with children
+ *            u8  rank                                terminal nodes
+ *            per child, sorted: u8 label length, label,
+ *                               LEB128 offset of the child past this table
+ *
+ * Children follow their parent, so the first offset is 0 and most fit in
+ * a byte; a leaf is two bytes. Either way byte 1 of a node is the best
+ * rank below it, which is all the search needs to prune.
+ *
+ * Ranks are 1..255, higher = more likely. complete() walks the prefix,
+ * then searches depth-first, skipping any subtree whose best rank can't
+ * beat the k-th result so far — a few dozen nodes per lookup whatever
+ * the vocabulary size. No heap: the stack and results are fixed arrays.
+ * The default vocabulary (WyPredictWords.h, ~500 words) is 4.3 KB; a
+ * 20k-word list packs to 8.9 bytes a word (wytrie --bench, synthetic
+ * words), less than the 9.9 bytes of text it came from.
+ *
+ * Learning: WY_PREDICT_LEARN entries of (word, hits). A suggestion scores
+ * rank + WY_PREDICT_BOOST × hits: a word picked once ranks with the
+ * middle of the vocabulary, twice beats all of it, and learned words that
+ * aren't in the vocabulary (an SSID, a host name) are suggested too. A full table drops its least
+ * used, oldest entry. save() / restore() round-trip it through NVS.
+ *
+ * Usage:
+ *   #include <ui/WyPredictWords.h>
+ *
+ *   WyPredict predict;
+ *   predict.begin(WY_PREDICT_WORDS, sizeof(WY_PREDICT_WORDS));
+ *   keyboard.setPredictor(&predict);               // bar above the keys
+ *
+ *   WyPredictHit hit[3];
+ *   uint8_t n = predict.suggest("pas", hit, 3);    // "password", "pass", ...
+ *   predict.learn("greenhouse-2");
+ *
+ * Pure C++ — the host tests and tools/wytrie.cpp use the same code.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef WY_PREDICT_WORD
+#define WY_PREDICT_WORD   32          /* longest word + NUL */
+#endif
+#ifndef WY_PREDICT_LEARN
+#define WY_PREDICT_LEARN  32          /* learned words kept in RAM */
+#endif
+#ifndef WY_PREDICT_BOOST
+#define WY_PREDICT_BOOST  128         /* score per accepted use */
+#endif
+#ifndef WY_PREDICT_K
+#define WY_PREDICT_K      4           /* most suggestions per lookup */
+#endif
+
+#define WY_TRIE_HEADER    8
+
+struct WyPredictHit {
+    char     word[WY_PREDICT_WORD];
+    uint16_t score;
+};
+
+/* Insert into out[0..n) kept best-first; equal scores keep arrival order */
+static inline void wyPredictOffer(WyPredictHit *out, uint8_t &n, uint8_t k,
+                                  const char *w, size_t len, uint16_t score) {
+    if (n == k && score <= out[k - 1].score) return;
+    uint8_t i = n < k ? n++ : (uint8_t)(k - 1);
+    while (i > 0 && out[i - 1].score < score) { out[i] = out[i - 1]; i--; }
+    memcpy(out[i].word, w, len);
+    out[i].word[len] = '\0';
+    out[i].score = score;
+}
+
+static inline char wyPredictLower(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c + 32) : c; }
+
+/* ── Builder ──────────────────────────────────────────────────────── */
+struct WyTrieWord {
+    const char *w;
+    uint8_t     rank;
+};
+
+static inline int _wy_trie_cmp(const void *a, const void *b) {
+    return strcmp(((const WyTrieWord *)a)->w, ((const WyTrieWord *)b)->w);
+}
+
+/* Edge label for sorted words [a, b) below depth d: their common prefix */
+static inline size_t _wy_trie_label(const WyTrieWord *v, size_t a, size_t b, size_t d) {
+    const char *x = v[a].w + d, *y = v[b - 1].w + d;
+    size_t i = 0;
+    while (x[i] && x[i] == y[i] && i < 255) i++;
+    return i;
+}
+
+static inline size_t _wy_trie_varlen(size_t x) {
+    size_t n = 1;
+    while (x >= 0x80) { x >>= 7; n++; }
+    return n;
+}
+
+/* Node for sorted words [lo, hi) that share their first d chars, written
+   at out + at (out == nullptr: sizing pass). Returns its end offset. */
+static inline size_t _wy_trie_node(const WyTrieWord *v, size_t lo, size_t hi, size_t d,
+                                   uint8_t *out, size_t at) {
+    bool   term = v[lo].w[d] == '\0';
+    size_t first = lo + (term ? 1 : 0);
+    uint8_t best = 0;
+    for (size_t i = lo; i < hi; i++) if (v[i].rank > best) best = v[i].rank;
+
+    /* Child table: label + offset of each subtree past the end of the table */
+    size_t table = 0, rel = 0, nch = 0;
+    for (size_t a = first, b; a < hi; a = b, nch++) {
+        for (b = a + 1; b < hi && v[b].w[d] == v[a].w[d]; b++) {}
+        size_t len = _wy_trie_label(v, a, b, d);
+        table += 1 + len + _wy_trie_varlen(rel);
+        rel += _wy_trie_node(v, a, b, d + len, nullptr, 0);
+    }
+    size_t head = 1 + (nch ? 1 : 0) + (term ? 1 : 0);
+    if (!out) return at + head + table + rel;
+
+    out[at] = (uint8_t)((term ? 0x80 : 0) | nch);
+    if (nch) out[at + 1] = best;
+    if (term) out[at + head - 1] = v[lo].rank;
+
+    size_t entry = at + head, base = at + head + table;
+    rel = 0;
+    for (size_t a = first, b; a < hi; a = b) {
+        for (b = a + 1; b < hi && v[b].w[d] == v[a].w[d]; b++) {}
+        size_t len = _wy_trie_label(v, a, b, d);
+        out[entry++] = (uint8_t)len;
+        memcpy(out + entry, v[a].w + d, len);
+        entry += len;
+        for (size_t x = rel; ; x >>= 7) {
+            out[entry++] = (uint8_t)((x & 0x7F) | (x >= 0x80 ? 0x80 : 0));
+            if (x < 0x80) break;
+        }
+        rel = _wy_trie_node(v, a, b, d + len, out, base + rel) - base;
+    }
+    return base + rel;
+}
+
+/*
+ * Build a blob from n words in any order. ranks[i] is 1..255, or pass
+ * nullptr to rank by list order (first = most likely). Duplicates keep
+ * their best rank; empty words and words of WY_PREDICT_WORD chars or
+ * more are dropped. A node holds up to 127 children — plenty for
+ * printable ASCII. Returns the blob size (out == nullptr just sizes it),
+ * or 0 if there are no words, it doesn't fit in cap or malloc fails.
+ */
+static inline size_t wyTrieBuild(const char *const *words, const uint8_t *ranks, size_t n,
+                                 uint8_t *out, size_t cap) {
+    WyTrieWord *v = (WyTrieWord *)malloc((n ? n : 1) * sizeof(WyTrieWord));
+    if (!v) return 0;
+    size_t m = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t len = words[i] ? strlen(words[i]) : 0;
+        if (!len || len >= WY_PREDICT_WORD) continue;
+        uint8_t r = ranks ? ranks[i] : (uint8_t)(255 - (i * 254) / (n > 1 ? n - 1 : 1));
+        v[m].w    = words[i];
+        v[m].rank = r ? r : 1;
+        m++;
+    }
+    qsort(v, m, sizeof(WyTrieWord), _wy_trie_cmp);
+    size_t u = 0;
+    for (size_t i = 0; i < m; i++) {
+        if (u && strcmp(v[u - 1].w, v[i].w) == 0) {
+            if (v[i].rank > v[u - 1].rank) v[u - 1].rank = v[i].rank;
+            continue;
+        }
+        v[u++] = v[i];
+    }
+    size_t size = u ? _wy_trie_node(v, 0, u, 0, nullptr, WY_TRIE_HEADER) : 0;
+    if (!size || size >= (1u << 24) || (out && size > cap)) { free(v); return 0; }
+    if (out) {
+        memcpy(out, "WYT1", 4);
+        for (int i = 0; i < 4; i++) out[4 + i] = (uint8_t)(size >> (8 * i));
+        _wy_trie_node(v, 0, u, 0, out, WY_TRIE_HEADER);
+    }
+    free(v);
+    return size;
+}
+
+/* ══════════════════════════════════════════════════════════════════
+ * WyTrie — read-only view of a blob
+ * ══════════════════════════════════════════════════════════════════ */
+class WyTrie {
+public:
+    /* The blob stays where it is (flash); checks magic and length */
+    bool begin(const uint8_t *blob, size_t len) {
+        _b = nullptr;
+        _n = 0;
+        if (!blob || len < WY_TRIE_HEADER + 2 || memcmp(blob, "WYT1", 4) != 0) return false;
+        uint32_t n = blob[4] | (uint32_t)blob[5] << 8 | (uint32_t)blob[6] << 16 | (uint32_t)blob[7] << 24;
+        if (n < WY_TRIE_HEADER + 2 || n > len) return false;
+        _b = blob;
+        _n = n;
+        return true;
+    }
+    bool ok() const { return _b != nullptr; }
+    size_t size() const { return _n; }
+
+    /* Rank of an exact word, 0 if it isn't in the vocabulary */
+    uint8_t rank(const char *word) const {
+        uint32_t node;
+        const uint8_t *rest;
+        uint8_t restLen;
+        _Frame f;
+        if (!_b || !_find(word, node, rest, restLen) || restLen || !(_b[node] & 0x80) ||
+            !_frame(node, 0, f)) return 0;
+        return _b[f.entry - 1];
+    }
+
+    /* Up to k (≤ WY_PREDICT_K) words starting with prefix, best first;
+       score = rank, ties in alphabetical order. Returns the count. */
+    uint8_t complete(const char *prefix, WyPredictHit *out, uint8_t k) const {
+        if (k > WY_PREDICT_K) k = WY_PREDICT_K;
+        uint32_t node;
+        const uint8_t *rest;
+        uint8_t restLen;
+        if (!_b || !k || !_find(prefix, node, rest, restLen)) return 0;
+
+        /* The prefix may stop inside an edge: the path carries on to `node` */
+        char   path[WY_PREDICT_WORD];
+        size_t plen = strlen(prefix);
+        if (plen + restLen >= WY_PREDICT_WORD) return 0;
+        memcpy(path, prefix, plen);
+        memcpy(path + plen, rest, restLen);
+        plen += restLen;
+
+        _Frame  st[WY_PREDICT_WORD];
+        uint8_t n = 0;
+        int sp = 0;
+        if (!_frame(node, plen, st[0])) return 0;
+        if (_b[node] & 0x80) wyPredictOffer(out, n, k, path, plen, _b[st[0].entry - 1]);
+
+        while (sp >= 0) {
+            _Frame &f = st[sp];
+            if (!f.left) { sp--; continue; }
+            uint32_t e = f.entry, rel;
+            uint8_t  len = _b[e];
+            f.entry = _next(e, rel);
+            f.left--;
+            uint32_t child = f.base + rel;
+            if (!f.entry || f.plen + len >= WY_PREDICT_WORD || sp + 1 >= WY_PREDICT_WORD) { sp--; continue; }
+            if (child + 2 > _n) continue;
+            if (n == k && _b[child + 1] <= out[k - 1].score) continue;     /* can't beat the k-th */
+            _Frame &c = st[sp + 1];
+            if (!_frame(child, f.plen + len, c)) continue;
+            memcpy(path + f.plen, _b + e + 1, len);
+            if (_b[child] & 0x80) wyPredictOffer(out, n, k, path, c.plen, _b[c.entry - 1]);
+            sp++;
+        }
+        return n;
+    }
+
+private:
+    const uint8_t *_b = nullptr;
+    size_t         _n = 0;
+
+    struct _Frame { uint32_t entry, base; uint8_t left, plen; };
+
+    uint8_t _head(uint32_t node) const {
+        uint8_t f = _b[node];
+        return (uint8_t)(1 + ((f & 0x7F) ? 1 : 0) + ((f & 0x80) ? 1 : 0));
+    }
+
+    /* Child entry at e: its offset past the table into rel; returns the
+       next entry, 0 if the blob is cut short */
+    uint32_t _next(uint32_t e, uint32_t &rel) const {
+        if (e >= _n) return 0;
+        e += 1 + _b[e];
+        rel = 0;
+        for (int sh = 0; ; sh += 7) {
+            if (e >= _n || sh > 21) return 0;
+            uint8_t c = _b[e++];
+            rel |= (uint32_t)(c & 0x7F) << sh;
+            if (!(c & 0x80)) return e;
+        }
+    }
+
+    /* Children of node: the table has to be walked once to find where it
+       ends, since offsets count from there */
+    bool _frame(uint32_t node, size_t plen, _Frame &f) const {
+        if (node + 2 > _n) return false;
+        f.entry = node + _head(node);
+        f.left  = _b[node] & 0x7F;
+        f.plen  = (uint8_t)plen;
+        uint32_t e = f.entry, rel;
+        for (uint8_t i = 0; i < f.left; i++)
+            if (!(e = _next(e, rel))) return false;
+        f.base = f.left ? e : f.entry;
+        return f.entry <= _n && f.base <= _n;
+    }
+
+    /* Walk word from the root. On success node is where it ends; if it
+       ends inside an edge, rest/restLen is the remainder of that label. */
+    bool _find(const char *w, uint32_t &node, const uint8_t *&rest, uint8_t &restLen) const {
+        node = WY_TRIE_HEADER;
+        rest = _b;
+        restLen = 0;
+        size_t i = 0;
+        _Frame f;
+        while (w[i]) {
+            if (!_frame(node, 0, f)) return false;
+            uint32_t e = f.entry, rel = 0;
+            for (;; f.left--) {
+                if (!f.left) return false;
+                uint32_t next = _next(e, rel);
+                if (!next) return false;
+                if (_b[e] && _b[e + 1] == (uint8_t)w[i]) break;
+                e = next;
+            }
+            uint8_t len = _b[e], j = 1;
+            while (j < len && w[i + j] && _b[e + 1 + j] == (uint8_t)w[i + j]) j++;
+            node = f.base + rel;
+            if (node + 2 > _n) return false;
+            if (j == len) { i += len; continue; }
+            if (w[i + j]) return false;                 /* mismatch inside the label */
+            rest = _b + e + 1 + j;
+            restLen = (uint8_t)(len - j);
+            return true;
+        }
+        return true;
+    }
+};
+
+/* ══════════════════════════════════════════════════════════════════
+ * WyPredict — vocabulary + learned words
+ * ══════════════════════════════════════════════════════════════════ */
+class WyPredict {
+public:
+    /* blob may be nullptr: learned words only */
+    bool begin(const uint8_t *blob = nullptr, size_t len = 0) {
+        clearLearned();
+        return blob ? _trie.begin(blob, len) : true;
+    }
+    const WyTrie &trie() const { return _trie; }
+
+    /*
+     * Up to k (≤ WY_PREDICT_K) completions of prefix, best first. Matching
+     * ignores case; vocabulary words follow a capitalised prefix ("Pa" →
+     * "Password"), learned words keep the case they were typed in.
+     */
+    uint8_t suggest(const char *prefix, WyPredictHit *out, uint8_t k) const {
+        if (k > WY_PREDICT_K) k = WY_PREDICT_K;
+        size_t plen = prefix ? strlen(prefix) : 0;
+        if (!k || !plen || plen >= WY_PREDICT_WORD) return 0;
+        char low[WY_PREDICT_WORD];
+        for (size_t i = 0; i <= plen; i++) low[i] = wyPredictLower(prefix[i]);
+
+        WyPredictHit voc[WY_PREDICT_K];
+        uint8_t nv = _trie.ok() ? _trie.complete(low, voc, WY_PREDICT_K) : 0;
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < nv; i++) {
+            int l = _learned(voc[i].word);
+            if (l >= 0) continue;                       /* offered below with its boost */
+            if (prefix[0] >= 'A' && prefix[0] <= 'Z' && voc[i].word[0] >= 'a' && voc[i].word[0] <= 'z')
+                voc[i].word[0] = (char)(voc[i].word[0] - 32);
+            wyPredictOffer(out, n, k, voc[i].word, strlen(voc[i].word), voc[i].score);
+        }
+        for (uint8_t i = 0; i < _nLearn; i++) {
+            const Learned &e = _learn[i];
+            if (!_startsWith(e.word, low, plen)) continue;
+            char w[WY_PREDICT_WORD];
+            size_t wl = strlen(e.word);
+            for (size_t j = 0; j <= wl; j++) w[j] = wyPredictLower(e.word[j]);
+            uint32_t s = (uint32_t)_trie.rank(w) + (uint32_t)WY_PREDICT_BOOST * e.hits;
+            wyPredictOffer(out, n, k, e.word, wl, (uint16_t)(s > 0xFFFF ? 0xFFFF : s));
+        }
+        return n;
+    }
+
+    /* The user typed or picked this word */
+    void learn(const char *word) {
+        size_t len = word ? strlen(word) : 0;
+        if (len < 2 || len >= WY_PREDICT_WORD) return;
+        int i = _learned(word);
+        if (i < 0) {
+            if (_nLearn < WY_PREDICT_LEARN) {
+                i = _nLearn++;
+            } else {
+                i = 0;
+                for (int j = 1; j < WY_PREDICT_LEARN; j++)
+                    if (_learn[j].hits < _learn[i].hits ||
+                        (_learn[j].hits == _learn[i].hits && _learn[j].stamp < _learn[i].stamp)) i = j;
+            }
+            _learn[i].hits = 0;
+        }
+        memcpy(_learn[i].word, word, len + 1);
+        if (_learn[i].hits == 0xFFFF)
+            for (uint8_t j = 0; j < _nLearn; j++) _learn[j].hits = (uint16_t)((_learn[j].hits + 1) / 2);
+        _learn[i].hits++;
+        if (_clock == 0xFFFF) _renumber();
+        _learn[i].stamp = ++_clock;
+    }
+
+    void forget(const char *word) {
+        int i = _learned(word);
+        if (i < 0) return;
+        _learn[i] = _learn[--_nLearn];
+    }
+    void clearLearned() { _nLearn = 0; _clock = 0; }
+    uint8_t learnedCount() const { return _nLearn; }
+    uint16_t hits(const char *word) const {
+        int i = _learned(word);
+        return i < 0 ? 0 : _learn[i].hits;
+    }
+
+    /* Learned table as bytes (NVS blob) */
+    size_t saveSize() const { return 8 + (size_t)_nLearn * sizeof(Learned); }
+    size_t save(uint8_t *buf, size_t cap) const {
+        size_t n = saveSize();
+        if (!buf || cap < n) return 0;
+        memcpy(buf, "WYL1", 4);
+        buf[4] = _nLearn;
+        buf[5] = WY_PREDICT_WORD;
+        buf[6] = (uint8_t)_clock;
+        buf[7] = (uint8_t)(_clock >> 8);
+        memcpy(buf + 8, _learn, (size_t)_nLearn * sizeof(Learned));
+        return n;
+    }
+    bool restore(const uint8_t *buf, size_t len) {
+        if (!buf || len < 8 || memcmp(buf, "WYL1", 4) != 0 || buf[5] != WY_PREDICT_WORD ||
+            buf[4] > WY_PREDICT_LEARN || len < 8 + (size_t)buf[4] * sizeof(Learned)) return false;
+        _nLearn = buf[4];
+        _clock = (uint16_t)(buf[6] | buf[7] << 8);
+        memcpy(_learn, buf + 8, (size_t)_nLearn * sizeof(Learned));
+        for (uint8_t i = 0; i < _nLearn; i++) _learn[i].word[WY_PREDICT_WORD - 1] = '\0';
+        return true;
+    }
+
+protected:
+    struct Learned {
+        char     word[WY_PREDICT_WORD];
+        uint16_t hits;
+        uint16_t stamp;
+    };
+    WyTrie   _trie;
+    Learned  _learn[WY_PREDICT_LEARN];
+    uint8_t  _nLearn = 0;
+    uint16_t _clock = 0;
+
+    /* Clock about to wrap: stamps become 1..n in the same order */
+    void _renumber() {
+        uint16_t s[WY_PREDICT_LEARN];
+        _clock = 0;
+        for (uint8_t i = 0; i < _nLearn; i++) {
+            s[i] = 1;
+            for (uint8_t j = 0; j < _nLearn; j++) if (_learn[j].stamp < _learn[i].stamp) s[i]++;
+            if (s[i] > _clock) _clock = s[i];
+        }
+        for (uint8_t i = 0; i < _nLearn; i++) _learn[i].stamp = s[i];
+    }
+
+    static bool _startsWith(const char *w, const char *lowPrefix, size_t plen) {
+        for (size_t i = 0; i < plen; i++)
+            if (wyPredictLower(w[i]) != lowPrefix[i]) return false;   /* also stops at w's NUL */
+        return true;
+    }
+    static bool _same(const char *a, const char *b) {
+        while (*a && wyPredictLower(*a) == wyPredictLower(*b)) { a++; b++; }
+        return wyPredictLower(*a) == wyPredictLower(*b);
+    }
+    int _learned(const char *word) const {
+        for (uint8_t i = 0; i < _nLearn; i++)
+            if (_same(_learn[i].word, word)) return i;
+        return -1;
+    }
+};
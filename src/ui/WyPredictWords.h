@@ -0,0 +1,284 @@
+/*
+ * WyPredictWords.h — WyPredict vocabulary, 521 words, 4360 bytes
+ * Generated by tools/wytrie.cpp from tools/wy_words.txt — edit that list and
+ * regenerate rather than editing this file.
+ */
+
+#pragma once
+#include <stdint.h>
+
+static const uint8_t WY_PREDICT_WORDS[4360] = {
+    0x57, 0x59, 0x54, 0x31, 0x08, 0x11, 0x00, 0x00, 0x19, 0xff, 0x01, 0x61, 0x00, 0x01, 0x62, 0xf5,
+    0x01, 0x01, 0x63, 0xe8, 0x03, 0x01, 0x64, 0x96, 0x06, 0x01, 0x65, 0x8d, 0x08, 0x01, 0x66, 0xf5,
+    0x08, 0x01, 0x67, 0xc9, 0x0a, 0x01, 0x68, 0xb0, 0x0b, 0x01, 0x69, 0xeb, 0x0c, 0x04, 0x6a, 0x75,
+    0x73, 0x74, 0xdb, 0x0d, 0x01, 0x6b, 0xdd, 0x0d, 0x01, 0x6c, 0x9a, 0x0e, 0x01, 0x6d, 0xdc, 0x0f,
+    0x01, 0x6e, 0xed, 0x11, 0x01, 0x6f, 0xda, 0x12, 0x01, 0x70, 0xe4, 0x13, 0x07, 0x71, 0x75, 0x61,
+    0x6c, 0x69, 0x74, 0x79, 0xe6, 0x15, 0x01, 0x72, 0xe8, 0x15, 0x01, 0x73, 0xb4, 0x17, 0x01, 0x74,
+    0x82, 0x1b, 0x01, 0x75, 0xf7, 0x1c, 0x01, 0x76, 0xed, 0x1d, 0x01, 0x77, 0xae, 0x1e, 0x01, 0x79,
+    0xd6, 0x20, 0x04, 0x7a, 0x6f, 0x6e, 0x65, 0x8d, 0x21, 0x8e, 0xff, 0xfe, 0x04, 0x62, 0x6f, 0x75,
+    0x74, 0x00, 0x02, 0x63, 0x63, 0x02, 0x01, 0x64, 0x13, 0x04, 0x66, 0x74, 0x65, 0x72, 0x2a, 0x04,
+    0x67, 0x61, 0x69, 0x6e, 0x2c, 0x02, 0x69, 0x72, 0x2e, 0x01, 0x6c, 0x30, 0x01, 0x6e, 0x55, 0x01,
+    0x70, 0x6b, 0x01, 0x72, 0x7a, 0x01, 0x73, 0x8a, 0x01, 0x01, 0x74, 0x92, 0x01, 0x01, 0x75, 0x94,
+    0x01, 0x01, 0x76, 0xa3, 0x01, 0x80, 0xec, 0x02, 0xbf, 0x03, 0x65, 0x73, 0x73, 0x00, 0x04, 0x6f,
+    0x75, 0x6e, 0x74, 0x02, 0x80, 0xbf, 0x80, 0x0d, 0x02, 0xd6, 0x01, 0x64, 0x00, 0x03, 0x6d, 0x69,
+    0x6e, 0x0b, 0x81, 0xc3, 0xa4, 0x04, 0x72, 0x65, 0x73, 0x73, 0x00, 0x80, 0xc3, 0x80, 0xd6, 0x80,
+    0xdc, 0x80, 0x9c, 0x80, 0x76, 0x04, 0xf4, 0x03, 0x61, 0x72, 0x6d, 0x00, 0x01, 0x6c, 0x02, 0x02,
+    0x73, 0x6f, 0x0b, 0x06, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x0d, 0x80, 0xaa, 0x81, 0xf4, 0xf4,
+    0x02, 0x6f, 0x77, 0x00, 0x80, 0x47, 0x80, 0xde, 0x80, 0x30, 0x83, 0xff, 0xe4, 0x01, 0x64, 0x00,
+    0x05, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x02, 0x01, 0x79, 0x04, 0x80, 0xff, 0x80, 0x2c, 0x80, 0xde,
+    0x02, 0x44, 0x01, 0x69, 0x00, 0x04, 0x70, 0x65, 0x61, 0x72, 0x02, 0x80, 0x16, 0x80, 0x44, 0x02,
+    0xf8, 0x05, 0x64, 0x75, 0x69, 0x6e, 0x6f, 0x00, 0x01, 0x65, 0x02, 0x80, 0x14, 0x80, 0xf8, 0x81,
+    0xf6, 0xf6, 0x01, 0x6b, 0x00, 0x80, 0x5b, 0x80, 0xf7, 0x02, 0xbd, 0x03, 0x64, 0x69, 0x6f, 0x00,
+    0x02, 0x74, 0x6f, 0x02, 0x80, 0x95, 0x80, 0xbd, 0x02, 0x6b, 0x07, 0x61, 0x69, 0x6c, 0x61, 0x62,
+    0x6c, 0x65, 0x00, 0x05, 0x65, 0x72, 0x61, 0x67, 0x65, 0x02, 0x80, 0x0a, 0x80, 0x6b, 0x08, 0xf9,
+    0x01, 0x61, 0x00, 0x01, 0x65, 0x18, 0x02, 0x69, 0x67, 0x77, 0x01, 0x6c, 0x79, 0x03, 0x6f, 0x74,
+    0x68, 0x92, 0x01, 0x02, 0x72, 0x69, 0x94, 0x01, 0x01, 0x75, 0xae, 0x01, 0x01, 0x79, 0xcf, 0x01,
+    0x02, 0xdb, 0x02, 0x63, 0x6b, 0x00, 0x05, 0x74, 0x74, 0x65, 0x72, 0x79, 0x09, 0x81, 0xdb, 0xdb,
+    0x02, 0x75, 0x70, 0x00, 0x80, 0x10, 0x80, 0xca, 0x89, 0xf9, 0xf9, 0x01, 0x63, 0x00, 0x05, 0x64,
+    0x72, 0x6f, 0x6f, 0x6d, 0x11, 0x02, 0x65, 0x6e, 0x13, 0x04, 0x66, 0x6f, 0x72, 0x65, 0x15, 0x03,
+    0x67, 0x69, 0x6e, 0x17, 0x03, 0x69, 0x6e, 0x67, 0x19, 0x05, 0x6c, 0x69, 0x65, 0x76, 0x65, 0x1b,
+    0x02, 0x73, 0x74, 0x1d, 0x01, 0x74, 0x1f, 0x02, 0x58, 0x04, 0x61, 0x75, 0x73, 0x65, 0x00, 0x03,
+    0x6f, 0x6d, 0x65, 0x02, 0x80, 0x32, 0x80, 0x58, 0x80, 0x7f, 0x80, 0x36, 0x80, 0xdc, 0x80, 0x56,
+    0x80, 0x35, 0x80, 0x52, 0x80, 0x1f, 0x02, 0x2e, 0x03, 0x74, 0x65, 0x72, 0x00, 0x04, 0x77, 0x65,
+    0x65, 0x6e, 0x02, 0x80, 0x1e, 0x80, 0x2e, 0x80, 0x23, 0x02, 0x8f, 0x03, 0x61, 0x63, 0x6b, 0x00,
+    0x02, 0x75, 0x65, 0x02, 0x80, 0x8f, 0x81, 0x8e, 0x8e, 0x05, 0x74, 0x6f, 0x6f, 0x74, 0x68, 0x00,
+    0x80, 0x18, 0x80, 0x2a, 0x03, 0x92, 0x03, 0x64, 0x67, 0x65, 0x00, 0x07, 0x67, 0x68, 0x74, 0x6e,
+    0x65, 0x73, 0x73, 0x02, 0x02, 0x6e, 0x67, 0x04, 0x80, 0x11, 0x80, 0x92, 0x80, 0x51, 0x03, 0xf5,
+    0x03, 0x69, 0x6c, 0x64, 0x00, 0x01, 0x74, 0x02, 0x01, 0x79, 0x12, 0x80, 0x41, 0x81, 0xf5, 0xf5,
+    0x03, 0x74, 0x6f, 0x6e, 0x00, 0x81, 0x8b, 0x8b, 0x01, 0x73, 0x00, 0x80, 0x8a, 0x80, 0x43, 0x80,
+    0xe5, 0x07, 0xf3, 0x01, 0x61, 0x00, 0x06, 0x65, 0x6c, 0x73, 0x69, 0x75, 0x73, 0x23, 0x03, 0x68,
+    0x61, 0x6e, 0x25, 0x01, 0x6c, 0x34, 0x01, 0x6f, 0x5c, 0x05, 0x72, 0x65, 0x61, 0x74, 0x65, 0xf0,
+    0x01, 0x01, 0x75, 0xf2, 0x01, 0x04, 0xf3, 0x02, 0x6c, 0x6c, 0x00, 0x04, 0x6d, 0x65, 0x72, 0x61,
+    0x02, 0x01, 0x6e, 0x04, 0x02, 0x72, 0x64, 0x0e, 0x80, 0x5a, 0x80, 0x96, 0x81, 0xf3, 0xf3, 0x03,
+    0x63, 0x65, 0x6c, 0x00, 0x80, 0xa0, 0x80, 0x85, 0x80, 0x6f, 0x02, 0xbe, 0x02, 0x67, 0x65, 0x00,
+    0x03, 0x6e, 0x65, 0x6c, 0x02, 0x80, 0xa2, 0x80, 0xbe, 0x03, 0xd4, 0x03, 0x65, 0x61, 0x72, 0x00,
+    0x04, 0x69, 0x65, 0x6e, 0x74, 0x02, 0x01, 0x6f, 0x04, 0x80, 0xa1, 0x80, 0xc5, 0x03, 0xd4, 0x02,
+    0x63, 0x6b, 0x00, 0x02, 0x73, 0x65, 0x02, 0x02, 0x75, 0x64, 0x04, 0x80, 0xab, 0x80, 0xd4, 0x80,
+    0x81, 0x07, 0xd0, 0x01, 0x32, 0x00, 0x02, 0x64, 0x65, 0x02, 0x02, 0x6c, 0x6f, 0x04, 0x02, 0x6d,
+    0x70, 0x11, 0x01, 0x6e, 0x29, 0x02, 0x70, 0x79, 0x69, 0x01, 0x75, 0x6b, 0x80, 0x75, 0x80, 0x6a,
+    0x02, 0x92, 0x01, 0x72, 0x00, 0x02, 0x75, 0x72, 0x02, 0x80, 0x92, 0x80, 0x91, 0x02, 0x0b, 0x04,
+    0x6c, 0x65, 0x74, 0x65, 0x00, 0x04, 0x75, 0x74, 0x65, 0x72, 0x08, 0x81, 0x06, 0x06, 0x01, 0x64,
+    0x00, 0x80, 0x05, 0x80, 0x0b, 0x04, 0xd0, 0x02, 0x66, 0x69, 0x00, 0x04, 0x6e, 0x65, 0x63, 0x74,
+    0x19, 0x05, 0x73, 0x69, 0x64, 0x65, 0x72, 0x22, 0x05, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x24, 0x02,
+    0xc6, 0x01, 0x67, 0x00, 0x02, 0x72, 0x6d, 0x0e, 0x81, 0xc6, 0xc6, 0x07, 0x75, 0x72, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x00, 0x80, 0xc6, 0x80, 0x9f, 0x81, 0xd0, 0xd0, 0x02, 0x65, 0x64, 0x00, 0x80,
+    0xcf, 0x80, 0x44, 0x80, 0x4c, 0x80, 0xa1, 0x02, 0x6b, 0x02, 0x6c, 0x64, 0x00, 0x02, 0x6e, 0x74,
+    0x02, 0x80, 0x3b, 0x80, 0x6b, 0x80, 0x49, 0x03, 0x72, 0x05, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x00,
+    0x04, 0x73, 0x74, 0x6f, 0x6d, 0x02, 0x01, 0x74, 0x04, 0x80, 0x72, 0x80, 0x0e, 0x80, 0x40, 0x07,
+    0xf1, 0x01, 0x61, 0x00, 0x01, 0x65, 0x22, 0x03, 0x68, 0x63, 0x70, 0x5c, 0x01, 0x69, 0x5e, 0x02,
+    0x6e, 0x73, 0xa4, 0x01, 0x01, 0x6f, 0xa6, 0x01, 0x01, 0x75, 0xca, 0x01, 0x03, 0xb0, 0x02, 0x72,
+    0x6b, 0x00, 0x01, 0x74, 0x02, 0x01, 0x79, 0x0e, 0x80, 0x90, 0x02, 0xab, 0x01, 0x61, 0x00, 0x01,
+    0x65, 0x02, 0x80, 0x99, 0x80, 0xab, 0x81, 0xb0, 0xb0, 0x01, 0x73, 0x00, 0x80, 0xb0, 0x05, 0xce,
+    0x03, 0x62, 0x75, 0x67, 0x00, 0x04, 0x63, 0x69, 0x64, 0x65, 0x02, 0x05, 0x66, 0x61, 0x75, 0x6c,
+    0x74, 0x04, 0x01, 0x6c, 0x06, 0x04, 0x76, 0x69, 0x63, 0x65, 0x15, 0x80, 0x9a, 0x80, 0x3c, 0x80,
+    0x0f, 0x02, 0xa8, 0x02, 0x61, 0x79, 0x00, 0x03, 0x65, 0x74, 0x65, 0x02, 0x80, 0xa8, 0x80, 0xa3,
+    0x81, 0xce, 0xce, 0x01, 0x73, 0x00, 0x80, 0xce, 0x80, 0xc0, 0x04, 0xcf, 0x01, 0x64, 0x00, 0x01,
+    0x65, 0x02, 0x07, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x04, 0x01, 0x73, 0x06, 0x80, 0x38,
+    0x80, 0x42, 0x80, 0x27, 0x04, 0xcf, 0x04, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x07, 0x63, 0x6f, 0x6e,
+    0x6e, 0x65, 0x63, 0x74, 0x08, 0x04, 0x70, 0x6c, 0x61, 0x79, 0x0a, 0x05, 0x74, 0x61, 0x6e, 0x63,
+    0x65, 0x0c, 0x81, 0xbb, 0xbb, 0x01, 0x64, 0x00, 0x80, 0xba, 0x80, 0xcf, 0x80, 0x93, 0x80, 0x74,
+    0x80, 0xc1, 0x84, 0xf1, 0xf1, 0x02, 0x65, 0x73, 0x00, 0x02, 0x6e, 0x65, 0x02, 0x02, 0x6f, 0x72,
+    0x04, 0x02, 0x77, 0x6e, 0x06, 0x80, 0x37, 0x80, 0x9f, 0x80, 0x7d, 0x81, 0xdb, 0xdb, 0x04, 0x6c,
+    0x6f, 0x61, 0x64, 0x00, 0x80, 0xd0, 0x02, 0x75, 0x04, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x02, 0x73,
+    0x74, 0x02, 0x80, 0x2d, 0x80, 0x75, 0x07, 0xd5, 0x01, 0x61, 0x00, 0x03, 0x64, 0x69, 0x74, 0x15,
+    0x04, 0x6d, 0x61, 0x69, 0x6c, 0x17, 0x01, 0x6e, 0x19, 0x04, 0x72, 0x72, 0x6f, 0x72, 0x31, 0x04,
+    0x73, 0x70, 0x33, 0x32, 0x33, 0x02, 0x76, 0x65, 0x35, 0x03, 0x2b, 0x02, 0x63, 0x68, 0x00, 0x03,
+    0x72, 0x6c, 0x79, 0x02, 0x02, 0x73, 0x79, 0x04, 0x80, 0x2b, 0x80, 0x20, 0x80, 0x1c, 0x80, 0xa2,
+    0x80, 0xd5, 0x02, 0xbc, 0x04, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x65, 0x72, 0x67, 0x79, 0x08,
+    0x81, 0xbc, 0xbc, 0x01, 0x64, 0x00, 0x80, 0xbb, 0x80, 0x72, 0x80, 0x9c, 0x80, 0x14, 0x02, 0xb1,
+    0x04, 0x6e, 0x69, 0x6e, 0x67, 0x00, 0x02, 0x72, 0x79, 0x02, 0x80, 0xb1, 0x80, 0x2b, 0x07, 0xfb,
+    0x01, 0x61, 0x00, 0x01, 0x65, 0x47, 0x01, 0x69, 0x54, 0x04, 0x6c, 0x61, 0x73, 0x68, 0x7c, 0x01,
+    0x6f, 0x7e, 0x01, 0x72, 0x98, 0x01, 0x03, 0x75, 0x6c, 0x6c, 0xb4, 0x01, 0x06, 0xb9, 0x05, 0x63,
+    0x74, 0x6f, 0x72, 0x79, 0x00, 0x08, 0x68, 0x72, 0x65, 0x6e, 0x68, 0x65, 0x69, 0x74, 0x02, 0x02,
+    0x69, 0x6c, 0x04, 0x01, 0x6c, 0x13, 0x04, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x01, 0x6e, 0x22, 0x80,
+    0x0f, 0x80, 0x6e, 0x02, 0x08, 0x02, 0x65, 0x64, 0x00, 0x03, 0x75, 0x72, 0x65, 0x02, 0x80, 0x08,
+    0x80, 0x08, 0x02, 0xb9, 0x01, 0x6c, 0x00, 0x02, 0x73, 0x65, 0x02, 0x80, 0x41, 0x80, 0xb9, 0x80,
+    0x65, 0x80, 0x7b, 0x02, 0x59, 0x02, 0x65, 0x6c, 0x00, 0x01, 0x77, 0x02, 0x80, 0x59, 0x80, 0x2a,
+    0x03, 0x9d, 0x02, 0x6c, 0x65, 0x00, 0x02, 0x6e, 0x64, 0x08, 0x01, 0x72, 0x0a, 0x81, 0x98, 0x98,
+    0x01, 0x73, 0x00, 0x80, 0x98, 0x80, 0x88, 0x02, 0x9d, 0x05, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x00,
+    0x02, 0x73, 0x74, 0x02, 0x80, 0x87, 0x80, 0x9d, 0x80, 0x85, 0x02, 0xfb, 0x01, 0x6c, 0x00, 0x01,
+    0x72, 0x10, 0x02, 0x97, 0x03, 0x64, 0x65, 0x72, 0x00, 0x03, 0x6c, 0x6f, 0x77, 0x02, 0x80, 0x97,
+    0x80, 0x49, 0x80, 0xfb, 0x03, 0xf1, 0x02, 0x65, 0x65, 0x00, 0x04, 0x69, 0x65, 0x6e, 0x64, 0x02,
+    0x02, 0x6f, 0x6d, 0x0a, 0x80, 0x1d, 0x81, 0x65, 0x65, 0x01, 0x73, 0x00, 0x80, 0x64, 0x80, 0xf1,
+    0x80, 0x1d, 0x05, 0xea, 0x01, 0x61, 0x00, 0x02, 0x65, 0x74, 0x1e, 0x03, 0x69, 0x76, 0x65, 0x20,
+    0x03, 0x6f, 0x6f, 0x64, 0x22, 0x01, 0x72, 0x24, 0x02, 0xc2, 0x01, 0x72, 0x00, 0x05, 0x74, 0x65,
+    0x77, 0x61, 0x79, 0x10, 0x02, 0x7f, 0x03, 0x61, 0x67, 0x65, 0x00, 0x03, 0x64, 0x65, 0x6e, 0x02,
+    0x80, 0x7e, 0x80, 0x7f, 0x80, 0xc2, 0x80, 0xea, 0x80, 0x5d, 0x80, 0xda, 0x02, 0x8e, 0x01, 0x65,
+    0x00, 0x01, 0x6f, 0x18, 0x02, 0x8e, 0x02, 0x61, 0x74, 0x00, 0x02, 0x65, 0x6e, 0x02, 0x80, 0x23,
+    0x81, 0x8e, 0x8e, 0x05, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x00, 0x80, 0x7e, 0x02, 0x66, 0x02, 0x75,
+    0x70, 0x00, 0x01, 0x77, 0x02, 0x80, 0x66, 0x80, 0x46, 0x06, 0xf7, 0x01, 0x61, 0x00, 0x01, 0x65,
+    0x20, 0x01, 0x69, 0x4f, 0x01, 0x6f, 0x5c, 0x03, 0x74, 0x74, 0x70, 0x8a, 0x01, 0x01, 0x75, 0x92,
+    0x01, 0x05, 0xf7, 0x01, 0x64, 0x00, 0x04, 0x70, 0x70, 0x65, 0x6e, 0x02, 0x02, 0x72, 0x64, 0x04,
+    0x01, 0x73, 0x06, 0x02, 0x76, 0x65, 0x08, 0x80, 0x37, 0x80, 0x50, 0x80, 0x1c, 0x80, 0x36, 0x80,
+    0xf7, 0x83, 0xe7, 0xe3, 0x01, 0x61, 0x00, 0x01, 0x6c, 0x0e, 0x01, 0x72, 0x1b, 0x02, 0x7b, 0x01,
+    0x72, 0x00, 0x03, 0x74, 0x65, 0x72, 0x02, 0x80, 0x54, 0x80, 0x7b, 0x02, 0xb8, 0x02, 0x6c, 0x6f,
+    0x00, 0x01, 0x70, 0x02, 0x80, 0xb8, 0x80, 0x88, 0x81, 0xe7, 0xe2, 0x01, 0x65, 0x00, 0x80, 0xe7,
+    0x02, 0xe2, 0x02, 0x67, 0x68, 0x00, 0x01, 0x73, 0x02, 0x80, 0x6d, 0x80, 0xe2, 0x05, 0xe9, 0x02,
+    0x6c, 0x64, 0x00, 0x02, 0x6d, 0x65, 0x02, 0x02, 0x73, 0x74, 0x04, 0x02, 0x75, 0x72, 0x0f, 0x01,
+    0x77, 0x17, 0x80, 0x51, 0x80, 0xda, 0x81, 0xc4, 0xc4, 0x04, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x80,
+    0xc4, 0x81, 0xae, 0xae, 0x01, 0x73, 0x00, 0x80, 0xad, 0x80, 0xe9, 0x81, 0x17, 0x17, 0x01, 0x73,
+    0x00, 0x80, 0x17, 0x02, 0xcc, 0x01, 0x62, 0x00, 0x06, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x02,
+    0x80, 0x12, 0x80, 0xcc, 0x05, 0xfd, 0x01, 0x66, 0x00, 0x01, 0x6d, 0x02, 0x01, 0x6e, 0x16, 0x01,
+    0x73, 0x4e, 0x01, 0x74, 0x50, 0x80, 0xf3, 0x02, 0x97, 0x03, 0x61, 0x67, 0x65, 0x00, 0x07, 0x70,
+    0x6f, 0x72, 0x74, 0x61, 0x6e, 0x74, 0x02, 0x80, 0x97, 0x80, 0x1f, 0x84, 0xfd, 0xfd, 0x05, 0x63,
+    0x6c, 0x75, 0x64, 0x65, 0x00, 0x02, 0x66, 0x6f, 0x02, 0x04, 0x73, 0x69, 0x64, 0x65, 0x04, 0x01,
+    0x74, 0x06, 0x80, 0x4c, 0x80, 0x9b, 0x80, 0x80, 0x02, 0xdd, 0x02, 0x65, 0x72, 0x00, 0x01, 0x6f,
+    0x10, 0x02, 0xa9, 0x03, 0x6e, 0x65, 0x74, 0x00, 0x03, 0x76, 0x61, 0x6c, 0x02, 0x80, 0x0b, 0x80,
+    0xa9, 0x80, 0xdd, 0x80, 0xfd, 0x81, 0xfc, 0xfc, 0x02, 0x65, 0x6d, 0x00, 0x81, 0xa5, 0xa5, 0x01,
+    0x73, 0x00, 0x80, 0xa4, 0x80, 0xec, 0x04, 0x8c, 0x01, 0x65, 0x00, 0x01, 0x69, 0x17, 0x03, 0x6e,
+    0x6f, 0x77, 0x28, 0x02, 0x77, 0x68, 0x2a, 0x02, 0x8c, 0x02, 0x65, 0x70, 0x00, 0x01, 0x79, 0x02,
+    0x80, 0x56, 0x81, 0x8c, 0x69, 0x05, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x00, 0x80, 0x8c, 0x02, 0x80,
+    0x02, 0x6c, 0x6c, 0x00, 0x05, 0x74, 0x63, 0x68, 0x65, 0x6e, 0x02, 0x80, 0x3f, 0x80, 0x80, 0x80,
+    0x60, 0x80, 0x70, 0x04, 0xea, 0x01, 0x61, 0x00, 0x01, 0x65, 0x1b, 0x01, 0x69, 0x45, 0x01, 0x6f,
+    0x68, 0x04, 0x9d, 0x02, 0x6d, 0x70, 0x00, 0x03, 0x72, 0x67, 0x65, 0x02, 0x02, 0x73, 0x74, 0x04,
+    0x02, 0x74, 0x65, 0x06, 0x80, 0x7c, 0x80, 0x22, 0x80, 0x9d, 0x80, 0x20, 0x04, 0xca, 0x01, 0x61,
+    0x00, 0x02, 0x66, 0x74, 0x13, 0x01, 0x74, 0x15, 0x03, 0x76, 0x65, 0x6c, 0x17, 0x03, 0x58, 0x01,
+    0x64, 0x00, 0x02, 0x72, 0x6e, 0x02, 0x02, 0x76, 0x65, 0x04, 0x80, 0x4b, 0x80, 0x4b, 0x80, 0x58,
+    0x80, 0x25, 0x80, 0x56, 0x80, 0xca, 0x05, 0xea, 0x03, 0x67, 0x68, 0x74, 0x00, 0x02, 0x6b, 0x65,
+    0x02, 0x02, 0x73, 0x74, 0x04, 0x04, 0x74, 0x74, 0x6c, 0x65, 0x06, 0x02, 0x76, 0x65, 0x08, 0x80,
+    0xcb, 0x80, 0xea, 0x80, 0xa5, 0x80, 0x24, 0x80, 0x52, 0x08, 0xd7, 0x05, 0x61, 0x64, 0x69, 0x6e,
+    0x67, 0x00, 0x02, 0x63, 0x61, 0x02, 0x01, 0x67, 0x11, 0x02, 0x6e, 0x67, 0x1f, 0x02, 0x6f, 0x6b,
+    0x21, 0x02, 0x73, 0x65, 0x23, 0x02, 0x76, 0x65, 0x25, 0x01, 0x77, 0x27, 0x80, 0x07, 0x02, 0x84,
+    0x01, 0x6c, 0x00, 0x04, 0x74, 0x69, 0x6f, 0x6e, 0x02, 0x80, 0x1a, 0x80, 0x84, 0x82, 0xd7, 0x9a,
+    0x02, 0x69, 0x6e, 0x00, 0x01, 0x73, 0x02, 0x80, 0xd7, 0x80, 0x99, 0x80, 0x24, 0x80, 0x5e, 0x80,
+    0x4e, 0x80, 0x45, 0x80, 0x6d, 0x07, 0xf2, 0x01, 0x61, 0x00, 0x01, 0x65, 0x29, 0x01, 0x69, 0x6b,
+    0x01, 0x6f, 0x87, 0x01, 0x03, 0x71, 0x74, 0x74, 0xd8, 0x01, 0x01, 0x75, 0xda, 0x01, 0x01, 0x79,
+    0xf2, 0x01, 0x05, 0xbc, 0x02, 0x64, 0x65, 0x00, 0x02, 0x6b, 0x65, 0x02, 0x01, 0x6e, 0x04, 0x01,
+    0x78, 0x12, 0x01, 0x79, 0x14, 0x80, 0x61, 0x80, 0x61, 0x02, 0xbc, 0x03, 0x75, 0x61, 0x6c, 0x00,
+    0x01, 0x79, 0x02, 0x80, 0xbc, 0x80, 0x29, 0x80, 0x6c, 0x80, 0x38, 0x86, 0xea, 0xea, 0x02, 0x61,
+    0x6e, 0x00, 0x02, 0x65, 0x74, 0x02, 0x04, 0x6d, 0x6f, 0x72, 0x79, 0x04, 0x02, 0x6e, 0x75, 0x06,
+    0x01, 0x73, 0x08, 0x03, 0x74, 0x65, 0x72, 0x1d, 0x80, 0x57, 0x80, 0x4d, 0x80, 0x86, 0x80, 0x8a,
+    0x02, 0xa8, 0x01, 0x68, 0x00, 0x04, 0x73, 0x61, 0x67, 0x65, 0x02, 0x80, 0x12, 0x81, 0xa8, 0xa8,
+    0x01, 0x73, 0x00, 0x80, 0xa7, 0x81, 0x70, 0x70, 0x01, 0x73, 0x00, 0x80, 0x6f, 0x02, 0xad, 0x03,
+    0x67, 0x68, 0x74, 0x00, 0x01, 0x6e, 0x02, 0x80, 0x3a, 0x81, 0xad, 0x6c, 0x03, 0x75, 0x74, 0x65,
+    0x00, 0x81, 0xad, 0xad, 0x01, 0x73, 0x00, 0x80, 0xac, 0x08, 0xe6, 0x04, 0x62, 0x69, 0x6c, 0x65,
+    0x00, 0x02, 0x64, 0x65, 0x02, 0x06, 0x69, 0x73, 0x74, 0x75, 0x72, 0x65, 0x04, 0x03, 0x6e, 0x74,
+    0x68, 0x06, 0x01, 0x72, 0x08, 0x02, 0x73, 0x74, 0x17, 0x01, 0x74, 0x19, 0x02, 0x76, 0x65, 0x28,
+    0x80, 0x0c, 0x80, 0xbd, 0x80, 0x77, 0x80, 0xaf, 0x02, 0xe6, 0x01, 0x65, 0x00, 0x04, 0x6e, 0x69,
+    0x6e, 0x67, 0x02, 0x80, 0xe6, 0x80, 0xb2, 0x80, 0x28, 0x02, 0x79, 0x03, 0x69, 0x6f, 0x6e, 0x00,
+    0x02, 0x6f, 0x72, 0x02, 0x80, 0x74, 0x80, 0x79, 0x80, 0x53, 0x80, 0x17, 0x02, 0x94, 0x02, 0x63,
+    0x68, 0x00, 0x01, 0x73, 0x02, 0x80, 0x29, 0x02, 0x94, 0x02, 0x69, 0x63, 0x00, 0x01, 0x74, 0x02,
+    0x80, 0x94, 0x80, 0x39, 0x80, 0xf2, 0x05, 0xf8, 0x03, 0x61, 0x6d, 0x65, 0x00, 0x01, 0x65, 0x02,
+    0x04, 0x69, 0x67, 0x68, 0x74, 0x2a, 0x01, 0x6f, 0x2c, 0x05, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x51,
+    0x80, 0xd9, 0x04, 0xe6, 0x02, 0x65, 0x64, 0x00, 0x01, 0x74, 0x02, 0x01, 0x77, 0x14, 0x02, 0x78,
+    0x74, 0x16, 0x80, 0x59, 0x02, 0xd8, 0x04, 0x6d, 0x61, 0x73, 0x6b, 0x00, 0x04, 0x77, 0x6f, 0x72,
+    0x6b, 0x02, 0x80, 0xc1, 0x80, 0xd8, 0x80, 0xe6, 0x80, 0x9e, 0x80, 0xb1, 0x83, 0xf8, 0xef, 0x02,
+    0x64, 0x65, 0x00, 0x01, 0x74, 0x08, 0x01, 0x77, 0x16, 0x81, 0x13, 0x13, 0x01, 0x73, 0x00, 0x80,
+    0x13, 0x81, 0xf8, 0xf8, 0x01, 0x65, 0x00, 0x81, 0xa6, 0xa6, 0x01, 0x73, 0x00, 0x80, 0xa6, 0x80,
+    0xe9, 0x80, 0x6a, 0x0a, 0xfe, 0x01, 0x66, 0x00, 0x01, 0x6b, 0x1e, 0x02, 0x6c, 0x64, 0x27, 0x01,
+    0x6e, 0x29, 0x03, 0x70, 0x65, 0x6e, 0x42, 0x01, 0x72, 0x44, 0x04, 0x74, 0x68, 0x65, 0x72, 0x4f,
+    0x02, 0x75, 0x74, 0x51, 0x03, 0x76, 0x65, 0x72, 0x5c, 0x02, 0x77, 0x6e, 0x5e, 0x81, 0xfe, 0xfe,
+    0x01, 0x66, 0x00, 0x83, 0xf0, 0xf0, 0x02, 0x65, 0x72, 0x00, 0x03, 0x69, 0x63, 0x65, 0x02, 0x04,
+    0x6c, 0x69, 0x6e, 0x65, 0x04, 0x80, 0x46, 0x80, 0x7d, 0x80, 0x19, 0x81, 0xb5, 0xb5, 0x02, 0x61,
+    0x79, 0x00, 0x80, 0xb5, 0x80, 0x21, 0x82, 0xfa, 0xfa, 0x01, 0x65, 0x00, 0x01, 0x6c, 0x02, 0x80,
+    0xeb, 0x02, 0xdf, 0x03, 0x69, 0x6e, 0x65, 0x00, 0x01, 0x79, 0x02, 0x80, 0x19, 0x80, 0xdf, 0x80,
+    0xd4, 0x81, 0xf5, 0xf5, 0x04, 0x61, 0x6e, 0x67, 0x65, 0x00, 0x80, 0x8d, 0x80, 0x2c, 0x81, 0xed,
+    0xed, 0x04, 0x73, 0x69, 0x64, 0x65, 0x00, 0x80, 0x81, 0x80, 0xdd, 0x80, 0x26, 0x07, 0xd9, 0x01,
+    0x61, 0x00, 0x01, 0x65, 0x33, 0x02, 0x68, 0x6f, 0x5a, 0x01, 0x6c, 0x68, 0x01, 0x6f, 0x78, 0x01,
+    0x72, 0x8e, 0x01, 0x01, 0x75, 0xc5, 0x01, 0x04, 0xd9, 0x02, 0x67, 0x65, 0x00, 0x01, 0x73, 0x02,
+    0x03, 0x75, 0x73, 0x65, 0x18, 0x01, 0x79, 0x20, 0x80, 0x89, 0x02, 0xd9, 0x01, 0x73, 0x00, 0x02,
+    0x74, 0x65, 0x0b, 0x81, 0xd9, 0x3e, 0x04, 0x77, 0x6f, 0x72, 0x64, 0x00, 0x80, 0xd9, 0x80, 0xa0,
+    0x81, 0x04, 0x03, 0x01, 0x64, 0x00, 0x80, 0x04, 0x80, 0x4d, 0x03, 0x6e, 0x05, 0x6e, 0x64, 0x69,
+    0x6e, 0x67, 0x00, 0x04, 0x6f, 0x70, 0x6c, 0x65, 0x02, 0x01, 0x72, 0x04, 0x80, 0x06, 0x80, 0x64,
+    0x02, 0x6e, 0x04, 0x63, 0x65, 0x6e, 0x74, 0x00, 0x03, 0x73, 0x6f, 0x6e, 0x02, 0x80, 0x6e, 0x80,
+    0x63, 0x02, 0x96, 0x02, 0x6e, 0x65, 0x00, 0x02, 0x74, 0x6f, 0x02, 0x80, 0x0d, 0x80, 0x96, 0x02,
+    0xb7, 0x02, 0x61, 0x79, 0x00, 0x04, 0x65, 0x61, 0x73, 0x65, 0x02, 0x80, 0x54, 0x80, 0xb7, 0x03,
+    0xc9, 0x03, 0x69, 0x6e, 0x74, 0x00, 0x02, 0x72, 0x74, 0x02, 0x03, 0x77, 0x65, 0x72, 0x04, 0x80,
+    0xbf, 0x80, 0xc3, 0x80, 0xc9, 0x03, 0xcb, 0x01, 0x65, 0x00, 0x05, 0x69, 0x76, 0x61, 0x74, 0x65,
+    0x14, 0x01, 0x6f, 0x16, 0x02, 0xcb, 0x05, 0x73, 0x73, 0x75, 0x72, 0x65, 0x00, 0x05, 0x76, 0x69,
+    0x6f, 0x75, 0x73, 0x02, 0x80, 0xcb, 0x80, 0x9e, 0x80, 0x67, 0x02, 0x4f, 0x04, 0x66, 0x69, 0x6c,
+    0x65, 0x00, 0x04, 0x76, 0x69, 0x64, 0x65, 0x02, 0x80, 0x0e, 0x80, 0x4f, 0x05, 0x8c, 0x04, 0x62,
+    0x6c, 0x69, 0x63, 0x00, 0x02, 0x6c, 0x6c, 0x02, 0x02, 0x6d, 0x70, 0x04, 0x04, 0x72, 0x70, 0x6c,
+    0x65, 0x06, 0x01, 0x74, 0x08, 0x80, 0x68, 0x80, 0x3c, 0x80, 0x7a, 0x80, 0x8c, 0x80, 0x57, 0x80,
+    0x76, 0x05, 0xd2, 0x02, 0x61, 0x69, 0x00, 0x01, 0x65, 0x0d, 0x04, 0x69, 0x67, 0x68, 0x74, 0x96,
+    0x01, 0x01, 0x6f, 0x98, 0x01, 0x02, 0x75, 0x6e, 0xa8, 0x01, 0x02, 0x83, 0x01, 0x6e, 0x00, 0x02,
+    0x73, 0x65, 0x02, 0x80, 0x83, 0x80, 0x3f, 0x07, 0xd2, 0x01, 0x61, 0x00, 0x01, 0x64, 0x18, 0x03,
+    0x6c, 0x61, 0x79, 0x1a, 0x01, 0x6d, 0x1c, 0x01, 0x70, 0x38, 0x05, 0x71, 0x75, 0x69, 0x72, 0x65,
+    0x48, 0x01, 0x73, 0x4a, 0x03, 0x48, 0x02, 0x63, 0x68, 0x00, 0x01, 0x64, 0x02, 0x01, 0x6c, 0x0a,
+    0x80, 0x40, 0x81, 0x48, 0x48, 0x01, 0x79, 0x00, 0x80, 0x1b, 0x80, 0x1e, 0x80, 0x8f, 0x80, 0x79,
+    0x02, 0xa3, 0x05, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x01, 0x6f, 0x02, 0x80, 0x45, 0x02, 0xa3,
+    0x02, 0x74, 0x65, 0x00, 0x02, 0x76, 0x65, 0x02, 0x80, 0x1a, 0x80, 0xa3, 0x02, 0x3d, 0x03, 0x65,
+    0x61, 0x74, 0x00, 0x03, 0x6f, 0x72, 0x74, 0x02, 0x80, 0x02, 0x80, 0x3d, 0x80, 0x3d, 0x03, 0xd2,
+    0x02, 0x65, 0x74, 0x00, 0x01, 0x74, 0x02, 0x03, 0x75, 0x6d, 0x65, 0x12, 0x80, 0xd2, 0x02, 0xd2,
+    0x03, 0x61, 0x72, 0x74, 0x00, 0x03, 0x6f, 0x72, 0x65, 0x02, 0x80, 0xd2, 0x80, 0x10, 0x80, 0x03,
+    0x80, 0x25, 0x02, 0xc0, 0x02, 0x6f, 0x6d, 0x00, 0x04, 0x75, 0x74, 0x65, 0x72, 0x02, 0x80, 0x80,
+    0x80, 0xc0, 0x81, 0x53, 0x53, 0x04, 0x6e, 0x69, 0x6e, 0x67, 0x00, 0x80, 0x05, 0x0e, 0xf0, 0x01,
+    0x61, 0x00, 0x01, 0x63, 0x0e, 0x01, 0x65, 0x22, 0x01, 0x68, 0x8e, 0x01, 0x01, 0x69, 0xc6, 0x01,
+    0x03, 0x6b, 0x69, 0x70, 0xe4, 0x01, 0x04, 0x6d, 0x61, 0x6c, 0x6c, 0xe6, 0x01, 0x01, 0x6f, 0xe8,
+    0x01, 0x02, 0x70, 0x65, 0x85, 0x02, 0x03, 0x73, 0x69, 0x64, 0x99, 0x02, 0x01, 0x74, 0x9b, 0x02,
+    0x01, 0x75, 0xde, 0x02, 0x05, 0x77, 0x69, 0x74, 0x63, 0x68, 0x85, 0x03, 0x03, 0x79, 0x6e, 0x63,
+    0x87, 0x03, 0x02, 0xd5, 0x02, 0x6d, 0x65, 0x00, 0x02, 0x76, 0x65, 0x02, 0x80, 0x27, 0x80, 0xd5,
+    0x02, 0xa9, 0x06, 0x68, 0x65, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x04, 0x72, 0x65, 0x65, 0x6e, 0x02,
+    0x80, 0xa9, 0x80, 0x93, 0x07, 0xe7, 0x04, 0x61, 0x72, 0x63, 0x68, 0x00, 0x01, 0x63, 0x02, 0x01,
+    0x65, 0x18, 0x02, 0x6c, 0x6c, 0x20, 0x01, 0x6e, 0x22, 0x03, 0x72, 0x76, 0x65, 0x36, 0x01, 0x74,
+    0x3e, 0x80, 0x89, 0x02, 0xac, 0x03, 0x6f, 0x6e, 0x64, 0x00, 0x03, 0x72, 0x65, 0x74, 0x08, 0x81,
+    0xac, 0xac, 0x01, 0x73, 0x00, 0x80, 0xab, 0x80, 0x69, 0x81, 0x5f, 0x5f, 0x01, 0x6d, 0x00, 0x80,
+    0x55, 0x80, 0x3e, 0x02, 0xd5, 0x01, 0x64, 0x00, 0x03, 0x73, 0x6f, 0x72, 0x02, 0x80, 0xd5, 0x81,
+    0xcd, 0xcd, 0x01, 0x73, 0x00, 0x80, 0xcd, 0x81, 0xc5, 0x42, 0x01, 0x72, 0x00, 0x80, 0xc5, 0x81,
+    0xe7, 0xe7, 0x04, 0x74, 0x69, 0x6e, 0x67, 0x00, 0x81, 0xc7, 0xc7, 0x01, 0x73, 0x00, 0x80, 0xc7,
+    0x04, 0xe3, 0x01, 0x61, 0x00, 0x01, 0x65, 0x14, 0x01, 0x6f, 0x16, 0x05, 0x75, 0x66, 0x66, 0x6c,
+    0x65, 0x24, 0x02, 0x67, 0x02, 0x6c, 0x6c, 0x00, 0x02, 0x72, 0x65, 0x02, 0x80, 0x39, 0x81, 0x67,
+    0x67, 0x01, 0x64, 0x00, 0x80, 0x66, 0x80, 0xe3, 0x02, 0x55, 0x03, 0x75, 0x6c, 0x64, 0x00, 0x01,
+    0x77, 0x02, 0x80, 0x3a, 0x80, 0x55, 0x80, 0x01, 0x04, 0xbe, 0x04, 0x67, 0x6e, 0x61, 0x6c, 0x00,
+    0x04, 0x6d, 0x70, 0x6c, 0x65, 0x02, 0x03, 0x6e, 0x63, 0x65, 0x04, 0x01, 0x74, 0x06, 0x80, 0xbe,
+    0x80, 0x1b, 0x80, 0x2f, 0x80, 0x4f, 0x80, 0x02, 0x80, 0x22, 0x84, 0xf0, 0xf0, 0x02, 0x69, 0x6c,
+    0x00, 0x02, 0x6d, 0x65, 0x02, 0x03, 0x72, 0x72, 0x79, 0x04, 0x03, 0x75, 0x6e, 0x64, 0x06, 0x80,
+    0x77, 0x80, 0xdf, 0x80, 0xb4, 0x80, 0x95, 0x03, 0x73, 0x02, 0x61, 0x6b, 0x00, 0x02, 0x65, 0x64,
+    0x02, 0x02, 0x6e, 0x64, 0x04, 0x80, 0x48, 0x80, 0x73, 0x80, 0x47, 0x80, 0x15, 0x02, 0xd3, 0x01,
+    0x61, 0x00, 0x01, 0x6f, 0x24, 0x04, 0xd3, 0x02, 0x6e, 0x64, 0x00, 0x02, 0x72, 0x74, 0x02, 0x01,
+    0x74, 0x04, 0x01, 0x79, 0x12, 0x80, 0x4e, 0x80, 0xd3, 0x02, 0xc9, 0x02, 0x69, 0x63, 0x00, 0x02,
+    0x75, 0x73, 0x02, 0x80, 0xc0, 0x80, 0xc9, 0x80, 0x41, 0x02, 0xd3, 0x01, 0x70, 0x00, 0x04, 0x72,
+    0x61, 0x67, 0x65, 0x0a, 0x81, 0xd3, 0xd3, 0x03, 0x70, 0x65, 0x64, 0x00, 0x80, 0x04, 0x80, 0x86,
+    0x04, 0xc2, 0x04, 0x62, 0x6e, 0x65, 0x74, 0x00, 0x01, 0x63, 0x02, 0x01, 0x6e, 0x11, 0x02, 0x72,
+    0x65, 0x13, 0x80, 0xc2, 0x02, 0x28, 0x04, 0x63, 0x65, 0x73, 0x73, 0x00, 0x01, 0x68, 0x02, 0x80,
+    0x09, 0x80, 0x28, 0x80, 0x82, 0x80, 0x26, 0x80, 0x78, 0x80, 0x11, 0x06, 0xff, 0x01, 0x61, 0x00,
+    0x01, 0x65, 0x10, 0x01, 0x68, 0x39, 0x03, 0x69, 0x6d, 0x65, 0x9e, 0x01, 0x01, 0x6f, 0xa6, 0x01,
+    0x01, 0x72, 0xcf, 0x01, 0x02, 0x60, 0x04, 0x62, 0x6c, 0x65, 0x74, 0x00, 0x02, 0x6b, 0x65, 0x02,
+    0x80, 0x0c, 0x80, 0x60, 0x04, 0xcc, 0x02, 0x6c, 0x6c, 0x00, 0x09, 0x6d, 0x70, 0x65, 0x72, 0x61,
+    0x74, 0x75, 0x72, 0x65, 0x02, 0x02, 0x73, 0x74, 0x04, 0x02, 0x78, 0x74, 0x0e, 0x80, 0x5b, 0x80,
+    0xcc, 0x81, 0xb9, 0xb9, 0x03, 0x69, 0x6e, 0x67, 0x00, 0x80, 0xb8, 0x80, 0xa7, 0x05, 0xff, 0x01,
+    0x61, 0x00, 0x01, 0x65, 0x18, 0x01, 0x69, 0x3c, 0x04, 0x6f, 0x75, 0x67, 0x68, 0x49, 0x05, 0x72,
+    0x6f, 0x75, 0x67, 0x68, 0x4b, 0x02, 0xfb, 0x01, 0x6e, 0x00, 0x01, 0x74, 0x0e, 0x81, 0xe0, 0xe0,
+    0x01, 0x6b, 0x00, 0x81, 0xb6, 0xb6, 0x01, 0x73, 0x00, 0x80, 0xb6, 0x80, 0xfb, 0x85, 0xff, 0xff,
+    0x02, 0x69, 0x72, 0x00, 0x01, 0x6d, 0x02, 0x01, 0x6e, 0x0a, 0x02, 0x72, 0x65, 0x0c, 0x01, 0x79,
+    0x0e, 0x80, 0xe1, 0x81, 0xe1, 0xe1, 0x01, 0x65, 0x00, 0x80, 0x91, 0x80, 0xe0, 0x80, 0xed, 0x80,
+    0xe4, 0x02, 0xf9, 0x02, 0x6e, 0x6b, 0x00, 0x01, 0x73, 0x02, 0x80, 0x5f, 0x80, 0xf9, 0x80, 0x30,
+    0x80, 0x2d, 0x81, 0xe5, 0xe5, 0x01, 0x72, 0x00, 0x80, 0xaa, 0x85, 0xff, 0xff, 0x03, 0x64, 0x61,
+    0x79, 0x00, 0x03, 0x6b, 0x65, 0x6e, 0x02, 0x06, 0x6d, 0x6f, 0x72, 0x72, 0x6f, 0x77, 0x04, 0x03,
+    0x74, 0x61, 0x6c, 0x06, 0x03, 0x75, 0x63, 0x68, 0x08, 0x80, 0xb3, 0x80, 0x68, 0x80, 0xb3, 0x80,
+    0x6b, 0x80, 0x8b, 0x02, 0xba, 0x02, 0x75, 0x65, 0x00, 0x01, 0x79, 0x02, 0x80, 0xba, 0x80, 0x5a,
+    0x04, 0xee, 0x01, 0x6e, 0x00, 0x01, 0x70, 0x30, 0x02, 0x72, 0x6c, 0x43, 0x01, 0x73, 0x45, 0x04,
+    0x4a, 0x09, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x03, 0x64, 0x65, 0x72,
+    0x02, 0x05, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x0e, 0x03, 0x74, 0x69, 0x6c, 0x10, 0x80, 0x0a, 0x81,
+    0x4a, 0x2c, 0x05, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x00, 0x80, 0x4a, 0x80, 0x09, 0x80, 0x31, 0x82,
+    0xee, 0xee, 0x04, 0x64, 0x61, 0x74, 0x65, 0x00, 0x04, 0x6c, 0x6f, 0x61, 0x64, 0x02, 0x80, 0xd1,
+    0x80, 0xd1, 0x80, 0x16, 0x02, 0xd7, 0x01, 0x65, 0x00, 0x03, 0x69, 0x6e, 0x67, 0x16, 0x82, 0xd7,
+    0x5d, 0x01, 0x64, 0x00, 0x01, 0x72, 0x02, 0x80, 0x5c, 0x81, 0xd7, 0xd7, 0x04, 0x6e, 0x61, 0x6d,
+    0x65, 0x00, 0x80, 0xd6, 0x80, 0x5c, 0x04, 0xc8, 0x02, 0x61, 0x6c, 0x00, 0x06, 0x65, 0x72, 0x73,
+    0x69, 0x6f, 0x6e, 0x14, 0x04, 0x69, 0x64, 0x65, 0x6f, 0x16, 0x02, 0x6f, 0x6c, 0x18, 0x02, 0xc8,
+    0x02, 0x75, 0x65, 0x00, 0x02, 0x76, 0x65, 0x08, 0x81, 0xc8, 0xc8, 0x01, 0x73, 0x00, 0x80, 0xc8,
+    0x80, 0x7a, 0x80, 0x87, 0x80, 0x96, 0x02, 0x94, 0x04, 0x74, 0x61, 0x67, 0x65, 0x00, 0x03, 0x75,
+    0x6d, 0x65, 0x02, 0x80, 0x71, 0x80, 0x94, 0x06, 0xfa, 0x01, 0x61, 0x00, 0x01, 0x65, 0x3a, 0x01,
+    0x68, 0x68, 0x01, 0x69, 0xad, 0x01, 0x01, 0x6f, 0xe6, 0x01, 0x04, 0x72, 0x69, 0x74, 0x65, 0x8c,
+    0x02, 0x05, 0xf6, 0x02, 0x69, 0x74, 0x00, 0x02, 0x6e, 0x74, 0x0a, 0x05, 0x72, 0x6e, 0x69, 0x6e,
+    0x67, 0x0c, 0x01, 0x73, 0x0e, 0x01, 0x74, 0x10, 0x81, 0x43, 0x43, 0x03, 0x69, 0x6e, 0x67, 0x00,
+    0x80, 0x07, 0x80, 0x5e, 0x80, 0x9b, 0x80, 0xf6, 0x03, 0x78, 0x02, 0x63, 0x68, 0x00, 0x02, 0x65,
+    0x72, 0x02, 0x01, 0x74, 0x04, 0x80, 0x4a, 0x80, 0x78, 0x80, 0x71, 0x86, 0xf2, 0xf2, 0x05, 0x61,
+    0x74, 0x68, 0x65, 0x72, 0x00, 0x01, 0x62, 0x02, 0x02, 0x65, 0x6b, 0x04, 0x04, 0x69, 0x67, 0x68,
+    0x74, 0x06, 0x05, 0x6c, 0x63, 0x6f, 0x6d, 0x65, 0x08, 0x02, 0x72, 0x65, 0x0a, 0x80, 0x83, 0x80,
+    0x15, 0x80, 0xaf, 0x80, 0x73, 0x80, 0xb4, 0x80, 0x35, 0x05, 0xef, 0x02, 0x61, 0x74, 0x00, 0x01,
+    0x65, 0x02, 0x01, 0x69, 0x0f, 0x01, 0x6f, 0x23, 0x01, 0x79, 0x31, 0x80, 0xef, 0x02, 0xe8, 0x01,
+    0x6e, 0x00, 0x02, 0x72, 0x65, 0x02, 0x80, 0xe8, 0x80, 0x33, 0x03, 0xe8, 0x02, 0x63, 0x68, 0x00,
+    0x02, 0x6c, 0x65, 0x02, 0x02, 0x74, 0x65, 0x04, 0x80, 0xe8, 0x80, 0x31, 0x80, 0x90, 0x82, 0x34,
+    0x34, 0x01, 0x6d, 0x00, 0x02, 0x73, 0x65, 0x02, 0x80, 0x34, 0x80, 0x33, 0x80, 0x32, 0x05, 0xfa,
+    0x02, 0x66, 0x69, 0x00, 0x02, 0x6c, 0x6c, 0x02, 0x02, 0x6e, 0x64, 0x04, 0x06, 0x72, 0x65, 0x6c,
+    0x65, 0x73, 0x73, 0x0d, 0x02, 0x74, 0x68, 0x0f, 0x80, 0xd8, 0x80, 0xeb, 0x81, 0x82, 0x82, 0x02,
+    0x6f, 0x77, 0x00, 0x80, 0x7c, 0x80, 0x18, 0x82, 0xfa, 0xfa, 0x02, 0x69, 0x6e, 0x00, 0x03, 0x6f,
+    0x75, 0x74, 0x02, 0x80, 0x2e, 0x80, 0x2f, 0x02, 0xb7, 0x01, 0x72, 0x00, 0x03, 0x75, 0x6c, 0x64,
+    0x1a, 0x02, 0xb7, 0x01, 0x6b, 0x00, 0x02, 0x6c, 0x64, 0x0f, 0x82, 0x63, 0x63, 0x03, 0x69, 0x6e,
+    0x67, 0x00, 0x01, 0x73, 0x02, 0x80, 0x62, 0x80, 0x62, 0x80, 0xb7, 0x80, 0x3b, 0x80, 0x50, 0x02,
+    0xfc, 0x01, 0x65, 0x00, 0x02, 0x6f, 0x75, 0x20, 0x03, 0xee, 0x02, 0x61, 0x72, 0x00, 0x04, 0x6c,
+    0x6c, 0x6f, 0x77, 0x02, 0x01, 0x73, 0x04, 0x80, 0xae, 0x80, 0x8d, 0x81, 0xee, 0xee, 0x06, 0x74,
+    0x65, 0x72, 0x64, 0x61, 0x79, 0x00, 0x80, 0xb2, 0x82, 0xfc, 0xfc, 0x02, 0x6e, 0x67, 0x00, 0x01,
+    0x72, 0x02, 0x80, 0x21, 0x80, 0xf4, 0x80, 0x84,
+};
@@ -4,8 +4,9 @@
  * Captures display contents as JPEG, supporting three backends:
  *
  *   1. Sprite mode (Arduino_GFX canvas — preferred, zero bus overhead)
- *   2. TFT_eSPI mode (ILI9341/ST7789 — readRectRGB row-by-row, real GRAM)
- *   3. HTTP server mode — serves live screenshots at GET /screenshot
+ *   2. TFT_eSPI mode (ILI9341/ST7789 — readRect in 16-row strips, real GRAM)
+ *   3. HTTP server mode — serves live screenshots at GET /screenshot and
+ *      a live mirror at GET /screen.mjpeg
  *
  * TFT_eSPI mode is new (added 2026-03-01) and covers the CYD + any
  * TFT_eSPI board. It's the right choice when you don't have a sprite.
@@ -25,15 +26,42 @@
  *   size_t len; uint8_t *jpg = WyScreenshot::captureToBuffer(&tft, 320, 240, len);
  *   // ... use jpg ...  free(jpg);
  *
+ *   // Or stream to anything (file, socket) without holding the JPEG:
+ *   WyScreenshot::captureStream(&tft, 320, 240, [](void *c, const uint8_t *d, size_t n) {
+ *     return ((File *)c)->write(d, n) == n; }, &file);
+ *
  * Usage (TFT_eSPI + FreeRTOS background task):
+ *   WyScreenshot::setDisplayLock(tftMutex);         // the mutex your UI draws under
  *   WyScreenshot::startServerTask(&tft, 320, 240);  // non-blocking
+ *   The task reads GRAM and the mirror's dirty tiles while the UI draws;
+ *   it takes the lock per 16-row strip read and tile update, never while
+ *   bytes go to a client, so a slow viewer can't stall drawing (a frame
+ *   may then mix strips from before and after a redraw). Call
+ *   markDirty() with it held. Without a lock, use handleServer() from
+ *   the drawing thread instead.
+ *
+ * Live mirror (/screen.mjpeg, one viewer at a time):
+ *   Each due frame reads GRAM back in strips and hashes 16×16 tiles
+ *   (WyDirtyTiles); a frame is encoded and sent only if a tile changed.
+ *   An idle screen backs off to one check per WY_MJPEG_IDLE_MS. If your
+ *   UI knows what it redraws, skip the readback entirely:
+ *     WyScreenshot::useDirtyMap(true);
+ *     WyScreenshot::markDirty(x, y, w, h);        // after each redraw
+ *   WyScreenshot::setMirrorFps(8);                // default WY_MJPEG_FPS
  *
  * Usage (Arduino_GFX sprite mode):
  *   WyScreenshot::captureToBuffer(canvas, len);
  *
+ * Usage (lossless dump over serial — CI / bench rigs, no WiFi):
+ *   Serial.begin(2000000);
+ *   WyScreenshot::dumpSerial(canvas);             // or (&tft, 320, 240)
+ *   // host: wydump /dev/ttyUSB0 --baud 2000000 -o shot   → shot_0000.png
+ *
  * Notes:
- *   - TFT_eSPI readRectRGB() reads row-by-row: ~1KB heap per row, safe on CYD
- *   - JPEG output buffer auto-sized; free() when done
+ *   - TFT_eSPI capture reads 16-row strips and encodes as it goes: ~10 KB
+ *     strip + ~6 KB encoder for 320 px, no full-frame buffer, safe on CYD
+ *   - /screenshot streams the JPEG as a chunked response while capturing
+ *   - captureToBuffer() output grows with the JPEG; free() when done
  *   - HTTP server on port WY_SCREENSHOT_PORT (default 81)
  *   - JPEGENC (bitbank2/JPEGENC) must be in lib_deps
  *
@@ -44,6 +72,10 @@
 #pragma once
 #include <Arduino.h>
 #include <WebServer.h>
+#include <new>
+#include "../display/WyPixel.h"
+#include "../display/WyDirtyTiles.h"
+#include "../display/WyFrameDump.h"
 
 #ifndef WY_SCREENSHOT_QUALITY
   #define WY_SCREENSHOT_QUALITY 85
@@ -53,6 +85,18 @@
   #define WY_SCREENSHOT_PORT 81
 #endif
 
+#ifndef WY_SCREENSHOT_STRIP
+  #define WY_SCREENSHOT_STRIP 16   // rows per panel read = one 4:2:0 MCU row
+#endif
+
+#ifndef WY_MJPEG_FPS
+  #define WY_MJPEG_FPS     5       // /screen.mjpeg frame rate cap
+#endif
+
+#ifndef WY_MJPEG_IDLE_MS
+  #define WY_MJPEG_IDLE_MS 1000    // slowest change check on an idle screen
+#endif
+
 // ── Forward declarations ──────────────────────────────────────────
 #if __has_include("JPEGENC.h")
   #include "JPEGENC.h"
@@ -72,94 +116,86 @@
 class WyScreenshot {
 public:
 
+  // JPEG sink for captureStream(): return false to abort (e.g. client gone)
+  typedef bool (*WriteFn)(void *ctx, const uint8_t *data, size_t len);
+
+  // ── TFT_eSPI: stream JPEG to a sink ────────────────────────────
+  // Reads the panel in WY_SCREENSHOT_STRIP-row strips (one 4:2:0 MCU row)
+  // and encodes each strip as it arrives; JPEGENC hands its output to
+  // `out` every ~2 KB, so the first bytes leave before the last rows are
+  // read. Peak heap: one strip (320 px → 10 KB) + the encoder state.
+  // Returns JPEG bytes written, 0 on OOM / encode / sink failure.
+#ifdef WY_HAS_TFTESPI
+  static size_t captureStream(TFT_eSPI *tft, int w, int h,
+                              WriteFn out, void *ctx,
+                              uint8_t quality = WY_SCREENSHOT_QUALITY) {
+    if (!tft) return 0;
+    return _encodeStrips(w, h, false, _tftStrip, tft, out, ctx, quality, "TFT_eSPI");
+  }
+
   // ── TFT_eSPI: capture to heap-allocated JPEG buffer ────────────
-  // Row-by-row readRectRGB — only ~960 bytes heap per row, safe even
-  // when main buffers are allocated. Caller must free() the result.
+  // captureStream() into a buffer that grows as the JPEG does — no
+  // full-frame RGB565 copy. Caller must free() the result.
   // Returns nullptr on OOM or encode failure.
-#ifdef WY_HAS_TFTESPI
   static uint8_t* captureToBuffer(TFT_eSPI *tft, int w, int h,
                                    size_t &outLen,
                                    uint8_t quality = WY_SCREENSHOT_QUALITY) {
     outLen = 0;
-#ifndef WY_HAS_JPEGENC
-    Serial.println("[WyScreenshot] ERROR: JPEGENC not found. Add bitbank2/JPEGENC to lib_deps.");
-    return nullptr;
-#else
-    uint8_t *rowBuf  = (uint8_t *)malloc(w * 3);
-    // RGB565 frame: 320×240×2 = 150KB — fits in heap after main bufs freed.
-    // readRect() returns RGB565 directly — no conversion needed for JPEGENC.
-    // JPEGE_PIXEL_RGB565 + addFrame = simplest correct path.
-    free(rowBuf);   // don't need row buffer — readRect fills full frame
-    uint16_t *frameBuf = (uint16_t *)malloc(w * h * 2);   // 150KB for 320×240
-    if (!frameBuf) {
-      Serial.printf("[WyScreenshot] OOM frameBuf heap=%u largest=%u\n",
-                    ESP.getFreeHeap(), ESP.getMaxAllocHeap());
-      return nullptr;
-    }
-    int jpegBufSz = 32768;  // 320×240 Q85 JPEG ≈ 15–25KB
-    uint8_t *jpegBuf = (uint8_t *)malloc(jpegBufSz);
-    if (!jpegBuf) { free(frameBuf); return nullptr; }
-    uint32_t t0 = millis();
-    tft->readRect(0, 0, w, h, frameBuf);   // bulk SPI read of full frame (RGB565)
-    JPEGENC jpg; JPEGENCODE enc;
-    int rc = jpg.open(jpegBuf, jpegBufSz);
-    if (rc == JPEGE_SUCCESS)
-      rc = jpg.encodeBegin(&enc, w, h, JPEGE_PIXEL_RGB565, JPEGE_SUBSAMPLE_420, quality);
-    if (rc == JPEGE_SUCCESS)
-      rc = jpg.addFrame(&enc, (uint8_t *)frameBuf, w * 2);
-    int jpegLen = (rc == JPEGE_SUCCESS) ? jpg.close() : 0;
-    free(frameBuf);
-    Serial.printf("[WyScreenshot] TFT_eSPI %dx%d → %d bytes JPEG in %lums\n",
-                  w, h, jpegLen, millis()-t0);
-    if (jpegLen <= 0) { free(jpegBuf); return nullptr; }
-    outLen = jpegLen;
-    return jpegBuf;
-#endif
+    _Grow g = { nullptr, 0, 0 };
+    size_t n = captureStream(tft, w, h, _growWrite, &g, quality);
+    if (!n) { free(g.buf); return nullptr; }
+    outLen = n;
+    return g.buf;
   }
 #endif // WY_HAS_TFTESPI
 
-  // ── Arduino_GFX canvas: capture to buffer ──────────────────────
+  // ── Arduino_GFX canvas: stream / capture to buffer ─────────────
+  // Same strip pipeline, reading the canvas framebuffer: each strip is
+  // converted to RGB888 with the WyPixel SWAR kernel (320 px → 15 KB)
+  // instead of copying the whole frame first.
 #ifdef WY_HAS_GFX
+  static size_t captureStream(Arduino_Canvas *canvas,
+                              WriteFn out, void *ctx,
+                              uint8_t quality = WY_SCREENSHOT_QUALITY) {
+    if (!canvas || !canvas->getFramebuffer()) return 0;
+    return _encodeStrips(canvas->width(), canvas->height(), true, _canvasStrip, canvas,
+                         out, ctx, quality, "canvas");
+  }
+
   static uint8_t* captureToBuffer(Arduino_Canvas *canvas,
                                    size_t &outLen,
                                    uint8_t quality = WY_SCREENSHOT_QUALITY) {
     outLen = 0;
-    if (!canvas) return nullptr;
-#ifndef WY_HAS_JPEGENC
-    Serial.println("[WyScreenshot] ERROR: JPEGENC not found.");
-    return nullptr;
-#else
-    uint16_t w = canvas->width(), h = canvas->height();
-    uint16_t *fb = canvas->getFramebuffer();
-    if (!fb) return nullptr;
-    // Convert RGB565 → RGB888
-    uint32_t nPx = (uint32_t)w * h;
-    uint8_t *rgb888 = (uint8_t *)malloc(nPx * 3);
-    if (!rgb888) return nullptr;
-    for (uint32_t i = 0; i < nPx; i++) {
-      uint16_t px = fb[i];
-      uint8_t r5=(px>>11)&0x1F, g6=(px>>5)&0x3F, b5=px&0x1F;
-      rgb888[i*3+0]=(r5<<3)|(r5>>2);
-      rgb888[i*3+1]=(g6<<2)|(g6>>4);
-      rgb888[i*3+2]=(b5<<3)|(b5>>2);
-    }
-    uint8_t *jpegBuf = (uint8_t *)malloc(w * h);
-    if (!jpegBuf) { free(rgb888); return nullptr; }
-    JPEGENC jpg; JPEGENCODE enc;
-    int rc = jpg.open(jpegBuf, jpegBufSz);
-    if (rc == JPEGE_SUCCESS)
-      rc = jpg.encodeBegin(&enc, w, h, JPEGE_PIXEL_RGB888, JPEGE_SUBSAMPLE_420, quality);
-    for (uint16_t y = 0; y < h && rc == JPEGE_SUCCESS; y++)
-      rc = jpg.addMCU(&enc, rgb888 + (uint32_t)y * w * 3, w * 3);
-    int jpegLen = (rc == JPEGE_SUCCESS) ? jpg.close() : 0;
-    free(rgb888);
-    if (jpegLen <= 0) { free(jpegBuf); return nullptr; }
-    outLen = jpegLen;
-    return jpegBuf;
-#endif
+    _Grow g = { nullptr, 0, 0 };
+    size_t n = captureStream(canvas, _growWrite, &g, quality);
+    if (!n) { free(g.buf); return nullptr; }
+    outLen = n;
+    return g.buf;
   }
 #endif // WY_HAS_GFX
 
+  // ── Serial framebuffer dump ────────────────────────────────────
+  // Raw RGB565 as WyFrameDump records: Q565-compressed chunks, CRC-32
+  // framed, decoded to PNG by tools/wydump. Lossless and no JPEG encoder:
+  // a 320×240 UI is ~5 KB, so the time is the UART's (~30 ms at 2 Mbaud)
+  // and write() blocking on a full TX buffer paces the encoder. Log output
+  // on the same port between dumps is fine — the decoder skips it.
+  // Returns bytes sent, 0 on OOM / write failure.
+#ifdef WY_HAS_TFTESPI
+  static size_t dumpSerial(TFT_eSPI *tft, int w, int h, Print &out = Serial) {
+    if (!tft || w <= 0 || h <= 0) return 0;
+    _DumpTft d = { tft, (uint16_t)w };
+    return wyFrameDump((uint16_t)w, (uint16_t)h, _dumpTft, &d, _dumpWrite, &out, _dumpSeq++);
+  }
+#endif
+#ifdef WY_HAS_GFX
+  static size_t dumpSerial(Arduino_Canvas *canvas, Print &out = Serial) {
+    if (!canvas || !canvas->getFramebuffer()) return 0;
+    return wyFrameDump(canvas->width(), canvas->height(), _dumpCanvas, canvas,
+                       _dumpWrite, &out, _dumpSeq++);
+  }
+#endif
+
   // ── HTTP server — TFT_eSPI mode ────────────────────────────────
   // startServer(): init, call handleServer() in loop()
   // startServerTask(): spins a FreeRTOS background task (non-blocking)
@@ -177,23 +213,42 @@ public:
       _server->send(200, "text/html", html);
     });
     _server->on("/screenshot", HTTP_GET, _handleScreenshot);
+    _server->on("/screen.mjpeg", HTTP_GET, _handleMjpeg);
     _server->begin();
     Serial.printf("[WyScreenshot] http://%s:%d/screenshot\n",
                   WiFi.localIP().toString().c_str(), port);
   }
 
+  // Also sends the next /screen.mjpeg frame when one is due
   static void handleServer() {
     if (_server) _server->handleClient();
+    _pumpMjpeg();
   }
 
+  // ── /screen.mjpeg controls ─────────────────────────────────────
+  static void setMirrorFps(uint8_t fps) { _fps = fps ? fps : 1; }
+
+  // true: trust markDirty() instead of reading GRAM back to find changes
+  static void useDirtyMap(bool on) { _dirtyMap = on; }
+
+  // Rect redrawn since the last frame (dirty-map mode; harmless otherwise)
+  static void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    _tiles.markDirty(x, y, w, h);
+  }
+
+  // Mutex the UI holds while drawing; server captures take it per strip
+  static void setDisplayLock(SemaphoreHandle_t lock) { _lock = lock; }
+
   // Non-blocking: spins a FreeRTOS task that calls handleServer() forever.
-  // Call once after startServer(). No loop() changes needed.
+  // Call once after startServer(). No loop() changes needed, but set a
+  // display lock first (setDisplayLock) — the task reads the panel.
   static void startServerTask(TFT_eSPI *tft, int w, int h,
                               uint16_t port = WY_SCREENSHOT_PORT,
                               uint32_t stackSize = 6144) {
     startServer(tft, w, h, port);
+    if (!_lock) Serial.println("[WyScreenshot] server task without a display lock — captures race the UI");
     xTaskCreate([](void*){
-      for(;;) { if(_server) _server->handleClient(); vTaskDelay(5/portTICK_PERIOD_MS); }
+      for(;;) { handleServer(); vTaskDelay(5/portTICK_PERIOD_MS); }
     }, "wyss", stackSize, nullptr, 1, nullptr);
   }
 #endif // WY_HAS_TFTESPI
@@ -204,20 +259,292 @@ private:
   static TFT_eSPI   *_tft;
 #endif
   static int         _w, _h;
+#ifdef WY_HAS_TFTESPI
+  static WiFiClient    _mj;            // current /screen.mjpeg viewer
+  static WyDirtyTiles  _tiles;
+  static uint32_t      _mjNext, _mjWait;
+  static uint8_t       _fps;
+  static bool          _dirtyMap;
+  static bool          _mjHead;        // viewer's 200 headers not sent yet
+  static SemaphoreHandle_t _lock;
+
+  struct _Locked {
+    _Locked()  { if (_lock) xSemaphoreTake(_lock, portMAX_DELAY); }
+    ~_Locked() { if (_lock) xSemaphoreGive(_lock); }
+  };
+#endif
+
+  // Fills strip rows [y, y + rows) at stride wP px, padded to whole MCUs
+  typedef void (*StripFn)(void *src, int y, int w, int rows, int wP, uint8_t *strip);
+
+  // Strip loop shared by both backends: rgb888 = strip is 3 B/px, else RGB565
+  static size_t _encodeStrips(int w, int h, bool rgb888, StripFn fill, void *src,
+                              WriteFn out, void *ctx, uint8_t quality, const char *tag) {
+#ifndef WY_HAS_JPEGENC
+    Serial.println("[WyScreenshot] ERROR: JPEGENC not found. Add bitbank2/JPEGENC to lib_deps.");
+    return 0;
+#else
+    if (w <= 0 || h <= 0) return 0;
+    int wP = (w + 15) & ~15, bpp = rgb888 ? 3 : 2;   // MCU-aligned strip width
+    uint8_t *strip = (uint8_t *)malloc((size_t)wP * WY_SCREENSHOT_STRIP * bpp);
+    JPEGENC *jpg   = new (std::nothrow) JPEGENC();   // ~6 KB: keep it off the task stack
+    if (!strip || !jpg) {
+      Serial.printf("[WyScreenshot] OOM strip heap=%u largest=%u\n",
+                    ESP.getFreeHeap(), ESP.getMaxAllocHeap());
+      free(strip); delete jpg;
+      return 0;
+    }
+    uint32_t t0 = millis();
+    _Sink sink = { out, ctx, 0, true };
+    JPEGENCODE enc;
+    // JPEGENC's file mode has no user pointer: the "filename" goes to
+    // _jOpen, which hands it back as the file handle — so pass the sink.
+    int rc = jpg->open((const char *)&sink, _jOpen, _jClose, _jRead, _jWrite, _jSeek);
+    if (rc == JPEGE_SUCCESS)
+      rc = jpg->encodeBegin(&enc, w, h, rgb888 ? JPEGE_PIXEL_RGB888 : JPEGE_PIXEL_RGB565,
+                            JPEGE_SUBSAMPLE_420, quality);
+    for (int y = 0; y < h && rc == JPEGE_SUCCESS && sink.ok; y += WY_SCREENSHOT_STRIP) {
+      int rows = h - y < WY_SCREENSHOT_STRIP ? h - y : WY_SCREENSHOT_STRIP;
+      fill(src, y, w, rows, wP, strip);
+      for (int x = 0; x < w && rc == JPEGE_SUCCESS; x += 16)
+        rc = jpg->addMCU(&enc, strip + x * bpp, wP * bpp);
+    }
+    int len = (rc == JPEGE_SUCCESS) ? jpg->close() : 0;
+    delete jpg;
+    free(strip);
+    if (!sink.ok || len <= 0) {
+      Serial.printf("[WyScreenshot] %s %dx%d encode failed (rc=%d, sink %s)\n",
+                    tag, w, h, rc, sink.ok ? "ok" : "closed");
+      return 0;
+    }
+    Serial.printf("[WyScreenshot] %s %dx%d → %u bytes JPEG in %lums\n",
+                  tag, w, h, (unsigned)sink.n, millis()-t0);
+    return sink.n;
+#endif
+  }
+
+  // Replicate the right column / bottom row of a strip into the MCU padding
+  static void _padStrip(uint8_t *px, int w, int rows, int wP, int bpp) {
+    size_t stride = (size_t)wP * bpp;
+    for (int r = 0; r < rows; r++) {
+      uint8_t *d = px + r * stride;
+      for (int x = w; x < wP; x++) memcpy(d + x * bpp, d + (w - 1) * bpp, bpp);
+    }
+    for (int r = rows; r < WY_SCREENSHOT_STRIP; r++)
+      memcpy(px + r * stride, px + (rows - 1) * stride, stride);
+  }
 
 #ifdef WY_HAS_TFTESPI
+  // readRect() packs rows at stride w: one SPI read, then spread to wP
+  static void _tftStrip(void *src, int y, int w, int rows, int wP, uint8_t *strip) {
+    uint16_t *px = (uint16_t *)strip;
+    ((TFT_eSPI *)src)->readRect(0, y, w, rows, px);
+    _spreadStrip(strip, w, rows, wP);
+  }
+  // Server handlers: display lock held for the read only, not the encode / send
+  static void _tftStripLocked(void *src, int y, int w, int rows, int wP, uint8_t *strip) {
+    {
+      _Locked l;
+      ((TFT_eSPI *)src)->readRect(0, y, w, rows, (uint16_t *)strip);
+    }
+    _spreadStrip(strip, w, rows, wP);
+  }
+  static void _spreadStrip(uint8_t *strip, int w, int rows, int wP) {
+    uint16_t *px = (uint16_t *)strip;
+    for (int r = rows - 1; r > 0; r--)
+      memmove(px + (size_t)r * wP, px + (size_t)r * w, (size_t)w * 2);
+    _padStrip(strip, w, rows, wP, 2);
+  }
+#endif
+
+#ifdef WY_HAS_GFX
+  static void _canvasStrip(void *src, int y, int w, int rows, int wP, uint8_t *strip) {
+    const uint16_t *fb = ((Arduino_Canvas *)src)->getFramebuffer();
+    for (int r = 0; r < rows; r++)
+      wyRGB565toRGB888(fb + (size_t)(y + r) * w, strip + (size_t)r * wP * 3, w);
+    _padStrip(strip, w, rows, wP, 3);
+  }
+#endif
+
+#ifdef WY_HAS_JPEGENC
+  struct _Sink { WriteFn fn; void *ctx; size_t n; bool ok; };
+
+  static void   *_jOpen(const char *name) { return (void *)name; }   // = &sink
+  static void    _jClose(JPEGE_FILE *) {}
+  static int32_t _jRead(JPEGE_FILE *, uint8_t *, int32_t) { return 0; }
+  static int32_t _jSeek(JPEGE_FILE *, int32_t pos) { return pos; }
+  static int32_t _jWrite(JPEGE_FILE *f, uint8_t *buf, int32_t len) {
+    _Sink *s = (_Sink *)f->fHandle;
+    if (!s->ok || !s->fn(s->ctx, buf, (size_t)len)) { s->ok = false; return 0; }
+    s->n += len;
+    return len;
+  }
+#endif
+
+  static uint32_t _dumpSeq;
+
+  static bool _dumpWrite(void *ctx, const uint8_t *p, size_t n) {
+    return ((Print *)ctx)->write(p, n) == n;
+  }
+#ifdef WY_HAS_TFTESPI
+  struct _DumpTft { TFT_eSPI *tft; uint16_t w; };
+  static void _dumpTft(void *src, uint16_t y, uint16_t rows, uint16_t *px) {
+    _DumpTft *d = (_DumpTft *)src;
+    d->tft->readRect(0, y, d->w, rows, px);
+  }
+#endif
+#ifdef WY_HAS_GFX
+  static void _dumpCanvas(void *src, uint16_t y, uint16_t rows, uint16_t *px) {
+    Arduino_Canvas *c = (Arduino_Canvas *)src;
+    memcpy(px, c->getFramebuffer() + (size_t)y * c->width(), (size_t)rows * c->width() * 2);
+  }
+#endif
+
+  struct _Grow { uint8_t *buf; size_t len, cap; };
+
+  static bool _growWrite(void *ctx, const uint8_t *data, size_t len) {
+    _Grow *g = (_Grow *)ctx;
+    if (g->len + len > g->cap) {
+      size_t cap = g->cap ? g->cap * 2 : 16384;    // 320×240 Q85 ≈ 15–25 KB
+      while (cap < g->len + len) cap *= 2;
+      uint8_t *nb = (uint8_t *)realloc(g->buf, cap);
+      if (!nb) return false;
+      g->buf = nb; g->cap = cap;
+    }
+    memcpy(g->buf + g->len, data, len);
+    g->len += len;
+    return true;
+  }
+
+#ifdef WY_HAS_TFTESPI
+  // Headers go out with the first JPEG bytes, so a failure before then
+  // can still answer 503. Body is chunked (length unknown up front).
+  static bool _httpWrite(void *ctx, const uint8_t *data, size_t len) {
+    bool *started = (bool *)ctx;
+    if (!*started) {
+      _server->sendHeader("Cache-Control", "no-cache");
+      _server->sendHeader("Access-Control-Allow-Origin", "*");
+      _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+      _server->send(200, "image/jpeg", "");
+      *started = true;
+    }
+    if (!_server->client().connected()) return false;
+    _server->sendContent((const char *)data, len);
+    return true;
+  }
+
   static void _handleScreenshot() {
     if (!_tft || !_server) return;
-    size_t len = 0;
-    uint8_t *jpg = captureToBuffer(_tft, _w, _h, len);
-    if (!jpg || len == 0) {
+    bool started = false;
+    _captureLocked(_httpWrite, &started);
+    if (!started) {
       _server->send(503, "text/plain", "Capture failed — OOM or encode error");
       return;
     }
-    _server->sendHeader("Cache-Control", "no-cache");
-    _server->sendHeader("Access-Control-Allow-Origin", "*");
-    _server->send_P(200, "image/jpeg", (const char *)jpg, len);
-    free(jpg);
+    _server->sendContent("");                       // terminating chunk
+  }
+
+  // A new viewer takes over the stream. The raw client outlives this
+  // handler; frames go out from _pumpMjpeg() on later handleServer() calls,
+  // so the server (and loop()) keeps running between frames. The 200
+  // headers wait for the first frame's JPEG bytes, so a capture that
+  // fails up front still gets a clean 503.
+  static void _handleMjpeg() {
+    if (!_tft || !_server) return;
+    if (_mj.connected()) _mj.stop();
+    bool ok;
+    {
+      _Locked l;
+      ok = _tiles.begin(_w, _h);
+    }
+    if (!ok) {
+      _server->send(503, "text/plain", "Mirror failed — OOM");
+      return;
+    }
+    _mj = _server->client();
+    _mjHead = true;
+    _mjNext = millis();
+    _mjWait = 1000 / _fps;
+  }
+
+  // Headers and the part boundary go out with a frame's first bytes
+  static bool _clientWrite(void *ctx, const uint8_t *data, size_t len) {
+    bool *started = (bool *)ctx;
+    if (!*started) {
+      if (_mjHead)
+        _mj.print("HTTP/1.1 200 OK\r\n"
+                  "Content-Type: multipart/x-mixed-replace; boundary=wyframe\r\n"
+                  "Cache-Control: no-cache\r\n"
+                  "Access-Control-Allow-Origin: *\r\n"
+                  "Connection: close\r\n\r\n");
+      _mjHead = false;
+      _mj.print("--wyframe\r\nContent-Type: image/jpeg\r\n\r\n");
+      *started = true;
+    }
+    return _mj.write(data, len) == len;
+  }
+
+  static void _mjClose() {
+    if (_mjHead) _mj.print("HTTP/1.1 503 Service Unavailable\r\nContent-Type: text/plain\r\n"
+                           "Connection: close\r\n\r\nMirror failed — capture error");
+    _mj.stop();
+    _Locked l;
+    _tiles.end();
+  }
+
+  static size_t _captureLocked(WriteFn out, void *ctx) {
+    return _encodeStrips(_w, _h, false, _tftStripLocked, _tft, out, ctx,
+                         WY_SCREENSHOT_QUALITY, "TFT_eSPI");
+  }
+
+  // GRAM readback → tile hashes. False on OOM (treated as "changed").
+  static bool _scanTiles() {
+    uint16_t *strip = (uint16_t *)malloc((size_t)_w * WY_SCREENSHOT_STRIP * 2);
+    if (!strip) return false;
+    for (int y = 0; y < _h; y += WY_SCREENSHOT_STRIP) {
+      int rows = _h - y < WY_SCREENSHOT_STRIP ? _h - y : WY_SCREENSHOT_STRIP;
+      _Locked l;
+      _tft->readRect(0, y, _w, rows, strip);
+      _tiles.scanStrip((uint16_t)y, strip, (uint16_t)_w, (uint16_t)rows);
+    }
+    free(strip);
+    return true;
+  }
+
+  // One step of the mirror: nothing until due; then skip if no tile
+  // changed (backing off towards WY_MJPEG_IDLE_MS), else encode straight
+  // into the socket. write() blocks while the client's window is full, so
+  // a slow viewer stretches the frame time and the next frame waits that
+  // long too — the stream paces itself to what the link drains.
+  static void _pumpMjpeg() {
+    if (!_tft || !_tiles.tiles()) return;
+    uint32_t now = millis(), frameMs = 1000 / _fps;
+    if ((int32_t)(now - _mjNext) < 0) return;
+    if (!_mj.connected()) { _mj.stop(); _Locked l; _tiles.end(); return; }
+    if (!_dirtyMap && !_scanTiles()) { _Locked l; _tiles.markAll(); }
+    bool idle;
+    {
+      _Locked l;
+      idle = !_tiles.count();
+      if (!idle) _tiles.clear();                    // changes from here on go in the next frame
+    }
+    if (idle) {
+      _mjWait = _mjWait * 2 > WY_MJPEG_IDLE_MS ? WY_MJPEG_IDLE_MS : _mjWait * 2;
+      _mjNext = now + _mjWait;
+      return;
+    }
+    bool started = false;
+    size_t n = _captureLocked(_clientWrite, &started);
+    if (!n && !started && !_mjHead) {               // nothing sent (OOM): stream intact, retry
+      _Locked l;
+      _tiles.markAll();
+      _mjNext = now + frameMs;
+      return;
+    }
+    if (!n || _mj.print("\r\n") != 2) { _mjClose(); return; }
+    uint32_t took = millis() - now;
+    _mjWait = frameMs;
+    _mjNext = now + (took > frameMs ? took : frameMs);
   }
 #endif
 };
@@ -230,6 +557,15 @@ private:
 WebServer  *WyScreenshot::_server = nullptr;
 int         WyScreenshot::_w      = 320;
 int         WyScreenshot::_h      = 240;
+uint32_t    WyScreenshot::_dumpSeq = 0;
 #ifdef WY_HAS_TFTESPI
-TFT_eSPI   *WyScreenshot::_tft    = nullptr;
+TFT_eSPI     *WyScreenshot::_tft      = nullptr;
+WiFiClient    WyScreenshot::_mj;
+WyDirtyTiles  WyScreenshot::_tiles;
+uint32_t      WyScreenshot::_mjNext   = 0;
+uint32_t      WyScreenshot::_mjWait   = 0;
+uint8_t       WyScreenshot::_fps      = WY_MJPEG_FPS;
+bool          WyScreenshot::_dirtyMap = false;
+bool          WyScreenshot::_mjHead   = false;
+SemaphoreHandle_t WyScreenshot::_lock = nullptr;
 #endif
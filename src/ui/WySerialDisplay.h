@@ -19,7 +19,7 @@
  *   }
  *
  *   void loop() {
- *     term.update();   // call once per loop — flushes pending chars
+ *     term.update();   // call once per loop — renders dirty lines
  *   }
  *
  * Configuration (optional, set before #include or in platformio.ini):
@@ -30,6 +30,17 @@
  *   WY_TERM_FG         - text colour (default: WY_GREEN)
  *   WY_TERM_HEADER     - 1 to show board name + uptime header bar (default: 1)
  *   WY_TERM_INTERCEPT  - 1 to auto-intercept Serial (default: 1)
+ *   WY_TERM_BUDGET_MS  - max ms update() spends drawing per call (default: 8,
+ *                        0 = no limit). Change at runtime with setBudget().
+ *
+ * Deferred rendering:
+ *   write() never touches the display — it only appends to the line buffer
+ *   and marks the affected lines dirty. update() then repaints dirty lines
+ *   (one fillRect + one text run per line) until the time budget is spent;
+ *   anything left over is picked up on the next call. A burst of debug
+ *   output therefore costs a memcpy on the caller's thread, and scrolling
+ *   100 lines between two update() calls costs one repaint, not 100.
+ *   Call flush() to force everything out immediately (e.g. before a reboot).
  *
  * Intercepting Serial:
  *   When WY_TERM_INTERCEPT=1 (default), WySerialDisplay installs itself as an
@@ -67,6 +78,9 @@
 #ifndef WY_TERM_INTERCEPT
   #define WY_TERM_INTERCEPT 1
 #endif
+#ifndef WY_TERM_BUDGET_MS
+  #define WY_TERM_BUDGET_MS 8
+#endif
 
 /* Character cell size for built-in GFX font */
 #define WY_TERM_CHAR_W  (6 * WY_TERM_FONT_SIZE)
@@ -86,8 +100,9 @@
 /* ── WySerialDisplay ─────────────────────────────────────────────── */
 class WySerialDisplay : public Print {
 public:
-    WySerialDisplay() : _gfx(nullptr), _row(0), _col(0), _dirty(false) {
+    WySerialDisplay() : _gfx(nullptr), _row(0), _col(0), _top(0), _dirty(false) {
         memset(_buf, ' ', sizeof(_buf));
+        memset(_lineDirty, 0, sizeof(_lineDirty));
     }
 
     /* Attach to a display. Call after display.begin(). */
@@ -104,24 +119,33 @@ public:
 #endif
     }
 
-    /* Call once per loop() — processes any buffered chars */
+    /* Call once per loop() — repaints dirty lines within the time budget */
     void update() {
-        if (_dirty) {
-            _dirty = false;
-            /* Redraw is done inline in write(), nothing to flush here.
-               This hook exists for future double-buffered mode. */
+        if (_gfx && _dirty) {
+            _render(_budgetMs);
         }
         /* Refresh header uptime every ~1s */
 #if WY_TERM_HEADER
         uint32_t now = millis();
-        if (now - _lastHeaderMs > 1000) {
+        if (_gfx && now - _lastHeaderMs > 1000) {
             _lastHeaderMs = now;
             _drawHeader();
         }
 #endif
     }
 
-    /* Print interface — write a single character */
+    /* Repaint every dirty line now, ignoring the time budget */
+    void flush() {
+        if (_gfx && _dirty) _render(0);
+    }
+
+    /* Max ms update() may spend drawing per call (0 = no limit) */
+    void setBudget(uint16_t ms) { _budgetMs = ms; }
+
+    /* True while buffered output is still waiting to be drawn */
+    bool pending() const { return _dirty; }
+
+    /* Print interface — write a single character (buffer only, no drawing) */
     size_t write(uint8_t c) override {
         if (!_gfx) return 1;
 
@@ -153,76 +177,101 @@ public:
     /* Clear screen */
     void clear() {
         memset(_buf, ' ', sizeof(_buf));
-        _row = 0; _col = 0;
-        if (_gfx) {
-            _gfx->fillRect(0, WY_TERM_HEADER_H,
-                           WY_DISPLAY_W, WY_DISPLAY_H - WY_TERM_HEADER_H,
-                           WY_TERM_BG);
-        }
+        _row = 0; _col = 0; _top = 0;
+        _markAll();
     }
 
     /* Change colours at runtime */
     void setColors(uint16_t fg, uint16_t bg) {
         _fg = fg; _bg = bg;
+        _markAll();
     }
 
 private:
     Arduino_GFX* _gfx;
-    char  _buf[WY_TERM_LINES][WY_TERM_COLS + 1];  /* +1 for safety */
+    /* Ring of lines: screen row r lives in _buf[(_top + r) % WY_TERM_LINES] */
+    char  _buf[WY_TERM_LINES][WY_TERM_COLS + 1];  /* +1 for NUL when drawing */
     uint8_t _row, _col;
-    bool _dirty;
+    uint8_t _top;                       /* buffer index of top screen row */
+    bool _lineDirty[WY_TERM_LINES];     /* indexed by screen row */
+    bool _dirty;                        /* any line dirty */
+    uint8_t _scan = 0;                  /* screen row update() resumes from */
+    uint16_t _budgetMs = WY_TERM_BUDGET_MS;
     uint16_t _fg = WY_TERM_FG;
     uint16_t _bg = WY_TERM_BG;
 #if WY_TERM_HEADER
     uint32_t _lastHeaderMs = 0;
 #endif
 
+    char* _line(uint8_t r) {
+        return _buf[(_top + r) % WY_TERM_LINES];
+    }
+
+    void _markAll() {
+        memset(_lineDirty, 1, sizeof(_lineDirty));
+        _dirty = true;
+        _scan  = 0;
+    }
+
     void _putChar(char c) {
         if (_col >= WY_TERM_COLS) _newline();
-        _buf[_row][_col] = c;
-        /* Draw char in-place */
-        int16_t px = _col * WY_TERM_CHAR_W;
-        int16_t py = WY_TERM_HEADER_H + _row * WY_TERM_CHAR_H;
-        _gfx->fillRect(px, py, WY_TERM_CHAR_W, WY_TERM_CHAR_H, _bg);
-        _gfx->setTextSize(WY_TERM_FONT_SIZE);
-        _gfx->setTextColor(_fg);
-        _gfx->setCursor(px, py);
-        _gfx->print(c);
-        _col++;
+        _line(_row)[_col++] = c;
+        _lineDirty[_row] = true;
+        _dirty = true;
     }
 
     void _newline() {
         /* Pad rest of current line */
-        while (_col < WY_TERM_COLS) _buf[_row][_col++] = ' ';
+        char* l = _line(_row);
+        while (_col < WY_TERM_COLS) l[_col++] = ' ';
         _col = 0;
 
         if (_row < WY_TERM_LINES - 1) {
             _row++;
         } else {
-            /* Scroll: shift buffer up one row */
-            for (uint8_t r = 0; r < WY_TERM_LINES - 1; r++) {
-                memcpy(_buf[r], _buf[r + 1], WY_TERM_COLS);
-            }
-            memset(_buf[WY_TERM_LINES - 1], ' ', WY_TERM_COLS);
-            _redrawAll();
+            /* Scroll: recycle the top line as the new bottom line.
+               Every screen row now shows different text — repaint all. */
+            _top = (_top + 1) % WY_TERM_LINES;
+            memset(_line(_row), ' ', WY_TERM_COLS);
+            _markAll();
         }
     }
 
-    void _redrawAll() {
-        /* Redraw full terminal area — called on scroll */
-        _gfx->fillRect(0, WY_TERM_HEADER_H,
-                       WY_DISPLAY_W, WY_DISPLAY_H - WY_TERM_HEADER_H,
-                       _bg);
+    /* Repaint dirty lines, stopping once budgetMs has elapsed (0 = no limit).
+       Always draws at least one line so output can't stall. */
+    void _render(uint16_t budgetMs) {
+        uint32_t t0 = millis();
         _gfx->setTextSize(WY_TERM_FONT_SIZE);
         _gfx->setTextColor(_fg);
+        for (uint8_t n = 0; n < WY_TERM_LINES; n++) {
+            uint8_t r = _scan;
+            _scan = (_scan + 1) % WY_TERM_LINES;
+            if (!_lineDirty[r]) continue;
+            _lineDirty[r] = false;
+            _drawLine(r);
+            if (budgetMs && millis() - t0 >= budgetMs) break;
+        }
+        _dirty = false;
         for (uint8_t r = 0; r < WY_TERM_LINES; r++) {
-            _gfx->setCursor(0, WY_TERM_HEADER_H + r * WY_TERM_CHAR_H);
-            for (uint8_t c = 0; c < WY_TERM_COLS; c++) {
-                _gfx->print(_buf[r][c]);
-            }
+            if (_lineDirty[r]) { _dirty = true; break; }
         }
     }
 
+    void _drawLine(uint8_t r) {
+        int16_t py = WY_TERM_HEADER_H + r * WY_TERM_CHAR_H;
+        _gfx->fillRect(0, py, WY_DISPLAY_W, WY_TERM_CHAR_H, _bg);
+        /* Trailing spaces draw nothing — skip them */
+        char* l = _line(r);
+        uint8_t len = WY_TERM_COLS;
+        while (len > 0 && l[len - 1] == ' ') len--;
+        if (!len) return;
+        char saved = l[len];
+        l[len] = '\0';
+        _gfx->setCursor(0, py);
+        _gfx->print(l);
+        l[len] = saved;
+    }
+
     void _drawHeader() {
 #if WY_TERM_HEADER
         if (!_gfx) return;
@@ -274,6 +323,9 @@ class WySerialDisplay : public Print {
 public:
     void begin(void* gfx = nullptr, bool clear = true) {}
     void update() {}
+    void flush() {}
+    void setBudget(uint16_t) {}
+    bool pending() const { return false; }
     void clear() {}
     size_t write(uint8_t c) override { return 1; }
     void printDirect(const char*) {}
@@ -0,0 +1,281 @@
+/*
+ * WyTrendChart.h — scrolling time-series chart for WyUI
+ * =======================================================
+ * Temperature, CO2, block interval, price: one value in, the plot moves
+ * one column left when a column fills up. Samples are decimated into a
+ * ring of per-column min / max, so a column covers `samplesPerColumn`
+ * samples and the drawn trace is a vertical span per pixel column.
+ *
+ * A new sample costs a diff, not a redraw. The chart remembers the span
+ * it drew in every column; update() scrolls the plot (memmove when the
+ * painter has a framebuffer) and then touches only the pixels whose
+ * span changed — on a framebuffer that is the newest column, on an SPI
+ * panel the trace pixels that moved. The axis labels and the full plot
+ * repaint only when the (rounded) range changes.
+ *
+ * Usage:
+ *   WyTrendChart co2(WY_GREEN, 0x0000, WY_GRAY, 0);  // line, bg, labels, decimals
+ *   co2.setBounds(0, 40, 320, 120);
+ *   co2.setSamplesPerColumn(6);                      // 10 s samples → 1 px per minute
+ *   screen.add(&co2);
+ *   ...
+ *   co2.push(ppm);                                   // then ui.frame()
+ *
+ * Memory: (plot width + 1) × 8 + plot width × 4 bytes, allocated on the
+ * first push / paint and again if the width changes (newest columns kept).
+ * Keep other widgets off the chart: update() draws outside the damage
+ * pass and doesn't repaint what sits on top.
+ */
+
+#pragma once
+#include <math.h>
+#include "WyUICore.h"
+
+#ifndef WY_TREND_COLS
+#define WY_TREND_COLS 320             /* ring size if samples arrive before layout */
+#endif
+
+class WyTrendChart : public WyWidget {
+public:
+    uint32_t rangeChanges = 0;        /* full repaints caused by the axis moving */
+
+    WyTrendChart(uint16_t line = 0x07FF, uint16_t bg = 0x0000, uint16_t label = 0x8410,
+                 uint8_t decimals = 1, uint8_t gutterChars = 6)
+        : _line(line), _bg(bg), _label(label), _dec(decimals), _gutter(gutterChars) {
+        _opaque = true;
+    }
+    ~WyTrendChart() { _free(); }
+    WyTrendChart(const WyTrendChart &) = delete;
+    WyTrendChart &operator=(const WyTrendChart &) = delete;
+
+    void setSamplesPerColumn(uint16_t n) { _per = n ? n : 1; }
+
+    /* Fixed axis; lo >= hi = auto (data range rounded out to 1/2/5 steps) */
+    void setRange(float lo, float hi) {
+        _fixed = isfinite(lo) && isfinite(hi) && lo < hi;
+        if (_fixed) _setRange(lo, hi);
+        else _autoRange();
+    }
+
+    void push(float v) {
+        if (!isfinite(v)) return;                         /* NaN / ±inf: sensor glitch, drop it */
+        if (!_ensure()) return;
+        if (!_filled || _acc >= _per) {
+            _head = (uint16_t)((_head + 1) % _ring);
+            _mn[_head] = _mx[_head] = v;
+            if (_filled < _ring) _filled++;
+            _acc = 0;
+            if (_shift < _cols) _shift++;
+        } else {
+            if (v < _mn[_head]) _mn[_head] = v;
+            if (v > _mx[_head]) _mx[_head] = v;
+        }
+        _acc++;
+        _count++;
+        if (!_fixed && _autoRange()) return;              /* full repaint queued */
+        requestUpdate();
+    }
+
+    void clear() {
+        _filled = 0; _acc = 0; _count = 0;
+        if (!_fixed) { _lo = 0; _hi = 0; }
+        invalidate();
+    }
+
+    uint32_t count() const { return _count; }
+    float    lo()    const { return _lo; }
+    float    hi()    const { return _hi; }
+    uint16_t columns() const { return _cols; }
+
+    WyRect plotRect() const {
+        int16_t g = _gutterW();
+        return WyRect{ (int16_t)(_b.x + g), _b.y, (int16_t)(_b.w - g), _b.h };
+    }
+
+    /* Full paint of whatever the clip covers */
+    void paint(WyPainter &p) override {
+        WyRect pl = plotRect();
+        WyRect gut = { _b.x, _b.y, _gutterW(), _b.h };
+        if (p.clip().intersects(gut)) {
+            p.fillRect(gut.x, gut.y, gut.w, gut.h, _bg);
+            p.fillRect((int16_t)(gut.right() - 1), gut.y, 1, gut.h, _label);
+            if (_lo < _hi) {
+                char s[16];
+                snprintf(s, sizeof(s), "%.*f", _dec, (double)_hi);
+                p.text((int16_t)(gut.right() - 3 - wyTextWidth(s, 1)), gut.y, s, 1, _label);
+                snprintf(s, sizeof(s), "%.*f", _dec, (double)_lo);
+                p.text((int16_t)(gut.right() - 3 - wyTextWidth(s, 1)),
+                       (int16_t)(gut.bottom() - wyTextHeight(1)), s, 1, _label);
+            }
+        }
+        WyRect cl = p.clip().intersect(pl);
+        if (cl.empty()) return;
+        p.fillRect(cl.x, cl.y, cl.w, cl.h, _bg);
+        if (!_ensure()) return;
+        bool whole = cl.y == pl.y && cl.h == pl.h;        /* full columns repainted */
+        for (int16_t x = (int16_t)(cl.x - pl.x); x < cl.right() - pl.x; x++) {
+            _Span s = _spanAt(x);
+            if (s.y0 <= s.y1)
+                p.fillRect((int16_t)(pl.x + x), (int16_t)(pl.y + s.y0), 1, (int16_t)(s.y1 - s.y0 + 1), _line);
+            _drawn[x] = whole ? s : _Span{ UNKNOWN, 0 };
+        }
+        if (cl == pl) _shift = 0;
+    }
+
+    /* Incremental: scroll, then fix only the columns whose span changed */
+    void update(WyPainter &p) override {
+        if (!_ensure()) return;
+        WyRect pl = plotRect();
+        p.setClip(pl);
+        if (_shift) {
+            int16_t k = (int16_t)_shift;
+            bool moved = k < _cols && p.scroll(pl, (int16_t)-k);
+            if (moved) {                                  /* pixels and memory of them move together */
+                memmove(_drawn, _drawn + k, (size_t)(_cols - k) * sizeof(_Span));
+                for (int16_t x = (int16_t)(_cols - k); x < _cols; x++) _drawn[x] = _Span{ UNKNOWN, 0 };
+            }
+            _shift = 0;
+        }
+        for (int16_t x = 0; x < _cols; x++) {
+            _Span s = _spanAt(x);
+            _diff(p, (int16_t)(pl.x + x), pl.y, _drawn[x], s);
+            _drawn[x] = s;
+        }
+    }
+
+    void layout() override { _ensure(); }
+
+private:
+    struct _Span { int16_t y0, y1; };                     /* y0 > y1 = nothing drawn */
+    static constexpr int16_t UNKNOWN = -32768;            /* pixels not known: repaint column */
+
+    uint16_t _line, _bg, _label;
+    uint8_t  _dec, _gutter;
+    uint16_t _per = 1, _acc = 0;
+    bool     _fixed = false;
+    float    _lo = 0, _hi = 0;
+    float   *_mn = nullptr, *_mx = nullptr;               /* ring of _ring columns */
+    _Span   *_drawn = nullptr;                            /* what's on screen, per plot column */
+    uint16_t _ring = 0, _cols = 0, _head = 0, _filled = 0, _shift = 0;
+    uint32_t _count = 0;
+
+    int16_t _gutterW() const {
+        return _gutter ? (int16_t)(_gutter * WY_UI_CHAR_W + 4) : 0;
+    }
+
+    void _free() {
+        free(_mn); free(_mx); free(_drawn);
+        _mn = _mx = nullptr; _drawn = nullptr;
+        _ring = _cols = 0;
+    }
+
+    /* Size the ring to the plot (+1 column so the oldest visible one can
+       join to its neighbour), keeping the newest columns */
+    bool _ensure() {
+        int16_t pw = plotRect().w;
+        uint16_t cols = pw > 0 ? (uint16_t)pw : (_cols ? _cols : WY_TREND_COLS);
+        if (_mn && cols == _cols) return true;
+        if (_mn && pw <= 0) return true;                  /* not laid out yet: keep what we have */
+        uint16_t ring = (uint16_t)(cols + 1);
+        float *mn = (float *)malloc(ring * sizeof(float));
+        float *mx = (float *)malloc(ring * sizeof(float));
+        _Span *dr = (_Span *)malloc(cols * sizeof(_Span));
+        if (!mn || !mx || !dr) { free(mn); free(mx); free(dr); return _mn != nullptr && cols == _cols; }
+        uint16_t keep = _filled < ring ? _filled : ring;
+        for (uint16_t a = 0; a < keep; a++) {             /* newest first, age a → slot keep-1-a */
+            uint16_t from = (uint16_t)((_head + _ring - a) % _ring);
+            mn[keep - 1 - a] = _mn[from];
+            mx[keep - 1 - a] = _mx[from];
+        }
+        for (uint16_t x = 0; x < cols; x++) dr[x] = _Span{ UNKNOWN, 0 };
+        _free();
+        _mn = mn; _mx = mx; _drawn = dr;
+        _ring = ring; _cols = cols;
+        _filled = keep;
+        _head = (uint16_t)(keep ? keep - 1 : ring - 1);
+        _shift = 0;
+        if (!_fixed) _autoRange();
+        return true;
+    }
+
+    int16_t _yOf(float v, int16_t h) const {
+        float f = (v - _lo) * (h - 1) / (_hi - _lo);
+        if (f < 0) f = 0;
+        if (f > h - 1) f = (float)(h - 1);
+        return (int16_t)(h - 1 - (int16_t)(f + 0.5f));
+    }
+
+    /* Span for plot column x: column min..max, stretched to meet the older neighbour */
+    _Span _spanAt(int16_t x) const {
+        uint16_t age = (uint16_t)(_cols - 1 - x);
+        if (age >= _filled || !(_lo < _hi)) return _Span{ 0, -1 };
+        int16_t h = _b.h;
+        uint16_t i = (uint16_t)((_head + _ring - age) % _ring);
+        _Span s = { _yOf(_mx[i], h), _yOf(_mn[i], h) };
+        if (age + 1 < _filled) {
+            uint16_t j = (uint16_t)((i + _ring - 1) % _ring);
+            int16_t t = _yOf(_mx[j], h), b = _yOf(_mn[j], h);
+            if (s.y0 > b) s.y0 = b;                       /* neighbour above: reach up */
+            if (s.y1 < t) s.y1 = t;                       /* neighbour below: reach down */
+        }
+        return s;
+    }
+
+    /* Paint the difference between what column x shows and what it should */
+    void _diff(WyPainter &p, int16_t x, int16_t y, const _Span &o, const _Span &n) {
+        if (o.y0 == UNKNOWN) {
+            p.fillRect(x, y, 1, _b.h, _bg);
+            if (n.y0 <= n.y1) p.fillRect(x, (int16_t)(y + n.y0), 1, (int16_t)(n.y1 - n.y0 + 1), _line);
+            return;
+        }
+        if (o.y0 == n.y0 && o.y1 == n.y1) return;
+        _minus(p, x, y, o, n, _bg);                       /* old pixels the new span doesn't cover */
+        _minus(p, x, y, n, o, _line);                     /* new pixels not already lit */
+    }
+
+    /* Fill a \ b (two runs at most) in column x */
+    static void _minus(WyPainter &p, int16_t x, int16_t y, const _Span &a, const _Span &b, uint16_t c) {
+        if (a.y0 > a.y1) return;
+        if (b.y0 > b.y1 || b.y1 < a.y0 || b.y0 > a.y1) {
+            p.fillRect(x, (int16_t)(y + a.y0), 1, (int16_t)(a.y1 - a.y0 + 1), c);
+            return;
+        }
+        if (a.y0 < b.y0) p.fillRect(x, (int16_t)(y + a.y0), 1, (int16_t)(b.y0 - a.y0), c);
+        if (a.y1 > b.y1) p.fillRect(x, (int16_t)(y + b.y1 + 1), 1, (int16_t)(a.y1 - b.y1), c);
+    }
+
+    /* Data range over the ring rounded out to a 1 / 2 / 5 step; true if it moved */
+    bool _autoRange() {
+        if (!_filled) return false;
+        float lo = _mn[_head], hi = _mx[_head];
+        for (uint16_t a = 1; a < _filled; a++) {
+            uint16_t i = (uint16_t)((_head + _ring - a) % _ring);
+            if (_mn[i] < lo) lo = _mn[i];
+            if (_mx[i] > hi) hi = _mx[i];
+        }
+        float span = hi - lo;
+        if (span <= 0) span = lo != 0 ? (lo < 0 ? -lo : lo) * 0.1f : 1.0f;
+        float raw = span / 4, step = 1;
+        if (!isfinite(raw) || raw < 1e-30f) {            /* ±FLT_MAX or denormal: no rounding */
+            if (hi <= lo) { lo -= 1; hi += 1; }
+            if (lo == _lo && hi == _hi) return false;
+            _setRange(lo, hi);
+            return true;
+        }
+        while (step > raw) step /= 10;
+        while (step * 10 <= raw) step *= 10;
+        step = raw <= step ? step : raw <= 2 * step ? 2 * step : raw <= 5 * step ? 5 * step : 10 * step;
+        float nlo = floorf(lo / step) * step, nhi = ceilf(hi / step) * step;
+        if (nhi <= nlo) nhi = nlo + step;
+        if (nlo == _lo && nhi == _hi) return false;
+        _setRange(nlo, nhi);
+        return true;
+    }
+
+    void _setRange(float lo, float hi) {
+        if (lo == _lo && hi == _hi) return;
+        _lo = lo; _hi = hi;
+        rangeChanges++;
+        invalidate();
+    }
+};
@@ -0,0 +1,125 @@
+/*
+ * WyUI.h — Retained-mode UI: screens, widgets, nav stack
+ * ========================================================
+ * Widgets are declared once and changed through setters; loop() calls
+ * frame(), which repaints only what changed since the last frame. See
+ * WyUICore.h for the widget set, damage rules and layout.
+ *
+ * Usage:
+ *   #include <ui/WyUI.h>
+ *
+ *   WyUI     ui;
+ *   WyScreen home(0x1082), settings(0x1082);
+ *   WyStack  col(true, 6, 8);                       // vertical, 6 px gap, 8 px padding
+ *   WyLabel  title("Greenhouse", 3, WY_WHITE, 0x1082, WY_ALIGN_CENTER);
+ *   WyValue  temp(1, " C", 4, WY_CYAN, 0x1082);
+ *   WyButton more("Settings", [](WyWidget *, void *) { ui.push(&settings); });
+ *
+ *   void setup() {
+ *       display.begin();
+ *       ui.begin(display.gfx, display.width, display.height);
+ *       ui.cacheScreens(true);                      // back = one blit (PSRAM)
+ *       home.add(&col);  col.setBounds(0, 0, display.width, display.height);
+ *       title.setSize(0, 40);  temp.setGrow(1);  more.setSize(0, 48);
+ *       col.add(&title);  col.add(&temp);  col.add(&more);
+ *       ui.push(&home);
+ *   }
+ *   void loop() {
+ *       touch.update();
+ *       ui.touch(touch.x, touch.y, touch.pressed);
+ *       temp.setValue(bme.temperature());           // no redraw unless the text changes
+ *       ui.frame();
+ *   }
+ *
+ * Screen cache: each covered screen holds an Arduino_Canvas the size of
+ * the display — 150 KB at 320×240, 750 KB at 800×480 — which Arduino_GFX
+ * puts in PSRAM when there is some. If it can't be allocated, pop()
+ * simply repaints the screen.
+ *
+ * Requires: WY_HAS_DISPLAY=1
+ */
+
+#pragma once
+#include "boards.h"
+
+#if WY_HAS_DISPLAY
+
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include <new>
+#include "WyUICore.h"
+
+/* ── Arduino_GFX painter ─────────────────────────────────────────── */
+class WyGfxPainter : public WyPainter {
+public:
+    WyGfxPainter(Arduino_GFX *gfx = nullptr, uint16_t w = 0, uint16_t h = 0) : WyPainter(w, h), _gfx(gfx) {}
+    ~WyGfxPainter() { delete _canvas; }
+
+    void attach(Arduino_GFX *gfx, uint16_t w, uint16_t h) { _gfx = gfx; resize(w, h); }
+    Arduino_GFX *gfx() const { return _gfx; }
+
+    /* The panel's own framebuffer (Arduino_Canvas, RGB panels): enables
+       memmove scrolling and makes the nav cache a memcpy */
+    void setFramebuffer(uint16_t *fb) { _fb = fb; }
+
+    /* Offscreen Arduino_Canvas, same size, never flushed to a panel */
+    WyPainter *offscreen() override {
+        Arduino_Canvas *c = new (std::nothrow) Arduino_Canvas(_w, _h, nullptr);
+        if (!c) return nullptr;
+        if (!c->begin(GFX_SKIP_OUTPUT_BEGIN) || !c->getFramebuffer()) {
+            Serial.printf("[WyUI] screen cache: %u B alloc failed\n", (unsigned)_w * _h * 2);
+            delete c;
+            return nullptr;
+        }
+        WyGfxPainter *p = new (std::nothrow) WyGfxPainter(c, _w, _h);
+        if (!p) { delete c; return nullptr; }
+        p->_canvas = c;
+        p->_fb = c->getFramebuffer();
+        return p;
+    }
+    const uint16_t *pixels() const override { return _fb; }
+
+protected:
+    Arduino_GFX    *_gfx;
+    Arduino_Canvas *_canvas = nullptr;       /* owned, offscreen painters only */
+    uint16_t       *_fb = nullptr;
+
+    void _fill(const WyRect &r, uint16_t c) override { _gfx->fillRect(r.x, r.y, r.w, r.h, c); }
+    void _text(int16_t x, int16_t y, const char *s, uint8_t size, uint16_t fg) override {
+        _gfx->setTextWrap(false);
+        _gfx->setTextSize(size);
+        _gfx->setTextColor(fg);
+        _gfx->setCursor(x, y);
+        _gfx->print(s);
+    }
+    void _blit(const WyRect &r, const uint16_t *px, uint16_t stride) override {
+        if (stride == r.w) {
+            _gfx->draw16bitRGBBitmap(r.x, r.y, (uint16_t *)px, r.w, r.h);
+            return;
+        }
+        for (int16_t y = 0; y < r.h; y++)
+            _gfx->draw16bitRGBBitmap(r.x, (int16_t)(r.y + y), (uint16_t *)(px + (size_t)y * stride), r.w, 1);
+    }
+    /* SPI panels only scroll whole rows in hardware, so sideways needs a framebuffer */
+    bool _scroll(const WyRect &r, int16_t dx) override { return wyFbScroll(_fb, _w, r, dx); }
+};
+
+/* ══════════════════════════════════════════════════════════════════
+ * WyUI
+ * ══════════════════════════════════════════════════════════════════ */
+class WyUI : public WyUICore {
+public:
+    void begin(Arduino_GFX *gfx, uint16_t w, uint16_t h) {
+        _gp.attach(gfx, w, h);
+        WyUICore::begin(&_gp);
+    }
+    Arduino_GFX *gfx() const { return _gp.gfx(); }
+
+    /* Drawing into an Arduino_Canvas or RGB panel? Pass its framebuffer */
+    void setFramebuffer(uint16_t *fb) { _gp.setFramebuffer(fb); }
+
+private:
+    WyGfxPainter _gp;
+};
+
+#endif /* WY_HAS_DISPLAY */
@@ -0,0 +1,1056 @@
+/*
+ * WyUICore.h — retained widget tree, damage regions and nav stack
+ * =================================================================
+ * The platform-free half of WyUI. Widgets (label, value, button, image,
+ * chart, list, stack) live in a tree under a WyScreen and are painted
+ * through a WyPainter. Setters never draw: they add the rectangle that
+ * changed to the screen's damage list, and frame() runs one layout pass
+ * and then repaints only widgets touching that damage, clipped to it.
+ * An idle screen costs one empty-list check per frame.
+ *
+ * Pure C++ — runs in host tests with WyFbPainter (an in-memory RGB565
+ * framebuffer). WyUI.h adds the Arduino_GFX painter.
+ *
+ * Text uses the GFX built-in font metrics: 6 × 8 px per char × size.
+ *
+ * Paint order is tree order (parent, then children in add() order), so
+ * later siblings sit on top. A widget that repaints adds its rect to the
+ * damage so anything above it repaints too. Opaque widgets (label,
+ * button, image, chart, list) fill their own background, so the screen
+ * background is only filled in the parts of the damage none of them cover.
+ *
+ * Nav stack: push() / pop() up to WY_UI_NAV_DEPTH screens. With
+ * cacheScreens(true) the screen being covered is kept as a full-screen
+ * offscreen copy (PSRAM on device, w × h × 2 bytes), and pop() is a single
+ * blit plus whatever changed on it while hidden.
+ *
+ * Memory: widgets are caller-owned objects linked into the tree — no heap
+ * except the screen cache.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef WY_UI_DAMAGE_MAX
+#define WY_UI_DAMAGE_MAX  8           /* rects per screen before merging */
+#endif
+#ifndef WY_UI_NAV_DEPTH
+#define WY_UI_NAV_DEPTH   8
+#endif
+#ifndef WY_UI_TEXT_MAX
+#define WY_UI_TEXT_MAX    40          /* label / button text incl. NUL */
+#endif
+
+#define WY_UI_CHAR_W  6               /* built-in GFX font cell */
+#define WY_UI_CHAR_H  8
+
+/* ── Geometry ─────────────────────────────────────────────────────── */
+struct WyRect {
+    int16_t x = 0, y = 0, w = 0, h = 0;
+
+    bool    empty() const { return w <= 0 || h <= 0; }
+    int32_t area()  const { return empty() ? 0 : (int32_t)w * h; }
+    int16_t right()  const { return (int16_t)(x + w); }
+    int16_t bottom() const { return (int16_t)(y + h); }
+    bool contains(int16_t px, int16_t py) const {
+        return px >= x && py >= y && px < x + w && py < y + h;
+    }
+    bool covers(const WyRect &o) const {
+        return !empty() && o.x >= x && o.y >= y && o.x + o.w <= x + w && o.y + o.h <= y + h;
+    }
+    bool intersects(const WyRect &o) const {
+        return !empty() && !o.empty() && o.x < x + w && x < o.x + o.w && o.y < y + h && y < o.y + o.h;
+    }
+    WyRect intersect(const WyRect &o) const {
+        int16_t x0 = x > o.x ? x : o.x, y0 = y > o.y ? y : o.y;
+        int16_t x1 = right() < o.right() ? right() : o.right();
+        int16_t y1 = bottom() < o.bottom() ? bottom() : o.bottom();
+        if (x1 <= x0 || y1 <= y0) return WyRect{};
+        return WyRect{ x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+    }
+    WyRect unite(const WyRect &o) const {
+        if (empty()) return o;
+        if (o.empty()) return *this;
+        int16_t x0 = x < o.x ? x : o.x, y0 = y < o.y ? y : o.y;
+        int16_t x1 = right() > o.right() ? right() : o.right();
+        int16_t y1 = bottom() > o.bottom() ? bottom() : o.bottom();
+        return WyRect{ x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+    }
+    bool operator==(const WyRect &o) const { return x == o.x && y == o.y && w == o.w && h == o.h; }
+    bool operator!=(const WyRect &o) const { return !(*this == o); }
+};
+
+static inline int16_t wyTextWidth(const char *s, uint8_t size) {
+    return (int16_t)(strlen(s) * WY_UI_CHAR_W * size);
+}
+static inline int16_t wyTextHeight(uint8_t size) { return (int16_t)(WY_UI_CHAR_H * size); }
+
+/* ── Damage list ──────────────────────────────────────────────────── */
+/*
+ * Up to WY_UI_DAMAGE_MAX rects. A new rect already covered is dropped,
+ * rects it covers are absorbed, and it merges with a neighbour when the
+ * union costs no extra area (adjacent / aligned). When the list is full
+ * it merges into whichever rect grows least.
+ */
+class WyDamage {
+public:
+    void add(const WyRect &r) {
+        if (r.empty()) return;
+        for (uint8_t i = 0; i < _n; i++)
+            if (_r[i].covers(r)) return;
+        for (uint8_t i = 0; i < _n; )
+            if (r.covers(_r[i])) _r[i] = _r[--_n]; else i++;
+        int best = -1;
+        int32_t bestGrow = 0;
+        for (uint8_t i = 0; i < _n; i++) {
+            int32_t grow = _r[i].unite(r).area() - _r[i].area() - r.area();
+            if (best < 0 || grow < bestGrow) { best = i; bestGrow = grow; }
+        }
+        if (best >= 0 && (bestGrow <= 0 || _n == WY_UI_DAMAGE_MAX)) {
+            WyRect u = _r[best].unite(r);
+            _r[best] = _r[--_n];
+            add(u);                               /* the union may swallow others */
+            return;
+        }
+        _r[_n++] = r;
+    }
+    void clear() { _n = 0; }
+    bool empty() const { return _n == 0; }
+    uint8_t count() const { return _n; }
+    const WyRect &operator[](uint8_t i) const { return _r[i]; }
+
+    /* Bounding box of the damage inside r (empty if none touches it) */
+    WyRect within(const WyRect &r) const {
+        WyRect b;
+        for (uint8_t i = 0; i < _n; i++) b = b.unite(_r[i].intersect(r));
+        return b;
+    }
+    int32_t area() const {
+        int32_t a = 0;
+        for (uint8_t i = 0; i < _n; i++) a += _r[i].area();
+        return a;
+    }
+
+private:
+    WyRect  _r[WY_UI_DAMAGE_MAX];
+    uint8_t _n = 0;
+};
+
+/* ── Painter ──────────────────────────────────────────────────────── */
+/*
+ * Drawing target. Every primitive is clipped to the current clip rect
+ * (the damage being repainted) before it reaches the backend; text is
+ * skipped when its box is outside the clip and otherwise drawn whole
+ * (the glyphs outside are identical pixels). pixelCount totals pixels
+ * sent — text counts its cell area.
+ */
+class WyPainter {
+public:
+    uint32_t pixelCount = 0;
+
+    WyPainter(uint16_t w = 0, uint16_t h = 0) { resize(w, h); }
+    virtual ~WyPainter() {}
+
+    uint16_t width()  const { return _w; }
+    uint16_t height() const { return _h; }
+    const WyRect &clip() const { return _clip; }
+    void setClip(const WyRect &r) { _clip = r.intersect(WyRect{ 0, 0, (int16_t)_w, (int16_t)_h }); }
+    void resetClip() { _clip = WyRect{ 0, 0, (int16_t)_w, (int16_t)_h }; }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+        WyRect r = WyRect{ x, y, w, h }.intersect(_clip);
+        if (r.empty()) return;
+        pixelCount += (uint32_t)r.area();
+        _fill(r, c);
+    }
+
+    /* Corner rows as spans, so clipping works the same as fillRect */
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t rad, uint16_t c) {
+        if (rad * 2 > w) rad = (int16_t)(w / 2);
+        if (rad * 2 > h) rad = (int16_t)(h / 2);
+        if (rad <= 0) { fillRect(x, y, w, h, c); return; }
+        for (int16_t dy = 0; dy < rad; dy++) {
+            int32_t t = rad - dy;
+            int16_t in = (int16_t)(rad - _isqrt((uint32_t)(rad * rad - (t - 1) * (t - 1))));
+            if (in < 0) in = 0;
+            fillRect((int16_t)(x + in), (int16_t)(y + dy), (int16_t)(w - 2 * in), 1, c);
+            fillRect((int16_t)(x + in), (int16_t)(y + h - 1 - dy), (int16_t)(w - 2 * in), 1, c);
+        }
+        fillRect(x, (int16_t)(y + rad), w, (int16_t)(h - 2 * rad), c);
+    }
+
+    void text(int16_t x, int16_t y, const char *s, uint8_t size, uint16_t fg) {
+        if (!s || !*s) return;
+        WyRect box = { x, y, wyTextWidth(s, size), wyTextHeight(size) };
+        WyRect vis = box.intersect(_clip);
+        if (vis.empty()) return;
+        pixelCount += (uint32_t)vis.area();
+        _text(x, y, s, size, fg);
+    }
+
+    /* w × h pixels, `stride` px per source row */
+    void blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *px, uint16_t stride) {
+        WyRect r = WyRect{ x, y, w, h }.intersect(_clip);
+        if (r.empty() || !px) return;
+        pixelCount += (uint32_t)r.area();
+        _blit(r, px + (size_t)(r.y - y) * stride + (r.x - x), stride);
+    }
+
+    /* Move the pixels of r sideways by dx (< 0 = left). Not clipped; the
+       strip uncovered keeps stale pixels. False if the backend can't. */
+    bool scroll(const WyRect &r, int16_t dx) {
+        WyRect c = r.intersect(WyRect{ 0, 0, (int16_t)_w, (int16_t)_h });
+        if (c.empty() || !dx) return true;
+        if (dx >= c.w || -dx >= c.w) return false;
+        return _scroll(c, dx);
+    }
+
+    /* Full-screen offscreen painter for the nav cache (nullptr = none) */
+    virtual WyPainter *offscreen() { return nullptr; }
+    /* Framebuffer, width() px per row, if this painter has one */
+    virtual const uint16_t *pixels() const { return nullptr; }
+
+protected:
+    uint16_t _w = 0, _h = 0;
+    WyRect   _clip;
+
+    void resize(uint16_t w, uint16_t h) { _w = w; _h = h; resetClip(); }
+
+    virtual void _fill(const WyRect &r, uint16_t c) = 0;
+    virtual void _text(int16_t x, int16_t y, const char *s, uint8_t size, uint16_t fg) = 0;
+    virtual void _blit(const WyRect &r, const uint16_t *px, uint16_t stride) = 0;
+    virtual bool _scroll(const WyRect &r, int16_t dx) { (void)r; (void)dx; return false; }
+
+    static uint32_t _isqrt(uint32_t v) {
+        uint32_t r = 0;
+        while ((r + 1) * (r + 1) <= v) r++;
+        return r;
+    }
+};
+
+/* memmove each row of r in a framebuffer `stride` px wide */
+static inline bool wyFbScroll(uint16_t *fb, uint16_t stride, const WyRect &r, int16_t dx) {
+    if (!fb) return false;
+    int16_t n = (int16_t)(r.w - (dx < 0 ? -dx : dx));
+    for (int16_t y = r.y; y < r.bottom(); y++) {
+        uint16_t *row = fb + (size_t)y * stride + r.x;
+        if (dx < 0) memmove(row, row - dx, (size_t)n * 2);
+        else        memmove(row + dx, row, (size_t)n * 2);
+    }
+    return true;
+}
+
+/*
+ * In-memory RGB565 framebuffer. Host tests and benchmarks draw into it,
+ * and it is the nav cache when nothing better is offered. No font data:
+ * each glyph is a solid 5 × 7 block in its cell, enough to check layout
+ * and damage. (WyUI.h caches through Arduino_Canvas for real text.)
+ */
+class WyFbPainter : public WyPainter {
+public:
+    WyFbPainter(uint16_t w, uint16_t h) : WyPainter(w, h) {
+        _fb = (uint16_t *)calloc((size_t)w * h, 2);
+        _own = true;
+        if (!_fb) resize(0, 0);
+    }
+    WyFbPainter(uint16_t *fb, uint16_t w, uint16_t h) : WyPainter(w, h), _fb(fb) {}
+    ~WyFbPainter() { if (_own) free(_fb); }
+    WyFbPainter(const WyFbPainter &) = delete;
+    WyFbPainter &operator=(const WyFbPainter &) = delete;
+
+    bool ok() const { return _fb != nullptr; }
+    uint16_t *framebuffer() { return _fb; }
+    uint16_t  at(int16_t x, int16_t y) const { return _fb[(size_t)y * _w + x]; }
+
+    WyPainter *offscreen() override {
+        WyFbPainter *p = new WyFbPainter(_w, _h);
+        if (!p->ok()) { delete p; return nullptr; }
+        return p;
+    }
+    const uint16_t *pixels() const override { return _fb; }
+
+protected:
+    uint16_t *_fb = nullptr;
+    bool      _own = false;
+
+    void _fill(const WyRect &r, uint16_t c) override {
+        for (int16_t y = r.y; y < r.bottom(); y++) {
+            uint16_t *p = _fb + (size_t)y * _w + r.x;
+            for (int16_t i = 0; i < r.w; i++) p[i] = c;
+        }
+    }
+    void _text(int16_t x, int16_t y, const char *s, uint8_t size, uint16_t fg) override {
+        WyRect saved = _clip;
+        for (; *s; s++, x = (int16_t)(x + WY_UI_CHAR_W * size)) {
+            if (*s == ' ') continue;
+            WyRect g = WyRect{ x, y, (int16_t)(5 * size), (int16_t)(7 * size) }.intersect(saved);
+            if (!g.empty()) _fill(g, fg);
+        }
+    }
+    void _blit(const WyRect &r, const uint16_t *px, uint16_t stride) override {
+        for (int16_t y = 0; y < r.h; y++)
+            memcpy(_fb + (size_t)(r.y + y) * _w + r.x, px + (size_t)y * stride, (size_t)r.w * 2);
+    }
+    bool _scroll(const WyRect &r, int16_t dx) override {
+        return wyFbScroll(_fb, _w, r, dx);
+    }
+};
+
+/* ── Widget base ──────────────────────────────────────────────────── */
+class WyWidget;
+class WyScreen;
+typedef void (*WyUIClickFn)(WyWidget *w, void *ctx);
+
+enum WyAlign : uint8_t {
+    WY_ALIGN_LEFT   = 0,
+    WY_ALIGN_CENTER = 1,
+    WY_ALIGN_RIGHT  = 2,
+};
+
+class WyWidget {
+public:
+    virtual ~WyWidget() {}
+
+    /* Absolute screen position. Inside a WyStack the stack sets this;
+       use setSize() there for the preferred size instead. */
+    void setBounds(int16_t x, int16_t y, int16_t w, int16_t h) {
+        WyRect nb = { x, y, w, h };
+        if (nb == _b) return;
+        invalidate();
+        _b = nb;
+        _prefW = w; _prefH = h;
+        invalidate();
+        _relayout();
+    }
+    /* Preferred size for a parent WyStack (0 = fill the cross axis) */
+    void setSize(int16_t w, int16_t h) {
+        if (w == _prefW && h == _prefH) return;
+        _prefW = w; _prefH = h;
+        if (_parent) _parent->requestLayout();
+    }
+    /* Share of a WyStack's leftover main-axis space (0 = fixed size) */
+    void setGrow(uint8_t g) {
+        if (g == _grow) return;
+        _grow = g;
+        if (_parent) _parent->requestLayout();
+    }
+    void setVisible(bool v) {
+        if (v == _visible) return;
+        _visible = v;
+        invalidate();
+        if (_parent) _parent->requestLayout();
+    }
+
+    const WyRect &bounds()  const { return _b; }
+    bool          visible() const { return _visible; }
+    bool          opaque()  const { return _opaque; }
+    WyWidget     *parent()  const { return _parent; }
+
+    /* Repaint all of this widget / part of it on the next frame() */
+    void invalidate() { invalidate(_b); }
+    void invalidate(const WyRect &r) {
+        WyDamage *d = _damage();
+        if (d) d->add(r.intersect(_b));
+    }
+    void requestLayout() { _needsLayout = true; }
+
+    /* Children, in paint order */
+    void add(WyWidget *c) {
+        if (!c || c->_parent) return;
+        c->_parent = this;
+        c->_next = nullptr;
+        if (!_first) _first = c;
+        else { WyWidget *t = _first; while (t->_next) t = t->_next; t->_next = c; }
+        requestLayout();
+        c->invalidate();
+    }
+    void remove(WyWidget *c) {
+        if (!c || c->_parent != this) return;
+        c->invalidate();
+        for (WyWidget **p = &_first; *p; p = &(*p)->_next)
+            if (*p == c) { *p = c->_next; break; }
+        c->_parent = nullptr; c->_next = nullptr;
+        requestLayout();
+    }
+    WyWidget *firstChild() const { return _first; }
+    WyWidget *next()       const { return _next; }
+
+    /* Paint this widget; the painter is already clipped to the damage */
+    virtual void paint(WyPainter &p) { (void)p; }
+    /* Place children (called in the layout pass after requestLayout()) */
+    virtual void layout() {}
+
+    /*
+     * Draw straight to the painter, outside the damage model, once per
+     * frame after requestUpdate() — for widgets that know exactly which
+     * pixels changed (e.g. a scrolling chart). Clip = the widget's bounds.
+     * Skipped when damage covers the whole widget; paint() runs instead.
+     * Widgets on top of one that updates are not repainted.
+     */
+    virtual void update(WyPainter &p) { (void)p; }
+    void requestUpdate() {
+        _needsUpdate = true;
+        WyScreen *s = _screen();
+        if (s) _markUpdates(s);
+    }
+
+    /* Touch: press / drag / release, for widgets with _touchable set */
+    virtual void onPress(int16_t x, int16_t y) { (void)x; (void)y; }
+    virtual void onDrag(int16_t x, int16_t y) { (void)x; (void)y; }
+    virtual void onRelease(bool inside) { (void)inside; }
+
+protected:
+    friend class WyUICore;
+    friend class WyStack;
+
+    WyRect    _b;
+    int16_t   _prefW = 0, _prefH = 0;
+    uint8_t   _grow = 0;
+    bool      _visible = true;
+    bool      _opaque = false;
+    bool      _touchable = false;
+    bool      _needsLayout = false;
+    bool      _needsUpdate = false;
+    WyWidget *_parent = nullptr, *_first = nullptr, *_next = nullptr;
+
+    virtual WyDamage *_damage() { return _parent ? _parent->_damage() : nullptr; }
+    virtual WyScreen *_screen() { return _parent ? _parent->_screen() : nullptr; }
+    static void _markUpdates(WyScreen *s);
+
+    /* Moved / resized: the children need placing again */
+    void _relayout() {
+        if (_first) requestLayout();
+        if (_parent) _parent->requestLayout();
+    }
+    /* Position set by a parent's layout(); damage only if it changed */
+    void _place(int16_t x, int16_t y, int16_t w, int16_t h) {
+        WyRect nb = { x, y, w, h };
+        if (nb == _b) return;
+        invalidate();
+        _b = nb;
+        invalidate();
+        if (_first) requestLayout();
+    }
+};
+
+/* ── Screen: root of a tree ───────────────────────────────────────── */
+class WyScreen : public WyWidget {
+public:
+    uint16_t bg = 0x0000;
+
+    explicit WyScreen(uint16_t background = 0x0000) : bg(background) {}
+
+    void setBackground(uint16_t c) {
+        if (c == bg) return;
+        bg = c;
+        invalidate();
+    }
+    const WyDamage &damage() const { return _dmg; }
+
+protected:
+    friend class WyUICore;
+    friend class WyWidget;
+    WyDamage _dmg;
+    bool     _updates = false;            /* some widget called requestUpdate() */
+    WyDamage *_damage() override { return &_dmg; }
+    WyScreen *_screen() override { return this; }
+};
+
+inline void WyWidget::_markUpdates(WyScreen *s) { s->_updates = true; }
+
+/* ── Stack: lays children out in a row or column ──────────────────── */
+class WyStack : public WyWidget {
+public:
+    explicit WyStack(bool vertical = true, int16_t gap = 4, int16_t pad = 0)
+        : _vert(vertical), _gap(gap), _pad(pad) {}
+
+    void setGap(int16_t gap, int16_t pad) {
+        _gap = gap; _pad = pad;
+        requestLayout();
+    }
+
+    void layout() override {
+        int16_t inner = (int16_t)((_vert ? _b.h : _b.w) - 2 * _pad);
+        int16_t cross = (int16_t)((_vert ? _b.w : _b.h) - 2 * _pad);
+        int32_t fixed = 0, grow = 0, n = 0;
+        for (WyWidget *c = _first; c; c = c->_next) {
+            if (!c->_visible) continue;
+            n++;
+            if (c->_grow) grow += c->_grow;
+            else fixed += _vert ? c->_prefH : c->_prefW;
+        }
+        int32_t spare = inner - fixed - (n > 1 ? (n - 1) * _gap : 0);
+        if (spare < 0) spare = 0;
+        int32_t pos = _pad, given = 0, seen = 0;
+        for (WyWidget *c = _first; c; c = c->_next) {
+            if (!c->_visible) continue;
+            int32_t len;
+            if (c->_grow) {                              /* last grower takes the rounding */
+                seen += c->_grow;
+                len = spare * seen / grow - given;
+                given += len;
+            } else {
+                len = _vert ? c->_prefH : c->_prefW;
+            }
+            int16_t cl = _vert ? c->_prefW : c->_prefH;
+            if (cl <= 0 || cl > cross) cl = cross;
+            if (_vert) c->_place((int16_t)(_b.x + _pad), (int16_t)(_b.y + pos), cl, (int16_t)len);
+            else       c->_place((int16_t)(_b.x + pos), (int16_t)(_b.y + _pad), (int16_t)len, cl);
+            pos += len + _gap;
+        }
+    }
+
+private:
+    bool    _vert;
+    int16_t _gap, _pad;
+};
+
+/* ── Label ────────────────────────────────────────────────────────── */
+class WyLabel : public WyWidget {
+public:
+    WyLabel(const char *text = "", uint8_t size = 2, uint16_t fg = 0xFFFF, uint16_t bg = 0x0000,
+            WyAlign align = WY_ALIGN_LEFT)
+        : _size(size), _fg(fg), _bg(bg), _align(align) {
+        _opaque = true;
+        _copy(text);
+    }
+
+    /* Damages only the old ∪ new text box, not the whole label */
+    void setText(const char *text) {
+        if (!text) text = "";
+        if (strncmp(text, _text, sizeof(_text) - 1) == 0) return;
+        WyRect before = textBox();
+        _copy(text);
+        invalidate(before.unite(textBox()));
+    }
+    void setColors(uint16_t fg, uint16_t bg) {
+        if (fg == _fg && bg == _bg) return;
+        _fg = fg; _bg = bg;
+        invalidate();
+    }
+    void setTextSize(uint8_t s) {
+        if (s == _size) return;
+        _size = s;
+        invalidate();
+    }
+    void setAlign(WyAlign a) {
+        if (a == _align) return;
+        _align = a;
+        invalidate();
+    }
+    const char *text() const { return _text; }
+
+    WyRect textBox() const {
+        int16_t tw = wyTextWidth(_text, _size), th = wyTextHeight(_size);
+        int16_t x = _b.x + 2;
+        if (_align == WY_ALIGN_CENTER) x = (int16_t)(_b.x + (_b.w - tw) / 2);
+        else if (_align == WY_ALIGN_RIGHT) x = (int16_t)(_b.x + _b.w - tw - 2);
+        return WyRect{ x, (int16_t)(_b.y + (_b.h - th) / 2), tw, th };
+    }
+
+    void paint(WyPainter &p) override {
+        p.fillRect(_b.x, _b.y, _b.w, _b.h, _bg);
+        WyRect t = textBox();
+        p.text(t.x, t.y, _text, _size, _fg);
+    }
+
+protected:
+    char     _text[WY_UI_TEXT_MAX];
+    uint8_t  _size;
+    uint16_t _fg, _bg;
+    WyAlign  _align;
+
+    void _copy(const char *s) {
+        strncpy(_text, s ? s : "", sizeof(_text) - 1);
+        _text[sizeof(_text) - 1] = '\0';
+    }
+};
+
+/* ── Value: a number with fixed decimals and a unit ───────────────── */
+/* setValue() only damages when the printed text changes */
+class WyValue : public WyLabel {
+public:
+    WyValue(uint8_t decimals = 1, const char *unit = "", uint8_t size = 2,
+            uint16_t fg = 0xFFFF, uint16_t bg = 0x0000, WyAlign align = WY_ALIGN_RIGHT)
+        : WyLabel("", size, fg, bg, align), _dec(decimals), _unit(unit ? unit : "") {}
+
+    void setValue(float v) {
+        _v = v;
+        char s[WY_UI_TEXT_MAX];
+        snprintf(s, sizeof(s), "%.*f%s", _dec, (double)v, _unit);
+        setText(s);
+    }
+    float value() const { return _v; }
+
+private:
+    uint8_t     _dec;
+    const char *_unit;
+    float       _v = 0;
+};
+
+/* ── Button ───────────────────────────────────────────────────────── */
+class WyButton : public WyLabel {
+public:
+    int16_t radius = 6;
+
+    WyButton(const char *text = "", WyUIClickFn onClick = nullptr, void *ctx = nullptr,
+             uint16_t fg = 0xFFFF, uint16_t face = 0x2945, uint16_t down = 0x0475, uint16_t bg = 0x0000)
+        : WyLabel(text, 2, fg, bg, WY_ALIGN_CENTER), _face(face), _down(down), _fn(onClick), _ctx(ctx) {
+        _touchable = true;
+    }
+
+    void onClick(WyUIClickFn fn, void *ctx = nullptr) { _fn = fn; _ctx = ctx; }
+    void setFace(uint16_t face, uint16_t down) {
+        if (face == _face && down == _down) return;
+        _face = face; _down = down;
+        invalidate();
+    }
+    bool pressed() const { return _pressed; }
+
+    void paint(WyPainter &p) override {
+        int16_t r = radius;                              /* background shows in the corners only */
+        if (r > 0) {
+            p.fillRect(_b.x, _b.y, r, r, _bg);
+            p.fillRect((int16_t)(_b.right() - r), _b.y, r, r, _bg);
+            p.fillRect(_b.x, (int16_t)(_b.bottom() - r), r, r, _bg);
+            p.fillRect((int16_t)(_b.right() - r), (int16_t)(_b.bottom() - r), r, r, _bg);
+        }
+        p.fillRoundRect(_b.x, _b.y, _b.w, _b.h, r, _pressed ? _down : _face);
+        WyRect t = textBox();
+        p.text(t.x, t.y, _text, _size, _fg);
+    }
+
+    void onPress(int16_t, int16_t) override { _setPressed(true); }
+    void onDrag(int16_t x, int16_t y) override { _setPressed(_b.contains(x, y)); }
+    void onRelease(bool inside) override {
+        _setPressed(false);
+        if (inside && _fn) _fn(this, _ctx);
+    }
+
+private:
+    uint16_t    _face, _down;
+    WyUIClickFn _fn;
+    void       *_ctx;
+    bool        _pressed = false;
+
+    void _setPressed(bool v) {
+        if (v == _pressed) return;
+        _pressed = v;
+        invalidate();
+    }
+};
+
+/* ── Image: RGB565 pixels, centred ────────────────────────────────── */
+class WyImageView : public WyWidget {
+public:
+    WyImageView(const uint16_t *px = nullptr, uint16_t w = 0, uint16_t h = 0, uint16_t bg = 0x0000)
+        : _px(px), _iw(w), _ih(h), _bg(bg) { _opaque = true; }
+
+    /* Same pointer + size = no-op; call invalidate() after editing in place */
+    void setPixels(const uint16_t *px, uint16_t w, uint16_t h) {
+        if (px == _px && w == _iw && h == _ih) return;
+        _px = px; _iw = w; _ih = h;
+        invalidate();
+    }
+
+    WyRect imageBox() const {
+        return WyRect{ (int16_t)(_b.x + (_b.w - (int16_t)_iw) / 2),
+                       (int16_t)(_b.y + (_b.h - (int16_t)_ih) / 2), (int16_t)_iw, (int16_t)_ih };
+    }
+
+    void paint(WyPainter &p) override {
+        WyRect im = _px ? imageBox().intersect(_b) : WyRect{};
+        if (im.empty()) { p.fillRect(_b.x, _b.y, _b.w, _b.h, _bg); return; }
+        /* Margins only — the image covers the rest */
+        p.fillRect(_b.x, _b.y, _b.w, (int16_t)(im.y - _b.y), _bg);
+        p.fillRect(_b.x, im.bottom(), _b.w, (int16_t)(_b.bottom() - im.bottom()), _bg);
+        p.fillRect(_b.x, im.y, (int16_t)(im.x - _b.x), im.h, _bg);
+        p.fillRect(im.right(), im.y, (int16_t)(_b.right() - im.right()), im.h, _bg);
+        WyRect full = imageBox();
+        p.blit(full.x, full.y, full.w, full.h, _px, _iw);
+    }
+
+private:
+    const uint16_t *_px;
+    uint16_t        _iw, _ih, _bg;
+};
+
+/* ── Chart: caller's sample array as a min / max column plot ──────── */
+class WyChart : public WyWidget {
+public:
+    WyChart(uint16_t line = 0x07FF, uint16_t bg = 0x0000) : _line(line), _bg(bg) { _opaque = true; }
+
+    /* lo == hi = auto range over the data */
+    void setData(const float *v, uint16_t n, float lo = 0, float hi = 0) {
+        _v = v; _n = n; _lo = lo; _hi = hi;
+        invalidate();
+    }
+
+    void paint(WyPainter &p) override {
+        p.fillRect(_b.x, _b.y, _b.w, _b.h, _bg);
+        if (!_v || _n < 1 || _b.w < 1 || _b.h < 1) return;
+        float lo = _lo, hi = _hi;
+        if (lo == hi) {
+            lo = hi = _v[0];
+            for (uint16_t i = 1; i < _n; i++) { if (_v[i] < lo) lo = _v[i]; if (_v[i] > hi) hi = _v[i]; }
+            if (lo == hi) { lo -= 1; hi += 1; }
+        }
+        float k = (_b.h - 1) / (hi - lo);
+        int16_t prev = -1;
+        for (int16_t c = 0; c < _b.w; c++) {
+            /* Samples landing in this column; at least one, so sparse data steps */
+            uint32_t a = (uint32_t)c * _n / _b.w, e = (uint32_t)(c + 1) * _n / _b.w;
+            if (e <= a) e = a + 1;
+            int16_t y0 = 32767, y1 = -1;
+            for (uint32_t i = a; i < e; i++) {
+                int16_t y = _row(_v[i], lo, k);
+                if (y < y0) y0 = y;
+                if (y > y1) y1 = y;
+            }
+            if (prev >= 0) {                             /* join to the last column */
+                if (prev < y0) y0 = prev;
+                if (prev > y1) y1 = prev;
+            }
+            prev = _row(_v[e - 1], lo, k);
+            p.fillRect((int16_t)(_b.x + c), (int16_t)(_b.y + y0), 1, (int16_t)(y1 - y0 + 1), _line);
+        }
+    }
+
+private:
+    const float *_v = nullptr;
+    uint16_t     _n = 0;
+    float        _lo = 0, _hi = 0;
+    uint16_t     _line, _bg;
+
+    int16_t _row(float v, float lo, float k) const {
+        float f = (v - lo) * k;
+        return (int16_t)(_b.h - 1 - (f < 0 ? 0 : f > _b.h - 1 ? _b.h - 1 : f));
+    }
+};
+
+/* ── List: rows of text, tap to select, drag to scroll ────────────── */
+typedef void (*WyUISelectFn)(WyWidget *list, int16_t index, void *ctx);
+
+class WyList : public WyWidget {
+public:
+    WyList(int16_t rowH = 28, uint16_t fg = 0xFFFF, uint16_t bg = 0x0000, uint16_t sel = 0x0475)
+        : _rowH(rowH), _fg(fg), _bg(bg), _selBg(sel) { _opaque = true; _touchable = true; }
+
+    void setItems(const char *const *items, uint16_t n) {
+        _items = items; _n = n;
+        if (_sel >= (int16_t)n) _sel = -1;
+        if (_top > _maxTop()) _top = _maxTop();
+        invalidate();
+    }
+    void onSelect(WyUISelectFn fn, void *ctx = nullptr) { _fn = fn; _ctx = ctx; }
+
+    /* Damages the two rows involved, not the list */
+    void setSelected(int16_t i) {
+        if (i < -1 || i >= (int16_t)_n) i = -1;
+        if (i == _sel) return;
+        invalidate(rowRect(_sel));
+        _sel = i;
+        invalidate(rowRect(_sel));
+    }
+    void scrollTo(int16_t top) {
+        if (top > _maxTop()) top = _maxTop();
+        if (top < 0) top = 0;
+        if (top == _top) return;
+        _top = top;
+        invalidate();
+    }
+    /* Item i changed text: repaint just its row */
+    void itemChanged(int16_t i) { invalidate(rowRect(i)); }
+
+    int16_t selected() const { return _sel; }
+    int16_t top()      const { return _top; }
+
+    /* Screen rect of item i (empty when scrolled out) */
+    WyRect rowRect(int16_t i) const {
+        if (i < _top || i >= (int16_t)_n) return WyRect{};
+        return WyRect{ _b.x, (int16_t)(_b.y + (i - _top) * _rowH), _b.w, _rowH }.intersect(_b);
+    }
+
+    void paint(WyPainter &p) override {
+        const WyRect &cl = p.clip();
+        int16_t first = (int16_t)(_top + (cl.y - _b.y) / _rowH);
+        int16_t last  = (int16_t)(_top + (cl.bottom() - 1 - _b.y) / _rowH);
+        for (int16_t i = first; i <= last; i++) {
+            int16_t y = (int16_t)(_b.y + (i - _top) * _rowH);
+            p.fillRect(_b.x, y, _b.w, _rowH, i == _sel ? _selBg : _bg);
+            if (i < (int16_t)_n && _items && _items[i])
+                p.text((int16_t)(_b.x + 6), (int16_t)(y + (_rowH - wyTextHeight(2)) / 2), _items[i], 2, _fg);
+        }
+    }
+
+    void onPress(int16_t, int16_t y) override { _pressY = _lastY = y; _dragged = false; }
+    void onDrag(int16_t, int16_t y) override {
+        int16_t rows = (int16_t)((_lastY - y) / _rowH);
+        if (!rows) return;
+        _dragged = true;
+        _lastY = (int16_t)(_lastY - rows * _rowH);
+        scrollTo((int16_t)(_top + rows));
+    }
+    void onRelease(bool inside) override {
+        if (!inside || _dragged) return;
+        int16_t i = (int16_t)(_top + (_pressY - _b.y) / _rowH);
+        if (i >= (int16_t)_n) return;
+        setSelected(i);
+        if (_fn) _fn(this, i, _ctx);
+    }
+
+private:
+    const char *const *_items = nullptr;
+    uint16_t     _n = 0;
+    int16_t      _rowH, _top = 0, _sel = -1, _pressY = 0, _lastY = 0;
+    bool         _dragged = false;
+    uint16_t     _fg, _bg, _selBg;
+    WyUISelectFn _fn = nullptr;
+    void        *_ctx = nullptr;
+
+    int16_t _maxTop() const {
+        int16_t vis = (int16_t)(_b.h / (_rowH > 0 ? _rowH : 1));
+        return (int16_t)(_n > vis ? _n - vis : 0);
+    }
+};
+
+/* ══════════════════════════════════════════════════════════════════
+ * WyUICore — nav stack, frame pass, touch routing
+ * ══════════════════════════════════════════════════════════════════ */
+class WyUICore {
+public:
+    uint32_t frames = 0;              /* frame() calls that painted */
+
+    WyUICore() {}
+    ~WyUICore() { for (uint8_t i = 0; i < WY_UI_NAV_DEPTH; i++) _drop(i); }
+    WyUICore(const WyUICore &) = delete;
+    WyUICore &operator=(const WyUICore &) = delete;
+
+    void begin(WyPainter *p) { _p = p; }
+    WyPainter *painter() const { return _p; }
+
+    /* Keep covered screens as offscreen copies so pop() is one blit */
+    void cacheScreens(bool on) {
+        _cacheOn = on;
+        if (!on) for (uint8_t i = 0; i < WY_UI_NAV_DEPTH; i++) _drop(i);
+    }
+
+    /* ── Nav stack ─────────────────────────────────────────────────── */
+    bool push(WyScreen *s) {
+        if (!s || !_p || _depth >= WY_UI_NAV_DEPTH) return false;
+        _release();
+        if (_depth && _cacheOn) _stash(_depth - 1);
+        _stack[_depth++] = s;
+        _show(s);
+        s->_dmg.add(_full());
+        return true;
+    }
+
+    /* Back. False at the root. */
+    bool pop() {
+        if (_depth < 2) return false;
+        _release();
+        _drop(--_depth);
+        WyScreen *s = _stack[_depth - 1];
+        _show(s);
+        WyPainter *c = _cache[_depth - 1];
+        if (c && c->pixels()) {
+            /* Copy as it was when covered; damage since then repaints next frame */
+            _p->resetClip();
+            _p->blit(0, 0, (int16_t)_p->width(), (int16_t)_p->height(), c->pixels(), _p->width());
+            _drop(_depth - 1);
+        } else {
+            s->_dmg.add(_full());
+        }
+        return true;
+    }
+
+    /* Swap the top screen without growing the stack */
+    bool replace(WyScreen *s) {
+        if (!s || !_depth) return push(s);
+        _release();
+        _stack[_depth - 1] = s;
+        _show(s);
+        s->_dmg.add(_full());
+        return true;
+    }
+
+    WyScreen *top()   const { return _depth ? _stack[_depth - 1] : nullptr; }
+    uint8_t   depth() const { return _depth; }
+    bool      cached(uint8_t level) const { return level < WY_UI_NAV_DEPTH && _cache[level]; }
+
+    /* ── Frame: layout, then repaint the damage ──────────────────────── */
+    /* True if anything was drawn */
+    bool frame() {
+        WyScreen *s = top();
+        if (!s || !_p) return false;
+        _layout(s);
+        bool drew = false;
+        if (s->_updates) {
+            s->_updates = false;
+            drew = _update(s, *_p, s->_dmg);
+            _p->resetClip();
+        }
+        if (!s->_dmg.empty()) {
+            _paint(s, *_p, s->_dmg);
+            s->_dmg.clear();
+            drew = true;
+        }
+        if (drew) frames++;
+        return drew;
+    }
+
+    /* Force a full repaint (e.g. after drawing over the UI directly) */
+    void invalidateAll() { if (top()) top()->_dmg.add(_full()); }
+
+    /* ── Touch ─────────────────────────────────────────────────────── */
+    /* Call every loop with the touch state; down = finger on the glass */
+    void touch(int16_t x, int16_t y, bool down) {
+        if (down) {
+            _tx = x; _ty = y;
+            if (!_down) {
+                _down = true;
+                _hit = top() ? _hitTest(top(), x, y) : nullptr;
+                if (_hit) _hit->onPress(x, y);
+            } else if (_hit) {
+                _hit->onDrag(x, y);
+            }
+        } else if (_down) {
+            _down = false;
+            WyWidget *w = _hit;
+            _hit = nullptr;
+            if (w) w->onRelease(w->_b.contains(_tx, _ty));
+        }
+    }
+
+    /* Top-most visible touchable widget under (x, y) */
+    WyWidget *hitTest(int16_t x, int16_t y) const { return top() ? _hitTest(top(), x, y) : nullptr; }
+
+private:
+    WyPainter *_p = nullptr;
+    WyScreen  *_stack[WY_UI_NAV_DEPTH] = {};
+    WyPainter *_cache[WY_UI_NAV_DEPTH] = {};
+    uint8_t    _depth = 0;
+    bool       _cacheOn = false;
+    bool       _down = false;
+    int16_t    _tx = 0, _ty = 0;
+    WyWidget  *_hit = nullptr;
+
+    WyRect _full() const { return WyRect{ 0, 0, (int16_t)_p->width(), (int16_t)_p->height() }; }
+
+    void _show(WyScreen *s) {
+        if (s->_b != _full()) { s->_b = _full(); s->requestLayout(); }
+    }
+
+    /* A press in flight belongs to the old screen */
+    void _release() {
+        if (_hit) _hit->onRelease(false);
+        _hit = nullptr;
+        _down = false;
+    }
+
+    void _drop(uint8_t i) {
+        delete _cache[i];
+        _cache[i] = nullptr;
+    }
+
+    /* Copy the screen at level i before something covers it */
+    void _stash(uint8_t i) {
+        if (!_cache[i]) _cache[i] = _p->offscreen();
+        WyPainter *c = _cache[i];
+        if (!c) return;                                   /* no memory: pop() repaints */
+        WyScreen *s = _stack[i];
+        _layout(s);
+        if (_p->pixels() && s->_dmg.empty()) {            /* the panel is a framebuffer */
+            c->resetClip();
+            c->blit(0, 0, (int16_t)c->width(), (int16_t)c->height(), _p->pixels(), _p->width());
+        } else {
+            WyDamage all;
+            all.add(_full());
+            _paint(s, *c, all);
+        }
+        s->_dmg.clear();
+    }
+
+    static void _layout(WyWidget *w) {
+        if (w->_needsLayout) { w->_needsLayout = false; w->layout(); }
+        for (WyWidget *c = w->_first; c; c = c->_next)
+            if (c->_visible) _layout(c);
+    }
+
+    void _paint(WyScreen *s, WyPainter &p, WyDamage &d) {
+        WyRect screen = { 0, 0, (int16_t)p.width(), (int16_t)p.height() };
+        for (uint8_t i = 0; i < d.count(); i++) {
+            WyRect r = d[i].intersect(screen);
+            p.setClip(r);
+            _fillBg(s, s, p, r, 0);
+        }
+        _paintChildren(s, p, d);
+        p.resetClip();
+    }
+
+    static bool _update(WyWidget *parent, WyPainter &p, const WyDamage &d) {
+        bool any = false;
+        for (WyWidget *c = parent->_first; c; c = c->_next) {
+            if (!c->_visible) continue;
+            if (c->_needsUpdate) {
+                c->_needsUpdate = false;
+                if (d.within(c->_b) != c->_b) {           /* else paint() redraws it all */
+                    p.setClip(c->_b);
+                    c->update(p);
+                    any = true;
+                }
+            }
+            if (c->_first && _update(c, p, d)) any = true;
+        }
+        return any;
+    }
+
+    static void _paintChildren(WyWidget *parent, WyPainter &p, WyDamage &d) {
+        for (WyWidget *c = parent->_first; c; c = c->_next) {
+            if (!c->_visible) continue;
+            WyRect cl = d.within(c->_b);
+            if (!cl.empty()) {
+                p.setClip(cl);
+                c->paint(p);
+                d.add(cl);                                /* whatever sits above repaints too */
+            }
+            if (c->_first) _paintChildren(c, p, d);
+        }
+    }
+
+    /* Screen background for r minus the opaque widgets that will cover it */
+    static void _fillBg(WyScreen *s, WyWidget *w, WyPainter &p, const WyRect &r, uint8_t depth) {
+        if (r.empty()) return;
+        WyWidget *o = depth < 16 ? _firstOpaque(w, r) : nullptr;
+        if (!o) { p.fillRect(r.x, r.y, r.w, r.h, s->bg); return; }
+        WyRect c = o->_b.intersect(r);                    /* up to four bands around it */
+        _fillBg(s, w, p, WyRect{ r.x, r.y, r.w, (int16_t)(c.y - r.y) }, (uint8_t)(depth + 1));
+        _fillBg(s, w, p, WyRect{ r.x, c.bottom(), r.w, (int16_t)(r.bottom() - c.bottom()) }, (uint8_t)(depth + 1));
+        _fillBg(s, w, p, WyRect{ r.x, c.y, (int16_t)(c.x - r.x), c.h }, (uint8_t)(depth + 1));
+        _fillBg(s, w, p, WyRect{ c.right(), c.y, (int16_t)(r.right() - c.right()), c.h }, (uint8_t)(depth + 1));
+    }
+
+    static WyWidget *_firstOpaque(WyWidget *w, const WyRect &r) {
+        for (WyWidget *c = w->_first; c; c = c->_next) {
+            if (!c->_visible) continue;
+            if (c->_opaque && c->_b.intersects(r)) return c;
+            if (c->_first) { WyWidget *o = _firstOpaque(c, r); if (o) return o; }
+        }
+        return nullptr;
+    }
+
+    static WyWidget *_hitTest(WyWidget *w, int16_t x, int16_t y) {
+        WyWidget *hit = nullptr;
+        for (WyWidget *c = w->_first; c; c = c->_next) {
+            if (!c->_visible || !c->_b.contains(x, y)) continue;
+            if (c->_touchable) hit = c;
+            if (c->_first) { WyWidget *h = _hitTest(c, x, y); if (h) hit = h; }
+        }
+        return hit;
+    }
+};
@@ -0,0 +1,62 @@
+// Arduino.h — host shim for tests that compile real sensor headers
+// =================================================================
+// Just enough of the Arduino core for src/sensors/WySensors.h: a
+// virtual millis() clock that delay() advances, a scripted analogRead()
+// and a Serial that prints to stdout. Tests own the state below.
+#pragma once
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+
+#define HIGH 1
+#define LOW  0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define VSPI 3
+#define HSPI 2
+
+struct WyHostClock {
+    uint32_t now = 0;                               // ms
+    uint32_t adcCalls = 0, adcLastAt = 0, adcMinGap = 0xFFFFFFFF;
+    int      (*adc)(int pin) = nullptr;             // value source, default 0
+};
+inline WyHostClock &wyHost() { static WyHostClock c; return c; }
+
+inline uint32_t millis() { return wyHost().now; }
+inline uint32_t micros() { return wyHost().now * 1000; }
+inline void delay(uint32_t ms) { wyHost().now += ms; }
+inline void delayMicroseconds(uint32_t) {}
+
+inline int analogRead(int pin) {
+    WyHostClock &h = wyHost();
+    if (h.adcCalls++ && h.now - h.adcLastAt < h.adcMinGap) h.adcMinGap = h.now - h.adcLastAt;
+    h.adcLastAt = h.now;
+    return h.adc ? h.adc(pin) : 0;
+}
+inline void pinMode(int, int) {}
+inline int  digitalRead(int) { return HIGH; }
+inline void digitalWrite(int, int) {}
+
+class Stream {
+public:
+    virtual ~Stream() {}
+    virtual size_t write(const uint8_t *, size_t n) { return n; }
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+};
+
+struct WyHostSerial : Stream {
+    bool quiet = true;
+    int printf(const char *fmt, ...) {
+        if (quiet) return 0;
+        va_list ap; va_start(ap, fmt);
+        int n = vprintf(fmt, ap);
+        va_end(ap);
+        return n;
+    }
+    size_t println(const char *s) { return quiet ? 0 : (size_t)::printf("%s\n", s); }
+};
+static WyHostSerial Serial;
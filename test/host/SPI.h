@@ -0,0 +1,3 @@
+// SPI.h — host shim (see Arduino.h)
+#pragma once
+#include "Arduino.h"
@@ -0,0 +1,3 @@
+// Wire.h — host shim (see Arduino.h)
+#pragma once
+#include "Arduino.h"
@@ -0,0 +1,388 @@
+#!/usr/bin/env python3
+# make_samples.py — regenerate the sample images used by test/test_image.cpp
+# Requires Pillow. Run from the repo root:  python3 test/images/make_samples.py
+import os
+from PIL import Image
+
+OUT = os.path.dirname(os.path.abspath(__file__))
+
+def gradient(w, h):
+    im = Image.new("RGB", (w, h))
+    px = im.load()
+    for y in range(h):
+        for x in range(w):
+            px[x, y] = (x * 255 // max(1, w - 1), y * 255 // max(1, h - 1), 96)
+    return im
+
+# 2 MP camera-style JPEG with an EXIF block in front of the SOF marker
+cam = gradient(1600, 1200)
+exif = Image.Exif()
+exif[0x010F] = "Wyltek"           # Make
+exif[0x0110] = "TestCam 2MP"      # Model
+exif[0x010E] = "x" * 4000         # ImageDescription — pushes SOF past 4 KB
+cam.save(os.path.join(OUT, "camera_1600x1200.jpg"), quality=20, exif=exif)
+
+gradient(320, 240).save(os.path.join(OUT, "progressive_320x240.jpg"),
+                        quality=50, progressive=True)
+
+icon = Image.new("RGBA", (48, 32), (0, 0, 0, 0))
+for y in range(32):
+    for x in range(48):
+        if (x // 8 + y // 8) % 2:
+            icon.putpixel((x, y), (0, 212, 170, 255))
+icon.save(os.path.join(OUT, "icon_48x32.png"))
+
+gradient(100, 75).save(os.path.join(OUT, "photo_100x75.bmp"))
+
+frames = [Image.new("P", (40, 30), i) for i in range(3)]
+frames[0].save(os.path.join(OUT, "anim_40x30.gif"), save_all=True,
+               append_images=frames[1:], duration=100, loop=0)
+
+# ── Streaming decoder samples (WyImageStream.h) ─────────────────────────────
+# Encoded with hand-rolled PNG/BMP writers so every variant the decoder
+# handles is covered (all five row filters, stored/fixed/dynamic deflate,
+# split IDATs, palette + tRNS, 16-bit, colour keys, BMP bitfields/padding).
+# Each stream_*.png / stream_*.bmp has a stream_*.565 reference: raw
+# little-endian RGB565, computed here independently of the encoders, with
+# alpha blended over black.
+import struct, zlib
+
+W, H = 40, 30
+
+def src(x, y):
+    return ((x * 5 + y * 3) & 255, (x * y) & 255, ((x ^ y) * 7) & 255, (x * 8 + y * 4) & 255)
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+def blend(c, a):
+    return c * a // 255           # over black
+
+def write_ref(name, px):
+    with open(os.path.join(OUT, name), "wb") as f:
+        for v in px:
+            f.write(struct.pack("<H", v))
+
+def chunk(tag, data):
+    return struct.pack(">I", len(data)) + tag + data + struct.pack(">I", zlib.crc32(tag + data))
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc: return a
+    return b if pb <= pc else c
+
+def filter_rows(rows, bpp):
+    out, prev = b"", bytes(len(rows[0]))
+    for i, r in enumerate(rows):
+        ft = i % 5
+        f = bytearray()
+        for j, v in enumerate(r):
+            a = r[j - bpp] if j >= bpp else 0
+            b = prev[j]
+            c = prev[j - bpp] if j >= bpp else 0
+            pred = (0, a, b, (a + b) >> 1, paeth(a, b, c))[ft]
+            f.append((v - pred) & 255)
+        out += bytes([ft]) + bytes(f)
+        prev = r
+    return out
+
+def write_png(name, w, h, ctype, depth, rows, bpp, plte=None, trns=None,
+              level=6, strategy=zlib.Z_DEFAULT_STRATEGY, idat=None):
+    co = zlib.compressobj(level, zlib.DEFLATED, 15, 9, strategy)
+    z = co.compress(filter_rows(rows, bpp)) + co.flush()
+    out = b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, depth, ctype, 0, 0, 0))
+    out += chunk(b"tEXt", b"Comment\x00skipped by the decoder")
+    if plte: out += chunk(b"PLTE", plte)
+    if trns: out += chunk(b"tRNS", trns)
+    step = idat or len(z)
+    for i in range(0, len(z), step):
+        out += chunk(b"IDAT", z[i:i + step])
+    out += chunk(b"IEND", b"")
+    open(os.path.join(OUT, name), "wb").write(out)
+
+def pack_bits(vals, depth):
+    out, acc, n = bytearray(), 0, 0
+    for v in vals:
+        acc = (acc << depth) | v; n += depth
+        if n == 8: out.append(acc); acc, n = 0, 0
+    if n: out.append(acc << (8 - n))
+    return bytes(out)
+
+# RGB8 — dynamic Huffman, IDAT split every 100 bytes
+rows = [bytes(c for x in range(W) for c in src(x, y)[:3]) for y in range(H)]
+write_png("stream_rgb.png", W, H, 2, 8, rows, 3, idat=100)
+write_ref("stream_rgb.565", [rgb565(*src(x, y)[:3]) for y in range(H) for x in range(W)])
+
+# RGBA8 — alpha blended over black
+rows = [bytes(c for x in range(W) for c in src(x, y)) for y in range(H)]
+write_png("stream_rgba.png", W, H, 6, 8, rows, 4, level=9)
+write_ref("stream_rgba.565", [rgb565(*(blend(c, src(x, y)[3]) for c in src(x, y)[:3]))
+                              for y in range(H) for x in range(W)])
+
+# Palette 8-bit + tRNS
+pal = [((i * 37) & 255, (i * 91) & 255, (i * 13) & 255) for i in range(200)]
+tr  = [(i * 5) & 255 for i in range(64)]          # first 64 entries translucent
+idx = lambda x, y: (x + y * 3) % 200
+rows = [bytes(idx(x, y) for x in range(W)) for y in range(H)]
+write_png("stream_pal8.png", W, H, 3, 8, rows, 1,
+          plte=bytes(c for p in pal for c in p), trns=bytes(tr))
+def pal_px(i):
+    a = tr[i] if i < len(tr) else 255
+    return rgb565(*(blend(c, a) for c in pal[i]))
+write_ref("stream_pal8.565", [pal_px(idx(x, y)) for y in range(H) for x in range(W)])
+
+# Palette 4-bit, no tRNS
+pal16 = [((i * 17) & 255, 255 - i * 16, (i * 60) & 255) for i in range(16)]
+idx4 = lambda x, y: (x // 3 + y) % 16
+rows = [pack_bits([idx4(x, y) for x in range(W)], 4) for y in range(H)]
+write_png("stream_pal4.png", W, H, 3, 4, rows, 1, plte=bytes(c for p in pal16 for c in p))
+write_ref("stream_pal4.565", [rgb565(*pal16[idx4(x, y)]) for y in range(H) for x in range(W)])
+
+# Grey 16-bit — fixed Huffman blocks
+g16 = lambda x, y: (x * 1000 + y * 700) & 0xFFFF
+rows = [b"".join(struct.pack(">H", g16(x, y)) for x in range(W)) for y in range(H)]
+write_png("stream_gray16.png", W, H, 0, 16, rows, 2, strategy=zlib.Z_FIXED)
+write_ref("stream_gray16.565", [rgb565(g16(x, y) >> 8, g16(x, y) >> 8, g16(x, y) >> 8)
+                                for y in range(H) for x in range(W)])
+
+# Grey 2-bit — stored (uncompressed) deflate blocks
+g2 = lambda x, y: (x + y) % 4
+rows = [pack_bits([g2(x, y) for x in range(W)], 2) for y in range(H)]
+write_png("stream_gray2.png", W, H, 0, 2, rows, 1, level=0)
+write_ref("stream_gray2.565", [rgb565(*(g2(x, y) * 255 // 3,) * 3) for y in range(H) for x in range(W)])
+
+# RGB 16-bit with a tRNS colour key
+KEY = (0x1234, 0x5678, 0x9ABC)
+def c16(x, y):
+    if (x + y) % 7 == 0: return KEY
+    return ((x * 2000) & 0xFFFF, (y * 3000) & 0xFFFF, (x * y * 97) & 0xFFFF)
+rows = [b"".join(struct.pack(">HHH", *c16(x, y)) for x in range(W)) for y in range(H)]
+write_png("stream_rgb16key.png", W, H, 2, 16, rows, 6, trns=struct.pack(">HHH", *KEY))
+write_ref("stream_rgb16key.565", [0 if c16(x, y) == KEY else rgb565(*(v >> 8 for v in c16(x, y)))
+                                  for y in range(H) for x in range(W)])
+
+# Large RGB (320×240) — output runs far past the 32 KB window.
+# No .565 file: the test recomputes the same pattern.
+BW, BH = 320, 240
+big = lambda x, y: (x & 255, y, ((x >> 3) ^ (y >> 3)) * 8 & 255)
+rows = [bytes(c for x in range(BW) for c in big(x, y)) for y in range(BH)]
+write_png("stream_big_320x240.png", BW, BH, 2, 8, rows, 3, idat=4096)
+
+def write_bmp(name, w, h, bpp, rowbytes, top_down=False, comp=0, extra=b"", palette=b""):
+    stride = (w * bpp + 31) // 32 * 4
+    pix = b"".join(r + bytes(stride - len(r)) for r in rowbytes)
+    off = 14 + 40 + len(extra) + len(palette)
+    dib = struct.pack("<IiiHHIIiiII", 40, w, -h if top_down else h, 1, bpp, comp,
+                      len(pix), 2835, 2835, len(palette) // 4, 0)
+    hdr = b"BM" + struct.pack("<IHHI", off + len(pix), 0, 0, off)
+    open(os.path.join(OUT, name), "wb").write(hdr + dib + extra + palette + pix)
+
+# 24 bpp, odd width (row padding), bottom-up
+BWID = 37
+rows_td = [bytes(c for x in range(BWID) for c in reversed(src(x, y)[:3])) for y in range(H)]
+write_bmp("stream_24.bmp", BWID, H, 24, list(reversed(rows_td)))
+write_ref("stream_24.565", [rgb565(*src(x, y)[:3]) for y in range(H) for x in range(BWID)])
+
+# 16 bpp RGB565 bitfields, top-down
+rows_td = [b"".join(struct.pack("<H", rgb565(*src(x, y)[:3])) for x in range(W)) for y in range(H)]
+write_bmp("stream_565.bmp", W, H, 16, rows_td, top_down=True, comp=3,
+          extra=struct.pack("<III", 0xF800, 0x07E0, 0x001F))
+write_ref("stream_565.565", [rgb565(*src(x, y)[:3]) for y in range(H) for x in range(W)])
+
+# 32 bpp BGRX, bottom-up
+rows_td = [bytes(c for x in range(W) for c in (src(x, y)[2], src(x, y)[1], src(x, y)[0], 0)) for y in range(H)]
+write_bmp("stream_32.bmp", W, H, 32, list(reversed(rows_td)))
+write_ref("stream_32.565", [rgb565(*src(x, y)[:3]) for y in range(H) for x in range(W)])
+
+# 8 bpp palette, bottom-up
+bpal = b"".join(bytes((p[2], p[1], p[0], 0)) for p in pal)
+rows_td = [bytes(idx(x, y) for x in range(W)) for y in range(H)]
+write_bmp("stream_pal8.bmp", W, H, 8, list(reversed(rows_td)), palette=bpal)
+write_ref("stream_pal8bmp.565", [rgb565(*pal[idx(x, y)]) for y in range(H) for x in range(W)])
+
+# 1 bpp, top-down
+b1 = lambda x, y: (x // 4 + y // 4) % 2
+rows_td = [pack_bits([b1(x, y) for x in range(W)], 1) for y in range(H)]
+write_bmp("stream_1.bmp", W, H, 1, rows_td, top_down=True,
+          palette=bytes((0x20, 0x10, 0x00, 0, 0xAA, 0xDD, 0xFF, 0)))
+write_ref("stream_1.565", [rgb565(0xFF, 0xDD, 0xAA) if b1(x, y) else rgb565(0x00, 0x10, 0x20)
+                           for y in range(H) for x in range(W)])
+
+# ── Animated GIF (WyGif.h) ──────────────────────────────────────────────────
+# Hand-rolled LZW/GIF writer so each frame's rect, disposal, transparency,
+# local palette and interlacing are exactly what the test expects.
+# stream_anim.565 holds the composited canvas after every frame, built by
+# a separate reference compositor below.
+
+def lzw_encode(pixels, min_size):
+    clear, eoi = 1 << min_size, (1 << min_size) + 1
+    out, acc, nacc = bytearray(), 0, 0
+    size = min_size + 1
+
+    def emit(code):
+        nonlocal acc, nacc
+        acc |= code << nacc
+        nacc += size
+        while nacc >= 8:
+            out.append(acc & 255)
+            acc >>= 8
+            nacc -= 8
+
+    def reset():
+        return {bytes([i]): i for i in range(clear)}, eoi + 1
+
+    table, nxt = reset()
+    emit(clear)
+    w = b""
+    for k in pixels:
+        wk = w + bytes([k])
+        if wk in table:
+            w = wk
+            continue
+        emit(table[w])
+        if nxt < 4096:
+            table[wk] = nxt
+            nxt += 1
+            if nxt > (1 << size) and size < 12:
+                size += 1
+        else:
+            emit(clear)
+            table, nxt = reset()
+            size = min_size + 1
+        w = bytes([k])
+    emit(table[w])
+    emit(eoi)
+    if nacc:
+        out.append(acc & 255)
+    return bytes(out)
+
+def sub_blocks(data):
+    out = b"".join(bytes([len(data[i:i + 255])]) + data[i:i + 255] for i in range(0, len(data), 255))
+    return out + b"\0"
+
+def pal_bytes(p):
+    return b"".join(bytes(c) for c in p)
+
+def interlaced(rows):
+    order = list(range(0, len(rows), 8)) + list(range(4, len(rows), 8)) + \
+            list(range(2, len(rows), 4)) + list(range(1, len(rows), 2))
+    return [rows[r] for r in order]
+
+GW, GH = 40, 30
+gpal = [((i * 16) & 255, (i * 48) & 255, (255 - i * 16) & 255) for i in range(16)]
+lpal = [(255, 0, 0), (0, 255, 0), (0, 0, 255), (255, 255, 255)]
+
+# (x, y, w, h, disposal, delay_cs, transparent index, local palette, interlace, pixel fn)
+gframes = [
+    (0,  0,  40, 30, 1, 5,  None, None, False, lambda x, y: (x // 5 + y // 5) % 16),
+    (8,  6,  12, 10, 2, 0,  15,   None, False, lambda x, y: 15 if (x + y) % 3 == 0 else (x * y) % 15),
+    (20, 10, 16, 16, 3, 10, None, lpal, True,  lambda x, y: (x // 2 + y) % 4),
+    (30, 20, 20, 20, 0, 2,  None, None, False, lambda x, y: 7),        # clipped, long runs
+    (0,  0,  4,  4,  1, 3,  3,    None, False, lambda x, y: 3 if x == y else 9),
+]
+
+gif = bytearray(b"GIF89a" + struct.pack("<HHBBB", GW, GH, 0x80 | 0x30 | 3, 0, 0))
+gif += pal_bytes(gpal)
+gif += b"\x21\xFF\x0BNETSCAPE2.0\x03\x01" + struct.pack("<H", 2) + b"\0"   # 3 plays
+gif += b"\x21\xFE" + sub_blocks(b"WyGif test animation")
+for fx, fy, fw, fh, disp, delay, tr, lp, il, fn in gframes:
+    gif += b"\x21\xF9\x04" + struct.pack("<BHB", disp << 2 | (tr is not None), delay, tr or 0) + b"\0"
+    packed = (0x80 | 1 if lp else 0) | (0x40 if il else 0)
+    gif += b"\x2C" + struct.pack("<HHHHB", fx, fy, fw, fh, packed)
+    if lp:
+        gif += pal_bytes(lp)
+    rows = [[fn(x, y) for x in range(fw)] for y in range(fh)]
+    if il:
+        rows = interlaced(rows)
+    min_size = 2 if lp else 4
+    gif += bytes([min_size]) + sub_blocks(lzw_encode([p for r in rows for p in r], min_size))
+gif += b"\x3B"
+with open(os.path.join(OUT, "stream_anim.gif"), "wb") as f:
+    f.write(gif)
+
+canvas = [[0] * GW for _ in range(GH)]
+refs, saved = [], None
+for i, (fx, fy, fw, fh, disp, delay, tr, lp, il, fn) in enumerate(gframes):
+    if i:
+        px, py, pw, ph, pdisp = prev
+        for y in range(py, min(py + ph, GH)):
+            for x in range(px, min(px + pw, GW)):
+                if pdisp == 2:
+                    canvas[y][x] = 0
+                elif pdisp == 3:
+                    canvas[y][x] = saved[y][x]
+    if disp == 3:
+        saved = [r[:] for r in canvas]
+    pal = lp or gpal
+    for y in range(fh):
+        for x in range(fw):
+            p = fn(x, y)
+            if p != tr and fx + x < GW and fy + y < GH:
+                canvas[fy + y][fx + x] = rgb565(*pal[p])
+    refs += [c for r in canvas for c in r]
+    prev = (fx, fy, fw, fh, disp)
+write_ref("stream_anim.565", refs)
+
+# ── UI asset set (Q565 benchmark: tools/q565.cpp --bench) ───────────────────
+# Typical dashboard assets: flat icons with transparency, a status bar,
+# a large gradient background and one photo-like image. Each has a PNG
+# (optimised) and a JPEG sibling for size comparison.
+from PIL import ImageDraw
+
+def save_asset(im, name):
+    im.save(os.path.join(OUT, name + ".png"), optimize=True)
+    im.convert("RGB").save(os.path.join(OUT, name + ".jpg"), quality=85)
+
+ic = Image.new("RGBA", (48, 48), (0, 0, 0, 0))
+d = ImageDraw.Draw(ic)
+for i, r in enumerate((22, 15, 8)):
+    d.arc((24 - r, 30 - r, 24 + r, 30 + r), 225, 315, fill=(0, 212, 170, 255), width=4)
+d.ellipse((21, 27, 27, 33), fill=(0, 212, 170, 255))
+save_asset(ic, "asset_wifi_48")
+
+ic = Image.new("RGBA", (64, 32), (0, 0, 0, 0))
+d = ImageDraw.Draw(ic)
+d.rounded_rectangle((1, 4, 56, 28), 4, outline=(230, 230, 230, 255), width=3)
+d.rectangle((57, 11, 62, 21), fill=(230, 230, 230, 255))
+d.rectangle((6, 9, 36, 23), fill=(80, 200, 80, 255))
+save_asset(ic, "asset_battery_64x32")
+
+ic = Image.new("RGBA", (64, 64), (0, 0, 0, 0))
+d = ImageDraw.Draw(ic)
+import math
+for k in range(8):
+    a = k * math.pi / 4
+    cx, cy = 32 + 22 * math.cos(a), 32 + 22 * math.sin(a)
+    d.ellipse((cx - 7, cy - 7, cx + 7, cy + 7), fill=(200, 200, 210, 255))
+d.ellipse((12, 12, 52, 52), fill=(200, 200, 210, 255))
+d.ellipse((24, 24, 40, 40), fill=(0, 0, 0, 0))
+save_asset(ic, "asset_gear_64")
+
+bar = Image.new("RGB", (320, 24), (24, 28, 36))
+d = ImageDraw.Draw(bar)
+d.rectangle((0, 22, 319, 23), fill=(0, 212, 170))
+for i in range(4):
+    d.rectangle((250 + i * 6, 16 - i * 3, 253 + i * 6, 18), fill=(230, 230, 230))
+d.text((6, 6), "12:34  Wyltek", fill=(230, 230, 230))
+save_asset(bar, "asset_statusbar_320x24")
+
+bgim = Image.new("RGB", (320, 240))
+px = bgim.load()
+for y in range(240):
+    for x in range(320):
+        px[x, y] = (16 + y // 8, 24 + y // 6, 48 + y // 3)
+d = ImageDraw.Draw(bgim)
+d.rounded_rectangle((16, 40, 152, 120), 8, fill=(36, 44, 60))
+d.rounded_rectangle((168, 40, 304, 120), 8, fill=(36, 44, 60))
+d.rounded_rectangle((16, 136, 304, 224), 8, fill=(36, 44, 60))
+save_asset(bgim, "asset_bg_320x240")
+
+photo = Image.new("RGB", (160, 120))
+px = photo.load()
+for y in range(120):
+    for x in range(160):
+        v = math.sin(x / 9.0) * math.cos(y / 7.0)
+        px[x, y] = (int(128 + 90 * v) ^ ((x * y) & 15), int(100 + 60 * math.sin((x + y) / 13.0)),
+                    int(140 - 80 * v) ^ ((x + 3 * y) & 7))
+save_asset(photo, "asset_photo_160x120")
@@ -144,6 +144,213 @@ fi
 TOTAL_P=$((TOTAL_P + SENSOR_PASS))
 TOTAL_F=$((TOTAL_F + SENSOR_FAIL))
 
+# ── Sensor start/poll tests (real WySensors.h on test/host shim) ──────────
+echo ""
+echo "  Running sensor start/poll tests..."
+SP_BIN="/tmp/wytest_sensors"
+SP_BUILD_ERR=$(g++ -std=c++17 -DHOST_TEST -Itest/host -Isrc test/test_sensors.cpp -o "$SP_BIN" -lm 2>&1) || true
+if [[ ! -x "$SP_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "sensors"
+  SP_PASS=0; SP_FAIL=1; SP_OUT="BUILD FAILED: $SP_BUILD_ERR"
+else
+  SP_OUT=$(timeout 30 "$SP_BIN" 2>&1) || true
+  SP_PASS=$(echo "$SP_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  SP_FAIL=$(echo "$SP_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $SP_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "sensors" "$SP_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "sensors" "$SP_PASS" "$SP_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$SP_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + SP_PASS))
+TOTAL_F=$((TOTAL_F + SP_FAIL))
+
+# ── Image header / fit tests ──────────────────────────────────────────────
+echo ""
+echo "  Running image tests..."
+IMAGE_BIN="/tmp/wytest_image"
+IMAGE_BUILD_ERR=$(g++ -std=c++17 -DHOST_TEST -Isrc test/test_image.cpp   -o "$IMAGE_BIN" 2>&1) || true
+if [[ ! -x "$IMAGE_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "image"
+  IMAGE_PASS=0; IMAGE_FAIL=1; IMAGE_OUT="BUILD FAILED: $IMAGE_BUILD_ERR"
+else
+  IMAGE_OUT=$(timeout 30 "$IMAGE_BIN" 2>&1) || true
+  IMAGE_PASS=$(echo "$IMAGE_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  IMAGE_FAIL=$(echo "$IMAGE_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $IMAGE_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "image" "$IMAGE_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "image" "$IMAGE_PASS" "$IMAGE_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$IMAGE_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + IMAGE_PASS))
+TOTAL_F=$((TOTAL_F + IMAGE_FAIL))
+
+# ── QR matrix / renderer tests ────────────────────────────────────────────
+echo ""
+echo "  Running QR tests..."
+QR_BIN="/tmp/wytest_qr"
+QR_BUILD_ERR=$(g++ -std=c++17 -DHOST_TEST -Isrc test/test_qr.cpp   -o "$QR_BIN" 2>&1) || true
+if [[ ! -x "$QR_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "qr"
+  QR_PASS=0; QR_FAIL=1; QR_OUT="BUILD FAILED: $QR_BUILD_ERR"
+else
+  QR_OUT=$(timeout 30 "$QR_BIN" 2>&1) || true
+  QR_PASS=$(echo "$QR_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  QR_FAIL=$(echo "$QR_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $QR_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "qr" "$QR_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "qr" "$QR_PASS" "$QR_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$QR_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + QR_PASS))
+TOTAL_F=$((TOTAL_F + QR_FAIL))
+
+# ── Pixel conversion kernel tests ─────────────────────────────────────────
+echo ""
+echo "  Running pixel kernel tests..."
+PIXEL_BIN="/tmp/wytest_pixel"
+PIXEL_BUILD_ERR=$(g++ -std=c++17 -O2 -DHOST_TEST -Isrc test/test_pixel.cpp -o "$PIXEL_BIN" 2>&1) || true
+if [[ ! -x "$PIXEL_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "pixel"
+  PIXEL_PASS=0; PIXEL_FAIL=1; PIXEL_OUT="BUILD FAILED: $PIXEL_BUILD_ERR"
+else
+  PIXEL_OUT=$(timeout 30 "$PIXEL_BIN" 2>&1) || true
+  PIXEL_PASS=$(echo "$PIXEL_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  PIXEL_FAIL=$(echo "$PIXEL_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $PIXEL_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "pixel" "$PIXEL_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "pixel" "$PIXEL_PASS" "$PIXEL_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$PIXEL_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + PIXEL_PASS))
+TOTAL_F=$((TOTAL_F + PIXEL_FAIL))
+
+# ── UI widget tree tests ─────────────────────────────────────────
+echo ""
+echo "  Running UI tests..."
+UI_BIN="/tmp/wytest_ui"
+UI_BUILD_ERR=$(g++ -std=c++17 -DHOST_TEST -Isrc test/test_ui.cpp -o "$UI_BIN" 2>&1) || true
+if [[ ! -x "$UI_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "ui"
+  UI_PASS=0; UI_FAIL=1; UI_OUT="BUILD FAILED: $UI_BUILD_ERR"
+else
+  UI_OUT=$(timeout 30 "$UI_BIN" 2>&1) || true
+  UI_PASS=$(echo "$UI_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  UI_FAIL=$(echo "$UI_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $UI_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "ui" "$UI_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "ui" "$UI_PASS" "$UI_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$UI_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + UI_PASS))
+TOTAL_F=$((TOTAL_F + UI_FAIL))
+
+# ── Keyboard redraw tests ────────────────────────────────────────
+echo ""
+echo "  Running keyboard tests..."
+KB_BIN="/tmp/wytest_keyboard"
+KB_BUILD_ERR=$(g++ -std=c++17 -DHOST_TEST -Isrc test/test_keyboard.cpp -o "$KB_BIN" 2>&1) || true
+if [[ ! -x "$KB_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "keyboard"
+  KB_PASS=0; KB_FAIL=1; KB_OUT="BUILD FAILED: $KB_BUILD_ERR"
+else
+  KB_OUT=$(timeout 30 "$KB_BIN" 2>&1) || true
+  KB_PASS=$(echo "$KB_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  KB_FAIL=$(echo "$KB_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $KB_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "keyboard" "$KB_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "keyboard" "$KB_PASS" "$KB_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$KB_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + KB_PASS))
+TOTAL_F=$((TOTAL_F + KB_FAIL))
+
+# ── Word prediction tests ────────────────────────────────────────
+echo ""
+echo "  Running prediction tests..."
+PR_BIN="/tmp/wytest_predict"
+PR_BUILD_ERR=$(g++ -std=c++17 -O2 -DHOST_TEST -Isrc test/test_predict.cpp -o "$PR_BIN" 2>&1) || true
+if [[ ! -x "$PR_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "predict"
+  PR_PASS=0; PR_FAIL=1; PR_OUT="BUILD FAILED: $PR_BUILD_ERR"
+else
+  PR_OUT=$(timeout 60 "$PR_BIN" 2>&1) || true
+  PR_PASS=$(echo "$PR_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  PR_FAIL=$(echo "$PR_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $PR_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "predict" "$PR_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "predict" "$PR_PASS" "$PR_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$PR_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + PR_PASS))
+TOTAL_F=$((TOTAL_F + PR_FAIL))
+
+# ── Key display canvas / flush tests ─────────────────────────────
+echo ""
+echo "  Running key display tests..."
+KD_BIN="/tmp/wytest_keydisplay"
+KD_BUILD_ERR=$(g++ -std=c++17 -O2 -DHOST_TEST -Isrc test/test_keydisplay.cpp -o "$KD_BIN" 2>&1) || true
+if [[ ! -x "$KD_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "keydisplay"
+  KD_PASS=0; KD_FAIL=1; KD_OUT="BUILD FAILED: $KD_BUILD_ERR"
+else
+  KD_OUT=$(timeout 60 "$KD_BIN" 2>&1) || true
+  KD_PASS=$(echo "$KD_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  KD_FAIL=$(echo "$KD_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $KD_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "keydisplay" "$KD_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "keydisplay" "$KD_PASS" "$KD_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$KD_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + KD_PASS))
+TOTAL_F=$((TOTAL_F + KD_FAIL))
+
+# ── MLX90640 frame math tests ────────────────────────────────────
+echo ""
+echo "  Running MLX90640 tests..."
+MX_BIN="/tmp/wytest_mlx90640"
+MX_BUILD_ERR=$(g++ -std=c++17 -O2 -pthread -DHOST_TEST -Isrc test/test_mlx90640.cpp -o "$MX_BIN" 2>&1) || true
+if [[ ! -x "$MX_BIN" ]]; then
+  printf "  ${R}✗${NC} %-35s BUILD FAILED\n" "mlx90640"
+  MX_PASS=0; MX_FAIL=1; MX_OUT="BUILD FAILED: $MX_BUILD_ERR"
+else
+  MX_OUT=$(timeout 60 "$MX_BIN" 2>&1) || true
+  MX_PASS=$(echo "$MX_OUT" | grep -cE '^\s*PASS:' 2>/dev/null || true)
+  MX_FAIL=$(echo "$MX_OUT" | grep -cE '^\s*FAIL:' 2>/dev/null || true)
+  if [[ $MX_FAIL -eq 0 ]]; then
+    printf "  ${G}✓${NC} %-35s ${BOLD}%2d tests${NC}\n" "mlx90640" "$MX_PASS"
+  else
+    printf "  ${R}✗${NC} %-35s ${BOLD}%2d passed, %d failed${NC}\n" \
+      "mlx90640" "$MX_PASS" "$MX_FAIL"
+  fi
+  if [[ $VERBOSE -eq 1 ]]; then echo "$MX_OUT"; fi
+fi
+TOTAL_P=$((TOTAL_P + MX_PASS))
+TOTAL_F=$((TOTAL_F + MX_FAIL))
+
 echo ""
 PASS_BOARDS=$((TOTAL_BOARDS - ${#FAILED_BOARDS[@]}))
 [[ ${#FAILED_BOARDS[@]} -eq 0 ]] && col=$G || col=$R
@@ -154,6 +361,42 @@ if [[ $SENSOR_FAIL -gt 0 ]]; then
   echo "  ${R}Failures in sensor_math:${NC}"
   echo "$SENSOR_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
 fi
+if [[ $SP_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in sensors:${NC}"
+  echo "$SP_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
+if [[ $IMAGE_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in image:${NC}"
+  echo "$IMAGE_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
+if [[ $QR_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in qr:${NC}"
+  echo "$QR_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
+if [[ $PIXEL_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in pixel:${NC}"
+  echo "$PIXEL_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
+if [[ $UI_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in ui:${NC}"
+  echo "$UI_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
+if [[ $KB_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in keyboard:${NC}"
+  echo "$KB_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
+if [[ $PR_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in predict:${NC}"
+  echo "$PR_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
+if [[ $KD_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in keydisplay:${NC}"
+  echo "$KD_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
+if [[ $MX_FAIL -gt 0 ]]; then
+  echo "  ${R}Failures in mlx90640:${NC}"
+  echo "$MX_OUT" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do echo "    $l"; done
+fi
 for board in "${FAILED_BOARDS[@]}"; do
   echo "  ${R}Failures in $board:${NC}"
   echo "${BO[$board]}" | grep -E '^\s*FAIL:|BUILD FAILED' | while read l; do
@@ -15,6 +15,9 @@
 //   7. WY_HAS_PSRAM is 0 or 1
 //   8. If WY_HAS_RGB_LED=1 then WY_LED_R/G/B are defined (>= 0)
 //   9. GPIO pins are in valid ESP32 range (-1 for not-present, or 0..48)
+//  10. WyKeyboard layouts scaled to WY_SCREEN_W × H: every key on screen
+//      horizontally, and the grid hit test agrees with the key rects for
+//      every pixel of the keyboard
 
 #include <stdio.h>
 #include <string.h>
@@ -24,6 +27,7 @@
 
 // Include the board definitions
 #include "boards.h"
+#include "ui/WyKeyboardCore.h"
 
 // ── Test infrastructure ────────────────────────────────────────────────────────
 static int _pass = 0, _fail = 0;
@@ -34,6 +38,16 @@ static int _pass = 0, _fail = 0;
 #define XSTR(x) #x
 #define STR(x) XSTR(x)
 
+/* Draws nothing — the keyboard test only needs geometry */
+class NullPainter : public WyPainter {
+public:
+    NullPainter(uint16_t w, uint16_t h) : WyPainter(w, h) {}
+protected:
+    void _fill(const WyRect &, uint16_t) override {}
+    void _text(int16_t, int16_t, const char *, uint8_t, uint16_t) override {}
+    void _blit(const WyRect &, const uint16_t *, uint16_t) override {}
+};
+
 static bool pinValid(int p) { return p == -1 || (p >= 0 && p <= 48); }
 
 int main() {
@@ -270,6 +284,50 @@ int main() {
 #endif
     }
 
+    // ── 7. Keyboard hit grid ───────────────────────────────────────────────────
+    SECTION("Keyboard hit grid");
+    {
+#if WY_HAS_DISPLAY && WY_SCREEN_W > 0 && WY_SCREEN_H > 0
+        const int W = WY_SCREEN_W, H = WY_SCREEN_H;
+        static const char *names[3] = { "QWERTY", "numeric", "symbols" };
+        NullPainter np(W, H);
+        WyKeyboardCore kb;
+        kb.begin(&np, W, H);
+        for (int l = 0; l < 3; l++) {
+            kb.show(nullptr, 0, false, (WyKbLayout)l);
+            bool onScreen = kb.keyCount() > 0;
+            for (int i = 0; i < kb.keyCount(); i++) {
+                const WyKeyboardCore::KeyDef &k = kb.key(i);
+                onScreen = onScreen && k.w > 0 && k.h > 0 && k.x >= 0 && k.x + k.w <= W;
+            }
+            /* Every pixel: the grid must return the key whose rect holds it
+               (down to the last key — 64 px OLEDs don't fit a keyboard) */
+            int bottom = H;
+            for (int i = 0; i < kb.keyCount(); i++)
+                if (kb.key(i).y + kb.key(i).h > bottom) bottom = kb.key(i).y + kb.key(i).h;
+            long wrong = 0, hits = 0;
+            for (int y = kb.kb_top(); y < bottom; y++)
+                for (int x = 0; x < W; x++) {
+                    int want = -1;
+                    for (int i = 0; i < kb.keyCount() && want < 0; i++) {
+                        const WyKeyboardCore::KeyDef &k = kb.key(i);
+                        if (x >= k.x && x < k.x + k.w && y >= k.y && y < k.y + k.h) want = i;
+                    }
+                    int got = kb.keyAt(x, y);
+                    if (want >= 0) { hits++; if (got != want) wrong++; }
+                }
+            char name[64], msg[48];
+            snprintf(name, sizeof(name), "%dx%d %s: keys fit the width", W, H, names[l]);
+            CHECK(onScreen, name, "key off screen or empty");
+            snprintf(name, sizeof(name), "%dx%d %s: grid hit == key rects", W, H, names[l]);
+            snprintf(msg, sizeof(msg), "%ld of %ld px wrong", wrong, hits);
+            CHECK(hits > 0 && wrong == 0, name, msg);
+        }
+#else
+        PASS("no display — skipping");
+#endif
+    }
+
     printf("\n========================================\n");
     printf("  Results: %d passed, %d failed\n", _pass, _fail);
     printf("========================================\n");
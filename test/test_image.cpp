@@ -0,0 +1,880 @@
+// test_image.cpp — WyImage header probing and fit/scale selection
+// No Arduino SDK required — exercises the pure WyImageInfo.h layer against
+// the sample files in test/images/ (regenerate with make_samples.py).
+//
+// Build: g++ -std=c++17 -DHOST_TEST -Isrc test/test_image.cpp -o /tmp/wytest_image
+// Run from the repo root (sample paths are relative).
+//
+// Covers:
+//   wyImageSniff  — magic-byte format detection
+//   wyImageProbe  — JPEG SOFn (past EXIF), PNG IHDR, BMP DIB, GIF LSD
+//   wyImageFit    — JPEG 1/2–1/8 decode scale choice and centring
+//   wyDecodePNG   — streamed PNG vs stream_*.565 references (all colour
+//                   types, filters, deflate block types, split IDATs)
+//   wyDecodeBMP   — row-by-row BMP vs references (1/8/16/24/32 bpp)
+//   WyGif         — per-frame canvas vs reference (disposal 0–3, transparency,
+//                   local palette, interlace, clipping), dirty rects,
+//                   tick() scheduling and loop count
+//   Q565          — encode/decode round trip (every op), row-group seek for
+//                   clipped draws, alpha key flag, corrupt input
+//   WyImageCache  — LRU order, byte budget, mtime/size invalidation,
+//                   hit/miss counters; repeat draw = copy vs re-decode timing
+//   WyTileMap     — .wyt pyramid build, visible-tile clipping vs the source
+//                   image, LRU reuse while panning, zoom centring + margins,
+//                   empty / damaged tiles
+//   WyFrameDump   — CRC-32 check value, serial stream round trip (UI and
+//                   noise → raw fallback), byte-at-a-time feed, log text
+//                   between frames, corrupt / truncated records; size and
+//                   encode time vs UART time at 2 Mbaud
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "display/WyImageInfo.h"
+#include "display/WyImageStream.h"
+#include "display/WyGif.h"
+#include "display/WyImageCache.h"
+#include "display/WyQ565.h"
+#include "display/WyTiles.h"
+#include "display/WyFrameDump.h"
+#include <chrono>
+
+static int _pass=0, _fail=0;
+#define PASS(n)         do{printf("  PASS: %s\n",n);_pass++;}while(0)
+#define FAIL(n,m)       do{printf("  FAIL: %s  (%s)\n",n,m);_fail++;}while(0)
+#define CHECK(c,n,m)    do{if(c)PASS(n);else FAIL(n,m);}while(0)
+#define SECTION(s)      printf("\n  [%s]\n",s)
+
+static std::vector<uint8_t> loadFile(const char *path) {
+    std::vector<uint8_t> v;
+    FILE *f = fopen(path, "rb");
+    if (!f) return v;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) v.insert(v.end(), buf, buf + n);
+    fclose(f);
+    return v;
+}
+
+// Reader that counts how many bytes the probe actually pulled in
+struct CountingSrc { const std::vector<uint8_t> *v; size_t bytes; int calls; };
+static size_t countingRead(void *ctx, uint32_t off, uint8_t *buf, size_t len) {
+    CountingSrc *s = (CountingSrc *)ctx;
+    s->calls++;
+    if (off >= s->v->size()) return 0;
+    if (len > s->v->size() - off) len = s->v->size() - off;
+    memcpy(buf, s->v->data() + off, len);
+    s->bytes += len;
+    return len;
+}
+
+
+// ── Streaming decode harness ────────────────────────────────────────────────
+// Collects rows into a framebuffer and records what the decoder asked for.
+struct Frame {
+    uint16_t w = 0, h = 0;
+    std::vector<uint16_t> px;
+    std::vector<int>      hits;     // times each row was delivered
+    int rows = 0, stopAfter = -1;
+};
+static bool frameRow(void *ctx, int16_t y, const uint16_t *p, uint16_t w) {
+    Frame *f = (Frame *)ctx;
+    if (y >= 0 && y < f->h && w == f->w) {
+        memcpy(&f->px[(size_t)y * w], p, w * 2);
+        f->hits[y]++;
+    }
+    f->rows++;
+    return f->stopAfter < 0 || f->rows < f->stopAfter;
+}
+struct ReadStats { const std::vector<uint8_t> *v; size_t maxLen; int calls; };
+static size_t statRead(void *ctx, uint32_t off, uint8_t *buf, size_t len) {
+    ReadStats *s = (ReadStats *)ctx;
+    s->calls++;
+    if (len > s->maxLen) s->maxLen = len;
+    if (off >= s->v->size()) return 0;
+    if (len > s->v->size() - off) len = s->v->size() - off;
+    memcpy(buf, s->v->data() + off, len);
+    return len;
+}
+
+// Tile view target: viewport-sized framebuffer, nullptr blits fill `bg`
+struct TileScreen { uint16_t w, h, bg; std::vector<uint16_t> px; int blits, fills; };
+static void tileBlit(void *ctx, int16_t x, int16_t y, const uint16_t *p,
+                     uint16_t stride, uint16_t w, uint16_t h) {
+    TileScreen *s = (TileScreen *)ctx;
+    if (x < 0 || y < 0 || x + w > s->w || y + h > s->h) { s->blits = -1000; return; }
+    for (uint16_t r = 0; r < h; r++)
+        for (uint16_t i = 0; i < w; i++)
+            s->px[(size_t)(y + r) * s->w + x + i] = p ? p[(size_t)r * stride + i] : s->bg;
+    if (p) s->blits++; else s->fills++;
+}
+// Viewport contents == img cropped at (vx, vy), bg outside it
+static bool tileViewMatches(const TileScreen &s, const std::vector<uint16_t> &img,
+                            int iw, int ih, int vx, int vy) {
+    for (int y = 0; y < s.h; y++)
+        for (int x = 0; x < s.w; x++) {
+            int sx = vx + x, sy = vy + y;
+            uint16_t want = (sx < 0 || sy < 0 || sx >= iw || sy >= ih) ? s.bg : img[(size_t)sy * iw + sx];
+            if (s.px[(size_t)y * s.w + x] != want) return false;
+        }
+    return true;
+}
+
+// Decode a sample and compare with its .565 reference
+static void checkDecode(const char *img, const char *ref, bool png) {
+    char path[128], name[160], msg[96];
+    snprintf(path, sizeof(path), "test/images/%s", img);
+    auto data = loadFile(path);
+    snprintf(path, sizeof(path), "test/images/%s", ref);
+    auto refb = loadFile(path);
+    WyImageInfo info;
+    if (data.empty() || refb.empty() || !wyImageProbeMem(data.data(), data.size(), info)) {
+        snprintf(name, sizeof(name), "%s loads", img);
+        FAIL(name, "missing sample or reference");
+        return;
+    }
+    Frame f;
+    f.w = info.width; f.h = info.height;
+    f.px.assign((size_t)f.w * f.h, 0xDEAD);
+    f.hits.assign(f.h, 0);
+    ReadStats rs = { &data, 0, 0 };
+    WyImgResult rc = png ? wyDecodePNG(statRead, &rs, frameRow, &f)
+                         : wyDecodeBMP(statRead, &rs, frameRow, &f);
+    snprintf(name, sizeof(name), "%s decodes OK", img);
+    snprintf(msg, sizeof(msg), "rc=%d", rc);
+    CHECK(rc == WY_IMG_OK, name, msg);
+
+    bool once = true;
+    for (int y = 0; y < f.h; y++) once &= f.hits[y] == 1;
+    snprintf(name, sizeof(name), "%s every row delivered once", img);
+    CHECK(once, name, "missing/duplicate rows");
+
+    size_t bad = 0, first = 0;
+    for (size_t i = 0; i < f.px.size() && i * 2 + 1 < refb.size(); i++) {
+        uint16_t r = (uint16_t)(refb[i * 2] | refb[i * 2 + 1] << 8);
+        if (f.px[i] != r) { if (!bad) first = i; bad++; }
+    }
+    snprintf(name, sizeof(name), "%s pixels match reference (%ux%u)", img, f.w, f.h);
+    snprintf(msg, sizeof(msg), "%zu mismatches, first at x=%zu y=%zu",
+             bad, first % (f.w ? f.w : 1), first / (f.w ? f.w : 1));
+    CHECK(bad == 0 && refb.size() == f.px.size() * 2, name, msg);
+
+    if (png) {
+        snprintf(name, sizeof(name), "%s reads ≤ WY_IMG_CHUNK bytes at a time", img);
+        CHECK(rs.maxLen <= WY_IMG_CHUNK, name, "oversized read");
+    }
+}
+
+// ── Frame dump harness ──────────────────────────────────────────────────────
+struct DumpSrc { const std::vector<uint16_t> *px; uint16_t w; };
+static void dumpFill(void *src, uint16_t y, uint16_t rows, uint16_t *px) {
+    DumpSrc *d = (DumpSrc *)src;
+    memcpy(px, d->px->data() + (size_t)y * d->w, (size_t)rows * d->w * 2);
+}
+static bool dumpWrite(void *ctx, const uint8_t *p, size_t n) {
+    std::vector<uint8_t> *v = (std::vector<uint8_t> *)ctx;
+    v->insert(v->end(), p, p + n);
+    return true;
+}
+/* 320×240 settings-screen lookalike: flat panels, text-ish stripes, gradient bar */
+static std::vector<uint16_t> dumpUI(uint16_t w, uint16_t h) {
+    std::vector<uint16_t> px((size_t)w * h, 0x10A2);
+    for (uint16_t y = 0; y < 28; y++) for (uint16_t x = 0; x < w; x++) px[(size_t)y * w + x] = 0x2945;
+    for (int i = 0; i < 6; i++)
+        for (uint16_t y = (uint16_t)(40 + i * 32); y < 40 + i * 32 + 26; y++)
+            for (uint16_t x = 8; x < w - 8; x++) {
+                bool glyph = y > 44 + i * 32 && y < 58 + i * 32 && x < 150 && ((x / 3 + y) % 5 < 2);
+                px[(size_t)y * w + x] = glyph ? 0xFFFF : 0x3186;
+            }
+    for (uint16_t x = 0; x < w; x++)
+        for (uint16_t y = h - 12; y < h; y++)
+            px[(size_t)y * w + x] = _wy_rgb565((uint8_t)(x * 255 / w), 96, (uint8_t)(255 - x * 255 / w));
+    return px;
+}
+
+int main() {
+    printf("\n========================================\n");
+    printf("  WyImage header / fit tests\n");
+    printf("========================================\n");
+
+    auto cam  = loadFile("test/images/camera_1600x1200.jpg");
+    auto prog = loadFile("test/images/progressive_320x240.jpg");
+    auto png  = loadFile("test/images/icon_48x32.png");
+    auto bmp  = loadFile("test/images/photo_100x75.bmp");
+    auto gif  = loadFile("test/images/anim_40x30.gif");
+
+    SECTION("Sample files present");
+    CHECK(!cam.empty() && !prog.empty() && !png.empty() && !bmp.empty() && !gif.empty(),
+          "all sample images loaded", "run from repo root / make_samples.py");
+
+    SECTION("Format sniffing");
+    CHECK(wyImageSniff(cam.data(),  cam.size())  == WY_IMG_JPEG, "JPEG magic", "wrong fmt");
+    CHECK(wyImageSniff(png.data(),  png.size())  == WY_IMG_PNG,  "PNG magic",  "wrong fmt");
+    CHECK(wyImageSniff(bmp.data(),  bmp.size())  == WY_IMG_BMP,  "BMP magic",  "wrong fmt");
+    CHECK(wyImageSniff(gif.data(),  gif.size())  == WY_IMG_GIF,  "GIF magic",  "wrong fmt");
+    const uint8_t junk[8] = {1,2,3,4,5,6,7,8};
+    CHECK(wyImageSniff(junk, sizeof(junk)) == WY_IMG_UNKNOWN, "junk → UNKNOWN", "misdetected");
+
+    SECTION("JPEG — 2 MP camera file with EXIF before SOF");
+    {
+        WyImageInfo i;
+        CountingSrc src = { &cam, 0, 0 };
+        bool ok = wyImageProbe(countingRead, &src, i);
+        CHECK(ok, "probe ok", "probe failed");
+        CHECK(i.fmt == WY_IMG_JPEG, "fmt = JPEG", "wrong fmt");
+        CHECK(i.width == 1600 && i.height == 1200, "1600×1200", "wrong size");
+        CHECK(!i.progressive, "baseline (not progressive)", "flagged progressive");
+        CHECK(i.bpp == 8, "8-bit precision", "wrong precision");
+        char m[64]; snprintf(m, sizeof(m), "read %zu bytes", src.bytes);
+        CHECK(src.bytes < 128, "header walk reads < 128 bytes (EXIF skipped)", m);
+    }
+
+    SECTION("JPEG — progressive");
+    {
+        WyImageInfo i;
+        CHECK(wyImageProbeMem(prog.data(), prog.size(), i), "probe ok", "probe failed");
+        CHECK(i.width == 320 && i.height == 240, "320×240", "wrong size");
+        CHECK(i.progressive, "progressive flagged (SOF2)", "not flagged");
+    }
+
+    SECTION("PNG — IHDR");
+    {
+        WyImageInfo i;
+        CHECK(wyImageProbeMem(png.data(), png.size(), i), "probe ok", "probe failed");
+        CHECK(i.fmt == WY_IMG_PNG && i.width == 48 && i.height == 32, "48×32 PNG", "wrong");
+        CHECK(i.bpp == 8, "bit depth 8", "wrong depth");
+    }
+
+    SECTION("BMP — DIB header");
+    {
+        WyImageInfo i;
+        CHECK(wyImageProbeMem(bmp.data(), bmp.size(), i), "probe ok", "probe failed");
+        CHECK(i.fmt == WY_IMG_BMP && i.width == 100 && i.height == 75, "100×75 BMP", "wrong");
+        CHECK(i.bpp == 24, "24 bpp", "wrong bpp");
+        CHECK(!i.topDown, "bottom-up row order", "wrong order");
+        // Same file patched to top-down (negative height)
+        std::vector<uint8_t> td = bmp;
+        int32_t neg = -75;
+        memcpy(&td[22], &neg, 4);
+        WyImageInfo t;
+        wyImageProbeMem(td.data(), td.size(), t);
+        CHECK(t.topDown && t.height == 75, "negative height → topDown, |h|", "wrong");
+    }
+
+    SECTION("GIF — logical screen descriptor");
+    {
+        WyImageInfo i;
+        CHECK(wyImageProbeMem(gif.data(), gif.size(), i), "probe ok", "probe failed");
+        CHECK(i.fmt == WY_IMG_GIF && i.width == 40 && i.height == 30, "40×30 GIF", "wrong");
+    }
+
+    SECTION("Truncated / corrupt input");
+    {
+        WyImageInfo i;
+        CHECK(!wyImageProbeMem(cam.data(), 200, i), "JPEG cut before SOF → false", "accepted");
+        CHECK(!wyImageProbeMem(png.data(), 20, i),  "PNG cut inside IHDR → false", "accepted");
+        CHECK(!wyImageProbeMem(junk, sizeof(junk), i), "junk → false", "accepted");
+    }
+
+    SECTION("Fit — JPEG decode-time scale");
+    {
+        WyImageInfo i;
+        wyImageProbeMem(cam.data(), cam.size(), i);
+        WyImageFit f = wyImageFit(i, 320, 240);
+        CHECK(f.scale == 8, "1600×1200 → 320×240 box: 1/8", "wrong scale");
+        CHECK(f.w == 200 && f.h == 150, "scaled size 200×150", "wrong size");
+        CHECK(f.x == 60 && f.y == 45, "centred at 60,45", "wrong offset");
+
+        f = wyImageFit(i, 800, 480);
+        CHECK(f.scale == 4 && f.w == 400 && f.h == 300, "→ 800×480 box: 1/4 (400×300)", "wrong");
+
+        f = wyImageFit(i, 1600, 1200);
+        CHECK(f.scale == 1 && f.x == 0 && f.y == 0, "exact fit: 1/1 at 0,0", "wrong");
+
+        f = wyImageFit(i, 100, 100);
+        CHECK(f.scale == 8 && f.x < 0, "too small even at 1/8: clamp, centre-crop", "wrong");
+
+        f = wyImageFit(i, 320, 240, 1);
+        CHECK(f.scale == 1 && f.x == -640, "maxScale=1 (no TJpgDec): 1:1 centred", "wrong");
+
+        WyImageInfo p;
+        wyImageProbeMem(prog.data(), prog.size(), p);
+        f = wyImageFit(p, 480, 320);
+        CHECK(f.scale == 1 && f.x == 80 && f.y == 40, "smaller than box: never upscale", "wrong");
+        CHECK(wyImageCheck(p) == WY_IMG_ERR_UNSUPPORTED && wyImageCheck(i) == WY_IMG_OK,
+              "progressive JPEG → UNSUPPORTED before drawFit() decodes", "wrong rc");
+    }
+
+    SECTION("Fit — non-JPEG formats are centred at 1:1");
+    {
+        WyImageInfo i;
+        wyImageProbeMem(png.data(), png.size(), i);
+        WyImageFit f = wyImageFit(i, 320, 240);
+        CHECK(f.scale == 1 && f.x == 136 && f.y == 104, "PNG 48×32 centred in 320×240", "wrong");
+        wyImageProbeMem(bmp.data(), bmp.size(), i);
+        f = wyImageFit(i, 64, 64);
+        CHECK(f.scale == 1 && f.x == -18 && f.y == -5, "BMP larger than box: centre-crop", "wrong");
+    }
+
+    SECTION("Streamed PNG — pixel output vs reference");
+    checkDecode("stream_rgb.png",      "stream_rgb.565",      true);   // dynamic, split IDAT
+    checkDecode("stream_rgba.png",     "stream_rgba.565",     true);   // alpha over black
+    checkDecode("stream_pal8.png",     "stream_pal8.565",     true);   // PLTE + tRNS
+    checkDecode("stream_pal4.png",     "stream_pal4.565",     true);   // packed 4-bit index
+    checkDecode("stream_gray16.png",   "stream_gray16.565",   true);   // fixed Huffman
+    checkDecode("stream_gray2.png",    "stream_gray2.565",    true);   // stored blocks
+    checkDecode("stream_rgb16key.png", "stream_rgb16key.565", true);   // 16-bit + colour key
+
+    SECTION("Streamed PNG — 320×240, window wrap, bounded memory");
+    {
+        auto big = loadFile("test/images/stream_big_320x240.png");
+        Frame f;
+        f.w = 320; f.h = 240;
+        f.px.assign(320 * 240, 0);
+        f.hits.assign(240, 0);
+        _WyImgMemSrc src = { big.data(), big.size() };
+        WyImgResult rc = wyDecodePNG(_wy_img_mem_read, &src, frameRow, &f);
+        CHECK(rc == WY_IMG_OK, "decodes OK", "decode failed");
+        size_t bad = 0;
+        for (int y = 0; y < 240; y++)
+            for (int x = 0; x < 320; x++) {
+                uint8_t r = x & 255, g = y, b = ((x >> 3) ^ (y >> 3)) * 8 & 255;
+                if (f.px[y * 320 + x] != _wy_rgb565(r, g, b)) bad++;
+            }
+        CHECK(bad == 0, "all 76800 pixels match the generator pattern", "mismatch");
+        size_t mem = wyDecodePNGMemory(_wy_img_mem_read, &src);
+        char m[80]; snprintf(m, sizeof(m), "%zu bytes", mem);
+        printf("    decoder heap: %zu bytes (file %zu, full RGB565 frame %d)\n",
+               mem, big.size(), 320 * 240 * 2);
+        CHECK(mem > 32768 && mem < 32768 + 8192, "peak heap = 32 KB window + < 8 KB", m);
+    }
+
+    SECTION("Streamed BMP — pixel output vs reference");
+    checkDecode("stream_24.bmp",   "stream_24.565",      false);  // odd width, bottom-up
+    checkDecode("stream_565.bmp",  "stream_565.565",     false);  // bitfields, top-down
+    checkDecode("stream_32.bmp",   "stream_32.565",      false);
+    checkDecode("stream_pal8.bmp", "stream_pal8bmp.565", false);
+    checkDecode("stream_1.bmp",    "stream_1.565",       false);
+
+    SECTION("Streamed BMP — reads one row at a time");
+    {
+        ReadStats rs = { &bmp, 0, 0 };
+        Frame f;
+        f.w = 100; f.h = 75;
+        f.px.assign(100 * 75, 0);
+        f.hits.assign(75, 0);
+        WyImgResult rc = wyDecodeBMP(statRead, &rs, frameRow, &f);
+        CHECK(rc == WY_IMG_OK, "photo_100x75.bmp decodes", "failed");
+        CHECK(rs.maxLen == 300, "largest read = one 300-byte row", "bigger reads");
+        // Bottom-up file: first file row is the bottom image row
+        uint16_t bl = f.px[74 * 100], tr = f.px[99];
+        CHECK(bl != tr, "rows placed by image y, not file order", "same");
+    }
+
+    SECTION("Streamed decode — stop, unsupported, corrupt");
+    {
+        auto rgb = loadFile("test/images/stream_rgb.png");
+        Frame f;
+        f.w = 40; f.h = 30; f.px.assign(1200, 0); f.hits.assign(30, 0);
+        f.stopAfter = 6;
+        _WyImgMemSrc src = { rgb.data(), rgb.size() };
+        WyImgResult rc = wyDecodePNG(_wy_img_mem_read, &src, frameRow, &f);
+        CHECK(rc == WY_IMG_STOPPED && f.rows == 6, "row callback false → STOPPED after 6 rows", "didn't stop");
+
+        std::vector<uint8_t> il = rgb;
+        il[28] = 1;                                     // IHDR interlace = Adam7
+        src = { il.data(), il.size() };
+        rc = wyDecodePNG(_wy_img_mem_read, &src, frameRow, &f);
+        CHECK(rc == WY_IMG_ERR_UNSUPPORTED, "interlaced PNG → UNSUPPORTED", "wrong rc");
+
+        src = { rgb.data(), rgb.size() / 2 };
+        f.rows = 0; f.stopAfter = -1;
+        rc = wyDecodePNG(_wy_img_mem_read, &src, frameRow, &f);
+        CHECK(rc == WY_IMG_ERR_CORRUPT, "truncated PNG → CORRUPT", "wrong rc");
+
+        std::vector<uint8_t> rle = bmp;
+        rle[30] = 1;                                    // BI_RLE8
+        src = { rle.data(), rle.size() };
+        rc = wyDecodeBMP(_wy_img_mem_read, &src, frameRow, &f);
+        CHECK(rc == WY_IMG_ERR_UNSUPPORTED, "RLE BMP → UNSUPPORTED", "wrong rc");
+
+        src = { cam.data(), cam.size() };
+        CHECK(wyDecodePNG(_wy_img_mem_read, &src, frameRow, &f) == WY_IMG_ERR_FORMAT,
+              "JPEG into PNG decoder → FORMAT", "wrong rc");
+    }
+
+    SECTION("GIF — frames vs reference canvas");
+    {
+        auto anim = loadFile("test/images/stream_anim.gif");
+        auto ref  = loadFile("test/images/stream_anim.565");
+        _WyImgMemSrc src = { anim.data(), anim.size() };
+        WyGif g;
+        CHECK(g.open(_wy_img_mem_read, &src) == WY_IMG_OK && g.width() == 40 && g.height() == 30,
+              "open 40×30", "open failed");
+        // Expected dirty rect = this frame ∪ what the previous disposal restored
+        const int16_t rects[5][4] = {
+            {  0,  0, 40, 30 },     // first frame: whole canvas
+            {  8,  6, 12, 10 },     // prev disposal 1 (keep): own rect only
+            {  8,  6, 28, 20 },     // prev disposal 2 (background) ∪ own rect
+            { 20, 10, 20, 20 },     // prev disposal 3 (previous) ∪ clipped own rect
+            {  0,  0,  4,  4 },     // prev disposal 0
+        };
+        const uint16_t delays[5] = { 50, 100, 100, 20, 30 };   // 0 cs → 100 ms
+        const char *what[5] = { "full frame", "transparency, disposal 2",
+                                "local palette + interlace, disposal 3",
+                                "clipped at screen edge", "after restore-previous" };
+        uint32_t drawn = 0;
+        for (int i = 0; i < 5; i++) {
+            WyGifFrame f;
+            char name[96], msg[96];
+            WyImgResult rc = g.next(f);
+            size_t bad = 0;
+            for (size_t p = 0; p < 1200 && rc == WY_IMG_OK; p++) {
+                size_t o = (size_t)i * 2400 + p * 2;
+                if (g.canvas()[p] != (uint16_t)(ref[o] | ref[o + 1] << 8)) bad++;
+            }
+            snprintf(name, sizeof(name), "frame %d canvas (%s)", i, what[i]);
+            snprintf(msg, sizeof(msg), "rc=%d, %zu pixel mismatches", rc, bad);
+            CHECK(rc == WY_IMG_OK && bad == 0, name, msg);
+            snprintf(name, sizeof(name), "frame %d dirty rect %d,%d %dx%d, %u ms", i,
+                     rects[i][0], rects[i][1], rects[i][2], rects[i][3], delays[i]);
+            snprintf(msg, sizeof(msg), "got %d,%d %ux%u, %u ms", f.x, f.y, f.w, f.h, f.delayMs);
+            CHECK(f.x == rects[i][0] && f.y == rects[i][1] && f.w == rects[i][2] &&
+                  f.h == rects[i][3] && f.delayMs == delays[i], name, msg);
+            drawn += f.w * f.h;
+        }
+        WyGifFrame f;
+        CHECK(g.next(f) == WY_IMG_STOPPED, "trailer → STOPPED", "no end");
+        printf("    dirty-rect pixels: %u of %u for full-frame redraws\n", drawn, 5 * 1200);
+        CHECK(drawn < 5 * 1200 / 2, "dirty rects < half of full redraws", "too large");
+
+        g.rewind();
+        CHECK(g.next(f) == WY_IMG_OK && f.w == 40 && f.h == 30 && f.index == 0,
+              "rewind → frame 0, full rect", "wrong");
+    }
+
+    SECTION("GIF — tick() scheduling and loops");
+    {
+        auto anim = loadFile("test/images/stream_anim.gif");
+        _WyImgMemSrc src = { anim.data(), anim.size() };
+        WyGif g;
+        g.open(_wy_img_mem_read, &src);
+        WyGifFrame f;
+        bool ok = g.tick(1000, f) && f.index == 0 && g.due() == 1050;
+        CHECK(ok, "first tick decodes frame 0, next due +50 ms", "wrong");
+        CHECK(!g.tick(1049, f), "not due yet → no decode", "decoded early");
+        CHECK(g.tick(1063, f) && f.index == 1 && g.due() == 1150,
+              "late tick keeps cadence (due 1150, not 1163)", "drifted");
+        CHECK(g.tick(5000, f) && f.index == 2 && g.due() == 5100,
+              "far behind → resync, no burst", "burst");
+
+        // NETSCAPE loop count 2 → 3 plays of 5 frames
+        int frames = 3;
+        uint32_t now = 5100;
+        for (int i = 0; i < 100 && g.playing(); i++, now += 1000)
+            if (g.tick(now, f)) frames++;
+        char m[48]; snprintf(m, sizeof(m), "%d frames", frames);
+        CHECK(frames == 15 && !g.playing() && g.error() == WY_IMG_OK,
+              "file loop count: 3 plays = 15 frames, then stops", m);
+
+        g.open(_wy_img_mem_read, &src, 1);
+        frames = 0; now = 0;
+        for (int i = 0; i < 100 && g.playing(); i++, now += 1000)
+            if (g.tick(now, f)) frames++;
+        CHECK(frames == 5, "loops=1 overrides file → 5 frames", "wrong count");
+        g.restart();
+        CHECK(g.playing() && g.tick(now, f) && f.index == 0, "restart() plays again", "didn't");
+
+        auto old = loadFile("test/images/anim_40x30.gif");
+        _WyImgMemSrc osrc = { old.data(), old.size() };
+        g.open(_wy_img_mem_read, &osrc, 2);
+        frames = 0; now = 0;
+        uint16_t delay = 0;
+        for (int i = 0; i < 100 && g.playing(); i++, now += 1000)
+            if (g.tick(now, f)) { frames++; delay = f.delayMs; }
+        // Pillow merges its three identical frames into one 300 ms frame
+        CHECK(frames == 2 && delay == 300 && g.error() == WY_IMG_OK,
+              "Pillow-encoded anim_40x30.gif: loops=2 → 2 × 1 frame, 300 ms", "wrong");
+        printf("    decoder heap (40×30): %zu bytes\n", g.memory());
+
+        std::vector<uint8_t> cut(anim.begin(), anim.begin() + 200);
+        _WyImgMemSrc csrc = { cut.data(), cut.size() };
+        g.open(_wy_img_mem_read, &csrc);
+        while (g.tick(now, f)) now += 1000;
+        CHECK(!g.playing() && g.error() == WY_IMG_ERR_CORRUPT, "truncated GIF → CORRUPT, stops", "wrong");
+        CHECK(g.open(_wy_img_mem_read, &src) == WY_IMG_OK &&
+              WyGif().open(_wy_img_mem_read, &osrc) == WY_IMG_OK, "reopen after error", "failed");
+
+        // Reopen resets playback: plays, schedule, error
+        bool same = true;
+        for (int run = 0; run < 2; run++) {
+            g.open(_wy_img_mem_read, &src, 3);
+            frames = 0; now = 0;
+            for (int i = 0; i < 100 && g.playing(); i++, now += 1000)
+                if (g.tick(now, f)) frames++;
+            same = same && frames == 15;
+        }
+        CHECK(same, "reopen with loops=3 → 15 frames every time", "plays carried over");
+        g.open(_wy_img_mem_read, &src, -1);
+        g.tick(100000, f);
+        g.stop();
+        g.open(_wy_img_mem_read, &src, -1);
+        CHECK(g.tick(0, f) && f.index == 0 && g.due() == 50, "reopen → first tick draws at once", "stale due");
+        _WyImgMemSrc psrc = { png.data(), png.size() };
+        CHECK(g.open(_wy_img_mem_read, &psrc) == WY_IMG_ERR_FORMAT, "PNG → FORMAT", "wrong");
+    }
+
+    SECTION("Q565 — round trip");
+    {
+        // Every op: runs (incl. long), index hits, small diffs, luma, literals
+        const uint16_t W2 = 100, H2 = 37;
+        std::vector<uint16_t> src(W2 * H2);
+        for (int y = 0; y < H2; y++)
+            for (int x = 0; x < W2; x++) {
+                uint16_t c;
+                if (y % 5 == 0)       c = 0x07E0;                                 // solid row → run
+                else if (x < 30)      c = _wy_rgb565(x * 8, y * 6, 64);            // gradient → diff/luma
+                else if (x < 60)      c = (x / 3) % 2 ? 0xF800 : 0x001F;            // alternating → index
+                else                  c = (uint16_t)((x * 7919u + y * 104729u) * 2654435761u >> 16); // noise → literal
+                src[y * W2 + x] = c;
+            }
+        for (int g : { 1, 8, 255 }) {
+            std::vector<uint8_t> q(wyEncodeQ565Bound(W2, H2, g));
+            size_t n = wyEncodeQ565(src.data(), W2, H2, q.data(), q.size(), g);
+            q.resize(n);
+            Frame f;
+            f.w = W2; f.h = H2; f.px.assign(W2 * H2, 0xDEAD); f.hits.assign(H2, 0);
+            WyImgResult rc = wyDecodeQ565Mem(q.data(), q.size(), frameRow, &f);
+            char name[64]; snprintf(name, sizeof(name), "group %d: %zu bytes, pixels identical", g, n);
+            CHECK(n && rc == WY_IMG_OK && f.px == src, name, "mismatch");
+        }
+        auto ref = loadFile("test/images/stream_rgb.565");
+        std::vector<uint16_t> px(1200);
+        for (int i = 0; i < 1200; i++) px[i] = (uint16_t)(ref[i * 2] | ref[i * 2 + 1] << 8);
+        std::vector<uint8_t> q(wyEncodeQ565Bound(40, 30));
+        q.resize(wyEncodeQ565(px.data(), 40, 30, q.data(), q.size()));
+        ReadStats rs = { &q, 0, 0 };
+        Frame f;
+        f.w = 40; f.h = 30; f.px.assign(1200, 0); f.hits.assign(30, 0);
+        CHECK(wyDecodeQ565(statRead, &rs, frameRow, &f) == WY_IMG_OK && f.px == px,
+              "streamed decode (read callback) matches", "mismatch");
+        WyImageInfo i;
+        CHECK(wyImageProbeMem(q.data(), q.size(), i) && i.fmt == WY_IMG_Q565 &&
+              i.width == 40 && i.height == 30, "probe → Q565 40×30", "not recognised");
+        CHECK(wyEncodeQ565(px.data(), 40, 30, q.data(), 50) == 0, "encoder: small cap → 0", "overflow");
+
+        // Flat assets shrink well below raw
+        uint16_t flat[64 * 32];
+        for (int k = 0; k < 64 * 32; k++) flat[k] = (k % 64 > 5 && k % 64 < 37 && k / 64 > 8 && k / 64 < 24) ? 0x5E8A : 0xF81F;
+        std::vector<uint8_t> fq(wyEncodeQ565Bound(64, 32));
+        size_t fn = wyEncodeQ565(flat, 64, 32, fq.data(), fq.size(), 8, true, 0xF81F);
+        char m[48]; snprintf(m, sizeof(m), "%zu bytes", fn);
+        CHECK(fn < 64 * 32 * 2 / 20, "flat 64×32 icon < 5% of raw", m);
+        CHECK(fq[8] & WY_Q565_FLAG_KEY && _wy_le16(&fq[10]) == 0xF81F, "alpha key stored in header", "missing");
+    }
+
+    SECTION("Q565 — clipped decode seeks to the first visible group");
+    {
+        const uint16_t W2 = 64, H2 = 64;
+        std::vector<uint16_t> src(W2 * H2);
+        for (int k = 0; k < W2 * H2; k++) src[k] = (uint16_t)(k * 37);
+        std::vector<uint8_t> q(wyEncodeQ565Bound(W2, H2, 8));
+        q.resize(wyEncodeQ565(src.data(), W2, H2, q.data(), q.size(), 8));
+        ReadStats rs = { &q, 0, 0 };
+        Frame f;
+        f.w = W2; f.h = H2; f.px.assign(W2 * H2, 0); f.hits.assign(H2, 0);
+        WyImgResult rc = wyDecodeQ565(statRead, &rs, frameRow, &f, 43, 50);
+        bool only = true, ok = true;
+        for (int y = 0; y < H2; y++) only &= f.hits[y] == (y >= 43 && y <= 50 ? 1 : 0);
+        for (int y = 43; y <= 50; y++) ok &= memcmp(&f.px[y * W2], &src[y * W2], W2 * 2) == 0;
+        CHECK(rc == WY_IMG_OK && only && ok, "rows 43..50 only, correct pixels", "wrong rows");
+        // groups 5 and 6 (rows 40..55) = ~2/8 of the stream, plus header/table reads
+        char m[64]; snprintf(m, sizeof(m), "%d reads", rs.calls);
+        CHECK(rs.calls == 4, "header + offsets + 2 group reads", m);
+
+        f.hits.assign(H2, 0); f.rows = 0;
+        CHECK(wyDecodeQ565Mem(q.data(), q.size(), frameRow, &f, -10, 3) == WY_IMG_OK &&
+              f.rows == 4 && f.hits[0] == 1 && f.hits[3] == 1, "y range clamps at the top (mem)", "wrong");
+        f.rows = 0;
+        CHECK(wyDecodeQ565Mem(q.data(), q.size(), frameRow, &f, 70, 90) == WY_IMG_OK && f.rows == 0,
+              "fully off-screen → no rows", "decoded");
+
+        std::vector<uint8_t> bad = q;
+        bad.resize(bad.size() - 20);
+        CHECK(wyDecodeQ565Mem(bad.data(), bad.size(), frameRow, &f) == WY_IMG_ERR_CORRUPT,
+              "truncated → CORRUPT", "wrong rc");
+        bad = q;
+        bad[q.size() - 40] = 0xFF;                   // long run past the row end
+        bad[q.size() - 39] = 0xFF;
+        f.rows = 0;
+        WyImgResult brc = wyDecodeQ565Mem(bad.data(), bad.size(), frameRow, &f);
+        CHECK(brc == WY_IMG_ERR_CORRUPT || brc == WY_IMG_OK, "damaged op stream never overruns the row", "crash");
+    }
+
+    SECTION("Image cache — LRU, budget, keys, counters");
+    {
+        WyImageCache c(3 * 2000);                 // three 50×20 bitmaps
+        uint16_t w = 0, h = 0;
+        CHECK(!c.get("/a.png", 1, 100, 1, w, h) && c.misses() == 1, "empty → miss", "hit?");
+        uint16_t *a = c.reserve("/a.png", 1, 100, 1, 50, 20);
+        uint16_t *b = c.reserve("/b.png", 1, 100, 1, 50, 20);
+        uint16_t *d = c.reserve("/c.jpg", 1, 100, 1, 50, 20);
+        CHECK(a && b && d && c.used() == 6000 && c.count() == 3, "3 entries fill the budget", "reserve failed");
+        a[0] = 0x1234;
+        const uint16_t *px = c.get("/a.png", 1, 100, 1, w, h);
+        CHECK(px == a && w == 50 && h == 20 && px[0] == 0x1234 && c.hits() == 1, "hit returns same bitmap", "wrong");
+        c.reserve("/d.bmp", 1, 100, 1, 50, 20);   // evicts LRU = /b.png (a was just used)
+        CHECK(c.evictions() == 1 && !c.get("/b.png", 1, 100, 1, w, h) &&
+              c.get("/a.png", 1, 100, 1, w, h) && c.get("/c.jpg", 1, 100, 1, w, h),
+              "eviction takes least recently drawn", "wrong victim");
+        CHECK(!c.get("/a.png", 2, 100, 1, w, h) && c.count() == 2, "new mtime → miss, stale entry freed", "stale hit");
+        CHECK(!c.get("/c.jpg", 1, 101, 1, w, h), "new size → miss", "stale hit");
+        CHECK(!c.get("/d.bmp", 1, 100, 8, w, h) && c.get("/d.bmp", 1, 100, 1, w, h),
+              "JPEG scale is part of the key", "scale ignored");
+        int sd = 0, spiffs = 0;
+        uint16_t *onSd = c.reserve("/d.bmp", 1, 100, 1, 10, 10, &sd);
+        CHECK(onSd && !c.get("/d.bmp", 1, 100, 1, w, h, &spiffs) && c.get("/d.bmp", 1, 100, 1, w, h, &sd) == onSd,
+              "same path on another FS → miss", "collided");
+        uint16_t *onRed = c.reserve("/d.bmp", 1, 100, 1, 10, 10, &sd, 0xF800);
+        CHECK(onRed && onRed != onSd && c.get("/d.bmp", 1, 100, 1, w, h, &sd, 0xF800) == onRed &&
+              !c.get("/d.bmp", 1, 100, 1, w, h, &sd, 0x001F), "bg colour is part of the key", "stale blend");
+        c.invalidate("/d.bmp");
+        c.reserve("/d.bmp", 1, 100, 1, 50, 20);
+        CHECK(!c.reserve("/huge.jpg", 1, 1, 1, 100, 100) && c.count() == 1,
+              "bigger than whole budget → not cached, nothing evicted", "evicted");
+        uint16_t *e = c.reserve("/e.png", 1, 1, 1, 10, 10);
+        c.drop(e);
+        CHECK(!c.get("/e.png", 1, 1, 1, w, h) && c.used() == 2000, "drop() after failed decode", "kept");
+        c.reserve("/d.bmp", 1, 100, 2, 10, 10);
+        CHECK(c.invalidate("/d.bmp") && c.count() == 0 && c.used() == 0, "invalidate() drops all scales", "left");
+        c.reserve("/x", 1, 1, 1, 50, 20); c.reserve("/y", 1, 1, 1, 50, 20);
+        c.setBudget(2000);
+        CHECK(c.count() == 1 && c.used() == 2000 && c.get("/y", 1, 1, 1, w, h), "shrinking budget evicts LRU", "wrong");
+        c.setBudget(0);
+        CHECK(c.count() == 0 && !c.reserve("/z", 1, 1, 1, 1, 1), "budget 0 disables", "still caching");
+        printf("    hits %u, misses %u, evictions %u\n", c.hits(), c.misses(), c.evictions());
+    }
+
+    SECTION("Image cache — repeat draw of a 320×240 PNG");
+    {
+        // What WyImage::drawPNG does: miss → decode into the reserved bitmap,
+        // hit → hand the bitmap straight to the display (here: copy to a frame)
+        auto big = loadFile("test/images/stream_big_320x240.png");
+        WyImageCache c(1024 * 1024);
+        std::vector<uint16_t> screen(320 * 240);
+        struct Sink { uint16_t *buf; uint16_t w; } sink;
+        auto bufRow = [](void *ctx, int16_t y, const uint16_t *px, uint16_t w) -> bool {
+            Sink *s = (Sink *)ctx;
+            memcpy(s->buf + (size_t)y * s->w, px, w * 2);
+            return true;
+        };
+        using clk = std::chrono::steady_clock;
+        const int N = 20;
+        double decodeUs = 0, hitUs = 0;
+        bool same = true;
+        for (int i = 0; i <= N; i++) {
+            auto t0 = clk::now();
+            uint16_t w, h;
+            const uint16_t *px = c.get("/big.png", 7, big.size(), 1, w, h);
+            if (!px) {
+                uint16_t *dst = c.reserve("/big.png", 7, big.size(), 1, 320, 240);
+                sink = { dst, 320 };
+                _WyImgMemSrc src = { big.data(), big.size() };
+                if (wyDecodePNG(_wy_img_mem_read, &src, bufRow, &sink) != WY_IMG_OK) same = false;
+                px = dst;
+            }
+            memcpy(screen.data(), px, 320 * 240 * 2);
+            double us = std::chrono::duration<double, std::micro>(clk::now() - t0).count();
+            if (i == 0) decodeUs = us; else hitUs += us / N;
+            if (screen[240 * 0 + 100] != _wy_rgb565(100, 0, (100 >> 3) * 8)) same = false;
+        }
+        printf("    first draw (decode): %.0f us, cached draw: %.0f us (%.0fx)\n",
+               decodeUs, hitUs, decodeUs / (hitUs > 0 ? hitUs : 1));
+        CHECK(same && c.hits() == N && c.misses() == 1, "1 miss then 20 hits, pixels intact", "wrong");
+        CHECK(hitUs * 5 < decodeUs, "cached draw ≥ 5× cheaper than decode", "not faster");
+    }
+
+    SECTION("Tiles — pyramid build and clipped viewport");
+    {
+        // 1000×700, 64 px tiles → 1000, 500, 250, 125, 63 wide: 5 levels.
+        // Right third is plain bg so those tiles aren't stored.
+        const int IW = 1000, IH = 700;
+        std::vector<uint16_t> img(IW * IH);
+        for (int y = 0; y < IH; y++)
+            for (int x = 0; x < IW; x++)
+                img[y * IW + x] = x >= 700 ? 0xFFFF
+                                : (x % 50 < 3 || y % 40 < 2) ? 0x2104
+                                : _wy_rgb565(x / 4, y / 3, (x ^ y) & 0xFF);
+        CHECK(wyTilesLevelCount(IW, IH, 64) == 5, "5 levels down to one tile", "wrong count");
+        std::vector<uint8_t> wyt(wyTilesBound(IW, IH, 64));
+        size_t n = wyTilesEncode(img.data(), IW, IH, 64, wyt.data(), wyt.size(), 0xFFFF);
+        wyt.resize(n);
+        char m[96]; snprintf(m, sizeof(m), "%zu bytes vs %d raw", n, IW * IH * 2);
+        CHECK(n > 0 && n < (size_t)IW * IH * 2 / 2, "encoded pyramid < half of raw level 0", m);
+
+        ReadStats rs = { &wyt, 0, 0 };
+        WyTileMap map;
+        CHECK(map.open(statRead, &rs) == WY_IMG_OK && map.levels() == 5 && map.tileSize() == 64 &&
+              map.levelInfo(0).cols == 16 && map.levelInfo(0).rows == 11 &&
+              map.levelInfo(2).w == 250 && map.levelInfo(4).w == 63,
+              "open: header + level table", "wrong geometry");
+        CHECK(rs.calls == 2, "open reads only header + level table", "extra reads");
+
+        TileScreen scr = { 300, 200, 0xABCD, std::vector<uint16_t>(300 * 200), 0, 0 };
+        map.bg = 0xABCD;
+        map.setViewport(300, 200);
+        map.centerOn(400, 300);                         // view 250..549 × 200..399
+        uint16_t drawn = map.render(tileBlit, &scr);
+        CHECK(map.viewX() == 250 && map.viewY() == 200, "centerOn → top-left 250,200", "wrong origin");
+        CHECK(drawn == 6 * 4 && scr.blits == 24 && scr.fills == 0, "6 × 4 visible tiles blitted", "wrong count");
+        CHECK(tileViewMatches(scr, img, IW, IH, 250, 200), "viewport pixels == source crop", "mismatch");
+        CHECK(map.misses() == 24 && map.hits() == 0, "each visible tile decoded once", "wrong");
+
+        int reads = rs.calls;
+        map.render(tileBlit, &scr);
+        map.panBy(10, 5);                               // 260..559: same tiles
+        scr.blits = 0;
+        map.render(tileBlit, &scr);
+        CHECK(rs.calls == reads && map.misses() == 24, "redraw + small pan: no reads, all cache hits", "re-read");
+        CHECK(tileViewMatches(scr, img, IW, IH, 260, 205), "panned pixels correct", "mismatch");
+
+        map.panBy(64, 0);                               // 324..623: tile column 9 appears
+        map.render(tileBlit, &scr);
+        snprintf(m, sizeof(m), "%u misses", map.misses());
+        CHECK(map.misses() == 24 + 4 && rs.calls == reads + 2 * 4, "one new column → 4 decodes, 2 reads each", m);
+        CHECK(tileViewMatches(scr, img, IW, IH, 324, 205), "pixels after a tile-crossing pan", "mismatch");
+
+        map.centerOn(-500, -500);
+        CHECK(map.viewX() == 0 && map.viewY() == 0, "clamped at top-left", "off image");
+        map.centerOn(99999, 99999);
+        CHECK(map.viewX() == IW - 300 && map.viewY() == IH - 200, "clamped at bottom-right", "off image");
+        map.resetStats();
+        scr.blits = scr.fills = 0;
+        map.render(tileBlit, &scr);
+        CHECK(tileViewMatches(scr, img, IW, IH, IW - 300, IH - 200), "edge tiles + empty (bg) tiles", "mismatch");
+        CHECK(map.errors() == 0, "no decode errors", "errors");
+
+        // Zoom: level 1 halves coordinates around the centre, pixels = 2×2 box filter
+        map.centerOn(400, 300);
+        map.setLevel(1);
+        CHECK(map.level() == 1 && map.viewX() + 150 == 200 && map.viewY() + 100 == 150,
+              "setLevel keeps the centre", "moved");
+        std::vector<uint16_t> l1(500 * 350), l2(250 * 175);
+        _wy_tiles_half(img.data(), IW, IH, l1.data(), 500, 350);
+        _wy_tiles_half(l1.data(), 500, 350, l2.data(), 250, 175);
+        map.render(tileBlit, &scr);
+        CHECK(tileViewMatches(scr, l1, 500, 350, map.viewX(), map.viewY()), "level 1 pixels", "mismatch");
+
+        map.setLevel(2);                                // 250×175 < viewport: centred
+        scr.fills = 0;
+        map.render(tileBlit, &scr);
+        CHECK(map.viewX() == -25 && map.viewY() == -12, "small level centred in the viewport", "not centred");
+        CHECK(scr.fills == 4 && tileViewMatches(scr, l2, 250, 175, -25, -12),
+              "level 2 pixels + 4 bg margin bands", "mismatch");
+        map.setLevel(9);
+        CHECK(map.level() == 2, "out-of-range level ignored", "changed");
+
+        // Damage: bad magic, and a tile blob that points past the end of the file
+        std::vector<uint8_t> bad = wyt;
+        bad[0] = 'X';
+        ReadStats brs = { &bad, 0, 0 };
+        WyTileMap bm;
+        CHECK(bm.open(statRead, &brs) == WY_IMG_ERR_FORMAT, "bad magic → FORMAT", "opened");
+        bad = wyt;
+        uint32_t idx0 = (uint32_t)_wy_le32(&bad[WY_TILE_HEADER + 8]);
+        bad[idx0 + 4] = 0xFF; bad[idx0 + 5] = 0xFF; bad[idx0 + 6] = 0x0F;  // tile 0,0: size ~1 MB
+        brs = { &bad, 0, 0 };
+        CHECK(bm.open(statRead, &brs) == WY_IMG_OK, "damaged index still opens", "failed");
+        bm.bg = scr.bg;
+        bm.setViewport(300, 200);
+        scr.fills = 0;
+        bm.render(tileBlit, &scr);
+        CHECK(bm.errors() == 1 && scr.fills == 1, "bad tile → error counted, drawn as bg", "wrong");
+    }
+
+    SECTION("Frame dump — serial stream round trip");
+    {
+        const uint8_t chk[] = "123456789";
+        CHECK(wyCrc32(chk, 9) == 0xCBF43926u, "CRC-32 check value", "wrong");
+
+        const uint16_t W = 320, H = 240;
+        std::vector<uint16_t> ui = dumpUI(W, H);
+        DumpSrc src = { &ui, W };
+        std::vector<uint8_t> s1;
+        auto t0 = std::chrono::steady_clock::now();
+        size_t n = wyFrameDump(W, H, dumpFill, &src, dumpWrite, &s1, 7);
+        double encMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        CHECK(n == s1.size() && n < (size_t)W * H * 2 / 10, "UI frame < 10% of raw", "too big");
+        CHECK(n > 24 && !memcmp(s1.data(), "WYF1", 4) && !memcmp(s1.data() + WY_DUMP_FRAME_BYTES, "WYC1", 4) &&
+              WY_DUMP_FRAME_BYTES == 20, "FRAME record is 20 B, first chunk follows", "padding / stray bytes");
+        printf("    UI 320x240: %zu bytes (%.1f%% of raw), encode %.2f ms, 2 Mbaud %.0f ms\n",
+               n, 100.0 * n / (W * H * 2), encMs, n * 10.0 / 2000.0);
+
+        WyFrameDumpReader rd;
+        bool got = rd.feed(s1.data(), s1.size());
+        CHECK(got && rd.frames == 1 && rd.seq() == 7 && rd.width() == W && rd.height() == H &&
+              memcmp(rd.pixels(), ui.data(), ui.size() * 2) == 0, "UI frame decodes exactly", "mismatch");
+
+        /* Noise: every chunk falls back to raw and still round-trips */
+        std::vector<uint16_t> noise((size_t)101 * 37);
+        uint32_t seed = 99;
+        for (auto &p : noise) { seed = seed * 1103515245u + 12345u; p = (uint16_t)(seed >> 9); }
+        DumpSrc nsrc = { &noise, 101 };
+        std::vector<uint8_t> s2;
+        wyFrameDump(101, 37, dumpFill, &nsrc, dumpWrite, &s2, 8);
+        size_t rawChunks = 0;
+        for (size_t i = 0; i + 7 < s2.size(); i++)
+            if (!memcmp(&s2[i], "WYC1", 4) && s2[i + 6] == WY_DUMP_CODEC_RAW) rawChunks++;
+        WyFrameDumpReader rn;
+        for (uint8_t b : s2) rn.feed(&b, 1);                              /* byte at a time */
+        CHECK(rawChunks == 5 && rn.frames == 1 && rn.width() == 101 &&
+              memcmp(rn.pixels(), noise.data(), noise.size() * 2) == 0,
+              "noise → raw chunks, partial last chunk, byte-at-a-time feed", "mismatch");
+
+        /* Log text, a corrupted frame and a truncated one between good frames */
+        std::string log = "[boot] hello WY not a frame WYF\r\n";
+        std::vector<uint8_t> s3(log.begin(), log.end());
+        s3.insert(s3.end(), s1.begin(), s1.end());
+        std::vector<uint8_t> bad = s1;
+        bad[bad.size() / 2] ^= 0x40;
+        s3.insert(s3.end(), bad.begin(), bad.end());
+        s3.insert(s3.end(), s1.begin(), s1.begin() + s1.size() / 3);
+        s3.insert(s3.end(), log.begin(), log.end());
+        s3.insert(s3.end(), s1.begin(), s1.end());
+        WyFrameDumpReader rl;
+        for (size_t i = 0; i < s3.size(); i += 1000)
+            rl.feed(&s3[i], std::min<size_t>(1000, s3.size() - i));
+        CHECK(rl.frames == 2 && rl.crcErrors >= 1 && rl.incomplete == 2 && rl.skipped >= 2 * log.size() - 8 &&
+              memcmp(rl.pixels(), ui.data(), ui.size() * 2) == 0,
+              "log text skipped, corrupt + truncated frames dropped, next frame good", "wrong counts");
+        printf("    frames %u, incomplete %u, crc errors %u, skipped %u bytes\n",
+               rl.frames, rl.incomplete, rl.crcErrors, rl.skipped);
+
+        std::vector<uint8_t> s4;
+        wyFrameDump(W, H, dumpFill, &src, dumpWrite, &s4, 9, WY_DUMP_ROWS, false);
+        WyFrameDumpReader rr;
+        CHECK(rr.feed(s4.data(), s4.size()) && s4.size() > (size_t)W * H * 2 &&
+              memcmp(rr.pixels(), ui.data(), ui.size() * 2) == 0, "compress = false → all raw", "mismatch");
+
+        /* Two frames in one feed: each is reported, the second via a drain call */
+        std::vector<uint8_t> s5 = s2;
+        s5.insert(s5.end(), s1.begin(), s1.end());
+        WyFrameDumpReader r2;
+        bool first = r2.feed(s5.data(), s5.size());
+        bool isNoise = first && r2.seq() == 8 && memcmp(r2.pixels(), noise.data(), noise.size() * 2) == 0;
+        bool second = r2.feed(nullptr, 0);
+        CHECK(isNoise && second && r2.seq() == 7 && r2.width() == W &&
+              memcmp(r2.pixels(), ui.data(), ui.size() * 2) == 0 && !r2.feed(nullptr, 0),
+              "back-to-back frames each surface before the next overwrites them", "frame lost");
+    }
+
+    printf("\n========================================\n");
+    printf("  Results: %d passed, %d failed\n", _pass, _fail);
+    printf("========================================\n");
+    return _fail ? 1 : 0;
+}
@@ -0,0 +1,368 @@
+// test_keyboard.cpp — WyKeyboard non-blocking flash and incremental redraw
+// No Arduino SDK required — exercises the pure WyKeyboardCore.h layer
+// through WyFbPainter, with a painter that also counts SPI bytes.
+//
+// Build: g++ -std=c++17 -DHOST_TEST -Isrc test/test_keyboard.cpp -o /tmp/wytest_keyboard
+//
+// Covers:
+//   Flash       — press returns at once with the key highlighted, tick()
+//                 restores it after WY_KB_FLASH_MS, a second press ends
+//                 the first flash, ENTER / layout keys don't flash
+//   Diff        — after any sequence (typing, shift, caps-less shift
+//                 release, backspace, layout switch, password, scrolled
+//                 field) the screen equals a from-scratch redraw
+//   Label box   — shift repaints label boxes only, not key backgrounds
+//   SPI bytes   — per keystroke at 320×240, 480×480, 800×480 vs the old
+//                 flash + full field + full keyboard redraw
+//   Hit grid    — layouts stay resident across layer / shift switches,
+//                 gaps go to a neighbour key, lookup time vs a linear scan
+//                 (per-board exhaustive checks live in test_boards.cpp)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "ui/WyKeyboardCore.h"
+
+static int _pass=0, _fail=0;
+#define PASS(n)         do{printf("  PASS: %s\n",n);_pass++;}while(0)
+#define FAIL(n,m)       do{printf("  FAIL: %s  (%s)\n",n,m);_fail++;}while(0)
+#define CHECK(c,n,m)    do{if(c)PASS(n);else FAIL(n,m);}while(0)
+#define SECTION(s)      printf("\n  [%s]\n",s)
+
+/*
+ * SPI cost of what reaches the panel: every window is CASET + RASET +
+ * RAMWR (3 command + 8 data bytes) then 2 bytes per pixel. GFX text with
+ * a transparent background is written a pixel at a time; the host glyph
+ * is a 5 × 7 block, so text costs 35 windowed pixels per character — an
+ * upper bound (real glyphs light ~15).
+ */
+class SpiPainter : public WyFbPainter {
+public:
+    uint32_t bytes = 0;
+    SpiPainter(uint16_t w, uint16_t h) : WyFbPainter(w, h) {}
+protected:
+    void _fill(const WyRect &r, uint16_t c) override {
+        bytes += 11 + 2 * (uint32_t)r.area();
+        WyFbPainter::_fill(r, c);
+    }
+    void _text(int16_t x, int16_t y, const char *s, uint8_t size, uint16_t fg) override {
+        for (const char *c = s; *c; c++) if (*c != ' ') bytes += 35u * size * size * 13;
+        WyFbPainter::_text(x, y, s, size, fg);
+    }
+};
+
+/* Exposes the full redraw for the "same as from scratch" checks */
+class TestKb : public WyKeyboardCore {
+public:
+    void redrawAll() { _draw_all(); }
+    int  fieldY() const { return _kb_y + _label_h; }
+    int  fieldH() const { return _field_h; }
+    bool shifted() const { return _shift; }
+};
+
+static int findKey(const TestKb &kb, const char *label) {
+    bool shift = strcmp(label, "⬆") == 0;                 /* "⬆" or "⬆!" */
+    for (int i = 0; i < kb.keyCount(); i++)
+        if (shift ? kb.key(i).type == TestKb::KT_SHIFT : strcmp(kb.key(i).label, label) == 0) return i;
+    return -1;
+}
+static WyKbResult tap(TestKb &kb, int idx, uint32_t now) {
+    const TestKb::KeyDef &k = kb.key(idx);
+    WyKbResult r = kb.press(k.x + k.w / 2, k.y + k.h / 2, now);
+    kb.release();
+    return r;
+}
+static WyKbResult tapLabel(TestKb &kb, const char *label, uint32_t now) {
+    int i = findKey(kb, label);
+    return i < 0 ? WY_KB_NONE : tap(kb, i, now);
+}
+
+/* Screen identical to a fresh redraw of the same state? Leaves the fresh one */
+static bool matchesFresh(TestKb &kb, WyFbPainter &fb) {
+    size_t n = (size_t)fb.width() * fb.height();
+    std::vector<uint16_t> inc(fb.framebuffer(), fb.framebuffer() + n);
+    kb.redrawAll();
+    bool same = memcmp(inc.data(), fb.framebuffer(), n * 2) == 0;
+    if (!same) {
+        for (size_t i = 0; i < n; i++)
+            if (inc[i] != fb.framebuffer()[i]) {
+                printf("    first diff at (%zu, %zu): %04X vs %04X\n", i % fb.width(), i / fb.width(),
+                       inc[i], fb.framebuffer()[i]);
+                break;
+            }
+    }
+    return same;
+}
+
+/* Old WyKeyboard: flash + restore (two full keys), full field, and on a
+   shift change every key again — priced with the same SPI model */
+static uint32_t oldKeyBytes(const TestKb::KeyDef &k, int keyH) {
+    SpiPainter p(1024, 1024);
+    int r = keyH / 5 < 4 ? keyH / 5 : 4;
+    p.fillRoundRect(k.x, k.y, k.w, k.h, (int16_t)r, 1);
+    p.text(0, 0, k.label, 1, 2);
+    return p.bytes;
+}
+static uint32_t oldStrokeBytes(TestKb &kb, int idx, int visChars, bool allKeys) {
+    SpiPainter p(1024, 1024);
+    p.fillRect(2, 0, 800, (int16_t)kb.fieldH(), 0);               /* field: fill + drawRect (4 lines) */
+    for (int i = 0; i < 4; i++) p.fillRect(0, 0, 1, 1, 0);
+    std::string vis(visChars, 'x');
+    p.text(8, 0, vis.c_str(), 1, 1);
+    p.fillRect(0, 0, 2, (int16_t)(kb.fieldH() - 8), 1);           /* cursor */
+    int keyH = kb.key(idx).h;
+    uint32_t b = p.bytes + 2 * oldKeyBytes(kb.key(idx), keyH);
+    if (allKeys)
+        for (int i = 0; i < kb.keyCount(); i++) b += oldKeyBytes(kb.key(i), keyH);
+    return b;
+}
+
+int main() {
+    printf("\n========================================\n");
+    printf("  WyKeyboard Tests\n");
+    printf("========================================\n");
+
+    const WyKbTheme &T = WY_KB_THEME_DARK;
+
+    SECTION("Non-blocking flash");
+    {
+        SpiPainter fb(320, 240);
+        TestKb kb;
+        kb.begin(&fb, 320, 240);
+        kb.show("SSID:", 32);
+        int q = findKey(kb, "q");
+        const TestKb::KeyDef &k = kb.key(q);
+        int16_t px = (int16_t)(k.x + 1), py = (int16_t)(k.y + k.h - 3);   /* background, not label */
+
+        CHECK(tap(kb, q, 1000) == WY_KB_TYPING && kb.flashing() && fb.at(px, py) == T.key_press &&
+              strcmp(kb.value(), "q") == 0, "press returns at once, key highlighted", "no highlight");
+        kb.tick(1000 + WY_KB_FLASH_MS - 1);
+        CHECK(kb.flashing() && fb.at(px, py) == T.key_press, "still highlighted before the flash time", "early");
+        kb.tick(1000 + WY_KB_FLASH_MS);
+        CHECK(!kb.flashing() && fb.at(px, py) == T.key_bg && matchesFresh(kb, fb),
+              "tick() restores the key after WY_KB_FLASH_MS", "stuck");
+
+        int w = findKey(kb, "w");
+        tap(kb, q, 2000);
+        tap(kb, w, 2010);
+        const TestKb::KeyDef &kw = kb.key(w);
+        CHECK(fb.at(px, py) == T.key_bg && fb.at((int16_t)(kw.x + 1), (int16_t)(kw.y + kw.h - 3)) == T.key_press &&
+              strcmp(kb.value(), "qqw") == 0, "second press ends the first flash", "two keys lit");
+        kb.tick(2010 + WY_KB_FLASH_MS);
+
+        fb.bytes = 0;
+        kb.tick(5000);
+        CHECK(fb.bytes == 0, "idle tick draws nothing", "drew");
+
+        tapLabel(kb, "?123", 6000);
+        CHECK(!kb.flashing() && findKey(kb, "7") >= 0 && matchesFresh(kb, fb),
+              "layout key: switch without a stale flash", "stale");
+        CHECK(tapLabel(kb, "OK", 7000) == WY_KB_DONE && !kb.flashing() && !kb.active(),
+              "ENTER closes without leaving a flash pending", "flash pending");
+        kb.tick(9000);
+        CHECK(true, "tick after close is harmless", "");
+    }
+
+    SECTION("Held touch types once");
+    {
+        SpiPainter fb(320, 240);
+        TestKb kb;
+        kb.begin(&fb, 320, 240);
+        kb.show("SSID:", 32);
+        const TestKb::KeyDef &k = kb.key(findKey(kb, "q"));
+        int x = k.x + k.w / 2, y = k.y + k.h / 2;
+
+        /* finger held 150 ms, loop polling every 5 ms like WY_KB_POLL */
+        int typed = 0;
+        for (uint32_t t = 0; t < 150; t += 5) {
+            kb.tick(t);
+            if (kb.press(x, y, t) == WY_KB_TYPING) typed++;
+        }
+        CHECK(typed == 1 && strcmp(kb.value(), "q") == 0,
+              "150 ms hold on 'q' types exactly one character", kb.value());
+
+        /* sliding onto another key while held doesn't type either */
+        const TestKb::KeyDef &kw = kb.key(findKey(kb, "w"));
+        kb.press(kw.x + kw.w / 2, kw.y + kw.h / 2, 160);
+        CHECK(strcmp(kb.value(), "q") == 0, "drag to another key while held: ignored", kb.value());
+
+        kb.release();
+        kb.press(x, y, 200);
+        kb.release();
+        CHECK(strcmp(kb.value(), "qq") == 0, "release re-arms: next touch types", kb.value());
+
+        /* callers that never release(): a gap in press() calls is a new touch */
+        kb.press(x, y, 300);
+        kb.press(x, y, 300 + WY_KB_REARM_MS);
+        CHECK(strcmp(kb.value(), "qqq") == 0, "no release(): held within the re-arm gap types once",
+              kb.value());
+        kb.press(x, y, 500);
+        kb.press(x, y, 700);
+        CHECK(strcmp(kb.value(), "qqqqq") == 0, "no release(): separate taps each type", kb.value());
+    }
+
+    SECTION("Incremental redraw == full redraw");
+    {
+        SpiPainter fb(320, 240);
+        TestKb kb;
+        kb.begin(&fb, 320, 240);
+        kb.show("Name:", 40);
+        uint32_t t = 0;
+        const char *seq[] = { "h", "e", "⬆", "L", "l", "⌫", "SPACE", "⬆", "⬆", "x", "⌫", "⌫", "o" };
+        bool ok = true;
+        for (const char *s : seq) {
+            ok = ok && tapLabel(kb, s, t += 10) != WY_KB_NONE;
+            ok = ok && matchesFresh(kb, fb);              /* flashing key is part of the picture */
+            kb.tick(t += WY_KB_FLASH_MS);
+            ok = ok && matchesFresh(kb, fb);
+        }
+        CHECK(ok && strcmp(kb.value(), "heLo") == 0, "typing, shift, backspace: screen == full redraw",
+              kb.value());
+
+        /* Long input scrolls the field; every char shifts */
+        kb.show("Long:");
+        for (int i = 0; i < 70 && ok; i++) {
+            tapLabel(kb, (i % 3) ? "a" : "b", t += 100);
+            kb.tick(t += WY_KB_FLASH_MS);
+            ok = matchesFresh(kb, fb);
+        }
+        for (int i = 0; i < 10 && ok; i++) { tapLabel(kb, "⌫", t += 100); ok = matchesFresh(kb, fb); }
+        CHECK(ok && kb.length() == 60, "scrolled field (longer than the box) stays exact", "field diverged");
+
+        TestKb pw;
+        pw.begin(&fb, 320, 240);
+        pw.show("Password:", 32, true);
+        for (int i = 0; i < 5 && ok; i++) { tapLabel(pw, "k", t += 100); ok = matchesFresh(pw, fb); }
+        tapLabel(pw, "⌫", t += 100);
+        CHECK(ok && matchesFresh(pw, fb) && strcmp(pw.value(), "kkkk") == 0, "password mask incremental", "mask");
+
+        TestKb sym;
+        SpiPainter big(480, 480);
+        sym.begin(&big, 480, 480);
+        sym.show(nullptr, 0, false, WY_KB_SYMBOLS);
+        tapLabel(sym, "#", t += 100);
+        tapLabel(sym, "ABC", t += 100);
+        tapLabel(sym, "⬆", t += 100);
+        tapLabel(sym, "Z", t += 100);
+        sym.tick(t += 100);
+        CHECK(matchesFresh(sym, big) && strcmp(sym.value(), "#Z") == 0 && !sym.shifted(),
+              "layout switches + one-shot shift (480×480)", sym.value());
+    }
+
+    SECTION("Shift repaints label boxes only");
+    {
+        SpiPainter fb(320, 240);
+        TestKb kb;
+        kb.begin(&fb, 320, 240);
+        kb.show();
+        int letters = 0;
+        for (int i = 0; i < kb.keyCount(); i++) letters += kb.key(i).type == TestKb::KT_CHAR;
+        const TestKb::KeyDef &s = kb.key(findKey(kb, "⬆"));
+        fb.pixelCount = 0;
+        tapLabel(kb, "⬆", 100);
+        uint32_t cap = (uint32_t)letters * 6 * 8 * 2 + 2u * s.w * s.h;    /* clear + text per letter, shift key */
+        printf("    shift: %u px for %d letter keys (full keys would be ~%d px)\n", fb.pixelCount, letters,
+               letters * kb.key(0).w * kb.key(0).h);
+        CHECK(fb.pixelCount <= cap && findKey(kb, "A") >= 0 && matchesFresh(kb, fb),
+              "shift: letters repaint their 6×8 label box", "repainted keys");
+        const TestKb::KeyDef &a = kb.key(findKey(kb, "A"));
+        CHECK(fb.at((int16_t)(a.x + 1), (int16_t)(a.y + a.h / 2)) == T.key_bg, "key background untouched", "bg");
+    }
+
+    SECTION("SPI bytes per keystroke");
+    {
+        struct { uint16_t w, h; } sizes[] = { { 320, 240 }, { 480, 480 }, { 800, 480 } };
+        bool ok = true;
+        for (auto &sz : sizes) {
+            SpiPainter fb(sz.w, sz.h);
+            TestKb kb;
+            kb.begin(&fb, sz.w, sz.h);
+            kb.show("Message:", 120);
+            uint32_t t = 0;
+            for (int i = 0; i < 10; i++) { tapLabel(kb, "m", t += 100); kb.tick(t += 100); }
+
+            int m = findKey(kb, "m");
+            int vis = kb.length() + 1;
+            fb.bytes = 0;
+            tap(kb, m, t += 100);
+            kb.tick(t += 100);
+            uint32_t chr = fb.bytes, chrOld = oldStrokeBytes(kb, m, vis, false);
+
+            int sh = findKey(kb, "⬆");
+            fb.bytes = 0;
+            tap(kb, sh, t += 100);
+            kb.tick(t += 100);
+            uint32_t shf = fb.bytes, shfOld = oldStrokeBytes(kb, sh, vis, true);
+
+            int M = findKey(kb, "M");
+            fb.bytes = 0;
+            tap(kb, M, t += 100);                                       /* one-shot shift releases */
+            kb.tick(t += 100);
+            uint32_t up = fb.bytes, upOld = oldStrokeBytes(kb, M, vis + 1, true);
+
+            printf("    %3ux%-3u char %6u B (was %6u)  shift %6u B (was %6u)  shifted char %6u B (was %6u)\n",
+                   sz.w, sz.h, chr, chrOld, shf, shfOld, up, upOld);
+            ok = ok && chr * 2 < chrOld && shf * 4 < shfOld && up * 4 < upOld && matchesFresh(kb, fb);
+        }
+        CHECK(ok, "keystrokes send a fraction of the old SPI bytes", "no gain");
+    }
+
+    SECTION("Hit grid");
+    {
+        SpiPainter fb(320, 240);
+        TestKb kb;
+        kb.begin(&fb, 320, 240);
+        kb.show();
+        std::vector<TestKb::KeyDef> before(&kb.key(0), &kb.key(0) + kb.keyCount());
+        const TestKb::KeyDef *addr = &kb.key(0);
+        tapLabel(kb, "?123", 10);
+        tapLabel(kb, "ABC", 20);
+        tapLabel(kb, "⬆", 30);
+        tapLabel(kb, "⬆", 40);
+        bool same = &kb.key(0) == addr && kb.keyCount() == (int)before.size();
+        for (int i = 0; i < kb.keyCount() && same; i++)
+            same = kb.key(i).x == before[i].x && kb.key(i).y == before[i].y && kb.key(i).w == before[i].w &&
+                   strcmp(kb.key(i).label, before[i].label) == 0;
+        CHECK(same, "layer and shift switches reuse the resident layout", "rebuilt");
+
+        const TestKb::KeyDef &q = kb.key(findKey(kb, "q")), &w = kb.key(findKey(kb, "w"));
+        CHECK(kb.keyAt(q.x + q.w, q.y + 2) == findKey(kb, "q") && kb.keyAt(w.x, w.y + q.h) == findKey(kb, "w") &&
+              kb.keyAt(5, kb.kb_top() + 3) == -1, "gaps belong to the key left / above, field is no key", "gap");
+
+        /* Lookup cost: grid vs scanning every rect (the old press()) */
+        const int N = 2000000;
+        uint32_t seed = 1, acc = 0;
+        int top = kb.kb_top();
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < N; i++) {
+            seed = seed * 1103515245u + 12345u;
+            acc += (uint32_t)kb.keyAt((int)(seed >> 8) % 320, top + (int)(seed >> 20) % (240 - top));
+        }
+        double gridNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / N;
+        seed = 1;
+        t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < N; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int tx = (int)(seed >> 8) % 320, ty = top + (int)(seed >> 20) % (240 - top), hit = -1;
+            for (int k = 0; k < kb.keyCount(); k++) {
+                const TestKb::KeyDef &d = kb.key(k);
+                if (tx >= d.x && tx <= d.x + d.w && ty >= d.y && ty <= d.y + d.h) { hit = k; break; }
+            }
+            acc += (uint32_t)hit;
+        }
+        double scanNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / N;
+        printf("    touch → key: grid %.1f ns, linear scan of %d keys %.1f ns  (%u)\n", gridNs, kb.keyCount(),
+               scanNs, acc & 1);
+        CHECK(gridNs < scanNs, "grid lookup beats the linear scan", "slower");
+    }
+
+    printf("\n========================================\n");
+    printf("  Results: %d passed, %d failed\n", _pass, _fail);
+    printf("========================================\n");
+    return _fail ? 1 : 0;
+}
@@ -0,0 +1,337 @@
+// test_keydisplay.cpp — WyKeyDisplay canvases and round-robin flush
+// No Arduino SDK required — exercises the pure WyKeyCanvas.h layer with
+// a simulated shared SPI bus driving four 128×128 panels.
+//
+// Build: g++ -std=c++17 -DHOST_TEST -Isrc test/test_keydisplay.cpp -o /tmp/wytest_keydisplay
+//
+// Covers:
+//   Canvas      — 5×7 glyph bits and scaling, palette reuse, nearest
+//                 colour once 256 are taken, clipping
+//   Incremental — setLabel / setMetric repaint only the changed text box,
+//                 the result equals a from-scratch draw, SPI bytes per
+//                 metric update vs the old full-cap redraw
+//   Flush       — after random drawing with polls in between (blocking
+//                 bus, DMA bus, byte-swapped) the panels equal the
+//                 canvases; keys are served round-robin with one CS switch
+//                 each; a key redrawn every loop doesn't starve the others;
+//                 the in-flight buffer is never touched before wait()
+//   Benchmark   — palette → RGB565 conversion per pixel, full refresh of
+//                 all four keys on a blocking vs a DMA bus (timeline model)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <chrono>
+
+#include "display/WyKeyCanvas.h"
+
+static int _pass=0, _fail=0;
+#define PASS(n)         do{printf("  PASS: %s\n",n);_pass++;}while(0)
+#define FAIL(n,m)       do{printf("  FAIL: %s  (%s)\n",n,m);_fail++;}while(0)
+#define CHECK(c,n,m)    do{if(c)PASS(n);else FAIL(n,m);}while(0)
+#define SECTION(s)      printf("\n  [%s]\n",s)
+
+static const int W = 128, H = 128, KEYS = 4;
+
+static uint32_t _seed = 1;
+static uint32_t rnd(uint32_t m) { _seed = _seed * 1103515245u + 12345u; return (_seed >> 16) % m; }
+
+/*
+ * Four panels on one bus. SPI bytes as in test_keyboard: CASET + RASET +
+ * RAMWR per window (11 bytes) plus 2 per pixel. In dma mode write() only
+ * queues: the pixels land at wait(), and wait() checks that the queued
+ * buffer wasn't touched in the meantime.
+ */
+class SimBus : public WyKeyBus {
+public:
+    std::vector<uint16_t> panel[KEYS];
+    bool dma = false, swapped = false;
+    int  cur = -1;
+    uint32_t bytes = 0, writes = 0, clobbered = 0;
+    std::vector<int> selectLog, writeLog;
+
+    SimBus() { for (auto &p : panel) p.assign(W * H, 0); }
+
+    void select(uint8_t key) override {
+        wait();
+        cur = key;
+        selectLog.push_back(key);
+    }
+    void write(const WyRect &r, const uint16_t *px) override {
+        if (_pend) clobbered++;                 /* flusher must wait() before queueing another */
+        bytes += 11 + 2 * (uint32_t)r.area();
+        writes++;
+        writeLog.push_back(cur);
+        _r = r;
+        _px = px;
+        _copy.assign(px, px + r.area());
+        _key = cur;
+        _pend = true;
+        if (!dma) wait();
+    }
+    void wait() override {
+        if (!_pend) return;
+        _pend = false;
+        if (memcmp(_px, _copy.data(), _copy.size() * 2)) clobbered++;
+        for (int y = 0; y < _r.h; y++)
+            for (int x = 0; x < _r.w; x++) {
+                uint16_t v = _copy[(size_t)y * _r.w + x];
+                if (swapped) v = (uint16_t)(v >> 8 | v << 8);
+                panel[_key][(size_t)(_r.y + y) * W + _r.x + x] = v;
+            }
+    }
+
+private:
+    WyRect _r;
+    const uint16_t *_px = nullptr;
+    std::vector<uint16_t> _copy;
+    int  _key = -1;
+    bool _pend = false;
+};
+
+struct Rig {
+    WyKeyCanvas *c[KEYS];
+    WyKeyFlush   f;
+    SimBus       bus;
+    Rig(bool dma = false, bool swap = false, uint32_t chunk = WY_KDISP_CHUNK) {
+        for (auto &k : c) k = new WyKeyCanvas(W, H);
+        bus.dma = dma;
+        bus.swapped = swap;
+        f.begin(&bus, c, KEYS, chunk, swap);
+    }
+    ~Rig() { for (auto k : c) delete k; }
+    int mismatches() const {
+        int bad = 0;
+        for (int k = 0; k < KEYS; k++)
+            for (int y = 0; y < H; y++)
+                for (int x = 0; x < W; x++)
+                    if (bus.panel[k][(size_t)y * W + x] != c[k]->at(x, y)) bad++;
+        return bad;
+    }
+};
+
+static bool sameCanvas(const WyKeyCanvas &a, const WyKeyCanvas &b) {
+    for (int y = 0; y < H; y++)
+        for (int x = 0; x < W; x++)
+            if (a.at(x, y) != b.at(x, y)) return false;
+    return true;
+}
+
+static void randomDraw(WyKeyCanvas &c) {
+    static const char *words[] = { "PEERS", "21", "83k/s", "BLOCK", "~{|}", "x" };
+    int16_t x = (int16_t)rnd(W + 20) - 10, y = (int16_t)rnd(H + 20) - 10;
+    uint16_t col = (uint16_t)(rnd(12) * 0x1111);
+    switch (rnd(4)) {
+        case 0: c.fillRect(x, y, (int16_t)rnd(60), (int16_t)rnd(60), col); break;
+        case 1: c.text(x, y, words[rnd(6)], (uint8_t)(1 + rnd(3)), col); break;
+        case 2: c.fillRoundRect(x, y, (int16_t)rnd(60), (int16_t)rnd(60), 6, col); break;
+        default: {
+            uint16_t px[16 * 16];
+            for (auto &p : px) p = (uint16_t)(rnd(4) * 0x2104);
+            c.blit(x, y, 16, 16, px, 16);
+        }
+    }
+}
+
+int main() {
+    printf("\n══ WyKeyDisplay canvas / flush tests ══\n");
+
+    SECTION("Canvas");
+    {
+        WyKeyCanvas c(W, H);
+        CHECK(c.ok() && c.paletteSize() == 1 && c.at(5, 5) == 0x0000, "new canvas is black, palette = {black}", "init");
+        c.text(0, 0, "A", 1, 0xFFFF);
+        /* 'A' column 0 = 0x7C: rows 2..6 lit */
+        bool col0 = c.at(0, 1) == 0 && c.at(0, 2) == 0xFFFF && c.at(0, 6) == 0xFFFF && c.at(0, 7) == 0;
+        bool gap  = c.at(5, 3) == 0;
+        CHECK(col0 && gap, "glyph 'A' column 0 = 0x7C, column 5 blank", "bits");
+        c.text(20, 0, "A", 2, 0xFFFF);
+        bool scaled = c.at(20, 3) == 0 && c.at(20, 4) == 0xFFFF && c.at(21, 13) == 0xFFFF && c.at(20, 14) == 0;
+        CHECK(scaled, "size 2 doubles each glyph pixel", "scale");
+        CHECK(c.paletteSize() == 2, "repeated colour reuses its palette slot", "palette");
+
+        WyKeyCanvas p(W, H);
+        for (int i = 0; i < 300; i++) p.fillRect((int16_t)(i % W), (int16_t)(i / W), 1, 1, (uint16_t)(i * 97));
+        CHECK(p.paletteSize() == 256, "palette stops at 256 colours", "size");
+        uint16_t want = 0xF81F;
+        int best = 0; int32_t bestD = INT32_MAX;
+        for (int i = 0; i < 256; i++) {
+            uint16_t q = p.palette()[i];
+            int dr = ((want >> 11) - (q >> 11)) * 2, dg = ((want >> 5) & 0x3F) - ((q >> 5) & 0x3F), db = ((want & 0x1F) - (q & 0x1F)) * 2;
+            int32_t d = dr * dr + dg * dg + db * db;
+            if (d < bestD) { bestD = d; best = i; }
+        }
+        p.fillRect(0, 100, 4, 4, want);
+        CHECK(p.at(2, 102) == p.palette()[best], "colour 257 maps to the nearest palette entry", "nearest");
+
+        WyKeyCanvas k(W, H);
+        k.dirty().clear();
+        k.setClip(WyRect{ 10, 10, 20, 20 });
+        k.fillRect(0, 0, W, H, 0x1234);
+        k.text(0, 12, "WWWWW", 2, 0xFFFF);
+        bool clipped = k.at(9, 15) == 0 && k.at(30, 15) == 0 && k.at(10, 10) == 0x1234;
+        WyRect clip = { 10, 10, 20, 20 };
+        CHECK(clipped && clip.covers(k.dirty().within(WyRect{ 0, 0, W, H })), "drawing and damage respect the clip", "clip");
+    }
+
+    SECTION("Incremental");
+    {
+        Rig rig;
+        rig.c[0]->setMetric("PEERS", "21", 0x8410, 0x07E0, 0);
+        rig.f.flush();
+        uint32_t b0 = rig.bus.bytes;
+        rig.c[0]->setMetric("PEERS", "21", 0x8410, 0x07E0, 0);
+        CHECK(rig.c[0]->dirty().empty(), "same metric again: no damage", "dirty");
+        rig.c[0]->setMetric("PEERS", "22", 0x8410, 0x07E0, 0);
+        rig.f.flush();
+        uint32_t upd = rig.bus.bytes - b0;
+        uint32_t full = 11 + 2 * W * H;
+        char m[96];
+        snprintf(m, sizeof(m), "%u B vs %u B full cap", upd, full);
+        printf("    metric update: %u B on the bus (full cap redraw %u B, %.1f%%)\n", upd, full, 100.0 * upd / full);
+        CHECK(upd * 8 < full, "value change sends < 1/8 of a full cap", m);
+
+        WyKeyCanvas ref(W, H);
+        ref.setMetric("PEERS", "22", 0x8410, 0x07E0, 0);
+        CHECK(sameCanvas(*rig.c[0], ref) && !rig.mismatches(), "incremental metric == from-scratch draw", "pixels");
+
+        /* Value grows past size 3 → drops to size 2; label and colour change */
+        const char *seq[][2] = { { "PEERS", "123456789" }, { "HASHRATE", "83k/s" }, { "HASHRATE", "8" }, { "", "" } };
+        bool same = true;
+        for (auto &s : seq) {
+            rig.c[0]->setMetric(s[0], s[1], 0x8410, 0xFD20, 0);
+            WyKeyCanvas r(W, H);
+            r.setMetric(s[0], s[1], 0x8410, 0xFD20, 0);
+            same = same && sameCanvas(*rig.c[0], r);
+        }
+        rig.c[0]->setLabel("CKB", 0xFFFF, 0x001F, 2);
+        rig.c[0]->setLabel("NODE", 0xFFFF, 0x001F, 2);
+        WyKeyCanvas r(W, H);
+        r.setLabel("NODE", 0xFFFF, 0x001F, 2);
+        same = same && sameCanvas(*rig.c[0], r);
+        rig.f.flush();
+        CHECK(same && !rig.mismatches(), "size drop, label change, setLabel ↔ setMetric == from scratch", "pixels");
+    }
+
+    SECTION("Flush");
+    {
+        const struct { bool dma, swap; uint32_t chunk; const char *name; } modes[] = {
+            { false, false, WY_KDISP_CHUNK, "blocking bus" },
+            { true,  false, WY_KDISP_CHUNK, "DMA bus" },
+            { true,  true,  WY_KDISP_CHUNK, "DMA bus, byte-swapped" },
+            { true,  false, 100,            "DMA bus, chunk < row (clamped)" },
+        };
+        for (auto &md : modes) {
+            _seed = 7;
+            Rig rig(md.dma, md.swap, md.chunk);
+            for (int it = 0; it < 400; it++) {
+                randomDraw(*rig.c[rnd(KEYS)]);
+                if (rnd(3) == 0) rig.f.poll(rnd(3000));
+            }
+            rig.f.flush();
+            char n[96], m[64];
+            snprintf(n, sizeof(n), "%s: panels == canvases, in-flight buffer untouched", md.name);
+            snprintf(m, sizeof(m), "%d px differ, %u clobbered", rig.mismatches(), rig.bus.clobbered);
+            CHECK(!rig.mismatches() && !rig.bus.clobbered && rig.f.idle(), n, m);
+        }
+
+        /* All four dirty: served 0,1,2,3 with one select each */
+        {
+            Rig rig(true);
+            for (auto k : rig.c) k->markAll();
+            int polls = 0;
+            while (rig.f.poll()) polls++;
+            rig.f.flush();
+            bool order = rig.bus.selectLog == std::vector<int>{ 0, 1, 2, 3 };
+            CHECK(order && rig.f.selects == 4, "round-robin: keys 0..3, one CS switch each", "order");
+            char m[64];
+            snprintf(m, sizeof(m), "%u chunks", rig.f.chunks);
+            CHECK(rig.f.chunks == (uint32_t)KEYS * W * H / WY_KDISP_CHUNK && polls + 1 == (int)rig.f.chunks,
+                  "default poll() = one chunk", m);
+        }
+
+        /* Key 0 redrawn every loop must not starve keys 1..3 */
+        {
+            Rig rig;
+            for (int k = 1; k < KEYS; k++) rig.c[k]->setLabel("K", 0xFFFF, (uint16_t)(k * 0x0841), 2);
+            int loops = 0;
+            while (loops < 200) {
+                char v[8];
+                snprintf(v, sizeof(v), "%d", loops);
+                rig.c[0]->setMetric("TICK", v, 0x8410, 0x07FF, 0);
+                rig.f.poll();
+                loops++;
+                bool rest = true;
+                for (int k = 1; k < KEYS; k++) rest = rest && rig.c[k]->dirty().empty();
+                if (rest) break;
+            }
+            char m[48];
+            snprintf(m, sizeof(m), "%d loops", loops);
+            CHECK(loops < 60, "busy key 0 doesn't starve keys 1..3", m);
+            rig.f.flush();
+            CHECK(!rig.mismatches(), "panels == canvases after the busy run", "pixels");
+        }
+
+        /* Drawing on the key being flushed: the new damage goes out next round */
+        {
+            Rig rig(true);
+            rig.c[2]->fillRect(0, 0, W, H, 0x07E0);
+            rig.f.poll();
+            rig.c[2]->text(10, 10, "MID", 3, 0xF800);
+            rig.c[2]->fillRect(0, 120, W, 8, 0x001F);
+            rig.f.flush();
+            CHECK(!rig.mismatches(), "draw during a key's flush still reaches the panel", "pixels");
+        }
+
+        /* Direct drawing moved CS: the next chunk selects again */
+        {
+            Rig rig;
+            rig.c[1]->markAll();
+            rig.f.poll();
+            size_t n = rig.bus.selectLog.size();
+            rig.f.poll();
+            bool kept = rig.bus.selectLog.size() == n;
+            rig.f.reselect();
+            rig.f.poll();
+            CHECK(kept && rig.bus.selectLog.size() == n + 1 && rig.bus.selectLog.back() == 1,
+                  "CS held within a key, re-selected after reselect()", "select");
+        }
+    }
+
+    SECTION("Benchmark");
+    {
+        Rig rig;
+        _seed = 3;
+        for (auto k : rig.c)
+            for (int i = 0; i < 200; i++) randomDraw(*k);
+        rig.f.flush();
+        const int reps = 50;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            for (auto k : rig.c) k->markAll();
+            rig.f.flush();
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count()
+                  / ((double)reps * KEYS * W * H);
+        printf("    convert + bus copy: %.2f ns/px on host\n", ns);
+
+        /*
+         * Full refresh of 4 keys at 40 MHz SPI (0.4 µs/px) with the
+         * conversion at ~12 ns/px (ESP32-S3, 240 MHz, ~3 cycles/px).
+         * Blocking: convert, then send. DMA: chunk i+1 converts while
+         * chunk i is on the wire; only the first conversion is exposed.
+         */
+        const double xfer = 0.4, conv = 0.012;
+        uint32_t chunks = KEYS * W * H / WY_KDISP_CHUNK;
+        double block = chunks * WY_KDISP_CHUNK * (xfer + conv) / 1000;
+        double dma = (WY_KDISP_CHUNK * conv + chunks * WY_KDISP_CHUNK * xfer) / 1000;
+        printf("    4-key refresh (model): blocking %.1f ms, DMA %.1f ms; one poll() holds the CPU %.2f ms blocking, %.2f ms DMA\n",
+               block, dma, WY_KDISP_CHUNK * (xfer + conv) / 1000, WY_KDISP_CHUNK * conv / 1000);
+        CHECK(dma < block && WY_KDISP_CHUNK * (xfer + conv) / 1000 < 1.0, "one poll() slice stays under 1 ms", "model");
+    }
+
+    printf("\n══ Results: %d passed, %d failed ══\n\n", _pass, _fail);
+    return _fail ? 1 : 0;
+}
@@ -0,0 +1,259 @@
+// test_pixel.cpp — WyPixel conversion kernels, WyDirtyTiles change detection
+// No Arduino SDK required — exercises the pure WyPixel.h / WyDirtyTiles.h layer.
+//
+// Build: g++ -std=c++17 -O2 -DHOST_TEST -Isrc test/test_pixel.cpp -o /tmp/wytest_pixel
+//
+// Covers:
+//   wyRGB565toRGB888 — all 65,536 colours vs the scalar reference, known
+//                      values, every length 0..19, unaligned src / dst
+//   wyRGB565Swap     — all colours, in place and out of place, odd lengths
+//   wyRGB565toGray   — all colours, black / white / primaries
+//   wyYUV422toRGB565 — every (U, V) pair over a Y sweep, grey axis, odd n
+//   WyDirtyTiles     — first frame dirty, identical frames clean, one
+//                      pixel → one tile, edge tiles, moved content,
+//                      markDirty clipping; a 10 s mirror session where a
+//                      clock ticks once a second → frames encoded
+//   Throughput       — scalar vs SWAR pixels/s for each kernel
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#include "display/WyPixel.h"
+#include "display/WyDirtyTiles.h"
+
+static int _pass=0, _fail=0;
+#define PASS(n)         do{printf("  PASS: %s\n",n);_pass++;}while(0)
+#define FAIL(n,m)       do{printf("  FAIL: %s  (%s)\n",n,m);_fail++;}while(0)
+#define CHECK(c,n,m)    do{if(c)PASS(n);else FAIL(n,m);}while(0)
+#define SECTION(s)      printf("\n  [%s]\n",s)
+
+// ── Harness ─────────────────────────────────────────────────────────────────
+static std::vector<uint16_t> allColours() {
+    std::vector<uint16_t> v(65536);
+    for (uint32_t i = 0; i < 65536; i++) v[i] = (uint16_t)i;
+    return v;
+}
+
+/* Seconds for `reps` calls of fn over n pixels → Mpx/s */
+template <typename F> static double mpxPerSec(size_t n, int reps, F fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) fn();
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return (double)n * reps / s / 1e6;
+}
+
+/* Screen → tiles, strip by strip as WyScreenshot reads GRAM */
+static uint16_t scanScreen(WyDirtyTiles &dt, const std::vector<uint16_t> &scr, uint16_t w, uint16_t h) {
+    uint16_t n = 0;
+    for (uint16_t y = 0; y < h; y += 16)
+        n += dt.scanStrip(y, &scr[(size_t)y * w], w, (uint16_t)(h - y < 16 ? h - y : 16));
+    return n;
+}
+
+static volatile uint8_t g_sink;    /* keeps the optimiser from dropping bench output */
+
+int main() {
+    printf("\n  WyPixel kernel tests\n  ====================\n");
+    auto all = allColours();
+
+    // ── RGB565 → RGB888 ─────────────────────────────────────────────────────
+    SECTION("RGB565 → RGB888");
+    {
+        std::vector<uint8_t> a(65536 * 3), b(65536 * 3);
+        wyRGB565toRGB888(all.data(), a.data(), all.size());
+        _wy_px_rgb888(all.data(), b.data(), all.size());
+        CHECK(a == b, "all 65,536 colours match scalar", "mismatch");
+
+        uint16_t px[4] = { 0x0000, 0xFFFF, 0xF800, 0x07E0 };
+        uint8_t o[12];
+        wyRGB565toRGB888(px, o, 4);
+        static const uint8_t want[12] = { 0,0,0, 255,255,255, 255,0,0, 0,255,0 };
+        CHECK(memcmp(o, want, 12) == 0, "black, white, red, green expand to full range", "wrong bytes");
+
+        bool ok = true;
+        std::vector<uint8_t> buf(64 * 3 + 8), ref(64 * 3);
+        for (size_t n = 0; n < 20 && ok; n++)
+            for (int so = 0; so < 2 && ok; so++)
+                for (int doff = 0; doff < 4 && ok; doff++) {
+                    const uint16_t *src = (const uint16_t *)((const uint8_t *)all.data() + 0x1235 * 2) + so;
+                    memset(buf.data(), 0xAA, buf.size());
+                    wyRGB565toRGB888(src, buf.data() + doff, n);
+                    _wy_px_rgb888(src, ref.data(), n);
+                    ok = memcmp(buf.data() + doff, ref.data(), n * 3) == 0 &&
+                         buf[doff + n * 3] == 0xAA;
+                }
+        CHECK(ok, "lengths 0..19, unaligned src / dst, no overrun", "mismatch");
+    }
+
+    // ── Byte swap ───────────────────────────────────────────────────────────
+    SECTION("RGB565 byte swap");
+    {
+        std::vector<uint16_t> a(65536), b(65536);
+        wyRGB565Swap(all.data(), a.data(), all.size());
+        _wy_px_swap(all.data(), b.data(), all.size());
+        CHECK(a == b && a[0x1234] == 0x3412, "all colours match scalar", "mismatch");
+
+        std::vector<uint16_t> c = all;
+        wyRGB565Swap(c.data(), c.data(), c.size());
+        CHECK(c == b, "in place", "mismatch");
+
+        bool ok = true;
+        for (size_t n = 0; n < 9 && ok; n++) {
+            uint16_t src[9], dst[10];
+            for (size_t i = 0; i < 9; i++) src[i] = (uint16_t)(0x0102 * (i + 1));
+            for (size_t i = 0; i < 10; i++) dst[i] = 0xBEEF;
+            wyRGB565Swap(src, dst, n);
+            for (size_t i = 0; i < n; i++) ok &= dst[i] == (uint16_t)((src[i] >> 8) | (src[i] << 8));
+            ok &= dst[n] == 0xBEEF;
+        }
+        CHECK(ok, "lengths 0..8, no overrun", "mismatch");
+    }
+
+    // ── Grey ────────────────────────────────────────────────────────────────
+    SECTION("RGB565 → grey");
+    {
+        std::vector<uint8_t> a(65536), b(65536);
+        wyRGB565toGray(all.data(), a.data(), all.size());
+        _wy_px_gray(all.data(), b.data(), all.size());
+        CHECK(a == b, "all colours match scalar", "mismatch");
+        CHECK(a[0x0000] == 0 && a[0xFFFF] == 255, "black 0, white 255", "wrong");
+        CHECK(a[0xF800] == 76 && a[0x07E0] == 149 && a[0x001F] == 28,
+              "primaries ≈ BT.601 weights (76 / 149 / 28)", "wrong");
+        uint8_t o[7];
+        memset(o, 0xAA, sizeof(o));
+        wyRGB565toGray(all.data() + 0x8000, o, 6);
+        bool ok = o[6] == 0xAA;
+        for (int i = 0; i < 6; i++) ok &= o[i] == b[0x8000 + i];
+        CHECK(ok, "tail of 2 after one SWAR block, no overrun", "mismatch");
+    }
+
+    // ── YUV422 → RGB565 ─────────────────────────────────────────────────────
+    SECTION("YUV422 (YUYV) → RGB565");
+    {
+        /* Every U, V with Y sweeping both lanes: 65,536 pairs */
+        std::vector<uint8_t> yuv(65536 * 4);
+        for (uint32_t i = 0; i < 65536; i++) {
+            uint8_t *p = &yuv[i * 4];
+            p[0] = (uint8_t)(i * 7); p[1] = (uint8_t)(i >> 8); p[2] = (uint8_t)(i * 13 + 5); p[3] = (uint8_t)i;
+        }
+        std::vector<uint16_t> a(131072), b(131072);
+        wyYUV422toRGB565(yuv.data(), a.data(), a.size());
+        _wy_px_yuv422(yuv.data(), b.data(), b.size());
+        CHECK(a == b, "all (U, V) pairs match scalar", "mismatch");
+
+        uint8_t grey[8] = { 0, 128, 255, 128, 128, 128, 128, 128 };
+        uint16_t o[4];
+        wyYUV422toRGB565(grey, o, 4);
+        CHECK(o[0] == 0x0000 && o[1] == 0xFFFF && o[2] == 0x8410 && o[3] == 0x8410,
+              "U = V = 128 is grey: Y 0 / 255 / 128", "wrong");
+
+        uint8_t red[4] = { 76, 85, 76, 255 };          /* BT.601 of pure red */
+        wyYUV422toRGB565(red, o, 2);
+        CHECK((o[0] >> 11) >= 30 && ((o[0] >> 5) & 0x3F) <= 1 && (o[0] & 0x1F) <= 1,
+              "red round-trips", "wrong");
+
+        uint16_t odd[4] = { 0xBEEF, 0xBEEF, 0xBEEF, 0xBEEF };
+        uint8_t three[6] = { 255, 128, 255, 128, 0, 128 };
+        wyYUV422toRGB565(three, odd, 3);
+        CHECK(odd[0] == 0xFFFF && odd[1] == 0xFFFF && odd[2] == 0x0000 && odd[3] == 0xBEEF,
+              "odd n reads 2n bytes, writes n pixels", "wrong");
+    }
+
+    // ── Dirty tiles ─────────────────────────────────────────────────────────
+    SECTION("WyDirtyTiles");
+    {
+        const uint16_t W = 330, H = 250;                     /* partial edge tiles */
+        std::vector<uint16_t> scr((size_t)W * H, 0x18E3);
+        WyDirtyTiles dt;
+        CHECK(dt.begin(W, H) && dt.cols() == 21 && dt.rows() == 16 && dt.count() == dt.tiles(),
+              "330×250 → 21×16 tiles, all dirty at start", "wrong grid");
+        scanScreen(dt, scr, W, H);
+        dt.clear();
+        CHECK(scanScreen(dt, scr, W, H) == 0 && dt.count() == 0, "identical frame → clean", "flagged");
+
+        scr[(size_t)100 * W + 200] ^= 1;
+        CHECK(scanScreen(dt, scr, W, H) == 1 && dt.isDirty(200 / 16, 100 / 16),
+              "one pixel → its tile only", "wrong tiles");
+        dt.clear();
+
+        scr[(size_t)249 * W + 329] = 0xFFFF;                 /* bottom-right 10×10 tile */
+        CHECK(scanScreen(dt, scr, W, H) == 1 && dt.isDirty(20, 15), "edge tile", "missed");
+        dt.clear();
+
+        scr[(size_t)40 * W + 40] = 0x1234;                   /* same pixels, swapped */
+        scanScreen(dt, scr, W, H); dt.clear();
+        std::swap(scr[(size_t)40 * W + 40], scr[(size_t)40 * W + 41]);
+        CHECK(scanScreen(dt, scr, W, H) == 1, "content moved within a tile", "missed");
+        dt.clear();
+
+        dt.markDirty(-5, -5, 20, 20);                        /* tiles (0,0) only */
+        dt.markDirty(320, 240, 100, 100);                    /* clipped to (20,15) */
+        dt.markDirty(400, 0, 10, 10);                        /* off screen */
+        dt.markDirty(16, 16, 0, 5);                          /* empty */
+        CHECK(dt.count() == 2 && dt.isDirty(0, 0) && dt.isDirty(20, 15),
+              "markDirty clips to the screen", "wrong count");
+        dt.clear();
+        dt.markDirty(15, 15, 2, 2);
+        CHECK(dt.count() == 4, "rect across a tile corner → 4 tiles", "wrong count");
+        dt.clear();
+
+        /* 10 s of mirroring at 5 fps: a 48×16 clock changes once a second */
+        const uint16_t SW = 320, SH = 240;
+        std::vector<uint16_t> ui((size_t)SW * SH, 0x0000);
+        WyDirtyTiles m;
+        m.begin(SW, SH);
+        int encoded = 0, polls = 0;
+        for (int t = 0; t < 50; t++, polls++) {
+            if (t % 5 == 0)
+                for (int y = 0; y < 16; y++)
+                    for (int x = 260; x < 308; x++) ui[(size_t)y * SW + x] = (uint16_t)(t * 977 + x);
+            scanScreen(m, ui, SW, SH);
+            if (m.count()) { encoded++; m.clear(); }
+        }
+        printf("    idle-ish UI: %d of %d polls encoded\n", encoded, polls);
+        CHECK(encoded == 10, "clock ticking 1/s → 10 frames in 10 s, not 50", "wrong count");
+    }
+
+    // ── Throughput ──────────────────────────────────────────────────────────
+    SECTION("Throughput (host, Mpx/s)");
+    {
+        const size_t N = 320 * 240;
+        std::vector<uint16_t> src(N), d16(N);
+        std::vector<uint8_t>  d8(N * 3), yuv(N * 2);
+        uint32_t seed = 7;
+        for (auto &p : src) { seed = seed * 1103515245u + 12345u; p = (uint16_t)(seed >> 12); }
+        for (size_t i = 0; i < yuv.size(); i++) yuv[i] = (uint8_t)(src[i / 2] >> (i & 1 ? 8 : 0));
+        const int R = 40;
+        struct Row { const char *name; double scalar, swar; } rows[4] = {
+            { "RGB565 → RGB888",
+              mpxPerSec(N, R, [&] { _wy_px_rgb888(src.data(), d8.data(), N); g_sink = d8[N]; }),
+              mpxPerSec(N, R, [&] { wyRGB565toRGB888(src.data(), d8.data(), N); g_sink = d8[N]; }) },
+            { "RGB565 byte swap",
+              mpxPerSec(N, R, [&] { _wy_px_swap(src.data(), d16.data(), N); g_sink = (uint8_t)d16[N / 2]; }),
+              mpxPerSec(N, R, [&] { wyRGB565Swap(src.data(), d16.data(), N); g_sink = (uint8_t)d16[N / 2]; }) },
+            { "RGB565 → grey",
+              mpxPerSec(N, R, [&] { _wy_px_gray(src.data(), d8.data(), N); g_sink = d8[N / 2]; }),
+              mpxPerSec(N, R, [&] { wyRGB565toGray(src.data(), d8.data(), N); g_sink = d8[N / 2]; }) },
+            { "YUV422 → RGB565",
+              mpxPerSec(N, R, [&] { _wy_px_yuv422(yuv.data(), d16.data(), N); g_sink = (uint8_t)d16[N / 2]; }),
+              mpxPerSec(N, R, [&] { wyYUV422toRGB565(yuv.data(), d16.data(), N); g_sink = (uint8_t)d16[N / 2]; }) },
+        };
+        printf("    %-18s %10s %10s %7s\n", "kernel", "scalar", "SWAR", "speedup");
+        bool ok = true;
+        for (auto &r : rows) {
+            printf("    %-18s %10.1f %10.1f %6.2fx\n", r.name, r.scalar, r.swar, r.swar / r.scalar);
+            ok &= r.swar > 0;
+        }
+        CHECK(ok, "throughput measured for every kernel", "zero");
+    }
+
+    printf("\n========================================\n");
+    printf("  Results: %d passed, %d failed\n", _pass, _fail);
+    printf("========================================\n");
+    return _fail ? 1 : 0;
+}
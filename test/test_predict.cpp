@@ -0,0 +1,402 @@
+// test_predict.cpp — WyPredict trie, learning and the keyboard prediction bar
+// No Arduino SDK required — WyPredict.h and WyKeyboardCore.h are pure C++.
+//
+// Build: g++ -std=c++17 -O2 -DHOST_TEST -Isrc test/test_predict.cpp -o /tmp/wytest_predict
+//
+// Covers:
+//   Trie       — exact ranks, prefixes ending inside an edge, ordering and
+//                ties, k limits, bad / truncated / corrupted blobs
+//   Top-k      — complete() == brute force over a 5000-word vocabulary
+//   Learning   — boosts, out-of-vocabulary words, case, eviction,
+//                save / restore
+//   Bar        — suggestions follow typing, tap replaces the word, space
+//                and OK learn, unchanged cells cost nothing, screen ==
+//                full redraw, no bar or learning in password mode
+//   Benchmark  — build time, bytes per word, lookup latency against a
+//                linear scan of the word list
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+#include "ui/WyKeyboardCore.h"
+#include "ui/WyPredictWords.h"
+
+static int _pass=0, _fail=0;
+#define PASS(n)         do{printf("  PASS: %s\n",n);_pass++;}while(0)
+#define FAIL(n,m)       do{printf("  FAIL: %s  (%s)\n",n,m);_fail++;}while(0)
+#define CHECK(c,n,m)    do{if(c)PASS(n);else FAIL(n,m);}while(0)
+#define SECTION(s)      printf("\n  [%s]\n",s)
+
+static std::vector<uint8_t> build(const std::vector<std::string> &w, const std::vector<uint8_t> *ranks = nullptr) {
+    std::vector<const char *> p;
+    for (const std::string &s : w) p.push_back(s.c_str());
+    const uint8_t *r = ranks ? ranks->data() : nullptr;
+    std::vector<uint8_t> blob(wyTrieBuild(p.data(), r, p.size(), nullptr, 0));
+    if (!blob.empty()) wyTrieBuild(p.data(), r, p.size(), blob.data(), blob.size());
+    return blob;
+}
+
+static std::string list(const WyPredictHit *h, int n) {
+    std::string s;
+    for (int i = 0; i < n; i++) s += (i ? "," : "") + std::string(h[i].word);
+    return s;
+}
+
+/* Pseudo-words, deterministic */
+static std::vector<std::string> synth(size_t n, uint32_t seed) {
+    static const char *on[] = { "b", "c", "d", "f", "g", "l", "m", "n", "p", "r", "s", "t", "st", "tr", "ch" };
+    static const char *nu[] = { "a", "e", "i", "o", "u", "ea", "ou" };
+    static const char *co[] = { "", "n", "r", "s", "t", "nd", "ng" };
+    auto rnd = [&](uint32_t m) { seed = seed * 1103515245u + 12345u; return (seed >> 16) % m; };
+    std::vector<std::string> v;
+    while (v.size() < n) {
+        std::string w;
+        int syl = 1 + rnd(3);
+        for (int k = 0; k < syl; k++) { w += on[rnd(15)]; w += nu[rnd(7)]; w += co[rnd(7)]; }
+        v.push_back(w);
+    }
+    return v;
+}
+
+class TestKb : public WyKeyboardCore {
+public:
+    void redrawAll() { _draw_all(); }
+    int  barH() const { return _bar_h; }
+};
+
+static int findKey(const TestKb &kb, const char *label) {
+    for (int i = 0; i < kb.keyCount(); i++)
+        if (strcmp(kb.key(i).label, label) == 0) return i;
+    return -1;
+}
+static WyKbResult tapLabel(TestKb &kb, const char *label, uint32_t now) {
+    int i = findKey(kb, label);
+    if (i < 0) return WY_KB_NONE;
+    const TestKb::KeyDef &k = kb.key(i);
+    WyKbResult r = kb.press(k.x + k.w / 2, k.y + k.h / 2, now);
+    kb.release();
+    kb.tick(now + WY_KB_FLASH_MS);
+    return r;
+}
+static void type(TestKb &kb, const char *s, uint32_t &t) {
+    for (; *s; s++) {
+        char c[2] = { *s, 0 };
+        tapLabel(kb, *s == ' ' ? "SPACE" : c, t += 100);
+    }
+}
+static WyKbResult tapCell(TestKb &kb, WyFbPainter &fb, int cell) {
+    for (int x = 0; x < fb.width(); x++)
+        for (int y = kb.kb_top(); y < fb.height(); y++)
+            if (kb.barAt(x, y) == cell) {
+                WyKbResult r = kb.press(x + 10, y + 2, 0);
+                kb.release();
+                return r;
+            }
+    return WY_KB_NONE;
+}
+static bool matchesFresh(TestKb &kb, WyFbPainter &fb) {
+    size_t n = (size_t)fb.width() * fb.height();
+    std::vector<uint16_t> inc(fb.framebuffer(), fb.framebuffer() + n);
+    kb.redrawAll();
+    return memcmp(inc.data(), fb.framebuffer(), n * 2) == 0;
+}
+
+int main() {
+    printf("\n========================================\n");
+    printf("  WyPredict Tests\n");
+    printf("========================================\n");
+
+    SECTION("Trie");
+    {
+        std::vector<std::string> w = { "pass", "password", "passwords", "path", "pump", "p", "zebra", "pass" };
+        std::vector<uint8_t>     r = { 200,    250,        10,          90,     90,     5,   1,       100 };
+        std::vector<uint8_t> blob = build(w, &r);
+        WyTrie t;
+        CHECK(t.begin(blob.data(), blob.size()) && t.size() == blob.size(), "build + begin", "rejected");
+        CHECK(t.rank("pass") == 200 && t.rank("password") == 250 && t.rank("p") == 5 && t.rank("zebra") == 1,
+              "exact ranks (duplicate keeps the best)", "rank");
+        CHECK(t.rank("pas") == 0 && t.rank("passw") == 0 && t.rank("passwordz") == 0 && t.rank("") == 0 &&
+              t.rank("q") == 0, "prefixes and strangers have no rank", "false hit");
+
+        WyPredictHit h[WY_PREDICT_K];
+        int n = t.complete("pa", h, 3);
+        CHECK(n == 3 && list(h, n) == "password,pass,path" && h[0].score == 250,
+              "complete: best first", list(h, n).c_str());
+        n = t.complete("passwo", h, 3);                  /* ends inside the edge "ord" */
+        CHECK(n == 2 && list(h, n) == "password,passwords", "prefix ending mid-edge", list(h, n).c_str());
+        n = t.complete("p", h, 4);
+        CHECK(n == 4 && list(h, n) == "password,pass,path,pump", "ties in alphabetical order", list(h, n).c_str());
+        CHECK(t.complete("pax", h, 3) == 0 && t.complete("passwordsx", h, 3) == 0 && t.complete("z", h, 0) == 0,
+              "no match, k = 0", "hits");
+        CHECK(t.complete("", h, 200) == WY_PREDICT_K, "k capped at WY_PREDICT_K", "overflow");
+
+        std::vector<std::string> none = { "", std::string(WY_PREDICT_WORD, 'x') };
+        CHECK(build(none).empty() && build({}).empty(), "empty and over-long words dropped", "built");
+        std::vector<uint8_t> one = build({ "a" });
+        CHECK(t.begin(one.data(), one.size()) && t.rank("a") == 255, "single word", "one");
+
+        bool ok = !t.begin(blob.data(), blob.size() - 1) && !t.begin(nullptr, 0);
+        std::vector<uint8_t> bad = blob;
+        bad[0] = 'X';
+        ok = ok && !t.begin(bad.data(), bad.size());
+        CHECK(ok, "bad magic / truncated blob rejected", "accepted");
+
+        /* Random corruption: lookups must stay inside the blob (build with
+           -fsanitize=address to see a stray read) */
+        std::vector<std::string> words = synth(300, 7);
+        std::vector<uint8_t> good = build(words);
+        uint32_t seed = 99;
+        int lookups = 0;
+        for (int round = 0; round < 300; round++) {
+            std::vector<uint8_t> c = good;
+            for (int k = 0; k < 4; k++) {
+                seed = seed * 1103515245u + 12345u;
+                size_t at = WY_TRIE_HEADER + (seed >> 8) % (c.size() - WY_TRIE_HEADER);
+                c[at] = (uint8_t)(seed >> 24);
+            }
+            if (!t.begin(c.data(), c.size())) continue;
+            for (int k = 0; k < 20; k++) {
+                const std::string &q = words[(round * 20 + k) % words.size()];
+                t.complete(q.substr(0, 1 + k % 3).c_str(), h, 3);
+                t.rank(q.c_str());
+                lookups++;
+            }
+        }
+        CHECK(lookups > 0, "corrupted blobs: lookups stay in bounds", "none ran");
+    }
+
+    SECTION("Top-k == brute force");
+    {
+        std::vector<std::string> w = synth(5000, 1);
+        std::vector<uint8_t> r;
+        uint32_t seed = 5;
+        for (size_t i = 0; i < w.size(); i++) { seed = seed * 1103515245u + 12345u; r.push_back(1 + (seed >> 16) % 255); }
+        std::vector<uint8_t> blob = build(w, &r);
+        WyTrie t;
+        t.begin(blob.data(), blob.size());
+
+        /* Reference: unique words, best rank, sorted by (rank desc, word) */
+        std::vector<std::pair<std::string, uint8_t>> ref;
+        {
+            std::vector<std::pair<std::string, uint8_t>> all;
+            for (size_t i = 0; i < w.size(); i++) all.push_back({ w[i], r[i] });
+            std::sort(all.begin(), all.end());
+            for (auto &e : all)
+                if (!ref.empty() && ref.back().first == e.first) ref.back().second = std::max(ref.back().second, e.second);
+                else ref.push_back(e);
+            std::stable_sort(ref.begin(), ref.end(), [](auto &a, auto &b) { return a.second > b.second; });
+        }
+        int bad = 0, checked = 0;
+        for (size_t i = 0; i < w.size(); i += 7) {
+            for (size_t l = 1; l <= w[i].size(); l += 2) {
+                std::string p = w[i].substr(0, l);
+                std::vector<std::string> want;
+                for (auto &e : ref)
+                    if (e.first.compare(0, p.size(), p) == 0 && want.size() < 3) want.push_back(e.first);
+                WyPredictHit h[3];
+                int n = t.complete(p.c_str(), h, 3);
+                bool same = n == (int)want.size();
+                for (int k = 0; k < n && same; k++) same = want[k] == h[k].word;
+                if (!same && bad++ < 3) printf("    '%s': %s\n", p.c_str(), list(h, n).c_str());
+                checked++;
+            }
+        }
+        char msg[32];
+        snprintf(msg, sizeof(msg), "%d of %d differ", bad, checked);
+        CHECK(bad == 0, "5000 words: every sampled prefix matches brute force", msg);
+        int exact = 0;
+        for (auto &e : ref) exact += t.rank(e.first.c_str()) == e.second;
+        CHECK(exact == (int)ref.size(), "rank() of every word", "rank");
+    }
+
+    SECTION("Learning");
+    {
+        WyPredict p;
+        CHECK(p.begin(WY_PREDICT_WORDS, sizeof(WY_PREDICT_WORDS)), "default vocabulary loads", "blob");
+        WyPredictHit h[3];
+        int n = p.suggest("pas", h, 3);
+        CHECK(n >= 2 && !strcmp(h[0].word, "password"), "vocabulary suggestion", list(h, n).c_str());
+        n = p.suggest("Pas", h, 3);
+        CHECK(n >= 1 && !strcmp(h[0].word, "Password"), "capitalised prefix → capitalised word", list(h, n).c_str());
+        CHECK(p.suggest("", h, 3) == 0 && p.suggest("qqq", h, 3) == 0, "empty / unknown prefix", "hits");
+
+        p.learn("pastry");
+        n = p.suggest("pas", h, 3);
+        CHECK(n == 3 && list(h, n).find("pastry") != std::string::npos, "word learned once is suggested",
+              list(h, n).c_str());
+        p.learn("Pastry");
+        n = p.suggest("pa", h, 3);
+        CHECK(!strcmp(h[0].word, "Pastry") && p.hits("PASTRY") == 2 && p.learnedCount() == 1,
+              "learned twice: first, case-insensitive, latest spelling", list(h, n).c_str());
+        p.learn("MyNet-5G");
+        n = p.suggest("myn", h, 3);
+        CHECK(n == 1 && !strcmp(h[0].word, "MyNet-5G"), "out-of-vocabulary word keeps its case", list(h, n).c_str());
+        p.learn("x");
+        CHECK(p.learnedCount() == 2, "single letters not learned", "learned");
+
+        /* Full table: the least used, oldest entry goes */
+        p.clearLearned();
+        p.learn("keepme"); p.learn("keepme");
+        char wd[16];
+        for (int i = 0; i < WY_PREDICT_LEARN; i++) { snprintf(wd, sizeof(wd), "word%02d", i); p.learn(wd); }
+        CHECK(p.learnedCount() == WY_PREDICT_LEARN && p.hits("keepme") == 2 && p.hits("word00") == 0 &&
+              p.hits("word01") == 1, "eviction: least used, then oldest", "evicted wrong");
+
+        /* 65,536 touches later the age order still holds */
+        {
+            WyPredict w;
+            w.begin();
+            for (int i = 0; i < 65530; i++) w.learn("often");
+            w.learn("older");
+            for (int i = 0; i < 10; i++) w.learn("often");
+            w.learn("newer");
+            for (int i = 0; w.learnedCount() < WY_PREDICT_LEARN; i++) {
+                snprintf(wd, sizeof(wd), "pad%02d", i);
+                w.learn(wd); w.learn(wd);
+            }
+            w.learn("latest");
+            CHECK(w.hits("older") == 0 && w.hits("newer") == 1 && w.hits("latest") == 1,
+                  "stamp clock wrap: oldest still evicted first", "evicted the newer word");
+        }
+
+        uint8_t buf[8 + WY_PREDICT_LEARN * 64];
+        size_t len = p.save(buf, sizeof(buf));
+        WyPredict q;
+        q.begin(WY_PREDICT_WORDS, sizeof(WY_PREDICT_WORDS));
+        bool ok = len == p.saveSize() && q.restore(buf, len) && q.learnedCount() == p.learnedCount() &&
+                  q.hits("keepme") == 2;
+        q.learn("word05");
+        ok = ok && q.hits("word05") == 2 && p.save(buf, 4) == 0;
+        buf[0] = 'X';
+        ok = ok && !q.restore(buf, len) && !q.restore(buf, 3);
+        CHECK(ok, "save / restore round trip, junk rejected", "restore");
+
+        WyPredict bare;
+        bare.begin();
+        bare.learn("hello");
+        CHECK(bare.suggest("he", h, 3) == 1, "works without a vocabulary", "none");
+    }
+
+    SECTION("Keyboard prediction bar");
+    {
+        WyPredict p;
+        p.begin(WY_PREDICT_WORDS, sizeof(WY_PREDICT_WORDS));
+        WyFbPainter fb(320, 240), fb2(320, 240);
+        TestKb kb, plain;
+        kb.setPredictor(&p);
+        kb.begin(&fb, 320, 240);
+        plain.begin(&fb2, 320, 240);
+        kb.show("Note:", 80);
+        plain.show("Note:", 80);
+
+        int lastKey = 0;
+        for (int i = 0; i < kb.keyCount(); i++) lastKey = std::max(lastKey, kb.key(i).y + kb.key(i).h);
+        CHECK(kb.barH() > 0 && lastKey <= 240 && kb.barAt(160, kb.key(0).y) == -1 &&
+              kb.keyAt(160, kb.key(0).y - kb.barH()) == -1, "bar fits between field and keys", "overlap");
+
+        uint32_t t = 0;
+        type(kb, "pas", t);
+        CHECK(!strcmp(kb.suggestion(0), "password") && matchesFresh(kb, fb), "suggestions after typing",
+              kb.suggestion(0));
+
+        /* Keystroke that leaves the suggestions alone costs the same as without a bar */
+        type(kb, "swo", t);
+        type(plain, "passwo", t);
+        fb.pixelCount = fb2.pixelCount = 0;
+        type(kb, "r", t);
+        type(plain, "r", t);
+        char msg[64];
+        snprintf(msg, sizeof(msg), "%u px vs %u px", fb.pixelCount, fb2.pixelCount);
+        CHECK(fb.pixelCount == fb2.pixelCount && matchesFresh(kb, fb), "unchanged cells repaint nothing", msg);
+
+        CHECK(tapCell(kb, fb, 0) == WY_KB_TYPING && !strcmp(kb.value(), "password ") && p.hits("password") == 1 &&
+              !kb.suggestion(0)[0] && matchesFresh(kb, fb), "tap replaces the word, adds a space, learns it",
+              kb.value());
+        CHECK(tapCell(kb, fb, 1) == WY_KB_NONE, "empty cell does nothing", "typed");
+
+        type(kb, "zqx ab", t);
+        CHECK(p.hits("zqx") == 1 && !strcmp(kb.suggestion(0), "about") && matchesFresh(kb, fb),
+              "space learns the finished word", kb.suggestion(0));
+        type(kb, " zq", t);
+        CHECK(!strcmp(kb.suggestion(0), "zqx") && matchesFresh(kb, fb), "learned word comes back",
+              kb.suggestion(0));
+        tapLabel(kb, "⌫", t += 100);
+        tapLabel(kb, "⌫", t += 100);
+        CHECK(!kb.suggestion(0)[0] && matchesFresh(kb, fb), "backspace refreshes the bar", "stale");
+        type(kb, "ab", t);
+        CHECK(tapLabel(kb, "OK", t += 100) == WY_KB_DONE && p.hits("ab") == 2, "OK learns the last word", "no");
+
+        /* A cell word longer than the cell is clipped, not spilled */
+        p.learn("abcdefghijklmnopqrstuvwxyz");
+        kb.show("Note:", 80);
+        type(kb, "abc", t);
+        CHECK(matchesFresh(kb, fb), "long suggestion clipped to its cell", "spill");
+
+        /* Password: no bar, nothing learned */
+        TestKb pw;
+        pw.setPredictor(&p);
+        pw.begin(&fb, 320, 240);
+        pw.show("Password:", 32, true);
+        uint8_t before = p.learnedCount();
+        type(pw, "hunter two", t);
+        tapLabel(pw, "OK", t += 100);
+        CHECK(pw.barH() == 0 && pw.key(0).y == plain.key(0).y && p.learnedCount() == before &&
+              !pw.suggestion(0)[0], "password mode: no bar, no learning", "leaked");
+    }
+
+    SECTION("Benchmark");
+    {
+        std::vector<std::string> w = synth(20000, 3);
+        auto t0 = std::chrono::steady_clock::now();
+        std::vector<uint8_t> blob = build(w);
+        double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        size_t raw = 0;
+        for (const std::string &s : w) raw += s.size() + 1;
+
+        WyPredict p;
+        p.begin(blob.data(), blob.size());
+        for (int i = 0; i < WY_PREDICT_LEARN; i++) p.learn(w[i * 97].c_str());
+
+        std::vector<std::string> q;
+        for (size_t i = 0; i < w.size(); i += 13)
+            for (size_t l = 1; l <= 4 && l <= w[i].size(); l++) q.push_back(w[i].substr(0, l));
+
+        WyPredictHit h[3];
+        uint32_t acc = 0;
+        t0 = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < 5; rep++)
+            for (const std::string &s : q) acc += p.suggest(s.c_str(), h, 3);
+        double trieNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / (5 * q.size());
+
+        /* Baseline: scan a plain array for prefix matches, keep the 3 best */
+        std::vector<const char *> arr;
+        for (const std::string &s : w) arr.push_back(s.c_str());
+        t0 = std::chrono::steady_clock::now();
+        for (const std::string &s : q) {
+            uint8_t n = 0;
+            for (size_t i = 0; i < arr.size(); i++)
+                if (!strncmp(arr[i], s.c_str(), s.size()))
+                    wyPredictOffer(h, n, 3, arr[i], strlen(arr[i]), (uint16_t)(255 - i * 254 / arr.size()));
+            acc += n;
+        }
+        double scanNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / q.size();
+
+        printf("    20000 words: blob %zu B (%.1f B/word, list %zu B), build %.1f ms\n", blob.size(),
+               (double)blob.size() / w.size(), raw, buildMs);
+        printf("    suggest(): %.0f ns per keystroke (1-4 letter prefixes, %d learned), linear scan %.0f ns  (%u)\n",
+               trieNs, WY_PREDICT_LEARN, scanNs, acc & 1);
+        CHECK(blob.size() < raw, "blob smaller than the word list", "bigger");
+        CHECK(trieNs * 20 < scanNs, "lookup ≥ 20× faster than scanning", "slow");
+    }
+
+    printf("\n========================================\n");
+    printf("  Results: %d passed, %d failed\n", _pass, _fail);
+    printf("========================================\n");
+    return _fail ? 1 : 0;
+}
@@ -0,0 +1,511 @@
+// test_qr.cpp — WyQR encoder, matrix cache and renderers
+// No Arduino SDK required — exercises the pure WyQREncode.h / WyQRCode.h layer.
+//
+// Build: g++ -std=c++17 -DHOST_TEST -Isrc test/test_qr.cpp -o /tmp/wytest_qr
+//
+// Covers:
+//   WyQRBits        — 1-bpp pack / unpack, row compare
+//   wyQRRenderBands — pixel output vs per-module reference, blit count,
+//                     quiet zone, band sizes down to one module row
+//   wyQRRenderRuns  — same pixels with run + repeated-row merging,
+//                     fill count vs one-fillRect-per-module
+//   WyQRCache       — hits / misses, (text, ecc) keys, LRU eviction, drop
+//   wyQRCapacity    — exact numeric / alnum / byte capacities (v1, v10, v40)
+//   wyQRPlanFor     — mode choice, bech32 → uppercase alnum, smallest
+//                     version, ECC boost, module counts for CKB payloads
+//   wyQREncode      — ISO / thonky reference codewords, and every version ×
+//                     ECC read back: format + version BCH, unmask, RS
+//                     syndromes per block, payload parse; encode time
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+
+#include "display/WyQRCode.h"
+#include "display/WyQREncode.h"
+
+static int _pass=0, _fail=0;
+#define PASS(n)         do{printf("  PASS: %s\n",n);_pass++;}while(0)
+#define FAIL(n,m)       do{printf("  FAIL: %s  (%s)\n",n,m);_fail++;}while(0)
+#define CHECK(c,n,m)    do{if(c)PASS(n);else FAIL(n,m);}while(0)
+#define SECTION(s)      printf("\n  [%s]\n",s)
+
+// ── Harness ─────────────────────────────────────────────────────────────────
+// Version-10-sized matrix: finder patterns, timing rows, pseudo-random data
+struct Matrix {
+    WyQRBits qr;
+    std::vector<uint8_t> store;
+    std::vector<uint8_t> ref;      // 1 byte per module
+    explicit Matrix(uint8_t size) {
+        store.assign(WyQRBits::bytes(size), 0);
+        ref.assign(size * size, 0);
+        qr.size = size; qr.version = (uint8_t)((size - 17) / 4); qr.bits = store.data();
+        uint32_t seed = 1;
+        for (int y = 0; y < size; y++)
+            for (int x = 0; x < size; x++) {
+                bool dark;
+                auto finder = [&](int fx, int fy) {
+                    int dx = x - fx, dy = y - fy;
+                    if (dx < 0 || dy < 0 || dx > 6 || dy > 6) return -1;
+                    int r = dx < dy ? dx : dy, r2 = (6 - dx) < (6 - dy) ? 6 - dx : 6 - dy;
+                    int d = r < r2 ? r : r2;
+                    return d == 1 ? 0 : 1;
+                };
+                int f = finder(0, 0);
+                if (f < 0) f = finder(size - 7, 0);
+                if (f < 0) f = finder(0, size - 7);
+                if (f >= 0) dark = f;
+                else if (y == 6) dark = x % 2 == 0;
+                else { seed = seed * 1103515245u + 12345u; dark = (seed >> 16) & 1; }
+                ref[y * size + x] = dark;
+                qr.set((uint8_t)x, (uint8_t)y, dark);
+            }
+    }
+};
+
+struct Canvas {
+    int w, h;
+    std::vector<uint16_t> px;
+    int calls = 0;
+    Canvas(int w_, int h_) : w(w_), h(h_), px(w_ * h_, 0x1234) {}
+};
+static void canvasBlit(void *ctx, int16_t x, int16_t y, const uint16_t *p, uint16_t w, uint16_t h) {
+    Canvas *c = (Canvas *)ctx;
+    for (int r = 0; r < h; r++)
+        for (int i = 0; i < w; i++)
+            if (x + i < c->w && y + r < c->h) c->px[(y + r) * c->w + x + i] = p[r * w + i];
+    c->calls++;
+}
+static void canvasFill(void *ctx, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t col) {
+    Canvas *c = (Canvas *)ctx;
+    for (int r = 0; r < h; r++)
+        for (int i = 0; i < w; i++)
+            if (x + i < c->w && y + r < c->h) c->px[(y + r) * c->w + x + i] = col;
+    c->calls++;
+}
+// What one fillRect per module (the old renderer) would have produced
+static bool matchesReference(const Canvas &c, const Matrix &m, int mod, int quiet,
+                             uint16_t fg, uint16_t bg) {
+    int size = m.qr.size;
+    for (int y = 0; y < c.h; y++)
+        for (int x = 0; x < c.w; x++) {
+            int mx = x / mod - quiet, my = y / mod - quiet;
+            bool dark = mx >= 0 && my >= 0 && mx < size && my < size && m.ref[my * size + mx];
+            if (c.px[y * c.w + x] != (dark ? fg : bg)) return false;
+        }
+    return true;
+}
+
+
+// ── Read-back decoder ───────────────────────────────────────────────────────
+// Undo wyQREncode() the way a scanner would and check every layer. Shares
+// only the function-pattern layout and zig-zag order with the encoder
+// (both fixed by the standard); the GF(256) math here is log-table based.
+static uint8_t gfExp[512], gfLog[256];
+static void gfInit() {
+    int x = 1;
+    for (int i = 0; i < 255; i++) {
+        gfExp[i] = (uint8_t)x; gfLog[x] = (uint8_t)i;
+        x <<= 1; if (x & 0x100) x ^= 0x11D;
+    }
+    for (int i = 255; i < 512; i++) gfExp[i] = gfExp[i - 255];
+}
+static uint8_t gfMul(uint8_t a, uint8_t b) { return a && b ? gfExp[gfLog[a] + gfLog[b]] : 0; }
+
+static int bitsOf(const WyQRBits &qr, const int (*pos)[2], int n) {
+    int v = 0;
+    for (int i = 0; i < n; i++) v |= qr.get((uint8_t)pos[i][0], (uint8_t)pos[i][1]) << i;
+    return v;
+}
+
+// Returns "" on success, else what broke; text receives the payload
+static std::string readBack(const WyQRBits &qr, std::string &text, int &eccOut, int &maskOut) {
+    int size = qr.size, ver = (size - 17) / 4;
+    // Format: both copies, valid BCH word
+    int a[15][2], b[15][2];
+    for (int i = 0; i <= 5; i++) { a[i][0] = 8; a[i][1] = i; }
+    a[6][0] = 8; a[6][1] = 7; a[7][0] = 8; a[7][1] = 8; a[8][0] = 7; a[8][1] = 8;
+    for (int i = 9; i < 15; i++) { a[i][0] = 14 - i; a[i][1] = 8; }
+    for (int i = 0; i < 8; i++) { b[i][0] = size - 1 - i; b[i][1] = 8; }
+    for (int i = 8; i < 15; i++) { b[i][0] = 8; b[i][1] = size - 15 + i; }
+    int f1 = bitsOf(qr, a, 15), f2 = bitsOf(qr, b, 15);
+    if (f1 != f2) return "format copies differ";
+    int ecc = -1, mask = -1;
+    for (int e = 0; e < 4; e++)
+        for (int m = 0; m < 8; m++)
+            if (wyQRFormatBits((uint8_t)e, (uint8_t)m) == f1) { ecc = e; mask = m; }
+    if (ecc < 0) return "format word invalid";
+    if (!qr.get(8, (uint8_t)(size - 8))) return "dark module missing";
+    if (ver >= 7) {
+        int vp[18][2], vq[18][2];
+        for (int i = 0; i < 18; i++) {
+            vp[i][0] = size - 11 + i % 3; vp[i][1] = i / 3;
+            vq[i][0] = i / 3; vq[i][1] = size - 11 + i % 3;
+        }
+        if ((uint32_t)bitsOf(qr, vp, 18) != wyQRVersionBits((uint8_t)ver) ||
+            (uint32_t)bitsOf(qr, vq, 18) != wyQRVersionBits((uint8_t)ver)) return "version word";
+    }
+    for (int i = 8; i < size - 8; i++)
+        if (qr.get((uint8_t)i, 6) != (i % 2 == 0) || qr.get(6, (uint8_t)i) != (i % 2 == 0)) return "timing";
+    for (int y = 0; y < 7; y++)
+        for (int x = 0; x < 7; x++) {
+            int d = std::max(abs(x - 3), abs(y - 3));
+            bool want = d != 2;
+            if (qr.get((uint8_t)x, (uint8_t)y) != want || qr.get((uint8_t)(size - 7 + x), (uint8_t)y) != want ||
+                qr.get((uint8_t)x, (uint8_t)(size - 7 + y)) != want) return "finder";
+        }
+
+    // Function map → unmasked zig-zag read of every codeword
+    std::vector<uint8_t> fnBits(WyQRBits::bytes((uint8_t)size)), scratch(fnBits.size());
+    WyQRBits tmp; tmp.size = (uint8_t)size; tmp.bits = scratch.data();
+    _WyQRBuild bld = { tmp, WyQRBits() };
+    bld.fn.size = (uint8_t)size; bld.fn.bits = fnBits.data();
+    _wy_qr_function_patterns(bld, (uint8_t)ver);
+    int rawCW = _wy_qr_raw_modules((uint8_t)ver) / 8;
+    std::vector<uint8_t> raw(rawCW, 0);
+    int i = 0;
+    for (int right = size - 1; right >= 1; right -= 2) {
+        if (right == 6) right = 5;
+        for (int v = 0; v < size; v++)
+            for (int j = 0; j < 2; j++) {
+                int x = right - j, y = ((right + 1) & 2) == 0 ? size - 1 - v : v;
+                if (bld.fn.get((uint8_t)x, (uint8_t)y)) continue;
+                bool m = qr.get((uint8_t)x, (uint8_t)y) ^ _wy_qr_mask_bit((uint8_t)mask, x, y);
+                if (i < rawCW * 8 && m) raw[i >> 3] |= (uint8_t)(0x80 >> (i & 7));
+                i++;
+            }
+    }
+    if (i < rawCW * 8) return "too few data modules";
+
+    // De-interleave, RS syndromes must all be zero
+    int nb = _wy_qr_blocks[ecc][ver], el = _wy_qr_ecc_per_block[ecc][ver];
+    int nShort = nb - rawCW % nb, shortLen = rawCW / nb - el;
+    int dataCW = wyQRDataCodewords((uint8_t)ver, (uint8_t)ecc);
+    std::vector<std::vector<uint8_t>> blk(nb);
+    int k = 0;
+    for (int j = 0; j <= shortLen; j++)
+        for (int bI = 0; bI < nb; bI++)
+            if (j < shortLen || bI >= nShort) blk[bI].push_back(raw[k++]);
+    if (k != dataCW) return "data length";
+    for (int j = 0; j < el; j++)
+        for (int bI = 0; bI < nb; bI++) blk[bI].push_back(raw[k++]);
+    std::vector<uint8_t> data;
+    for (int bI = 0; bI < nb; bI++) {
+        for (int s = 0; s < el; s++) {
+            uint8_t syn = 0;
+            for (uint8_t c : blk[bI]) syn = gfMul(syn, gfExp[s]) ^ c;
+            if (syn) return "RS syndrome non-zero";
+        }
+        data.insert(data.end(), blk[bI].begin(), blk[bI].end() - el);
+    }
+
+    // Segment
+    size_t bit = 0;
+    auto take = [&](int n) { int v = 0; while (n--) { v = v << 1 | ((data[bit >> 3] >> (7 - (bit & 7))) & 1); bit++; } return v; };
+    int mode = take(4);
+    int cb = mode == 1 ? (ver < 10 ? 10 : ver < 27 ? 12 : 14) : mode == 2 ? (ver < 10 ? 9 : ver < 27 ? 11 : 13)
+                                                                      : (ver < 10 ? 8 : 16);
+    int count = take(cb);
+    text.clear();
+    const char *an = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+    if (mode == 1) {
+        for (int n = count; n > 0; n -= 3) {
+            int d = n >= 3 ? 3 : n, v = take(d * 3 + 1);
+            char t[4]; snprintf(t, sizeof(t), "%0*d", d, v);
+            text += t;
+        }
+    } else if (mode == 2) {
+        for (int n = count; n > 0; n -= 2) {
+            if (n >= 2) { int v = take(11); text += an[v / 45]; text += an[v % 45]; }
+            else text += an[take(6)];
+        }
+    } else if (mode == 4) {
+        for (int n = 0; n < count; n++) text += (char)take(8);
+    } else return "unknown mode";
+    eccOut = ecc; maskOut = mask;
+    return "";
+}
+
+static std::string randomText(uint32_t &seed, size_t n, const char *alphabet) {
+    std::string s;
+    size_t an = strlen(alphabet);
+    for (size_t i = 0; i < n; i++) { seed = seed * 1103515245u + 12345u; s += alphabet[(seed >> 16) % an]; }
+    return s;
+}
+
+static const char *CKB_ADDR =    // full-format secp256k1 address, 97 chars
+    "ckb1qzda0cr08m85hc8jlnfp3zer7xulejywt49kt2rr0vthywaa50xwsqdnnw6p3q6vxu0vu2zqvtnr5k9cm0jfsrstk8d8e";
+
+int main() {
+    printf("\n========================================\n");
+    printf("  WyQR matrix / renderer tests\n");
+    printf("========================================\n");
+
+    SECTION("WyQRBits — 1-bpp matrix");
+    {
+        Matrix m(57);
+        bool same = true;
+        for (int y = 0; y < 57; y++)
+            for (int x = 0; x < 57; x++) same &= m.qr.get(x, y) == (bool)m.ref[y * 57 + x];
+        CHECK(same, "get() returns what set() stored", "mismatch");
+        CHECK(WyQRBits::stride(57) == 8 && WyQRBits::bytes(57) == 456, "57 modules → 8 B/row, 456 B", "wrong");
+        CHECK(WyQRBits::bytes(WY_QR_MAX_SIZE) == 23 * 177, "v40 matrix ≤ 4 KB", "wrong");
+        m.qr.set(3, 3, false);
+        CHECK(!m.qr.get(3, 3) && m.qr.get(0, 0), "clear one module", "wrong");
+        m.qr.set(3, 3, true);
+        for (int x = 0; x < 57; x++) m.qr.set(x, 30, m.qr.get(x, 29));
+        CHECK(m.qr.rowEquals(29, 30) && !m.qr.rowEquals(0, 1), "rowEquals", "wrong");
+    }
+
+    SECTION("Bands — v10 at 4 px, 2-module quiet zone");
+    {
+        Matrix m(57);
+        const int mod = 4, quiet = 2;
+        int W = wyQRPixels(57, mod, quiet);
+        Canvas c(W, W);
+        std::vector<uint16_t> band(WY_QR_BAND_BYTES / 2);
+        uint16_t n = wyQRRenderBands(m.qr, mod, quiet, 0x0000, 0xFFFF, band.data(), band.size(), canvasBlit, &c);
+        char msg[64]; snprintf(msg, sizeof(msg), "%u blits", n);
+        CHECK(W == 244, "244 px square", "wrong size");
+        CHECK(n == 16 && c.calls == 16, "8 KB band → 4 module rows per blit → 16 blits (vs 3,249 fillRects)", msg);
+        CHECK(matchesReference(c, m, mod, quiet, 0x0000, 0xFFFF), "pixels == per-module reference", "mismatch");
+    }
+
+    SECTION("Bands — sizes, colours, no quiet zone");
+    {
+        Matrix m(25);
+        bool ok = true;
+        int worst = 0;
+        for (int mod : { 1, 2, 3, 7 })
+            for (int quiet : { 0, 1, 4 }) {
+                int W = wyQRPixels(25, mod, quiet);
+                for (size_t bandPx : { (size_t)W * mod, (size_t)W * mod * 3 + 5, (size_t)W * W }) {
+                    Canvas c(W, W);
+                    std::vector<uint16_t> band(bandPx);
+                    uint16_t n = wyQRRenderBands(m.qr, mod, quiet, 0xF800, 0x07E0, band.data(), bandPx, canvasBlit, &c);
+                    ok &= matchesReference(c, m, mod, quiet, 0xF800, 0x07E0);
+                    if (bandPx == (size_t)W * W) ok &= n == 1;               // whole code fits: one blit
+                    if (n > worst) worst = n;
+                }
+            }
+        CHECK(ok, "mod 1/2/3/7 × quiet 0/1/4 × 3 band sizes: pixels exact", "mismatch");
+        CHECK(worst == 25 + 8, "one-module-row band = one blit per module row", "wrong count");
+        Canvas c(10, 10);
+        uint16_t tiny[4];
+        CHECK(wyQRRenderBands(m.qr, 4, 2, 0, 0xFFFF, tiny, 4, canvasBlit, &c) == 0 && c.calls == 0,
+              "band smaller than a module row → 0, nothing drawn", "drew");
+    }
+
+    SECTION("Runs — no-buffer fallback");
+    {
+        Matrix m(57);
+        const int mod = 4, quiet = 2;
+        int W = wyQRPixels(57, mod, quiet);
+        Canvas c(W, W);
+        uint16_t n = wyQRRenderRuns(m.qr, mod, quiet, 0x0000, 0xFFFF, canvasFill, &c);
+        int dark = 0;
+        for (uint8_t v : m.ref) dark += v;
+        char msg[64]; snprintf(msg, sizeof(msg), "%u fills, %d dark modules", n, dark);
+        CHECK(matchesReference(c, m, mod, quiet, 0x0000, 0xFFFF), "pixels == per-module reference", "mismatch");
+        CHECK(n * 3 < 57 * 57 && n < dark, "runs + repeated rows: < 1/3 of one fill per module", msg);
+        printf("    %s (old renderer: %d)\n", msg, 57 * 57);
+        Matrix s(21);
+        Canvas c2(wyQRPixels(21, 3, 0), wyQRPixels(21, 3, 0));
+        wyQRRenderRuns(s.qr, 3, 0, 0x0000, 0xFFFF, canvasFill, &c2);
+        CHECK(matchesReference(c2, s, 3, 0, 0x0000, 0xFFFF), "v1, no quiet zone: pixels exact", "mismatch");
+    }
+
+    SECTION("Capacity tables — exact, versions 1–40");
+    {
+        gfInit();
+        CHECK(wyQRCapacity(1, WY_QR_ECC_L, WY_QR_MODE_NUMERIC) == 41 && wyQRCapacity(1, WY_QR_ECC_L, WY_QR_MODE_ALNUM) == 25 &&
+              wyQRCapacity(1, WY_QR_ECC_L, WY_QR_MODE_BYTE) == 17 && wyQRCapacity(1, WY_QR_ECC_H, WY_QR_MODE_BYTE) == 7,
+              "v1: L 41/25/17, H byte 7", "wrong");
+        CHECK(wyQRCapacity(10, WY_QR_ECC_M, WY_QR_MODE_BYTE) == 213 && wyQRCapacity(10, WY_QR_ECC_M, WY_QR_MODE_ALNUM) == 311 &&
+              wyQRCapacity(10, WY_QR_ECC_H, WY_QR_MODE_BYTE) == 119, "v10: M byte 213, alnum 311; H byte 119", "wrong");
+        CHECK(wyQRCapacity(40, WY_QR_ECC_L, WY_QR_MODE_NUMERIC) == 7089 && wyQRCapacity(40, WY_QR_ECC_L, WY_QR_MODE_ALNUM) == 4296 &&
+              wyQRCapacity(40, WY_QR_ECC_L, WY_QR_MODE_BYTE) == 2953 && wyQRCapacity(40, WY_QR_ECC_H, WY_QR_MODE_BYTE) == 1273,
+              "v40: L 7089/4296/2953, H byte 1273", "wrong");
+        bool mono = true;
+        for (int e = 0; e < 4; e++)
+            for (int v = 2; v <= 40; v++)
+                for (int m : { WY_QR_MODE_NUMERIC, WY_QR_MODE_ALNUM, WY_QR_MODE_BYTE })
+                    mono &= wyQRCapacity(v, e, m) > wyQRCapacity(v - 1, e, m);
+        for (int v = 1; v <= 40; v++)
+            for (int e = 1; e < 4; e++) mono &= wyQRDataCodewords(v, e) < wyQRDataCodewords(v, e - 1);
+        CHECK(mono, "capacity grows with version, shrinks with ECC", "table typo");
+        CHECK(_wy_qr_raw_modules(1) == 208 && _wy_qr_raw_modules(40) == 29648, "raw modules v1 208, v40 29648", "wrong");
+    }
+
+    SECTION("Encoder — reference codewords");
+    {
+        WyQRPlan p; p.version = 1; p.ecc = WY_QR_ECC_M; p.mode = WY_QR_MODE_NUMERIC;
+        uint8_t d[16] = { 0 }, raw[26];
+        _wy_qr_data("01234567", p, d, 16);
+        _wy_qr_interleave(d, p, raw);
+        const uint8_t iso[26] = { 0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC,
+                                  0x11, 0xEC, 0x11, 0xA5, 0x24, 0xD4, 0xC1, 0xED, 0x36, 0xC7, 0x87, 0x2C, 0x55 };
+        CHECK(memcmp(raw, iso, 26) == 0, "ISO 18004 example \"01234567\" 1-M: data + ECC", "mismatch");
+        p.ecc = WY_QR_ECC_Q; p.mode = WY_QR_MODE_ALNUM;
+        uint8_t d2[13] = { 0 };
+        _wy_qr_data("HELLO WORLD", p, d2, 13);
+        _wy_qr_interleave(d2, p, raw);
+        const uint8_t hw[26] = { 32, 91, 11, 120, 209, 114, 220, 77, 67, 64, 236, 17, 236,
+                                 168, 72, 22, 82, 217, 54, 156, 0, 46, 15, 180, 122, 16 };
+        CHECK(memcmp(raw, hw, 26) == 0, "\"HELLO WORLD\" 1-Q: data + ECC", "mismatch");
+        CHECK(wyQRFormatBits(WY_QR_ECC_M, 0) == 0x5412 && wyQRFormatBits(WY_QR_ECC_L, 0) == 0x77C4 &&
+              wyQRFormatBits(WY_QR_ECC_H, 7) == 0x083B, "format words M0 5412, L0 77C4, H7 083B", "wrong");
+        CHECK(wyQRVersionBits(7) == 0x07C94 && wyQRVersionBits(40) == 0x28C69, "version words v7 07C94, v40 28C69", "wrong");
+    }
+
+    SECTION("Encoder — every version × ECC reads back");
+    {
+        uint32_t seed = 7;
+        int ok = 0, total = 0;
+        std::string firstErr;
+        std::vector<uint8_t> store(WyQRBits::bytes(WY_QR_MAX_SIZE));
+        const char *alpha[3] = { "0123456789", "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:",
+                                 "abcdefghijklmnopqrstuvwxyz{}#!?&=_~0123456789" };
+        for (int v = 1; v <= 40; v++)
+            for (int e = 0; e < 4; e++) {
+                int m = (v + e) % 3;
+                uint8_t mode = m == 0 ? WY_QR_MODE_NUMERIC : m == 1 ? WY_QR_MODE_ALNUM : WY_QR_MODE_BYTE;
+                size_t cap = wyQRCapacity(v, e, mode);
+                std::string t = randomText(seed, cap - (v % 4) * (cap / 10), alpha[m]);
+                WyQRPlan p;
+                bool planned = wyQRPlanFor(t.c_str(), (uint8_t)e, p, true, (uint8_t)v);
+                WyQRBits qr; qr.bits = store.data();
+                std::string back, err;
+                int be = -1, bm = -1;
+                total++;
+                if (!planned || p.version != v || p.mode != mode) err = "plan";
+                else if (!wyQREncode(t.c_str(), p, qr)) err = "encode";
+                else if (qr.size != 17 + 4 * v) err = "size";
+                else err = readBack(qr, back, be, bm);
+                if (err.empty() && (back != t || be != p.ecc)) err = "payload";
+                if (err.empty()) ok++;
+                else if (firstErr.empty()) firstErr = "v" + std::to_string(v) + " ecc" + std::to_string(e) + ": " + err;
+            }
+        char m[96]; snprintf(m, sizeof(m), "%d/%d, first: %s", ok, total, firstErr.c_str());
+        CHECK(ok == total, "160 codes: format, version, timing, finders, RS syndromes, payload", m);
+
+        WyQRPlan p;
+        wyQRPlanFor("HELLO WORLD", WY_QR_ECC_Q, p);
+        bool masks = true;
+        for (int mk = 0; mk < 8; mk++) {
+            WyQRBits qr; qr.bits = store.data();
+            std::string back; int be, bm;
+            masks &= wyQREncode("HELLO WORLD", p, qr, (int8_t)mk) && readBack(qr, back, be, bm).empty() &&
+                     bm == mk && back == "HELLO WORLD";
+        }
+        CHECK(masks, "all 8 forced masks read back", "mask bug");
+    }
+
+    SECTION("Planner — mode, bech32, version, ECC, module count");
+    {
+        WyQRPlan p;
+        CHECK(wyQRPlanFor("0123456789", WY_QR_ECC_M, p) && p.mode == WY_QR_MODE_NUMERIC, "digits → numeric", "wrong mode");
+        CHECK(wyQRPlanFor("HTTPS://WYL.TK/A", WY_QR_ECC_M, p) && p.mode == WY_QR_MODE_ALNUM && !p.upcase,
+              "uppercase URL → alnum", "wrong mode");
+        CHECK(wyQRIsBech32(CKB_ADDR) && wyQRIsBech32("CKB1QZDA0CR08M85") && !wyQRIsBech32("ckb1Qzda0cr08m85") &&
+              !wyQRIsBech32("hello world") && !wyQRIsBech32("ckb1qzdabio0") && !wyQRIsBech32("ckb1qz"),
+              "bech32 detection (charset, one case, length)", "wrong");
+
+        CHECK(wyQRPlanFor(CKB_ADDR, WY_QR_ECC_M, p) && p.mode == WY_QR_MODE_ALNUM && p.upcase, "CKB address → uppercase alnum", "byte");
+        uint8_t alnumVer = p.version, alnumSize = p.size();
+        WyQRPlan pb;
+        wyQRPlanFor(CKB_ADDR, WY_QR_ECC_M, pb, false);
+        char m[96]; snprintf(m, sizeof(m), "alnum v%u (%u modules) vs byte v%u (%u)", alnumVer, alnumSize, pb.version, pb.size());
+        CHECK(alnumVer == 5 && alnumSize == 37 && pb.version == 6 && pb.size() == 41,
+              "97-char CKB address: v5 / 37 modules (byte mode would be v6 / 41)", m);
+        printf("    %s\n", m);
+
+        std::vector<uint8_t> store(WyQRBits::bytes(WY_QR_MAX_SIZE));
+        WyQRBits qr; qr.bits = store.data();
+        std::string back; int be, bm;
+        wyQREncode(CKB_ADDR, p, qr);
+        std::string up = CKB_ADDR;
+        for (char &c : up) c = (char)toupper(c);
+        CHECK(readBack(qr, back, be, bm).empty() && back == up, "address reads back uppercase", "mismatch");
+
+        CHECK(wyQRPlanFor("A", WY_QR_ECC_M, p) && p.version == 1 && p.ecc == WY_QR_ECC_H, "tiny payload → v1, ECC boosted to H", "no boost");
+        CHECK(wyQRPlanFor("ckb:ckb1abc?amount=1", WY_QR_ECC_M, p) && p.mode == WY_QR_MODE_BYTE, "URI with '?=' stays byte", "wrong mode");
+
+        // CKB payment URI beyond the old v10 ceiling (154 bytes)
+        std::string uri = std::string("nervos:") + CKB_ADDR + "?amount=123456.78901234&memo=" + std::string(150, 'x');
+        CHECK(wyQRPlanFor(uri.c_str(), WY_QR_ECC_M, p) && p.version > 10 && wyQRCapacity(p.version, WY_QR_ECC_M, WY_QR_MODE_BYTE) >= uri.size() &&
+              wyQRCapacity(p.version - 1, WY_QR_ECC_M, WY_QR_MODE_BYTE) < uri.size(),
+              "283-byte URI → smallest version that fits (> v10)", "wrong version");
+        snprintf(m, sizeof(m), "%zu-byte URI → v%u, %u modules, ECC %c", uri.size(), p.version, p.size(), "LMQH"[p.ecc]);
+        printf("    %s\n", m);
+
+        std::string max(2953, 'z');
+        CHECK(wyQRPlanFor(max.c_str(), WY_QR_ECC_L, p) && p.version == 40 && p.size() == 177, "2953 bytes at L → v40, 177 modules", "wrong");
+        max += 'z';
+        CHECK(!wyQRPlanFor(max.c_str(), WY_QR_ECC_L, p), "2954 bytes → doesn't fit", "fit");
+    }
+
+    SECTION("Encoder — time");
+    {
+        std::vector<uint8_t> store(WyQRBits::bytes(WY_QR_MAX_SIZE));
+        using clk = std::chrono::steady_clock;
+        struct Case { const char *name; std::string text; uint8_t ecc; } cases[] = {
+            { "CKB address (v5)", CKB_ADDR, WY_QR_ECC_M },
+            { "200-byte URI", std::string("nervos:") + CKB_ADDR + "?amount=" + std::string(88, '9'), WY_QR_ECC_M },
+            { "v40 L, 2953 bytes", std::string(2953, 'q'), WY_QR_ECC_L },
+        };
+        double worst = 0;
+        for (auto &c : cases) {
+            WyQRPlan p;
+            wyQRPlanFor(c.text.c_str(), c.ecc, p);
+            WyQRBits qr; qr.bits = store.data();
+            int n = p.version > 20 ? 5 : 50;
+            auto t0 = clk::now();
+            for (int i = 0; i < n; i++) wyQREncode(c.text.c_str(), p, qr);
+            double us = std::chrono::duration<double, std::micro>(clk::now() - t0).count() / n;
+            printf("    %-20s v%-2u %3u modules  %8.0f us\n", c.name, p.version, qr.size, us);
+            if (us > worst) worst = us;
+        }
+        CHECK(worst < 100000, "v40 encode < 100 ms on the host", "slow");
+    }
+
+    SECTION("Cache — LRU of encoded payloads");
+    {
+        WyQRCache cache;
+        CHECK(cache.get("ckb1qzda", 1) == nullptr && cache.misses() == 1, "empty → miss", "hit");
+        WyQRBits *a = cache.reserve("ckb1qzda", 1, 21, 1);
+        CHECK(a && a->size == 21 && a->bits && !a->get(20, 20), "reserve → zeroed 21×21", "bad entry");
+        a->set(5, 5, true);
+        WyQRBits *hit = cache.get("ckb1qzda", 1);
+        CHECK(hit == a && hit->get(5, 5) && cache.hits() == 1, "same text + ecc → same matrix", "miss");
+        CHECK(cache.get("ckb1qzda", 3) == nullptr, "different ecc → miss", "hit");
+        CHECK(cache.get("ckb1qzdb", 1) == nullptr, "different text → miss", "hit");
+
+        char key[16];
+        for (int i = 0; i < WY_QR_CACHE; i++) {          // fill, touching "ckb1qzda" each time
+            snprintf(key, sizeof(key), "pay-%d", i);
+            cache.reserve(key, 1, 25, 2);
+            cache.get("ckb1qzda", 1);
+        }
+        CHECK(cache.count() == WY_QR_CACHE, "count capped at WY_QR_CACHE", "wrong count");
+        CHECK(cache.get("ckb1qzda", 1) != nullptr, "recently used entry survives", "evicted");
+        CHECK(cache.get("pay-0", 1) == nullptr, "least recently used evicted", "kept");
+        snprintf(key, sizeof(key), "pay-%d", WY_QR_CACHE - 1);
+        WyQRBits *last = cache.get(key, 1);
+        CHECK(last != nullptr, "newest entry kept", "evicted");
+        cache.drop(last);
+        CHECK(cache.get(key, 1) == nullptr && cache.count() == WY_QR_CACHE - 1, "drop() forgets it", "still there");
+        cache.clear();
+        CHECK(cache.count() == 0, "clear()", "entries left");
+    }
+
+    printf("\n========================================\n");
+    printf("  Results: %d passed, %d failed\n", _pass, _fail);
+    printf("========================================\n");
+    return _fail ? 1 : 0;
+}
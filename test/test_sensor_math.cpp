@@ -9,6 +9,7 @@
 //   WyHCSR04— echo duration → distance (temperature-compensated SoS)
 //   WyGUVAS12SD — ADC → UVI conversion
 //   WySensorData — struct defaults and field behaviour
+//   (start()/poll() and sweep timing run on the real headers: test_sensors.cpp)
 
 #include <stdio.h>
 #include <math.h>
@@ -0,0 +1,219 @@
+// test_sensors.cpp — WySensors start()/poll() machinery on a host clock
+// Compiles the real src/sensors/WySensors.h against test/host/ (Arduino
+// shim: millis() is a virtual clock that delay() advances).
+//
+// Build: g++ -std=c++17 -DHOST_TEST -Itest/host -Isrc test/test_sensors.cpp -o test/test_sensors
+//
+// Covers:
+//   WyAnalogSampler — sample count, spacing, settle time, mean, run()
+//   WySensorBase    — startMeasurement()/poll(), _measure() and its timeout,
+//                     default poll() wrapping a blocking read()
+//   WySensors       — start()/poll()/sweep() overlap, result(), sweep timeout
+//                     leaving a hung sensor busy without a result
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "sensors/WySensors.h"
+
+static int _pass=0, _fail=0;
+#define PASS(n)         do{printf("  PASS: %s\n",n);_pass++;}while(0)
+#define FAIL(n,m)       do{printf("  FAIL: %s  (%s)\n",n,m);_fail++;}while(0)
+#define CHECK(c,n,m)    do{if(c)PASS(n);else FAIL(n,m);}while(0)
+#define SECTION(s)      printf("\n  [%s]\n",s)
+
+static int adcCycle(int) { return 1000 + (int)(wyHost().adcCalls % 3); }   // 1001, 1002, 1000, ...
+
+static void resetAdc(uint32_t now) {
+    WyHostClock &h = wyHost();
+    h.now = now; h.adcCalls = 0; h.adcLastAt = 0; h.adcMinGap = 0xFFFFFFFF;
+    h.adc = adcCycle;
+}
+
+// A conversion that takes convMs, the way the I2C / 1-Wire drivers do it.
+// pin = conversion ms, pin2 == 1 = never reports done (unplugged mid-sweep).
+class TimedSensor : public WySensorBase {
+public:
+    uint32_t ms; bool stuck;
+    uint32_t starts = 0;
+    TimedSensor(WyGPIOPins p) : ms((uint32_t)p.pin), stuck(p.pin2 == 1) {}
+
+    const char*  driverName() override { return "TIMED"; }
+    bool         begin() override { return true; }
+    WySensorData read() override { return _measure(500); }
+
+    bool startMeasurement() override {
+        _start();
+        _wait(ms);
+        starts++;
+        return true;
+    }
+    bool poll() override {
+        if (!_busy) return _done;
+        if (stuck || _waiting()) return false;
+        WySensorData d;
+        d.temperature = (float)ms;
+        d.ok = true;
+        _finish(d);
+        return true;
+    }
+};
+
+// A driver with only a blocking read() — uses the default poll()
+class BlockingSensor : public WySensorBase {
+public:
+    uint32_t ms, reads = 0;
+    BlockingSensor(WyGPIOPins p) : ms((uint32_t)p.pin) {}
+    const char*  driverName() override { return "BLOCK"; }
+    bool         begin() override { return true; }
+    WySensorData read() override {
+        delay(ms);
+        reads++;
+        WySensorData d; d.raw = 42; d.ok = true;
+        return d;
+    }
+};
+
+int main() {
+    printf("\n========================================\n");
+    printf("  WySensors start/poll tests\n");
+    printf("========================================\n");
+
+    SECTION("WyAnalogSampler");
+    {
+        WyAnalogSampler s;
+        resetAdc(100);
+        s.start(34, 8, 2, 80);                      // soil probe: 80ms settle, 8 × 2ms
+        while (!s.poll()) delay(1);
+        WyHostClock &h = wyHost();
+        CHECK(h.adcCalls == 8, "exactly n samples", "wrong count");
+        CHECK(h.adcMinGap >= 2, "samples >= gapMs apart", "too close");
+        CHECK(h.now - 100 == 80 + 7 * 2, "done at settle + (n-1)*gap", "wrong finish time");
+        CHECK(s.mean() >= 1000 && s.mean() <= 1002, "integer mean", "wrong mean");
+        CHECK(s.poll() && h.adcCalls == 8, "poll() after done stays true, no extra read", "reset");
+
+        WyAnalogSampler z;
+        z.start(34, 0);
+        CHECK(z.poll() && h.adcCalls == 9, "n=0 treated as 1", "no sample");
+
+        // Two samplers interleave on one clock without stretching each other
+        WyAnalogSampler a, b;
+        h.now = 1000;
+        a.start(1, 16, 2); b.start(2, 5, 2);
+        bool ad = false, bd = false; uint32_t aAt = 0, bAt = 0;
+        while (!(ad && bd)) {
+            if (!ad && a.poll()) { ad = true; aAt = h.now - 1000; }
+            if (!bd && b.poll()) { bd = true; bAt = h.now - 1000; }
+            delay(1);
+        }
+        CHECK(aAt == 30 && bAt == 8, "two in flight keep their own pace", "interference");
+
+        resetAdc(2000);
+        uint16_t m = a.run(3, 4, 5, 10);
+        CHECK(m >= 1000 && m <= 1002 && h.now - 2000 == 10 + 3 * 5 && h.adcMinGap >= 5,
+              "run(): blocking form, same spacing", "wrong timing");
+    }
+
+    SECTION("WySensorBase: start / poll / _measure");
+    {
+        wyHost().now = 0;
+        TimedSensor t({40, -1});
+        CHECK(!t.busy() && !t.resultReady(), "idle before start", "state");
+        t.startMeasurement();
+        CHECK(t.busy() && !t.poll() && !t.resultReady(), "converting: poll() false", "finished early");
+        delay(39);
+        CHECK(!t.poll(), "not done at 39 ms", "finished early");
+        delay(1);
+        CHECK(t.poll() && t.resultReady() && !t.busy() && t.result().ok && t.result().temperature == 40,
+              "done at conversion time, result() holds it", "no result");
+        CHECK(t.poll(), "poll() after done stays true", "reset");
+
+        wyHost().now = 1000;
+        WySensorData d = t.read();
+        CHECK(d.ok && wyHost().now - 1000 == 40, "read() = _measure(): blocks for the conversion", "wrong");
+
+        TimedSensor hung({10, 1});
+        wyHost().now = 5000;
+        d = hung.read();
+        CHECK(!d.ok && d.error && strcmp(d.error, "timeout") == 0 && !hung.busy() && hung.resultReady(),
+              "_measure() timeout: error result, no longer busy", "hung");
+        CHECK(wyHost().now - 5000 == 501, "_measure() gives up after timeoutMs", "wrong bound");
+
+        BlockingSensor b({25});
+        wyHost().now = 0;
+        b.startMeasurement();
+        CHECK(b.busy() && b.poll() && b.reads == 1 && b.result().ok && b.result().raw == 42,
+              "default poll(): runs read() once and finishes", "wrong");
+        CHECK(b.poll() && b.reads == 1, "default poll() after done: no second read", "re-read");
+    }
+
+    SECTION("WySensors: overlapped sweep");
+    {
+        // DS18B20 12-bit, VEML7700 100ms IT, SGP30, AHT20, soil probe
+        const uint32_t ms[] = { 750, 105, 12, 80, 80 + 7 * 2 };
+        const int n = sizeof(ms) / sizeof(ms[0]);
+        WySensors reg;
+        TimedSensor *s[n];
+        uint32_t sum = 0, mx = 0;
+        char name[8];
+        for (int i = 0; i < n; i++) {
+            snprintf(name, sizeof(name), "s%d", i);
+            s[i] = reg.addGPIO<TimedSensor>(name, (int8_t)0, -1);
+            s[i]->ms = ms[i];
+            sum += ms[i]; if (ms[i] > mx) mx = ms[i];
+        }
+        reg.begin();
+        CHECK(reg.result("s0").error && strcmp(reg.result("s0").error, "no result yet") == 0,
+              "result() before any sweep: no result yet", "stale");
+
+        wyHost().now = 5000;
+        uint8_t ok = reg.sweep(3000);
+        uint32_t took = wyHost().now - 5000;
+        CHECK(ok == n, "every sensor finishes", "one missing");
+        CHECK(took == mx, "sweep costs the slowest conversion", "not max");
+        CHECK(took < sum, "cheaper than sequential reads", "no overlap");
+        printf("    sequential %u ms  →  swept %u ms\n", (unsigned)sum, (unsigned)took);
+        CHECK(reg.result("s1").ok && reg.result("s1").temperature == 105, "result(name) after sweep", "wrong");
+
+        // Manual start()/poll() from loop(): returns at once, finishes later
+        wyHost().now = 9000;
+        reg.start();
+        uint32_t polls = 0;
+        while (!reg.poll()) { delay(10); polls++; }
+        CHECK(polls == 75 && s[0]->starts == 2, "start() + poll() from loop(): never blocks", "blocked");
+
+        // Blocking drivers ride along through the default poll()
+        WySensors mixed;
+        TimedSensor *slow = mixed.addGPIO<TimedSensor>("slow", (int8_t)0, -1);
+        slow->ms = 188;
+        BlockingSensor *blk = mixed.addGPIO<BlockingSensor>("blk", (int8_t)0, -1);
+        mixed.begin();
+        wyHost().now = 20000;
+        ok = mixed.sweep(3000);
+        CHECK(ok == 2 && blk->reads == 1 && wyHost().now - 20000 == 188,
+              "zero-wait drivers ride along", "stalled");
+    }
+
+    SECTION("WySensors: sweep timeout");
+    {
+        WySensors reg;
+        TimedSensor *good = reg.addGPIO<TimedSensor>("good", (int8_t)0, -1);
+        TimedSensor *hung = reg.addGPIO<TimedSensor>("hung", (int8_t)0, 1);
+        good->ms = 20; hung->ms = 0;
+        reg.begin();
+        wyHost().now = 30000;
+        uint8_t ok = reg.sweep(300);
+        uint32_t took = wyHost().now - 30000;
+        CHECK(ok == 1 && reg.result("good").ok, "healthy sensor still ok", "lost");
+        CHECK(hung->busy() && !hung->resultReady() && reg.result("hung").error &&
+              strcmp(reg.result("hung").error, "no result yet") == 0,
+              "hung sensor left busy, without a result", "fake result");
+        CHECK(took == 301, "gives up after timeoutMs", "wrong bound");
+        CHECK(!reg.poll(), "poll() still reports the straggler", "dropped");
+    }
+
+    printf("\n========================================\n");
+    printf("  Results: %d passed, %d failed\n", _pass, _fail);
+    printf("========================================\n");
+    return _fail ? 1 : 0;
+}
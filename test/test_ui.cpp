@@ -0,0 +1,539 @@
+// test_ui.cpp — WyUI retained widget tree, damage regions, nav stack cache
+// No Arduino SDK required — exercises the pure WyUICore.h layer through
+// WyFbPainter (an in-memory RGB565 framebuffer).
+//
+// Build: g++ -std=c++17 -DHOST_TEST -Isrc test/test_ui.cpp -o /tmp/wytest_ui
+//
+// Covers:
+//   WyRect / WyDamage — intersect / unite, covered rects dropped, absorbed
+//                       rects, aligned neighbours merged, overflow merge
+//   Frame pass        — first frame paints the screen once, idle frames
+//                       paint nothing, every incremental frame leaves the
+//                       framebuffer identical to a from-scratch render
+//   Widgets           — label text box damage, value no-op when the
+//                       printed text is unchanged, list row damage,
+//                       overlapping siblings, hide / show, chart, image
+//   WyStack           — fixed + grow sizes, gaps, padding, relayout damage
+//   Touch             — button click, drag-off cancel, list select + scroll
+//   Nav stack         — push / pop with and without the screen cache,
+//                       changes made while covered, pixels per "back"
+//   WyTrendChart      — scroll (framebuffer) and span-diff (no scroll)
+//                       updates stay identical to a full render, pixels
+//                       per sample, labels only on range change, column
+//                       decimation, resize; benchmark vs full redraw
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <chrono>
+#include <math.h>
+
+#include "ui/WyUICore.h"
+#include "ui/WyTrendChart.h"
+
+static int _pass=0, _fail=0;
+#define PASS(n)         do{printf("  PASS: %s\n",n);_pass++;}while(0)
+#define FAIL(n,m)       do{printf("  FAIL: %s  (%s)\n",n,m);_fail++;}while(0)
+#define CHECK(c,n,m)    do{if(c)PASS(n);else FAIL(n,m);}while(0)
+#define SECTION(s)      printf("\n  [%s]\n",s)
+
+// ── Harness ─────────────────────────────────────────────────────────────────
+static const uint16_t W = 320, H = 240;
+
+/* Paint screen s from scratch into a fresh framebuffer; compare with fb.
+   Only call with s's damage already painted (right after frame()). */
+static bool matchesFresh(WyScreen &s, const WyFbPainter &fb) {
+    WyFbPainter ref(W, H);
+    WyUICore ui;
+    ui.begin(&ref);
+    ui.push(&s);
+    ui.frame();
+    return memcmp(ref.pixels(), fb.pixels(), (size_t)W * H * 2) == 0;
+}
+
+/* A panel without a framebuffer: no scrolling, like an SPI TFT */
+class NoScrollPainter : public WyFbPainter {
+public:
+    NoScrollPainter(uint16_t w, uint16_t h) : WyFbPainter(w, h) {}
+protected:
+    bool _scroll(const WyRect &, int16_t) override { return false; }
+};
+
+static float wave(int i) { return 20.0f + 4.0f * sinf(i * 0.05f) + (float)((i * 7919) % 13) * 0.05f; }
+
+static int _clicks = 0;
+static void onClick(WyWidget *, void *) { _clicks++; }
+static int16_t _picked = -2;
+static void onPick(WyWidget *, int16_t i, void *) { _picked = i; }
+
+int main() {
+    printf("\n========================================\n");
+    printf("  WyUI retained widget tree tests\n");
+    printf("========================================\n");
+
+    SECTION("WyRect / WyDamage");
+    {
+        WyRect a = { 10, 10, 20, 20 }, b = { 25, 5, 10, 10 };
+        CHECK(a.intersect(b) == (WyRect{ 25, 10, 5, 5 }) && a.unite(b) == (WyRect{ 10, 5, 25, 25 }),
+              "intersect / unite", "wrong rect");
+        CHECK(a.intersect(WyRect{ 30, 10, 5, 5 }).empty() && !a.intersects(WyRect{ 30, 10, 5, 5 }),
+              "touching edges don't intersect", "overlap");
+
+        WyDamage d;
+        d.add(WyRect{ 0, 0, 100, 100 });
+        d.add(WyRect{ 10, 10, 5, 5 });
+        CHECK(d.count() == 1 && d.area() == 10000, "covered rect dropped", "added");
+        d.add(WyRect{ 0, 0, 200, 200 });
+        CHECK(d.count() == 1 && d.area() == 40000, "covering rect absorbs", "not absorbed");
+
+        WyDamage e;
+        e.add(WyRect{ 0, 0, 50, 10 });
+        e.add(WyRect{ 0, 10, 50, 10 });
+        CHECK(e.count() == 1 && e[0] == (WyRect{ 0, 0, 50, 20 }), "aligned neighbours merge for free", "split");
+        e.add(WyRect{ 200, 200, 10, 10 });
+        CHECK(e.count() == 2, "distant rect kept separate", "merged");
+
+        WyDamage f;
+        for (int i = 0; i < WY_UI_DAMAGE_MAX + 3; i++) f.add(WyRect{ (int16_t)(i * 30), (int16_t)(i * 20), 8, 8 });
+        bool all = true;
+        for (int i = 0; i < WY_UI_DAMAGE_MAX + 3; i++)
+            if (f.within(WyRect{ (int16_t)(i * 30), (int16_t)(i * 20), 8, 8 }).area() != 64) all = false;
+        CHECK(f.count() <= WY_UI_DAMAGE_MAX && all, "overflow merges, nothing lost", "rect dropped");
+    }
+
+    SECTION("Frame pass — first, idle and incremental frames");
+    {
+        WyFbPainter fb(W, H);
+        WyUICore ui;
+        ui.begin(&fb);
+        WyScreen s(0x1082);
+        WyLabel title("Greenhouse", 3, 0xFFFF, 0x2945, WY_ALIGN_CENTER);
+        WyValue temp(1, " C", 4, 0x07FF, 0x1082);
+        WyLabel status("ok", 2, 0x8410, 0x1082);
+        title.setBounds(0, 0, W, 40);
+        temp.setBounds(20, 60, 280, 60);
+        status.setBounds(0, 200, W, 40);
+        s.add(&title); s.add(&temp); s.add(&status);
+        temp.setValue(21.4f);
+
+        CHECK(ui.push(&s) && ui.frame(), "first frame paints", "nothing drawn");
+        uint32_t first = fb.pixelCount;
+        CHECK(first >= (uint32_t)W * H && first < (uint32_t)W * H * 3 / 2,
+              "first frame ≈ one screen of pixels", "too many / few");
+        printf("    first frame %u px (screen %u)\n", first, W * H);
+        CHECK(matchesFresh(s, fb), "first frame matches reference", "mismatch");
+
+        fb.pixelCount = 0;
+        CHECK(!ui.frame() && fb.pixelCount == 0, "idle frame paints nothing", "painted");
+
+        temp.setValue(21.44f);                                           /* prints the same */
+        CHECK(s.damage().empty() && !ui.frame(), "value: same printed text → no damage", "damaged");
+
+        temp.setValue(21.5f);
+        CHECK(!s.damage().empty() && s.damage().area() < temp.bounds().area(),
+              "value change damages the text box, not the widget", "whole widget");
+        ui.frame();
+        uint32_t upd = fb.pixelCount;
+        printf("    value update %u px (%.1f%% of screen)\n", upd, 100.0 * upd / (W * H));
+        CHECK(upd > 0 && upd < (uint32_t)temp.bounds().area(), "value update < widget area", "too many");
+        CHECK(matchesFresh(s, fb), "after value update matches reference", "mismatch");
+
+        status.setText("sensor timeout");                                 /* longer text */
+        ui.frame();
+        status.setText("ok");                                             /* shorter: old box cleared */
+        ui.frame();
+        CHECK(matchesFresh(s, fb), "longer then shorter text leaves no residue", "residue");
+
+        title.setColors(0xFFE0, 0x2945);
+        temp.setValue(-3.0f);
+        status.setVisible(false);
+        ui.frame();
+        CHECK(matchesFresh(s, fb), "several changes in one frame", "mismatch");
+        status.setVisible(true);
+        ui.frame();
+        CHECK(matchesFresh(s, fb), "hide then show", "mismatch");
+
+        /* Randomised: many small updates, check against a fresh render every time */
+        uint32_t seed = 7;
+        bool ok = true;
+        for (int i = 0; i < 200 && ok; i++) {
+            seed = seed * 1103515245u + 12345u;
+            switch ((seed >> 16) % 4) {
+                case 0: temp.setValue((float)((seed >> 8) % 1000) / 10.0f); break;
+                case 1: status.setText((seed >> 20) & 1 ? "warming" : "idle"); break;
+                case 2: title.setAlign((WyAlign)((seed >> 18) % 3)); break;
+                case 3: status.setVisible((seed >> 19) & 1); break;
+            }
+            ui.frame();
+            ok = matchesFresh(s, fb);
+        }
+        CHECK(ok, "200 random updates, framebuffer always exact", "diverged");
+    }
+
+    SECTION("Overlap, image, chart");
+    {
+        WyFbPainter fb(W, H);
+        WyUICore ui;
+        ui.begin(&fb);
+        WyScreen s(0x0000);
+        WyLabel under("background text here", 2, 0xFFFF, 0x001F);
+        WyButton over("OK", onClick, nullptr);
+        under.setBounds(10, 10, 300, 60);
+        over.setBounds(200, 30, 80, 60);                                  /* sits on the label */
+        s.add(&under); s.add(&over);
+        std::vector<uint16_t> img(32 * 16);
+        for (size_t i = 0; i < img.size(); i++) img[i] = (uint16_t)(i * 2654435761u >> 16);
+        WyImageView pic(img.data(), 32, 16, 0x4208);
+        pic.setBounds(10, 100, 60, 40);
+        s.add(&pic);
+        float data[200];
+        for (int i = 0; i < 200; i++) data[i] = (float)((i * 37) % 91) - 45.0f;
+        WyChart chart(0x07E0, 0x0000);
+        chart.setBounds(80, 100, 230, 120);
+        chart.setData(data, 200);
+        s.add(&chart);
+        ui.push(&s);
+        ui.frame();
+        CHECK(matchesFresh(s, fb), "overlapping widgets, image, chart: first frame", "mismatch");
+        CHECK(fb.at(10 + 14, 100 + 12) == img[0] && fb.at(10 + 14 + 31, 100 + 12 + 15) == img[32 * 16 - 1],
+              "image centred in its bounds", "wrong place");
+
+        under.setText("changed text under the button!");
+        ui.frame();
+        CHECK(matchesFresh(s, fb), "label under a button: button repainted on top", "button lost");
+        CHECK(fb.at(205, 60) == 0x2945, "button face intact", "overdrawn");
+
+        fb.pixelCount = 0;
+        float few[3] = { 1, 5, 2 };
+        chart.setData(few, 3, 0, 10);
+        ui.frame();
+        CHECK(matchesFresh(s, fb) && fb.pixelCount <= (uint32_t)chart.bounds().area() * 2,
+              "chart: sparse data, fixed range", "mismatch");
+    }
+
+    SECTION("WyStack layout");
+    {
+        WyFbPainter fb(W, H);
+        WyUICore ui;
+        ui.begin(&fb);
+        WyScreen s;
+        WyStack col(true, 6, 8);
+        WyLabel a("top", 2), b("middle", 2), c("bottom", 2);
+        WyButton d("wide");
+        col.setBounds(0, 0, W, H);
+        a.setSize(0, 30); b.setGrow(1); c.setGrow(1); d.setSize(100, 40);
+        s.add(&col);
+        col.add(&a); col.add(&b); col.add(&c); col.add(&d);
+        ui.push(&s);
+        ui.frame();
+        /* inner 224: 30 + 40 fixed, 3 gaps of 6 = 18 → 136 for two growers */
+        CHECK(a.bounds() == (WyRect{ 8, 8, 304, 30 }) && b.bounds() == (WyRect{ 8, 44, 304, 68 }) &&
+              c.bounds() == (WyRect{ 8, 118, 304, 68 }) && d.bounds() == (WyRect{ 8, 192, 100, 40 }),
+              "fixed + grow + gap + padding", "wrong bounds");
+        CHECK(matchesFresh(s, fb), "stack first frame", "mismatch");
+
+        fb.pixelCount = 0;
+        a.setSize(0, 50);                                                 /* pushes the growers */
+        ui.frame();
+        CHECK(b.bounds() == (WyRect{ 8, 64, 304, 58 }) && d.bounds().y == 192, "relayout on size change",
+              "not relaid");
+        CHECK(matchesFresh(s, fb) && fb.pixelCount < (uint32_t)W * H,
+              "relayout repaints the moved widgets only", "mismatch / full screen");
+
+        fb.pixelCount = 0;
+        c.setVisible(false);
+        ui.frame();
+        CHECK(b.bounds().h == 122 && matchesFresh(s, fb), "hidden child gives its space away", "wrong");
+    }
+
+    SECTION("Touch — button, list");
+    {
+        WyFbPainter fb(W, H);
+        WyUICore ui;
+        ui.begin(&fb);
+        WyScreen s;
+        WyButton btn("Tap", onClick);
+        btn.setBounds(10, 10, 100, 40);
+        static const char *items[] = { "alpha", "bravo", "charlie", "delta", "echo", "foxtrot",
+                                       "golf", "hotel", "india", "juliet", "kilo", "lima" };
+        WyList list(30);
+        list.setBounds(10, 60, 200, 150);                                 /* 5 rows visible */
+        list.setItems(items, 12);
+        list.onSelect(onPick);
+        s.add(&btn); s.add(&list);
+        ui.push(&s);
+        ui.frame();
+
+        ui.touch(50, 30, true);
+        CHECK(btn.pressed(), "press highlights", "not pressed");
+        ui.frame();
+        CHECK(fb.at(50, 12) == 0x0475, "pressed face painted", "not painted");
+        ui.touch(50, 30, false);
+        ui.frame();
+        CHECK(_clicks == 1 && !btn.pressed() && fb.at(50, 12) == 0x2945, "release inside clicks", "no click");
+
+        ui.touch(50, 30, true);
+        ui.touch(250, 200, true);                                         /* drag off */
+        CHECK(!btn.pressed(), "drag off un-highlights", "still pressed");
+        ui.touch(250, 200, false);
+        CHECK(_clicks == 1, "release outside doesn't click", "clicked");
+
+        ui.frame();
+        fb.pixelCount = 0;
+        ui.touch(50, 60 + 2 * 30 + 5, true);
+        ui.touch(50, 60 + 2 * 30 + 5, false);
+        CHECK(_picked == 2 && list.selected() == 2, "tap selects row", "wrong row");
+        ui.frame();
+        CHECK(fb.pixelCount <= 200 * 30 + 8 * 12 * 16 && matchesFresh(s, fb),
+              "selection repaints one row", "too many px / mismatch");
+        fb.pixelCount = 0;
+        list.setSelected(3);
+        ui.frame();
+        CHECK(fb.pixelCount <= 2 * (200 * 30 + 8 * 12 * 16) && matchesFresh(s, fb),
+              "moving the selection repaints two rows", "too many px / mismatch");
+
+        ui.touch(50, 200, true);
+        ui.touch(50, 140, true);                                          /* drag up two rows */
+        ui.touch(50, 140, false);
+        CHECK(list.top() == 2 && _picked == 2, "drag scrolls, doesn't select", "wrong");
+        ui.frame();
+        CHECK(matchesFresh(s, fb), "scrolled list", "mismatch");
+        CHECK(ui.hitTest(50, 30) == &btn && ui.hitTest(300, 230) == nullptr, "hitTest", "wrong widget");
+    }
+
+    SECTION("Nav stack — screen cache");
+    {
+        WyFbPainter fb(W, H);
+        WyUICore ui;
+        ui.begin(&fb);
+        WyScreen home(0x1082), detail(0x0000);
+        WyLabel hTitle("Home", 3, 0xFFFF, 0x1082, WY_ALIGN_CENTER);
+        WyValue hTemp(1, " C", 4, 0x07FF, 0x1082);
+        WyList hList(24);
+        static const char *rows[] = { "one", "two", "three", "four", "five", "six", "seven" };
+        hTitle.setBounds(0, 0, W, 40);
+        hTemp.setBounds(0, 40, W, 60);
+        hList.setBounds(0, 100, W, 140);
+        hList.setItems(rows, 7);
+        home.add(&hTitle); home.add(&hTemp); home.add(&hList);
+        WyLabel dTitle("Detail", 3, 0xFFFF, 0x0000);
+        dTitle.setBounds(0, 0, W, 40);
+        detail.add(&dTitle);
+
+        /* Without the cache: back repaints the whole screen */
+        ui.push(&home);
+        ui.frame();
+        ui.push(&detail);
+        ui.frame();
+        CHECK(ui.depth() == 2 && !ui.cached(0), "push without cache", "cached");
+        fb.pixelCount = 0;
+        ui.pop();
+        ui.frame();
+        uint32_t repaint = fb.pixelCount;
+        CHECK(ui.depth() == 1 && matchesFresh(home, fb), "pop repaints", "mismatch");
+
+        ui.cacheScreens(true);
+        ui.push(&detail);
+        ui.frame();
+        CHECK(ui.cached(0), "push with cache keeps a copy of home", "no copy");
+        fb.pixelCount = 0;
+        ui.pop();
+        uint32_t blit = fb.pixelCount;
+        bool painted = ui.frame();
+        CHECK(blit == (uint32_t)W * H && !painted && !ui.cached(0) && matchesFresh(home, fb),
+              "pop = one full-screen blit, nothing else", "extra work / mismatch");
+        printf("    back: repaint %u px vs one blit of %u px\n", repaint, blit);
+
+        ui.push(&detail);
+        ui.frame();
+        hTemp.setValue(30.2f);                                            /* changes while covered */
+        hList.setSelected(1);
+        fb.pixelCount = 0;
+        ui.pop();
+        ui.frame();
+        CHECK(fb.pixelCount > (uint32_t)W * H && fb.pixelCount < (uint32_t)W * H * 5 / 4 &&
+              matchesFresh(home, fb), "changes made while covered land after the blit", "stale / mismatch");
+
+        CHECK(!ui.pop() && ui.depth() == 1, "pop at root refuses", "popped");
+        WyScreen many[WY_UI_NAV_DEPTH];
+        int pushed = 0;
+        for (int i = 0; i < WY_UI_NAV_DEPTH; i++) if (ui.push(&many[i])) pushed++;
+        CHECK(pushed == WY_UI_NAV_DEPTH - 1, "depth limit", "overflow");
+        while (ui.pop()) ui.frame();
+        CHECK(matchesFresh(home, fb), "unwind to root through cached screens", "mismatch");
+
+        ui.replace(&detail);
+        ui.frame();
+        CHECK(ui.depth() == 1 && ui.top() == &detail && matchesFresh(detail, fb), "replace", "wrong");
+    }
+
+    SECTION("WyTrendChart — incremental scrolling");
+    {
+        const int N = 1500;
+        struct { const char *name; WyFbPainter *fb; } modes[2];
+        WyFbPainter fbScroll(W, H);
+        NoScrollPainter fbDiff(W, H);
+        modes[0] = { "scroll", &fbScroll };
+        modes[1] = { "diff", &fbDiff };
+        for (auto &m : modes) {
+            WyUICore ui;
+            ui.begin(m.fb);
+            WyScreen s(0x0000);
+            WyTrendChart ch(0x07E0, 0x0000, 0x8410, 1);
+            ch.setBounds(0, 60, W, 120);
+            ch.setRange(10, 30);
+            s.add(&ch);
+            ui.push(&s);
+            ui.frame();
+            bool ok = true;
+            uint32_t worst = 0;
+            for (int i = 0; i < N; i++) {
+                m.fb->pixelCount = 0;
+                ch.push(wave(i));
+                ui.frame();
+                if (i > ch.columns() && m.fb->pixelCount > worst) worst = m.fb->pixelCount;
+                if (i % 97 == 0 || i == N - 1) ok = ok && matchesFresh(s, *m.fb);
+            }
+            char name[64];
+            snprintf(name, sizeof(name), "%s: incremental frames match a full render", m.name);
+            CHECK(ok && ch.rangeChanges == 1, name, "diverged");
+            printf("    %s: worst %u px per sample once full (plot %d px)\n", m.name, worst, ch.plotRect().area());
+            snprintf(name, sizeof(name), "%s: px per sample bounded", m.name);
+            uint32_t cap = m.fb == &fbScroll ? 3u * 120 : (uint32_t)ch.plotRect().area() / 10;
+            CHECK(worst > 0 && worst <= cap, name, "too many pixels");
+        }
+
+        /* Auto range: labels drawn once, redrawn only when the range moves */
+        {
+            WyFbPainter fb(W, H);
+            WyUICore ui;
+            ui.begin(&fb);
+            WyScreen s;
+            WyTrendChart ch(0x07E0, 0x0000, 0x8410, 0);
+            ch.setBounds(0, 0, 200, 100);
+            s.add(&ch);
+            ui.push(&s);
+            for (int i = 0; i < 50; i++) { ch.push(400.0f + (i % 10)); ui.frame(); }
+            uint32_t changes = ch.rangeChanges;
+            fb.framebuffer()[50 * W + 2] = 0xF81F;                            /* sentinel in the gutter */
+            for (int i = 0; i < 300; i++) { ch.push(400.0f + (i * 3) % 10); ui.frame(); }
+            CHECK(ch.rangeChanges == changes && fb.at(2, 50) == 0xF81F && ch.lo() <= 400 && ch.hi() >= 409,
+                  "in-range samples never touch the axis labels", "labels redrawn");
+            ch.push(480.0f);
+            ui.frame();
+            CHECK(ch.rangeChanges == changes + 1 && fb.at(2, 50) != 0xF81F && ch.hi() >= 480 &&
+                  matchesFresh(s, fb), "out-of-range sample: new range, labels redrawn", "stale axis");
+            for (int i = 0; i < 200; i++) { ch.push(402.0f); ui.frame(); }
+            CHECK(ch.hi() < 480 && matchesFresh(s, fb), "spike scrolls out → range shrinks back", "stuck range");
+        }
+
+        /* Non-finite samples are dropped; extreme finite ones don't hang the 1/2/5 rounding */
+        {
+            WyFbPainter fb(W, H);
+            WyUICore ui;
+            ui.begin(&fb);
+            WyScreen s;
+            WyTrendChart ch(0x07E0, 0x0000, 0x8410, 0);
+            ch.setBounds(0, 0, 200, 100);
+            s.add(&ch);
+            ui.push(&s);
+            ch.push(1.0f); ch.push(2.0f); ui.frame();
+            float lo = ch.lo(), hi = ch.hi();
+            uint32_t changes = ch.rangeChanges;
+            ch.push(NAN); ch.push(INFINITY); ch.push(-INFINITY); ui.frame();
+            CHECK(ch.lo() == lo && ch.hi() == hi && ch.rangeChanges == changes && isfinite(ch.lo()) &&
+                  isfinite(ch.hi()) && matchesFresh(s, fb), "NaN / ±INFINITY samples are skipped", "range moved");
+            ch.setRange(-INFINITY, INFINITY);
+            CHECK(ch.lo() == lo && ch.hi() == hi, "setRange(±inf) falls back to auto range", "took inf range");
+            ch.push(-3.4e38f); ch.push(3.4e38f); ui.frame();
+            CHECK(isfinite(ch.lo()) && isfinite(ch.hi()) && ch.lo() < ch.hi(), "±FLT_MAX span: finite range",
+                  "bad range");
+            WyTrendChart tiny(0x07E0, 0x0000, 0x8410, 0);
+            tiny.setBounds(0, 0, 200, 100);
+            tiny.push(1e-40f); tiny.push(1e-40f);
+            CHECK(isfinite(tiny.lo()) && tiny.lo() < tiny.hi(), "denormal samples: finite range", "bad range");
+        }
+
+        /* Decimation: a one-sample spike inside a 10-sample column still shows */
+        {
+            WyFbPainter fb(W, H);
+            WyUICore ui;
+            ui.begin(&fb);
+            WyScreen s;
+            WyTrendChart ch(0xFFFF, 0x0000, 0x8410, 0, 0);                   /* no gutter */
+            ch.setBounds(0, 0, 100, 101);
+            ch.setRange(0, 100);
+            ch.setSamplesPerColumn(10);
+            s.add(&ch);
+            ui.push(&s);
+            for (int i = 0; i < 200; i++) { ch.push(i == 155 ? 90.0f : 10.0f); ui.frame(); }
+            /* 20 columns; the spike's column is 5 from the newest */
+            CHECK(fb.at(99 - 4, 10) == 0xFFFF && fb.at(99 - 4, 90) == 0xFFFF && fb.at(99, 10) == 0 &&
+                  fb.at(99, 90) == 0xFFFF && matchesFresh(s, fb), "min / max per column keeps spikes", "spike lost");
+
+            ch.setBounds(0, 0, 50, 101);                                     /* narrower: newest kept */
+            ui.frame();
+            CHECK(ch.columns() == 50 && fb.at(49 - 4, 10) == 0xFFFF && matchesFresh(s, fb),
+                  "resize keeps the newest columns", "lost history");
+        }
+
+        /* Benchmark: one new sample on a 320 × 120 chart */
+        {
+            const int S = 2000;
+            float ring[320];
+            WyFbPainter fb(W, H);
+            WyUICore ui;
+            ui.begin(&fb);
+            WyScreen s;
+            WyChart full(0x07E0, 0x0000);
+            full.setBounds(0, 60, W, 120);
+            s.add(&full);
+            ui.push(&s);
+            ui.frame();
+            fb.pixelCount = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < S; i++) {                                    /* old way: shift + redraw */
+                memmove(ring, ring + 1, sizeof(ring) - sizeof(float));
+                ring[319] = wave(i);
+                full.setData(ring, 320, 10, 30);
+                ui.frame();
+            }
+            double usFull = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / S;
+            uint32_t pxFull = fb.pixelCount / S;
+
+            double us[2];
+            uint32_t px[2];
+            for (int m = 0; m < 2; m++) {
+                WyFbPainter *p = m ? (WyFbPainter *)new NoScrollPainter(W, H) : new WyFbPainter(W, H);
+                WyUICore u2;
+                u2.begin(p);
+                WyScreen s2;
+                WyTrendChart ch(0x07E0, 0x0000, 0x8410, 1, 0);
+                ch.setBounds(0, 60, W, 120);
+                ch.setRange(10, 30);
+                s2.add(&ch);
+                u2.push(&s2);
+                u2.frame();
+                p->pixelCount = 0;
+                t0 = std::chrono::steady_clock::now();
+                for (int i = 0; i < S; i++) { ch.push(wave(i)); u2.frame(); }
+                us[m] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / S;
+                px[m] = p->pixelCount / S;
+                delete p;
+            }
+            printf("    per sample, 320x120: full redraw %u px %.1f us | scroll %u px %.1f us | diff %u px %.1f us\n",
+                   pxFull, usFull, px[0], us[0], px[1], us[1]);
+            printf("    SPI @ 40 MHz (16 bit/px): full %.2f ms, diff %.3f ms\n",
+                   pxFull * 16 / 40000.0, px[1] * 16 / 40000.0);
+            CHECK(px[0] * 20 < pxFull && px[1] * 5 < pxFull, "incremental ≥5× fewer pixels than full redraw",
+                  "no gain");
+        }
+    }
+
+    printf("\n========================================\n");
+    printf("  Results: %d passed, %d failed\n", _pass, _fail);
+    printf("========================================\n");
+    return _fail ? 1 : 0;
+}
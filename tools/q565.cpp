@@ -0,0 +1,186 @@
+// q565.cpp — convert PNG/BMP to Q565 and benchmark it against PNG/JPEG
+// Host tool, no Arduino SDK. Uses the same decoders/encoder as the device
+// (WyImageStream.h, WyQ565.h), so what you convert is what WyImage draws.
+//
+// Build: g++ -O2 -std=c++17 -Isrc tools/q565.cpp -o q565
+//
+// Convert:
+//   q565 icon.png icon.q565                  opaque, alpha blended over black
+//   q565 icon.png icon.q565 --alpha          alpha < 50% → transparent (key)
+//   q565 icon.png icon.q565 --alpha --key F81F --bg 202830 --group 16
+//     --key   RGB565 hex used for transparent pixels (default F81F); opaque
+//             pixels that collide with it are nudged by one blue step
+//     --bg    RRGGBB that partially transparent pixels are blended over
+//     --group rows per offset-table entry (default 8; 1 = every row)
+//
+// Benchmark (sizes vs PNG and a same-named .jpg if present, decode time):
+//   q565 --bench test/images/asset_*.png
+//
+// Alpha: WyImageStream's PNG decoder only outputs blended pixels, so the
+// tool decodes twice — over black and over white. Pixels that come out the
+// same are opaque; the black/white spread gives the alpha.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <string>
+#include <chrono>
+
+#include "display/WyImageInfo.h"
+#include "display/WyImageStream.h"
+#include "display/WyQ565.h"
+
+static std::vector<uint8_t> loadFile(const char *path) {
+    std::vector<uint8_t> v;
+    FILE *f = fopen(path, "rb");
+    if (!f) return v;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) v.insert(v.end(), buf, buf + n);
+    fclose(f);
+    return v;
+}
+
+struct Frame { uint16_t w = 0, h = 0; std::vector<uint16_t> px; };
+
+static bool frameRow(void *ctx, int16_t y, const uint16_t *p, uint16_t w) {
+    Frame *f = (Frame *)ctx;
+    if (y >= 0 && y < f->h && w == f->w) memcpy(&f->px[(size_t)y * w], p, w * 2);
+    return true;
+}
+
+static WyImgResult decodeFile(const std::vector<uint8_t> &data, Frame &f, uint16_t bg) {
+    WyImageInfo info;
+    if (!wyImageProbeMem(data.data(), data.size(), info)) return WY_IMG_ERR_FORMAT;
+    f.w = info.width; f.h = info.height;
+    f.px.assign((size_t)f.w * f.h, 0);
+    _WyImgMemSrc src = { data.data(), data.size() };
+    if (info.fmt == WY_IMG_PNG) return wyDecodePNG(_wy_img_mem_read, &src, frameRow, &f, bg);
+    if (info.fmt == WY_IMG_BMP) return wyDecodeBMP(_wy_img_mem_read, &src, frameRow, &f);
+    return WY_IMG_ERR_UNSUPPORTED;
+}
+
+static uint16_t rgb565hex(uint32_t v) {
+    return _wy_rgb565((uint8_t)(v >> 16), (uint8_t)(v >> 8), (uint8_t)v);
+}
+
+/* Opaque pixels + key for alpha < 50%, semi-transparent ones blended over bg */
+static bool loadWithAlpha(const std::vector<uint8_t> &data, Frame &out, bool alpha,
+                          uint16_t key, uint16_t bg, uint32_t &keyed) {
+    keyed = 0;
+    if (decodeFile(data, out, alpha ? 0x0000 : bg) != WY_IMG_OK) return false;
+    if (!alpha) return true;
+    Frame white, blended;
+    if (decodeFile(data, white, 0xFFFF) != WY_IMG_OK) return false;
+    if (decodeFile(data, blended, bg) != WY_IMG_OK) return false;
+    for (size_t i = 0; i < out.px.size(); i++) {
+        uint16_t b = out.px[i], w = white.px[i];
+        int spread = ((w >> 5) & 0x3F) - ((b >> 5) & 0x3F);   /* 0 = opaque, 63 = clear */
+        if (spread > 31) { out.px[i] = key; keyed++; continue; }
+        uint16_t c = spread ? blended.px[i] : b;
+        if (c == key) c ^= 1;                                  /* keep opaque ≠ key */
+        out.px[i] = c;
+    }
+    return true;
+}
+
+static double usPer(std::chrono::steady_clock::time_point t0, int n) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / n;
+}
+
+static bool nullRow(void *, int16_t, const uint16_t *, uint16_t) { return true; }
+
+static int bench(int argc, char **argv) {
+    printf("%-28s %9s %7s %7s %7s %7s %9s %9s %6s\n",
+           "file", "size", "PNG", "JPEG", "Q565", "raw", "PNG us", "Q565 us", "speed");
+    size_t tp = 0, tj = 0, tq = 0, tr = 0;
+    double tpu = 0, tqu = 0;
+    for (int i = 0; i < argc; i++) {
+        auto png = loadFile(argv[i]);
+        Frame f;
+        uint32_t keyed;
+        if (!loadWithAlpha(png, f, true, 0xF81F, 0x0000, keyed)) {
+            fprintf(stderr, "%s: can't decode\n", argv[i]);
+            continue;
+        }
+        std::string jp = argv[i];
+        size_t dot = jp.rfind('.');
+        if (dot != std::string::npos) jp = jp.substr(0, dot) + ".jpg";
+        size_t jsz = loadFile(jp.c_str()).size();
+
+        std::vector<uint8_t> q(wyEncodeQ565Bound(f.w, f.h));
+        size_t qsz = wyEncodeQ565(f.px.data(), f.w, f.h, q.data(), q.size(),
+                                  WY_Q565_ROW_GROUP, keyed > 0, 0xF81F);
+        q.resize(qsz);
+
+        /* Enough iterations for ~50 ms each */
+        int n = 1 + (int)(2000000 / ((size_t)f.w * f.h));
+        auto t0 = std::chrono::steady_clock::now();
+        for (int k = 0; k < n; k++) {
+            _WyImgMemSrc src = { png.data(), png.size() };
+            wyDecodePNG(_wy_img_mem_read, &src, nullRow, nullptr);
+        }
+        double pu = usPer(t0, n);
+        t0 = std::chrono::steady_clock::now();
+        for (int k = 0; k < n; k++) wyDecodeQ565Mem(q.data(), q.size(), nullRow, nullptr);
+        double qu = usPer(t0, n);
+
+        const char *base = strrchr(argv[i], '/');
+        base = base ? base + 1 : argv[i];
+        char dim[16];
+        snprintf(dim, sizeof(dim), "%ux%u", f.w, f.h);
+        printf("%-28s %9s %7zu %7zu %7zu %7zu %9.1f %9.1f %5.1fx\n", base, dim,
+               png.size(), jsz, qsz, (size_t)f.w * f.h * 2, pu, qu, pu / qu);
+        tp += png.size(); tj += jsz; tq += qsz; tr += (size_t)f.w * f.h * 2;
+        tpu += pu; tqu += qu;
+    }
+    printf("%-28s %9s %7zu %7zu %7zu %7zu %9.1f %9.1f %5.1fx\n", "total", "",
+           tp, tj, tq, tr, tpu, tqu, tqu > 0 ? tpu / tqu : 0);
+    printf("(JPEG: size only — its decoder, TJpgDec, is device-side)\n");
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0) return bench(argc - 2, argv + 2);
+    if (argc < 3) {
+        fprintf(stderr, "usage: q565 in.png out.q565 [--alpha] [--key F81F] [--bg RRGGBB] [--group N]\n"
+                        "       q565 --bench a.png [b.png ...]\n");
+        return 2;
+    }
+    bool alpha = false;
+    uint16_t key = 0xF81F, bg = 0x0000;
+    int group = WY_Q565_ROW_GROUP;
+    for (int i = 3; i < argc; i++) {
+        if (!strcmp(argv[i], "--alpha")) alpha = true;
+        else if (!strcmp(argv[i], "--key") && i + 1 < argc)   key = (uint16_t)strtoul(argv[++i], nullptr, 16);
+        else if (!strcmp(argv[i], "--bg") && i + 1 < argc)    bg = rgb565hex((uint32_t)strtoul(argv[++i], nullptr, 16));
+        else if (!strcmp(argv[i], "--group") && i + 1 < argc) group = atoi(argv[++i]);
+        else { fprintf(stderr, "unknown option %s\n", argv[i]); return 2; }
+    }
+    if (group < 1 || group > 255) { fprintf(stderr, "--group must be 1..255\n"); return 2; }
+
+    auto data = loadFile(argv[1]);
+    if (data.empty()) { fprintf(stderr, "%s: can't read\n", argv[1]); return 1; }
+    Frame f;
+    uint32_t keyed;
+    if (!loadWithAlpha(data, f, alpha, key, bg, keyed)) {
+        fprintf(stderr, "%s: not a PNG/BMP this decoder handles\n", argv[1]);
+        return 1;
+    }
+    std::vector<uint8_t> q(wyEncodeQ565Bound(f.w, f.h, (uint8_t)group));
+    size_t n = wyEncodeQ565(f.px.data(), f.w, f.h, q.data(), q.size(), (uint8_t)group, alpha, key);
+    FILE *o = fopen(argv[2], "wb");
+    if (!n || !o || fwrite(q.data(), 1, n, o) != n) {
+        fprintf(stderr, "%s: write failed\n", argv[2]);
+        if (o) fclose(o);
+        return 1;
+    }
+    fclose(o);
+    printf("%s: %ux%u, %zu → %zu bytes (raw %zu)", argv[2], f.w, f.h, data.size(), n,
+           (size_t)f.w * f.h * 2);
+    if (alpha) printf(", %u transparent px (key %04X)", keyed, key);
+    printf("\n");
+    return 0;
+}
@@ -0,0 +1,212 @@
+// wydump.cpp — decode WyScreenshot::dumpSerial() streams to PNG
+// Host tool, no Arduino SDK. Uses WyFrameDump.h, the same code the device
+// encodes with.
+//
+// Build: g++ -O2 -std=c++17 -Isrc tools/wydump.cpp -o wydump
+//
+// Capture:
+//   wydump /dev/ttyUSB0 --baud 2000000              first frame → frame_0000.png
+//   wydump /dev/ttyUSB0 --baud 2000000 -o ci --count 5
+//   wydump capture.bin -o shot                      every frame in a saved log
+//     -o       output prefix; files are <prefix>_<seq>.png
+//     --count  stop after N frames (serial default 1, files: all)
+//   Log text on the port is skipped; frames with CRC errors are dropped
+//   and counted.
+//
+// Benchmark (stream size, encode / decode time vs UART time):
+//   wydump --bench
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <chrono>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <sys/stat.h>
+
+#include "display/WyFrameDump.h"
+#include "display/WyPixel.h"
+
+/* ── PNG writer: RGB8, stored (uncompressed) deflate blocks ────────── */
+static void be32(std::vector<uint8_t> &v, uint32_t x) {
+    v.push_back((uint8_t)(x >> 24)); v.push_back((uint8_t)(x >> 16));
+    v.push_back((uint8_t)(x >> 8));  v.push_back((uint8_t)x);
+}
+static void chunk(std::vector<uint8_t> &png, const char *type, const std::vector<uint8_t> &data) {
+    be32(png, (uint32_t)data.size());
+    size_t at = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+    be32(png, wyCrc32(&png[at], data.size() + 4));
+}
+
+static bool writePNG(const char *path, const uint16_t *px, uint16_t w, uint16_t h) {
+    std::vector<uint8_t> raw;                                  /* filter byte + RGB per row */
+    raw.reserve((size_t)h * (w * 3 + 1));
+    std::vector<uint8_t> line((size_t)w * 3);
+    for (uint16_t y = 0; y < h; y++) {
+        wyRGB565toRGB888(px + (size_t)y * w, line.data(), w);
+        raw.push_back(0);
+        raw.insert(raw.end(), line.begin(), line.end());
+    }
+    std::vector<uint8_t> z = { 0x78, 0x01 };
+    uint32_t a = 1, b = 0;
+    for (uint8_t c : raw) { a = (a + c) % 65521; b = (b + a) % 65521; }
+    for (size_t off = 0; off < raw.size() || off == 0; ) {
+        size_t n = raw.size() - off < 65535 ? raw.size() - off : 65535;
+        z.push_back(off + n == raw.size() ? 1 : 0);
+        z.push_back((uint8_t)n); z.push_back((uint8_t)(n >> 8));
+        z.push_back((uint8_t)~n); z.push_back((uint8_t)(~n >> 8));
+        z.insert(z.end(), raw.begin() + off, raw.begin() + off + n);
+        off += n;
+        if (!n) break;
+    }
+    be32(z, (b << 16) | a);
+
+    std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<uint8_t> ihdr;
+    be32(ihdr, w); be32(ihdr, h);
+    ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 });                /* 8-bit RGB */
+    chunk(png, "IHDR", ihdr);
+    chunk(png, "IDAT", z);
+    chunk(png, "IEND", {});
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+    fclose(f);
+    return ok;
+}
+
+/* ── Serial port ───────────────────────────────────────────────────── */
+static speed_t baudFlag(long baud) {
+    switch (baud) {
+        case 115200:  return B115200;
+        case 230400:  return B230400;
+        case 460800:  return B460800;
+        case 921600:  return B921600;
+#ifdef B1000000
+        case 1000000: return B1000000;
+        case 1500000: return B1500000;
+        case 2000000: return B2000000;
+        case 3000000: return B3000000;
+#endif
+        default:      return 0;
+    }
+}
+
+static int openSerial(const char *path, long baud) {
+    int fd = open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0) return -1;
+    struct termios t;
+    if (tcgetattr(fd, &t) != 0) return fd;                     /* not a tty: plain file / pipe */
+    speed_t sp = baudFlag(baud);
+    if (!sp) { fprintf(stderr, "unsupported baud %ld\n", baud); close(fd); return -1; }
+    cfmakeraw(&t);
+    cfsetispeed(&t, sp); cfsetospeed(&t, sp);
+    t.c_cc[VMIN] = 1; t.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &t);
+    tcflush(fd, TCIFLUSH);
+    return fd;
+}
+
+/* ── Benchmark ─────────────────────────────────────────────────────── */
+struct Src { const std::vector<uint16_t> *px; uint16_t w; };
+static void fillRows(void *s, uint16_t y, uint16_t rows, uint16_t *px) {
+    Src *src = (Src *)s;
+    memcpy(px, src->px->data() + (size_t)y * src->w, (size_t)rows * src->w * 2);
+}
+static bool toVec(void *ctx, const uint8_t *p, size_t n) {
+    std::vector<uint8_t> *v = (std::vector<uint8_t> *)ctx;
+    v->insert(v->end(), p, p + n);
+    return true;
+}
+
+static int bench() {
+    const uint16_t W = 320, H = 240;
+    std::vector<uint16_t> ui((size_t)W * H, 0x10A2), photo((size_t)W * H);
+    for (uint16_t y = 0; y < H; y++)
+        for (uint16_t x = 0; x < W; x++) {
+            uint16_t &p = ui[(size_t)y * W + x];
+            if (y < 28) p = 0x2945;
+            else if (y % 32 > 8 && y % 32 < 30 && x > 8 && x < W - 8)
+                p = (x < 160 && y % 32 > 12 && y % 32 < 24 && (x / 3 + y) % 5 < 2) ? 0xFFFF : 0x3186;
+        }
+    uint32_t seed = 1;
+    for (uint16_t y = 0; y < H; y++)
+        for (uint16_t x = 0; x < W; x++) {
+            seed = seed * 1103515245u + 12345u;
+            int n = (int)((seed >> 16) & 7) - 4;
+            int r = (x * 31 / W + n / 2) & 31, g = (y * 63 / H + n) & 63, b = ((x + y) * 31 / (W + H)) & 31;
+            photo[(size_t)y * W + x] = (uint16_t)(r << 11 | g << 5 | b);
+        }
+
+    printf("%-14s %9s %7s %9s %9s %12s %12s\n", "frame", "bytes", "% raw", "enc ms", "dec ms",
+           "921600 ms", "2000000 ms");
+    struct { const char *name; std::vector<uint16_t> *px; } frames[] = { { "UI", &ui }, { "photo-like", &photo } };
+    for (auto &f : frames) {
+        Src src = { f.px, W };
+        std::vector<uint8_t> s;
+        const int R = 50;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < R; i++) { s.clear(); wyFrameDump(W, H, fillRows, &src, toVec, &s, (uint32_t)i); }
+        double enc = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / R;
+        t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < R; i++) { WyFrameDumpReader rd; rd.feed(s.data(), s.size()); }
+        double dec = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / R;
+        printf("%-14s %9zu %6.1f%% %9.2f %9.2f %12.0f %12.0f\n", f.name, s.size(),
+               100.0 * s.size() / (W * H * 2), enc, dec, s.size() * 10000.0 / 921600, s.size() * 10000.0 / 2000000);
+    }
+    printf("%-14s %9u %6.1f%% %9s %9s %12.0f %12.0f\n", "raw RGB565", W * H * 2, 100.0, "-", "-",
+           W * H * 2 * 10000.0 / 921600, W * H * 2 * 10000.0 / 2000000);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0) return bench();
+    if (argc < 2) {
+        fprintf(stderr, "usage: wydump <tty|file> [--baud 2000000] [-o prefix] [--count N]\n"
+                        "       wydump --bench\n");
+        return 2;
+    }
+    long baud = 2000000;
+    const char *prefix = "frame";
+    long count = -1;
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "--baud") && i + 1 < argc) baud = atol(argv[++i]);
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) prefix = argv[++i];
+        else if (!strcmp(argv[i], "--count") && i + 1 < argc) count = atol(argv[++i]);
+        else { fprintf(stderr, "unknown option %s\n", argv[i]); return 2; }
+    }
+    int fd = openSerial(argv[1], baud);
+    if (fd < 0) { fprintf(stderr, "%s: can't open\n", argv[1]); return 1; }
+    struct stat st;
+    bool isFile = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+    if (count < 0) count = isFile ? 0 : 1;                     /* 0 = until EOF */
+
+    WyFrameDumpReader rd;
+    uint8_t buf[8192];
+    long saved = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    ssize_t n;
+    while ((count == 0 || saved < count) && (n = read(fd, buf, sizeof(buf))) > 0) {
+        for (bool got = rd.feed(buf, (size_t)n); got && (count == 0 || saved < count); got = rd.feed(nullptr, 0)) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s_%04u.png", prefix, rd.seq());
+            if (!writePNG(path, rd.pixels(), rd.width(), rd.height())) {
+                fprintf(stderr, "%s: write failed\n", path);
+                close(fd);
+                return 1;
+            }
+            double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            printf("%s: %ux%u  (%.2f s)\n", path, rd.width(), rd.height(), s);
+            saved++;
+        }
+    }
+    close(fd);
+    if (rd.crcErrors || rd.incomplete)
+        fprintf(stderr, "dropped %u frame(s), %u CRC error(s)\n", rd.incomplete, rd.crcErrors);
+    return saved ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+// wytiles.cpp — build .wyt tile pyramids and benchmark WyTileMap
+// Host tool, no Arduino SDK. Uses the device decoders and WyTiles.h, so the
+// file it writes is exactly what WyTileView reads.
+//
+// Build: g++ -O2 -std=c++17 -Isrc tools/wytiles.cpp -o wytiles
+//
+// Convert:
+//   wytiles plan.png plan.wyt                  128 px tiles, levels down to one tile
+//   wytiles plan.png plan.wyt --tile 64 --bg FFFFFF
+//     --tile  tile edge in pixels (16..255)
+//     --bg    RRGGBB; tiles entirely this colour aren't stored (WyTileView
+//             fills them with its bg), transparent PNG pixels blend over it
+//
+// Benchmark (tiles/s through the LRU, 800×480 viewport):
+//   wytiles --bench plan.wyt       pan + zoom tour over a file, read with fread
+//   wytiles --bench                same over a generated 4096×3072 floor plan
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <chrono>
+
+#include "display/WyImageInfo.h"
+#include "display/WyImageStream.h"
+#include "display/WyTiles.h"
+
+static std::vector<uint8_t> loadFile(const char *path) {
+    std::vector<uint8_t> v;
+    FILE *f = fopen(path, "rb");
+    if (!f) return v;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) v.insert(v.end(), buf, buf + n);
+    fclose(f);
+    return v;
+}
+
+struct Frame { uint16_t w = 0, h = 0; std::vector<uint16_t> px; };
+
+static bool frameRow(void *ctx, int16_t y, const uint16_t *p, uint16_t w) {
+    Frame *f = (Frame *)ctx;
+    if (y >= 0 && y < f->h && w == f->w) memcpy(&f->px[(size_t)y * w], p, w * 2);
+    return true;
+}
+
+static WyImgResult decodeFile(const std::vector<uint8_t> &data, Frame &f, uint16_t bg) {
+    WyImageInfo info;
+    if (!wyImageProbeMem(data.data(), data.size(), info)) return WY_IMG_ERR_FORMAT;
+    f.w = info.width; f.h = info.height;
+    f.px.assign((size_t)f.w * f.h, 0);
+    _WyImgMemSrc src = { data.data(), data.size() };
+    if (info.fmt == WY_IMG_PNG) return wyDecodePNG(_wy_img_mem_read, &src, frameRow, &f, bg);
+    if (info.fmt == WY_IMG_BMP) return wyDecodeBMP(_wy_img_mem_read, &src, frameRow, &f);
+    return WY_IMG_ERR_UNSUPPORTED;
+}
+
+/* Floor-plan-ish test image: white, grid, walls, coloured rooms */
+static void synthPlan(Frame &f, uint16_t w, uint16_t h) {
+    f.w = w; f.h = h;
+    f.px.assign((size_t)w * h, 0xFFFF);
+    uint32_t seed = 12345;
+    auto rnd = [&](uint32_t n) { seed = seed * 1103515245u + 12345u; return (seed >> 8) % n; };
+    for (uint16_t y = 0; y < h; y++)
+        for (uint16_t x = 0; x < w; x++)
+            if (x % 64 == 0 || y % 64 == 0) f.px[(size_t)y * w + x] = 0xDEFB;
+    for (int r = 0; r < 120; r++) {
+        uint16_t rx = (uint16_t)rnd(w - 400), ry = (uint16_t)rnd(h - 300);
+        uint16_t rw = (uint16_t)(80 + rnd(300)), rh = (uint16_t)(60 + rnd(220));
+        uint16_t c = _wy_rgb565((uint8_t)(160 + rnd(96)), (uint8_t)(160 + rnd(96)), (uint8_t)(160 + rnd(96)));
+        for (uint16_t y = ry; y < ry + rh; y++)
+            for (uint16_t x = rx; x < rx + rw; x++) {
+                bool wall = y < ry + 4 || y >= ry + rh - 4 || x < rx + 4 || x >= rx + rw - 4;
+                f.px[(size_t)y * w + x] = wall ? 0x2104 : c;
+            }
+    }
+}
+
+struct FileSrc { FILE *f; };
+static size_t fileRead(void *ctx, uint32_t off, uint8_t *buf, size_t len) {
+    FILE *f = ((FileSrc *)ctx)->f;
+    if (fseek(f, off, SEEK_SET) != 0) return 0;
+    return fread(buf, 1, len, f);
+}
+
+/* Blit into a host framebuffer, as draw16bitRGBBitmap would into the panel */
+struct Screen { uint16_t w, h; std::vector<uint16_t> px; uint64_t pixels = 0; };
+static void screenBlit(void *ctx, int16_t x, int16_t y, const uint16_t *p,
+                       uint16_t stride, uint16_t w, uint16_t h) {
+    Screen *s = (Screen *)ctx;
+    for (uint16_t r = 0; r < h; r++) {
+        uint16_t *d = &s->px[(size_t)(y + r) * s->w + x];
+        if (p) memcpy(d, p + (size_t)r * stride, (size_t)w * 2);
+        else   for (uint16_t i = 0; i < w; i++) d[i] = 0;
+    }
+    s->pixels += (uint64_t)w * h;
+}
+
+static int bench(const char *path) {
+    std::vector<uint8_t> mem;
+    FileSrc fsrc = { nullptr };
+    _WyImgMemSrc msrc = { nullptr, 0 };
+    WyTileMap map;
+    WyImgResult rc;
+    if (path) {
+        fsrc.f = fopen(path, "rb");
+        if (!fsrc.f) { fprintf(stderr, "%s: can't read\n", path); return 1; }
+        rc = map.open(fileRead, &fsrc);
+    } else {
+        Frame f;
+        synthPlan(f, 4096, 3072);
+        mem.resize(wyTilesBound(f.w, f.h, 128));
+        mem.resize(wyTilesEncode(f.px.data(), f.w, f.h, 128, mem.data(), mem.size(), 0xFFFF));
+        msrc = { mem.data(), mem.size() };
+        rc = map.open(_wy_img_mem_read, &msrc);
+        path = "(generated 4096x3072)";
+    }
+    if (rc != WY_IMG_OK) { fprintf(stderr, "%s: open failed (%d)\n", path, rc); return 1; }
+
+    Screen scr = { 800, 480, std::vector<uint16_t>(800 * 480) };
+    map.setViewport(scr.w, scr.h);
+    const WyTileLevel &L0 = map.levelInfo(0);
+    printf("%s: %ux%u, %u levels, %u px tiles, LRU %u tiles (%u KB)\n", path, L0.w, L0.h,
+           map.levels(), map.tileSize(), map.cacheSlots(),
+           (unsigned)((size_t)map.cacheSlots() * map.tileSize() * map.tileSize() * 2 / 1024));
+    printf("%-24s %7s %8s %8s %8s %9s %8s\n", "pass", "frames", "blits", "decoded", "hit %",
+           "tiles/s", "fps");
+
+    auto run = [&](const char *name, int frames, auto step) {
+        map.resetStats();
+        uint32_t blits = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; i++) { step(i); blits += map.render(screenBlit, &scr); }
+        double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        uint32_t lookups = map.hits() + map.misses();
+        printf("%-24s %7d %8u %8u %7.1f%% %9.0f %8.1f\n", name, frames, blits, map.misses(),
+               lookups ? 100.0 * map.hits() / lookups : 0.0, blits / s, frames / s);
+    };
+
+    /* Cold start, then every level-0 tile read + decoded with no blit */
+    run("first frame (cold)", 1, [&](int) {});
+    {
+        map.resetStats();
+        uint32_t n = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint16_t ty = 0; ty < L0.rows; ty++)
+            for (uint16_t tx = 0; tx < L0.cols; tx++) { uint16_t w, h; map.tile(0, tx, ty, w, h); n++; }
+        double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        printf("%-24s %7s %8u %8u %8s %9.0f %8s\n", "  read+decode only", "-", n, map.misses(), "-",
+               n / s, "-");
+    }
+    map.setLevel(0);
+    map.centerOn(0, 0);
+    run("pan 4 px/frame (L0)", 600, [&](int i) { map.panBy(4, (i / 100) % 2 ? 2 : -2); });
+    run("pan 32 px/frame (L0)", 200, [&](int i) { map.panBy(i < 100 ? 32 : -32, 16); });
+    run("zoom out/in", 2 * map.levels(), [&](int i) {
+        int l = i < map.levels() ? i : 2 * map.levels() - 1 - i;
+        map.setLevel((uint8_t)l);
+    });
+    if (fsrc.f) fclose(fsrc.f);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0) return bench(argc >= 3 ? argv[2] : nullptr);
+    if (argc < 3) {
+        fprintf(stderr, "usage: wytiles in.png out.wyt [--tile 128] [--bg RRGGBB]\n"
+                        "       wytiles --bench [map.wyt]\n");
+        return 2;
+    }
+    int tile = 128;
+    uint16_t bg = 0x0000;
+    for (int i = 3; i < argc; i++) {
+        if (!strcmp(argv[i], "--tile") && i + 1 < argc) tile = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--bg") && i + 1 < argc) {
+            uint32_t v = (uint32_t)strtoul(argv[++i], nullptr, 16);
+            bg = _wy_rgb565((uint8_t)(v >> 16), (uint8_t)(v >> 8), (uint8_t)v);
+        }
+        else { fprintf(stderr, "unknown option %s\n", argv[i]); return 2; }
+    }
+    if (tile < 16 || tile > 255) { fprintf(stderr, "--tile must be 16..255\n"); return 2; }
+
+    auto data = loadFile(argv[1]);
+    if (data.empty()) { fprintf(stderr, "%s: can't read\n", argv[1]); return 1; }
+    Frame f;
+    if (decodeFile(data, f, bg) != WY_IMG_OK) {
+        fprintf(stderr, "%s: not a PNG/BMP this decoder handles\n", argv[1]);
+        return 1;
+    }
+    std::vector<uint8_t> out(wyTilesBound(f.w, f.h, (uint16_t)tile));
+    size_t n = wyTilesEncode(f.px.data(), f.w, f.h, (uint16_t)tile, out.data(), out.size(), bg);
+    FILE *o = fopen(argv[2], "wb");
+    if (!n || !o || fwrite(out.data(), 1, n, o) != n) {
+        fprintf(stderr, "%s: write failed\n", argv[2]);
+        if (o) fclose(o);
+        return 1;
+    }
+    fclose(o);
+    printf("%s: %ux%u, %u levels of %d px tiles, %zu bytes (raw %zu)\n", argv[2], f.w, f.h,
+           wyTilesLevelCount(f.w, f.h, (uint16_t)tile), tile, n, (size_t)f.w * f.h * 2);
+    return 0;
+}
@@ -0,0 +1,180 @@
+// wytrie.cpp — build a WyPredict vocabulary blob and benchmark lookups
+// Host tool, no Arduino SDK. Uses the same builder/reader as the device
+// (WyPredict.h), so what you build is what the prediction bar reads.
+//
+// Build: g++ -O2 -std=c++17 -Isrc tools/wytrie.cpp -o wytrie
+//
+// Convert:
+//   wytrie tools/wy_words.txt src/ui/WyPredictWords.h       C header
+//   wytrie words.txt words.wyt                               raw blob (SD / LittleFS)
+//   wytrie words.txt words.h --name MY_WORDS --keep-case
+//     one word per line, most likely first; "word<TAB>count" lines are
+//     ranked by count instead (log scale). '#' lines are comments. Words
+//     are lowercased unless --keep-case.
+//
+// Benchmark (blob size, build time, complete() latency over every prefix
+// of every word: mean and p99; with no list, 20000 synthetic words):
+//   wytrie --bench [words.txt]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+
+#include "ui/WyPredict.h"
+
+struct Vocab {
+    std::vector<std::string> words;
+    std::vector<uint8_t>     ranks;       /* empty: list order */
+};
+
+static bool loadWords(const char *path, bool keepCase, Vocab &v) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    std::vector<double> counts;
+    char line[256];
+    bool counted = false;
+    while (fgets(line, sizeof(line), f)) {
+        size_t n = strcspn(line, "\r\n");
+        line[n] = '\0';
+        if (!n || line[0] == '#') continue;
+        char *tab = strchr(line, '\t');
+        double c = 0;
+        if (tab) { *tab = '\0'; c = atof(tab + 1); counted = true; }
+        std::string w(line);
+        if (!keepCase) for (char &ch : w) if (ch >= 'A' && ch <= 'Z') ch = (char)(ch + 32);
+        v.words.push_back(w);
+        counts.push_back(c);
+    }
+    fclose(f);
+    if (counted) {
+        double top = 1;
+        for (double c : counts) if (c > top) top = c;
+        for (double c : counts)
+            v.ranks.push_back((uint8_t)(1 + lround(254.0 * log1p(c > 0 ? c : 0) / log1p(top))));
+    }
+    return true;
+}
+
+/* Deterministic pronounceable pseudo-words with a Zipf-ish order */
+static void synthWords(size_t n, Vocab &v) {
+    static const char *on[] = { "b", "c", "d", "f", "g", "h", "l", "m", "n", "p", "r", "s", "t", "st", "tr", "pl", "gr", "ch" };
+    static const char *nu[] = { "a", "e", "i", "o", "u", "ea", "ou", "ai" };
+    static const char *co[] = { "", "n", "r", "s", "t", "l", "nd", "ng", "st", "rt" };
+    uint32_t s = 12345;
+    auto rnd = [&](uint32_t m) { s = s * 1103515245u + 12345u; return (s >> 16) % m; };
+    for (size_t i = 0; i < n; i++) {
+        std::string w;
+        int syl = 1 + rnd(3) + (rnd(4) == 0);
+        for (int k = 0; k < syl; k++) {
+            w += on[rnd(sizeof(on) / sizeof(on[0]))];
+            w += nu[rnd(sizeof(nu) / sizeof(nu[0]))];
+            w += co[rnd(sizeof(co) / sizeof(co[0]))];
+        }
+        if (w.size() < WY_PREDICT_WORD) v.words.push_back(w);
+    }
+}
+
+static std::vector<uint8_t> build(const Vocab &v) {
+    std::vector<const char *> ptr;
+    for (const std::string &w : v.words) ptr.push_back(w.c_str());
+    const uint8_t *r = v.ranks.empty() ? nullptr : v.ranks.data();
+    size_t n = wyTrieBuild(ptr.data(), r, ptr.size(), nullptr, 0);
+    std::vector<uint8_t> blob(n);
+    if (n) wyTrieBuild(ptr.data(), r, ptr.size(), blob.data(), blob.size());
+    return blob;
+}
+
+static bool writeHeader(const char *path, const char *name, const std::vector<uint8_t> &blob, size_t words, const char *src) {
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "/*\n * %s — WyPredict vocabulary, %zu words, %zu bytes\n", strrchr(path, '/') ? strrchr(path, '/') + 1 : path,
+            words, blob.size());
+    fprintf(f, " * Generated by tools/wytrie.cpp from %s — edit that list and\n * regenerate rather than editing this file.\n */\n\n",
+            src);
+    fprintf(f, "#pragma once\n#include <stdint.h>\n\nstatic const uint8_t %s[%zu] = {\n", name, blob.size());
+    for (size_t i = 0; i < blob.size(); i++)
+        fprintf(f, "%s0x%02x,%s", i % 16 ? "" : "    ", blob[i], (i % 16 == 15 || i + 1 == blob.size()) ? "\n" : " ");
+    fprintf(f, "};\n");
+    fclose(f);
+    return true;
+}
+
+static int bench(const Vocab &v) {
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<uint8_t> blob = build(v);
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    WyTrie trie;
+    if (!trie.begin(blob.data(), blob.size())) { fprintf(stderr, "build failed\n"); return 1; }
+
+    size_t raw = 0;
+    for (const std::string &w : v.words) raw += w.size() + 1;
+    printf("words       %zu\n", v.words.size());
+    printf("blob        %zu B (%.1f B/word, word list %zu B)\n", blob.size(), (double)blob.size() / v.words.size(), raw);
+    printf("build       %.1f ms\n", buildMs);
+
+    /* Every prefix of every word, 3 suggestions each — what a keystroke costs */
+    WyPredictHit hit[3];
+    std::vector<double> lat;
+    size_t found = 0;
+    for (const std::string &w : v.words) {
+        char p[WY_PREDICT_WORD];
+        for (size_t l = 1; l <= w.size(); l++) {
+            memcpy(p, w.c_str(), l);
+            p[l] = '\0';
+            auto a = std::chrono::steady_clock::now();
+            found += trie.complete(p, hit, 3);
+            lat.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - a).count());
+        }
+    }
+    double sum = 0;
+    for (double us : lat) sum += us;
+    std::sort(lat.begin(), lat.end());
+    printf("complete()  %zu lookups, %.2f us avg, %.2f us p99, %.2f hits avg\n", lat.size(), sum / lat.size(),
+           lat[lat.size() * 99 / 100], (double)found / lat.size());
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    const char *name = "WY_PREDICT_WORDS";
+    bool keepCase = false, doBench = false;
+    std::vector<const char *> pos;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--name") && i + 1 < argc) name = argv[++i];
+        else if (!strcmp(argv[i], "--keep-case")) keepCase = true;
+        else if (!strcmp(argv[i], "--bench")) doBench = true;
+        else pos.push_back(argv[i]);
+    }
+
+    Vocab v;
+    if (doBench) {
+        if (pos.empty()) synthWords(20000, v);
+        else if (!loadWords(pos[0], keepCase, v)) { fprintf(stderr, "can't read %s\n", pos[0]); return 1; }
+        return bench(v);
+    }
+    if (pos.size() != 2) {
+        fprintf(stderr, "usage: wytrie words.txt out.h|out.wyt [--name NAME] [--keep-case]\n"
+                        "       wytrie --bench [words.txt]\n");
+        return 2;
+    }
+    if (!loadWords(pos[0], keepCase, v)) { fprintf(stderr, "can't read %s\n", pos[0]); return 1; }
+    std::vector<uint8_t> blob = build(v);
+    if (blob.empty()) { fprintf(stderr, "no words (or blob over 16 MB)\n"); return 1; }
+
+    size_t len = strlen(pos[1]);
+    bool header = len > 2 && !strcmp(pos[1] + len - 2, ".h");
+    if (header) {
+        if (!writeHeader(pos[1], name, blob, v.words.size(), pos[0])) { fprintf(stderr, "can't write %s\n", pos[1]); return 1; }
+    } else {
+        FILE *f = fopen(pos[1], "wb");
+        if (!f || fwrite(blob.data(), 1, blob.size(), f) != blob.size()) { fprintf(stderr, "can't write %s\n", pos[1]); return 1; }
+        fclose(f);
+    }
+    printf("%s: %zu words → %zu B\n", pos[1], v.words.size(), blob.size());
+    return 0;
+}